@@ -0,0 +1,212 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+#include <algorithm>
+
+namespace z {
+
+// Statistik arena. Counter "frame" di-reset oleh FrameArena::reset()
+struct ArenaStats {
+    size_t allocations = 0;         // jumlah allocate() ke arena
+    size_t bytes = 0;               // byte terpakai (termasuk padding alignment)
+    size_t peakBytes = 0;           // puncak byte terpakai dalam frame
+    size_t blockAllocations = 0;    // alokasi memori sistem (new[]) untuk block baru
+    size_t capacity = 0;            // total kapasitas block saat ini
+};
+
+// Bump allocator untuk data sementara satu frame.
+// allocate() hanya menggeser pointer; semuanya dibebaskan sekaligus oleh reset().
+// Kalau satu frame butuh lebih dari satu block, reset() menggabungkannya menjadi
+// satu block besar, jadi setelah beberapa frame arena tidak alokasi lagi.
+// Tidak thread-safe: pakai satu arena per thread (threadLocal()).
+class FrameArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit FrameArena(size_t initialSize = DEFAULT_BLOCK_SIZE) {
+        addBlock(initialSize);
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Arena milik thread pemanggil
+    static FrameArena& threadLocal() {
+        thread_local FrameArena arena;
+        return arena;
+    }
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        if (size == 0) size = 1;
+
+        Block* block = &m_blocks[m_current];
+        size_t offset = alignUp(block->used, alignment);
+
+        while (offset + size > block->size) {
+            if (m_current + 1 < m_blocks.size()) {
+                // Block berikutnya sudah ada dari frame sebelumnya
+                m_current++;
+            } else {
+                addBlock(std::max(block->size * 2, size + alignment));
+                m_current = m_blocks.size() - 1;
+            }
+            block = &m_blocks[m_current];
+            offset = alignUp(block->used, alignment);
+        }
+
+        size_t before = block->used;
+        block->used = offset + size;
+
+        m_frame.allocations++;
+        m_frame.bytes += block->used - before;
+        m_frame.peakBytes = std::max(m_frame.peakBytes, m_frame.bytes);
+        return block->data.get() + offset;
+    }
+
+    template <typename T>
+    T* allocateArray(size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // Posisi arena untuk dikembalikan dengan rewind() (lihat ArenaScope)
+    struct Marker {
+        size_t block;
+        size_t used;
+        size_t bytes;
+    };
+
+    Marker mark() const {
+        return Marker{m_current, m_blocks[m_current].used, m_frame.bytes};
+    }
+
+    // Bebaskan semua alokasi setelah marker (urutan LIFO)
+    void rewind(const Marker& marker) {
+        for (size_t i = marker.block + 1; i <= m_current; i++)
+            m_blocks[i].used = 0;
+        m_current = marker.block;
+        m_blocks[m_current].used = marker.used;
+        m_frame.bytes = marker.bytes;
+    }
+
+    // Awal frame: bebaskan semua alokasi frame sebelumnya
+    void reset() {
+        m_lastFrame = m_frame;
+        m_lastFrame.capacity = capacity();
+        m_frame = ArenaStats();
+
+        // Frame ini meluber ke beberapa block: ganti dengan satu block yang cukup
+        if (m_blocks.size() > 1) {
+            size_t total = capacity();
+            m_blocks.clear();
+            addBlock(total);
+        }
+
+        m_blocks[0].used = 0;
+        m_current = 0;
+    }
+
+    // Statistik frame berjalan
+    ArenaStats frameStats() const {
+        ArenaStats stats = m_frame;
+        stats.capacity = capacity();
+        return stats;
+    }
+
+    // Statistik frame sebelum reset() terakhir
+    const ArenaStats& lastFrameStats() const { return m_lastFrame; }
+
+    // Total alokasi block sejak arena dibuat
+    size_t totalBlockAllocations() const { return m_totalBlockAllocations; }
+
+    size_t capacity() const {
+        size_t total = 0;
+        for (const Block& b : m_blocks)
+            total += b.size;
+        return total;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size = 0;
+        size_t used = 0;
+    };
+
+    std::vector<Block> m_blocks;
+    size_t m_current = 0;
+    ArenaStats m_frame;
+    ArenaStats m_lastFrame;
+    size_t m_totalBlockAllocations = 0;
+
+    static size_t alignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    void addBlock(size_t size) {
+        Block block;
+        block.data.reset(new unsigned char[size]);
+        block.size = size;
+        m_blocks.push_back(std::move(block));
+        m_frame.blockAllocations++;
+        m_totalBlockAllocations++;
+    }
+};
+
+// Kembalikan arena ke posisi awal scope saat keluar scope.
+// Untuk scratch buffer di dalam satu fungsi (dipakai Canvas).
+class ArenaScope {
+public:
+    explicit ArenaScope(FrameArena& arena = FrameArena::threadLocal())
+        : m_arena(arena), m_marker(arena.mark()) {}
+
+    ~ArenaScope() { m_arena.rewind(m_marker); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    FrameArena& arena() { return m_arena; }
+
+private:
+    FrameArena& m_arena;
+    FrameArena::Marker m_marker;
+};
+
+// Allocator STL di atas FrameArena. deallocate() tidak melakukan apa-apa;
+// memori kembali saat reset()/rewind(). Container tidak boleh hidup lebih lama
+// dari frame (atau ArenaScope) tempat ia dibuat.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept : m_arena(&FrameArena::threadLocal()) {}
+    explicit ArenaAllocator(FrameArena& arena) noexcept : m_arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.arena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    FrameArena* arena() const noexcept { return m_arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.arena(); }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_arena != other.arena(); }
+
+private:
+    FrameArena* m_arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace z
@@ -0,0 +1,144 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <climits>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_image.h"
+
+namespace z {
+
+// Skyline bottom-left packer: garis langit (x, y, width) dari kiri ke kanan,
+// setiap rect diletakkan di posisi yang ujung bawahnya paling tinggi (y + h terkecil).
+// Cepat dan cukup rapat untuk glyph / icon yang ukurannya mirip.
+class SkylinePacker {
+public:
+    SkylinePacker() = default;
+    SkylinePacker(int width, int height) { reset(width, height); }
+
+    void reset(int width, int height) {
+        m_width = std::max(width, 0);
+        m_height = std::max(height, 0);
+        m_skyline.assign(1, Node{0, 0, m_width});
+        m_usedArea = 0;
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // Bagian area yang sudah terpakai (0..1)
+    double occupancy() const {
+        return m_width > 0 && m_height > 0 ? static_cast<double>(m_usedArea) / (static_cast<double>(m_width) * m_height) : 0.0;
+    }
+
+    // Cari tempat untuk rect width x height; false kalau tidak muat lagi
+    bool pack(int width, int height, Vec2<int>& position) {
+        if (width <= 0 || height <= 0) return false;
+
+        size_t best = m_skyline.size();
+        int bestBottom = INT_MAX, bestWidth = INT_MAX, bestY = 0;
+        for (size_t i = 0; i < m_skyline.size(); i++) {
+            int y = fit(i, width, height);
+            if (y < 0) continue;
+            int bottom = y + height;
+            if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].width < bestWidth)) {
+                best = i;
+                bestBottom = bottom;
+                bestWidth = m_skyline[i].width;
+                bestY = y;
+            }
+        }
+        if (best == m_skyline.size()) return false;
+
+        position = Vec2<int>(m_skyline[best].x, bestY);
+        m_skyline.insert(m_skyline.begin() + static_cast<ptrdiff_t>(best), Node{position.x, bestY + height, width});
+
+        // Node di kanan yang tertutup rect baru dipotong atau dibuang
+        for (size_t i = best + 1; i < m_skyline.size();) {
+            const Node& prev = m_skyline[i - 1];
+            Node& node = m_skyline[i];
+            int overlap = prev.x + prev.width - node.x;
+            if (overlap <= 0) break;
+            node.x += overlap;
+            node.width -= overlap;
+            if (node.width > 0) break;
+            m_skyline.erase(m_skyline.begin() + static_cast<ptrdiff_t>(i));
+        }
+
+        // Gabungkan node bersebelahan dengan tinggi sama
+        for (size_t i = 0; i + 1 < m_skyline.size();) {
+            if (m_skyline[i].y == m_skyline[i + 1].y) {
+                m_skyline[i].width += m_skyline[i + 1].width;
+                m_skyline.erase(m_skyline.begin() + static_cast<ptrdiff_t>(i) + 1);
+            } else {
+                i++;
+            }
+        }
+
+        m_usedArea += static_cast<size_t>(width) * height;
+        return true;
+    }
+
+private:
+    struct Node {
+        int x, y, width;
+    };
+
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<Node> m_skyline;
+    size_t m_usedArea = 0;
+
+    // y terendah untuk rect yang kirinya di node index, -1 kalau keluar atlas
+    int fit(size_t index, int width, int height) const {
+        if (m_skyline[index].x + width > m_width) return -1;
+        int y = 0;
+        int left = width;
+        for (size_t i = index; left > 0; i++) {
+            y = std::max(y, m_skyline[i].y);
+            if (y + height > m_height) return -1;
+            left -= m_skyline[i].width;
+        }
+        return y;
+    }
+};
+
+// Banyak image kecil dalam satu Image (satu alokasi), dibagi oleh SkylinePacker.
+// Gambar dengan Canvas::drawSubImage / drawSprites memakai region dari add().
+// blendMode/colorKey atlas berlaku untuk semua isinya.
+class TextureAtlas {
+public:
+    explicit TextureAtlas(int width = 1024, int height = 1024, int padding = 1)
+        : m_image(width, height), m_packer(width, height), m_padding(std::max(padding, 0)) {}
+
+    // Salin image ke atlas; return region-nya, rect kosong kalau atlas sudah penuh
+    Rect<int> add(const Image& image) {
+        Vec2<int> position;
+        if (image.empty() || !m_packer.pack(image.width() + m_padding, image.height() + m_padding, position))
+            return Rect<int>();
+        for (int y = 0; y < image.height(); y++)
+            std::copy(image.row(y), image.row(y) + image.width(), m_image.row(position.y + y) + position.x);
+        m_count++;
+        return Rect<int>(position.x, position.y, image.width(), image.height());
+    }
+
+    // Kosongkan atlas (region lama tidak berlaku lagi)
+    void clear() {
+        m_image.fill(makePixel(0, 0, 0, 0));
+        m_packer.reset(m_image.width(), m_image.height());
+        m_count = 0;
+    }
+
+    Image& image() { return m_image; }
+    const Image& image() const { return m_image; }
+    size_t count() const { return m_count; }
+    double occupancy() const { return m_packer.occupancy(); }
+
+private:
+    Image m_image;
+    SkylinePacker m_packer;
+    int m_padding;
+    size_t m_count = 0;
+};
+
+} // namespace z
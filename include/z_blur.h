@@ -0,0 +1,221 @@
+#pragma once
+#include "z_platform.h"
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_simd.h"
+#include "z_arena.h"
+#include "z_jobs.h"
+
+#if Z_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace z {
+
+namespace detail {
+
+// ===== BOX SATU BARIS =====
+// out[x] = rata-rata in[x - r .. x + r] dengan tepi dijepit, per channel (termasuk alpha).
+// Sliding window: O(1) per pixel berapa pun radius-nya. Jumlah integer (eksak),
+// pembagian lewat float round-to-nearest, jadi skalar dan SSE2 identik.
+
+inline void boxRowScalar(const Pixel* in, Pixel* out, int n, int r) {
+    const float inv = 1.0f / static_cast<float>(2 * r + 1);
+    uint32_t sum[4] = {};
+    auto add = [&](Pixel p, int weight) {
+        for (int c = 0; c < 4; c++)
+            sum[c] += ((p >> (c * 8)) & 0xFF) * static_cast<uint32_t>(weight);
+    };
+    add(in[0], r + 1);
+    for (int k = 1; k <= r; k++)
+        add(in[std::min(k, n - 1)], 1);
+    for (int x = 0; x < n; x++) {
+        Pixel p = 0;
+        for (int c = 0; c < 4; c++)
+            p |= static_cast<Pixel>(std::nearbyint(static_cast<float>(sum[c]) * inv)) << (c * 8);
+        out[x] = p;
+        Pixel enter = in[std::min(x + r + 1, n - 1)], leave = in[std::max(x - r, 0)];
+        for (int c = 0; c < 4; c++)
+            sum[c] += ((enter >> (c * 8)) & 0xFF) - ((leave >> (c * 8)) & 0xFF);
+    }
+}
+
+#if Z_HAS_SSE2
+
+// Satu pixel -> 4 lane int32 (b, g, r, a)
+inline __m128i widenPixel(Pixel p) {
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(p)), zero), zero);
+}
+
+// Keempat channel dalam satu register: satu add/sub per pixel untuk semua channel
+inline void boxRowSse(const Pixel* in, Pixel* out, int n, int r) {
+    const __m128 inv = _mm_set1_ps(1.0f / static_cast<float>(2 * r + 1));
+    const uint32_t edge = static_cast<uint32_t>(r + 1);
+    __m128i sum = _mm_setr_epi32(static_cast<int>((in[0] & 0xFF) * edge), static_cast<int>(((in[0] >> 8) & 0xFF) * edge),
+                                 static_cast<int>(((in[0] >> 16) & 0xFF) * edge), static_cast<int>((in[0] >> 24) * edge));
+    for (int k = 1; k <= r; k++)
+        sum = _mm_add_epi32(sum, widenPixel(in[std::min(k, n - 1)]));
+
+    // Tengah baris tanpa jepit tepi
+    const int begin = std::min(r, n), end = std::max(begin, n - r - 1);
+    auto emit = [&](int x) {
+        __m128i v = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sum), inv));
+        v = _mm_packs_epi32(v, v);
+        out[x] = static_cast<Pixel>(_mm_cvtsi128_si32(_mm_packus_epi16(v, v)));
+    };
+    int x = 0;
+    for (; x < begin; x++) {
+        emit(x);
+        sum = _mm_add_epi32(sum, _mm_sub_epi32(widenPixel(in[std::min(x + r + 1, n - 1)]), widenPixel(in[std::max(x - r, 0)])));
+    }
+    for (; x < end; x++) {
+        emit(x);
+        sum = _mm_add_epi32(sum, _mm_sub_epi32(widenPixel(in[x + r + 1]), widenPixel(in[x - r])));
+    }
+    for (; x < n; x++) {
+        emit(x);
+        sum = _mm_add_epi32(sum, _mm_sub_epi32(widenPixel(in[std::min(x + r + 1, n - 1)]), widenPixel(in[std::max(x - r, 0)])));
+    }
+}
+
+#endif // Z_HAS_SSE2
+
+inline void boxRow(const Pixel* in, Pixel* out, int n, int r) {
+#if Z_HAS_SSE2
+    if (simd::level() != simd::Level::Scalar) {
+        boxRowSse(in, out, n, r);
+        return;
+    }
+#endif
+    boxRowScalar(in, out, n, r);
+}
+
+// ===== TRANSPOSE BERBLOK =====
+// dst(y, x) = src(x, y) untuk baris [rowBegin, rowEnd) src; tile 16x16 supaya
+// baca dan tulis sama-sama tetap di cache walaupun stride besar.
+
+inline constexpr int blurTile = 16;
+
+inline void transposeRows(const Pixel* src, size_t srcStride, Pixel* dst, size_t dstStride, int width, int rowBegin, int rowEnd) {
+    for (int ty = rowBegin; ty < rowEnd; ty += blurTile) {
+        const int yEnd = std::min(ty + blurTile, rowEnd);
+        for (int tx = 0; tx < width; tx += blurTile) {
+            const int xEnd = std::min(tx + blurTile, width);
+            for (int y = ty; y < yEnd; y++) {
+                const Pixel* from = src + static_cast<size_t>(y) * srcStride;
+                for (int x = tx; x < xEnd; x++)
+                    dst[static_cast<size_t>(x) * dstStride + y] = from[x];
+            }
+        }
+    }
+}
+
+// fn(begin, end) untuk [0, count), paralel per potongan kalau jobs ada dan kerjanya cukup besar
+template <typename Fn>
+inline void blurRows(Jobs* jobs, int count, size_t pixels, Fn&& fn) {
+    if (jobs && jobs->threadCount() > 1 && pixels >= 128 * 1024) {
+        size_t grain = std::max<size_t>(blurTile, static_cast<size_t>(count) / (jobs->threadCount() * 4));
+        grain = (grain + blurTile - 1) / blurTile * blurTile;       // potongan transpose sejajar tile
+        jobs->parallelFor(0, static_cast<size_t>(count), [&fn](size_t begin, size_t end) {
+            fn(static_cast<int>(begin), static_cast<int>(end));
+        }, grain);
+    } else {
+        fn(0, count);
+    }
+}
+
+// Semua pass box di satu baris, ping-pong antara dua buffer; hasil di out
+inline void boxPasses(const Pixel* in, Pixel* out, Pixel* scratch, int n, const int* radii, int passes) {
+    const Pixel* from = in;
+    for (int p = 0; p < passes; p++) {
+        // Pass terakhir langsung ke out
+        Pixel* to = (passes - p) % 2 == 1 ? out : scratch;
+        boxRow(from, to, n, radii[p]);
+        from = to;
+    }
+}
+
+// Separable: pass horizontal ke buffer, transpose, pass yang sama per kolom, transpose balik.
+// src boleh sama dengan dst (region dibaca seluruhnya sebelum ditulis).
+inline void separableBlur(const Surface& src, const Surface& dst, Rect<int> region, const int* radii, int passes, Jobs* jobs) {
+    region = region.intersect(Rect<int>(0, 0, std::min(src.width, dst.width), std::min(src.height, dst.height)));
+    if (region.empty()) return;
+    const int width = region.w, height = region.h;
+    const size_t pixels = static_cast<size_t>(width) * height;
+
+    ArenaScope scratch;
+    Pixel* rows = scratch.arena().allocateArray<Pixel>(pixels);         // width x height
+    Pixel* columns = scratch.arena().allocateArray<Pixel>(pixels);      // height x width
+
+    blurRows(jobs, height, pixels, [&](int begin, int end) {
+        ArenaScope local;
+        Pixel* temp = local.arena().allocateArray<Pixel>(static_cast<size_t>(width));
+        for (int y = begin; y < end; y++)
+            boxPasses(src.row(region.y + y) + region.x, rows + static_cast<size_t>(y) * width, temp, width, radii, passes);
+    });
+    blurRows(jobs, height, pixels, [&](int begin, int end) {
+        transposeRows(rows, static_cast<size_t>(width), columns, static_cast<size_t>(height), width, begin, end);
+    });
+    blurRows(jobs, width, pixels, [&](int begin, int end) {
+        ArenaScope local;
+        Pixel* temp = local.arena().allocateArray<Pixel>(static_cast<size_t>(height));
+        for (int x = begin; x < end; x++) {
+            Pixel* column = columns + static_cast<size_t>(x) * height;
+            boxPasses(column, rows + static_cast<size_t>(x) * height, temp, height, radii, passes);
+        }
+    });
+    // rows sekarang width baris x height kolom; transpose balik langsung ke dst
+    blurRows(jobs, width, pixels, [&](int begin, int end) {
+        transposeRows(rows, static_cast<size_t>(height), dst.row(region.y) + region.x, static_cast<size_t>(dst.stride), height, begin, end);
+    });
+}
+
+} // namespace detail
+
+// Tiga radius box yang variansnya mendekati Gaussian sigma (Kovesi / Wells)
+inline void gaussianBoxRadii(float sigma, int radii[3]) {
+    const double variance = 12.0 * static_cast<double>(sigma) * sigma;
+    int lower = static_cast<int>(std::floor(std::sqrt(variance / 3.0 + 1.0)));
+    if (lower % 2 == 0) lower--;
+    lower = std::max(lower, 1);
+    const int upper = lower + 2;
+    const int smaller = static_cast<int>(std::lround((variance - 3.0 * lower * lower - 12.0 * lower - 9.0) / (-4.0 * lower - 4.0)));
+    for (int i = 0; i < 3; i++)
+        radii[i] = ((i < smaller ? lower : upper) - 1) / 2;
+}
+
+// ===== BLUR SURFACE =====
+// Region dipotong ke surface; pixel di luar region tidak dibaca maupun ditulis (tepi region dijepit).
+// Semua channel di-blur apa adanya (alpha tidak premultiplied). jobs opsional: pass dan
+// transpose dibagi per potongan baris.
+
+// Box blur radius r (lebar 2r + 1), in-place
+inline void boxBlur(const Surface& surface, Rect<int> region, int radius, Jobs* jobs = nullptr) {
+    if (radius <= 0) return;
+    detail::separableBlur(surface, surface, region, &radius, 1, jobs);
+}
+
+// Out-of-place: region src ditulis ke region yang sama di dst, src tidak berubah
+inline void boxBlur(const Surface& src, const Surface& dst, Rect<int> region, int radius, Jobs* jobs = nullptr) {
+    int radii[1] = { std::max(radius, 0) };
+    detail::separableBlur(src, dst, region, radii, 1, jobs);
+}
+
+// Aproksimasi Gaussian dengan tiga pass box per arah, out-of-place
+inline void gaussianBlur(const Surface& src, const Surface& dst, Rect<int> region, float sigma, Jobs* jobs = nullptr) {
+    int radii[3] = {};
+    if (sigma > 0.0f) gaussianBoxRadii(sigma, radii);
+    detail::separableBlur(src, dst, region, radii, 3, jobs);
+}
+
+inline void gaussianBlur(const Surface& surface, Rect<int> region, float sigma, Jobs* jobs = nullptr) {
+    if (sigma <= 0.0f) return;
+    gaussianBlur(surface, surface, region, sigma, jobs);
+}
+
+} // namespace z
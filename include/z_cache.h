@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+namespace z {
+
+namespace detail {
+
+// ===== CONTENT ID =====
+// Id baru setiap kali isi objek berubah (Path, Gradient): kunci cache turunan tanpa
+// membandingkan isi. Unik di seluruh proses, aman dari thread mana pun, tidak pernah 0.
+inline uint64_t nextContentId() {
+    static std::atomic<uint64_t> counter{1};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+// ===== GENERATION CACHE =====
+// Cache dua generasi (LRU kasar tanpa list): saat current penuh, current menjadi previous dan
+// previous lama dibuang; entry di previous yang dipakai lagi dipindah ke current. Lookup yang
+// kena tidak mengalokasi. Dipakai TextCache (label) dan FlattenCache (path ter-flatten).
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class GenerationCache {
+public:
+    explicit GenerationCache(size_t capacity) : m_capacity(capacity) {}
+
+    // nullptr kalau tidak ada. same(value) menolak entry dengan key sama tapi isi lain
+    // (tabrakan hash di TextCache). Pointer berlaku sampai insert() / clear() berikutnya.
+    template <typename Same>
+    Value* find(const Key& key, Same same) {
+        auto it = m_current.find(key);
+        if (it != m_current.end() && same(it->second))
+            return &it->second;
+        auto old = m_previous.find(key);
+        if (old == m_previous.end() || !same(old->second))
+            return nullptr;
+        Value value = std::move(old->second);
+        m_previous.erase(old);
+        return &insert(key, std::move(value));
+    }
+
+    Value* find(const Key& key) {
+        return find(key, [](const Value&) { return true; });
+    }
+
+    // Key yang sudah ada di current ditimpa
+    Value& insert(const Key& key, Value&& value) {
+        if (m_current.size() >= m_capacity && m_current.find(key) == m_current.end()) {
+            m_previous.swap(m_current);
+            m_current.clear();
+        }
+        Value& slot = m_current[key];
+        slot = std::move(value);
+        return slot;
+    }
+
+    void clear() {
+        m_current.clear();
+        m_previous.clear();
+    }
+
+    void setCapacity(size_t capacity) {
+        m_capacity = capacity;
+        clear();
+    }
+
+    size_t capacity() const { return m_capacity; }
+    size_t size() const { return m_current.size() + m_previous.size(); }
+
+private:
+    size_t m_capacity;
+    std::unordered_map<Key, Value, Hash> m_current;
+    std::unordered_map<Key, Value, Hash> m_previous;
+};
+
+} // namespace z
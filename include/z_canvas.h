@@ -1,23 +1,59 @@
 #pragma once
-#include <windows.h>
+#include "z_platform.h"
 #include <memory>
+#include <vector>
 #include "z_unit.h"
+#include "z_surface.h"
+#include "z_color.h"
+#include "z_raster.h"
+#include "z_drawlist.h"
+#include "z_arena.h"
+#include "z_simd.h"
+#include "z_surface_pool.h"
+#include "z_image.h"
+#include "z_font.h"
+#include "z_scale.h"
+#include "z_blur.h"
+#include "z_gradient.h"
+#include "z_path.h"
+#include "z_stroke.h"
+#include "z_series.h"
+#include "z_heatmap.h"
+#include "z_points.h"
+#include "z_floodfill.h"
+#include "z_window.h"
 
 namespace z {
 
+// Statistik primitive Canvas. Counter frame di-reset oleh present()
+struct CanvasStats {
+    size_t primitives = 0;      // primitive yang digambar (termasuk yang ditolak)
+    size_t rejected = 0;        // ditolak karena seluruhnya di luar clip, tidak sampai ke backend
+};
+
 class Canvas {
 public:
-    // Constructor
-    Canvas(HWND hwnd) : m_hwnd(hwnd), m_hdc(nullptr), m_memDC(nullptr), m_memBitmap(nullptr), m_oldBitmap(nullptr) {
+    // Constructor - handle dari Window::handle()
+#if Z_PLATFORM_WIN32
+    Canvas(NativeHandle hwnd) : m_hwnd(hwnd), m_hdc(nullptr), m_memDC(nullptr), m_memBitmap(nullptr), m_oldBitmap(nullptr) {
         m_hdc = GetDC(hwnd);
         setupDoubleBuffering();
+        resize();
+    }
+#else
+    Canvas(NativeHandle window) : m_hwnd(window) {
+        setupDoubleBuffering();
+        resize();
     }
+#endif
 
     // Destructor
     ~Canvas() {
         cleanup();
+#if Z_PLATFORM_WIN32
         if (m_hdc)
             ReleaseDC(m_hwnd, m_hdc);
+#endif
     }
 
     // Disable copy constructor dan assignment operator
@@ -28,11 +64,7 @@ public:
     
     // Clear canvas dengan warna tertentu
     void clear(COLORREF color = RGB(0, 0, 0)) {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        HBRUSH bg = CreateSolidBrush(color);
-        FillRect(m_memDC, &rect, bg);
-        DeleteObject(bg);
+        clearInternal(color);
     }
 
     // Clear dengan Color struct
@@ -40,48 +72,116 @@ public:
         clear(RGB(color.r, color.g, color.b));
     }
 
-    // Present buffer ke layar
+    void clear(PackedColor color) {
+        clearInternal(color.colorRef());
+    }
+
+    // Present buffer ke layar (headless: ke front buffer window di memori), lalu mulai frame statistik baru
     void present() {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        BitBlt(m_hdc, 0, 0, rect.right, rect.bottom, m_memDC, 0, 0, SRCCOPY);
+        m_lastFrameStats = m_frameStats;
+        m_frameStats = CanvasStats();
+#if Z_PLATFORM_WIN32
+        BitBlt(m_hdc, 0, 0, m_width, m_height, m_memDC, 0, 0, SRCCOPY);
+#else
+        m_hwnd->present(surface());
+#endif
+        // Ukuran yang tertunda / shrink yang sudah lewat delay; isi frame ikut disalin
+        if (m_pool.update(secondsNow())) {
+            reallocateStorage(m_pool.capacity());
+            applySize();
+        }
     }
 
-    // Resize canvas (dipanggil saat window resize)
+    // Eksekusi perintah yang direkam di DrawList (lihat z_drawlist.h)
+    void draw(const DrawList& list) {
+        const POINT* points = list.points().data();
+        for (const DrawList::Command& cmd : list.commands()) {
+            switch (cmd.op) {
+                case DrawList::Op::Clear:
+                    clearInternal(cmd.fill);
+                    break;
+                case DrawList::Op::Pixel:
+                    drawPixelInternal(cmd.a, cmd.b, cmd.fill);
+                    break;
+                case DrawList::Op::Line:
+                    drawLineInternal(cmd.a, cmd.b, cmd.c, cmd.d, cmd.stroke, cmd.width);
+                    break;
+                case DrawList::Op::Rect:
+                    drawRectInternal(cmd.a, cmd.b, cmd.c, cmd.d, cmd.fill, cmd.stroke, cmd.hasFill, cmd.hasStroke, cmd.width);
+                    break;
+                case DrawList::Op::Ellipse:
+                    drawEllipseInternal(cmd.a, cmd.b, cmd.c, cmd.d, cmd.fill, cmd.stroke, cmd.hasFill, cmd.hasStroke, cmd.width);
+                    break;
+                case DrawList::Op::Polygon:
+                    drawPolygonInternal(points + cmd.a, cmd.b, cmd.fill, cmd.stroke, cmd.hasFill, cmd.hasStroke, cmd.width);
+                    break;
+            }
+        }
+    }
+
+    // Resize canvas (dipanggil saat window resize). Storage hanya dialokasi ulang kalau
+    // ukuran baru tidak muat (lihat z_surface_pool.h); isi frame lama tetap ada.
     void resize() {
-        cleanup();
-        setupDoubleBuffering();
+        if (m_pool.resize(getSize(), secondsNow()))
+            reallocateStorage(m_pool.capacity());
+        applySize();
     }
 
+    // Panggil pada EventType::ResizeBegin / ResizeEnd: selama drag border, ukuran yang
+    // tidak muat tidak dialokasi ulang (frame dipotong ke kapasitas sampai drag selesai)
+    void beginInteractiveResize() {
+        m_pool.beginInteractive();
+    }
+
+    void endInteractiveResize() {
+        if (m_pool.endInteractive(secondsNow()))
+            reallocateStorage(m_pool.capacity());
+        applySize();
+    }
+
+    void setSurfacePoolConfig(const SurfacePoolConfig& config) { m_pool.setConfig(config); }
+    const SurfacePoolStats& surfaceStats() const { return m_pool.stats(); }
+
+    // Opsional: blit besar (drawImageScaled) dibagi per baris ke jobs; null = satu thread.
+    // jobs harus tetap hidup selama dipakai canvas.
+    void setJobs(Jobs* jobs) { m_jobs = jobs; }
+
+#if Z_PLATFORM_WIN32
     // Get HDC untuk operasi advanced
     HDC getHDC() const { return m_memDC; }
-    HWND getHWND() const { return m_hwnd; }
+#endif
+    NativeHandle getHWND() const { return m_hwnd; }
+
+    // Akses langsung ke back buffer (32-bit, lihat z_surface.h)
+    Surface surface() {
+#if Z_PLATFORM_WIN32
+        GdiFlush();     // pastikan operasi GDI sudah selesai menulis ke DIB
+#endif
+        return Surface(pixelData(), m_width, m_height, m_stride);
+    }
 
     // ===== BASIC DRAWING =====
 
     // Draw pixel
     void drawPixel(int x, int y, COLORREF color = RGB(255, 255, 255)) {
-        SetPixel(m_memDC, x, y, color);
+        drawPixelInternal(x, y, color);
     }
 
     void drawPixel(Vec2<int> pos, COLORREF color = RGB(255, 255, 255)) {
-        SetPixel(m_memDC, pos.x, pos.y, color);
+        drawPixelInternal(pos.x, pos.y, color);
     }
 
     void drawPixel(Vec2<int> pos, Color<unsigned char> color) {
-        SetPixel(m_memDC, pos.x, pos.y, RGB(color.r, color.g, color.b));
+        drawPixelInternal(pos.x, pos.y, RGB(color.r, color.g, color.b));
+    }
+
+    void drawPixel(Vec2<int> pos, PackedColor color) {
+        drawPixelInternal(pos.x, pos.y, color.colorRef());
     }
 
     // Draw line
     void drawLine(int x1, int y1, int x2, int y2, COLORREF color = RGB(255, 255, 255), int width = 1) {
-        HPEN pen = CreatePen(PS_SOLID, width, color);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, pen);
-        
-        MoveToEx(m_memDC, x1, y1, nullptr);
-        LineTo(m_memDC, x2, y2);
-        
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(pen);
+        drawLineInternal(x1, y1, x2, y2, color, width);
     }
 
     void drawLine(Vec2<int> start, Vec2<int> end, COLORREF color = RGB(255, 255, 255), int width = 1) {
@@ -92,6 +192,10 @@ public:
         drawLine(start.x, start.y, end.x, end.y, RGB(color.r, color.g, color.b), width);
     }
 
+    void drawLine(Vec2<int> start, Vec2<int> end, PackedColor color, int width = 1) {
+        drawLine(start.x, start.y, end.x, end.y, color.colorRef(), width);
+    }
+
     // ===== RECTANGLE DRAWING =====
 
     // Basic rectangle - outline only
@@ -124,6 +228,10 @@ public:
         drawRect(rect.x, rect.y, rect.w, rect.h, RGB(strokeColor.r, strokeColor.g, strokeColor.b), strokeWidth);
     }
 
+    void drawRect(Rect<int> rect, PackedColor strokeColor, int strokeWidth = 1) {
+        drawRect(rect.x, rect.y, rect.w, rect.h, strokeColor.colorRef(), strokeWidth);
+    }
+
     // ===== FILLED RECTANGLE =====
 
     // Filled rectangle
@@ -143,6 +251,10 @@ public:
         fillRect(rect.x, rect.y, rect.w, rect.h, RGB(fillColor.r, fillColor.g, fillColor.b));
     }
 
+    void fillRect(Rect<int> rect, PackedColor fillColor) {
+        fillRect(rect.x, rect.y, rect.w, rect.h, fillColor.colorRef());
+    }
+
     // Filled rectangle with stroke
     void fillRect(int x, int y, int width, int height, COLORREF fillColor, COLORREF strokeColor, int strokeWidth = 1) {
         drawRectInternal(x, y, width, height, fillColor, strokeColor, true, true, strokeWidth);
@@ -164,15 +276,7 @@ public:
 
     // Circle outline only
     void drawCircle(int centerX, int centerY, int radius, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
-        HPEN pen = CreatePen(PS_SOLID, strokeWidth, strokeColor);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, pen);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, GetStockObject(NULL_BRUSH));
-        
-        Ellipse(m_memDC, centerX - radius, centerY - radius, centerX + radius, centerY + radius);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(pen);
+        drawEllipseInternal(centerX - radius, centerY - radius, centerX + radius, centerY + radius, RGB(0, 0, 0), strokeColor, false, true, strokeWidth);
     }
 
     void drawCircle(Vec2<int> center, int radius, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
@@ -183,19 +287,15 @@ public:
         drawCircle(center.x, center.y, radius, RGB(strokeColor.r, strokeColor.g, strokeColor.b), strokeWidth);
     }
 
+    void drawCircle(Vec2<int> center, int radius, PackedColor strokeColor, int strokeWidth = 1) {
+        drawCircle(center.x, center.y, radius, strokeColor.colorRef(), strokeWidth);
+    }
+
     // ===== FILLED CIRCLE =====
 
     // Filled circle
     void fillCircle(int centerX, int centerY, int radius, COLORREF fillColor = RGB(255, 255, 255)) {
-        HBRUSH brush = CreateSolidBrush(fillColor);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, brush);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, GetStockObject(NULL_PEN));
-        
-        Ellipse(m_memDC, centerX - radius, centerY - radius, centerX + radius, centerY + radius);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(brush);
+        drawEllipseInternal(centerX - radius, centerY - radius, centerX + radius, centerY + radius, fillColor, RGB(0, 0, 0), true, false, 1);
     }
 
     void fillCircle(Vec2<int> center, int radius, COLORREF fillColor = RGB(255, 255, 255)) {
@@ -206,19 +306,13 @@ public:
         fillCircle(center.x, center.y, radius, RGB(fillColor.r, fillColor.g, fillColor.b));
     }
 
+    void fillCircle(Vec2<int> center, int radius, PackedColor fillColor) {
+        fillCircle(center.x, center.y, radius, fillColor.colorRef());
+    }
+
     // Filled circle with stroke
     void fillCircle(int centerX, int centerY, int radius, COLORREF fillColor, COLORREF strokeColor, int strokeWidth = 1) {
-        HBRUSH brush = CreateSolidBrush(fillColor);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, brush);
-        HPEN pen = CreatePen(PS_SOLID, strokeWidth, strokeColor);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, pen);
-        
-        Ellipse(m_memDC, centerX - radius, centerY - radius, centerX + radius, centerX + radius);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(brush);
-        DeleteObject(pen);
+        drawEllipseInternal(centerX - radius, centerY - radius, centerX + radius, centerY + radius, fillColor, strokeColor, true, true, strokeWidth);
     }
 
     void fillCircle(Vec2<int> center, int radius, COLORREF fillColor, COLORREF strokeColor, int strokeWidth = 1) {
@@ -233,15 +327,7 @@ public:
 
     // Ellipse outline only
     void drawEllipse(int centerX, int centerY, int radiusX, int radiusY, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
-        HPEN pen = CreatePen(PS_SOLID, strokeWidth, strokeColor);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, pen);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, GetStockObject(NULL_BRUSH));
-        
-        Ellipse(m_memDC, centerX - radiusX, centerY - radiusY, centerX + radiusX, centerY + radiusY);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(pen);
+        drawEllipseInternal(centerX - radiusX, centerY - radiusY, centerX + radiusX, centerY + radiusY, RGB(0, 0, 0), strokeColor, false, true, strokeWidth);
     }
 
     void drawEllipse(Vec2<int> center, Vec2<int> radius, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
@@ -254,15 +340,7 @@ public:
 
     // Filled ellipse
     void fillEllipse(int centerX, int centerY, int radiusX, int radiusY, COLORREF fillColor = RGB(255, 255, 255)) {
-        HBRUSH brush = CreateSolidBrush(fillColor);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, brush);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, GetStockObject(NULL_PEN));
-        
-        Ellipse(m_memDC, centerX - radiusX, centerY - radiusY, centerX + radiusX, centerY + radiusY);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(brush);
+        drawEllipseInternal(centerX - radiusX, centerY - radiusY, centerX + radiusX, centerY + radiusY, fillColor, RGB(0, 0, 0), true, false, 1);
     }
 
     void fillEllipse(Vec2<int> center, Vec2<int> radius, COLORREF fillColor = RGB(255, 255, 255)) {
@@ -277,50 +355,414 @@ public:
 
     // Draw polygon (outline only)
     void drawPolygon(const POINT* points, int count, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
-        HPEN pen = CreatePen(PS_SOLID, strokeWidth, strokeColor);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, pen);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, GetStockObject(NULL_BRUSH));
-        
-        Polygon(m_memDC, points, count);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(pen);
+        drawPolygonInternal(points, count, RGB(0, 0, 0), strokeColor, false, true, strokeWidth);
     }
 
     void drawPolygon(const Vec2<int>* points, int count, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
-        POINT* winPoints = new POINT[count];
-        for (int i = 0; i < count; i++) {
-            winPoints[i].x = points[i].x;
-            winPoints[i].y = points[i].y;
-        }
-        drawPolygon(winPoints, count, strokeColor, strokeWidth);
-        delete[] winPoints;
+        drawPolygonInternal(points, count, RGB(0, 0, 0), strokeColor, false, true, strokeWidth);
     }
 
     // Fill polygon
     void fillPolygon(const POINT* points, int count, COLORREF fillColor = RGB(255, 255, 255)) {
-        HBRUSH brush = CreateSolidBrush(fillColor);
-        HBRUSH oldBrush = (HBRUSH)SelectObject(m_memDC, brush);
-        HPEN oldPen = (HPEN)SelectObject(m_memDC, GetStockObject(NULL_PEN));
-        
-        Polygon(m_memDC, points, count);
-        
-        SelectObject(m_memDC, oldBrush);
-        SelectObject(m_memDC, oldPen);
-        DeleteObject(brush);
+        drawPolygonInternal(points, count, fillColor, RGB(0, 0, 0), true, false, 1);
     }
 
     void fillPolygon(const Vec2<int>* points, int count, COLORREF fillColor = RGB(255, 255, 255)) {
-        POINT* winPoints = new POINT[count];
+        drawPolygonInternal(points, count, fillColor, RGB(0, 0, 0), true, false, 1);
+    }
+
+    void drawPolygon(const Vec2<float>* points, int count, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
+        drawPolygonInternal(points, count, RGB(0, 0, 0), strokeColor, false, true, strokeWidth);
+    }
+
+    void fillPolygon(const Vec2<float>* points, int count, COLORREF fillColor = RGB(255, 255, 255)) {
+        drawPolygonInternal(points, count, fillColor, RGB(0, 0, 0), true, false, 1);
+    }
+
+    // ===== POLYLINE =====
+    // Seluruh polyline di-stroke sekaligus: satu outline (join + cap) lalu satu fill NonZero,
+    // jadi tidak ada pen per segmen dan sambungan tidak digambar dua kali.
+    // Lebar <= 1 pixel di layar memakai Bresenham seperti drawLine.
+
+    void drawPolyline(const Vec2<float>* points, int count, COLORREF color = RGB(255, 255, 255), float width = 1.0f,
+                      LineJoin join = LineJoin::Miter, LineCap cap = LineCap::Butt) {
+        StrokeStyle style;
+        style.width = width;
+        style.join = join;
+        style.cap = cap;
+        drawPolylineInternal(points, count, false, toPixel(color), style);
+    }
+
+    void drawPolyline(const Vec2<float>* points, int count, PackedColor color, float width = 1.0f,
+                      LineJoin join = LineJoin::Miter, LineCap cap = LineCap::Butt) {
+        drawPolyline(points, count, color.colorRef(), width, join, cap);
+    }
+
+    void drawPolyline(const Vec2<float>* points, int count, COLORREF color, const StrokeStyle& style) {
+        drawPolylineInternal(points, count, false, toPixel(color), style);
+    }
+
+    // Polyline tertutup: titik terakhir tersambung ke titik pertama dengan join, tanpa cap
+    void drawPolygon(const Vec2<float>* points, int count, COLORREF color, const StrokeStyle& style) {
+        drawPolylineInternal(points, count, true, toPixel(color), style);
+    }
+
+    // ===== GRADIENT FILL =====
+    // Geometri gradient di koordinat user, ikut transform seperti shape-nya.
+    // Selalu lewat rasterizer software (juga di Win32, langsung ke DIB).
+
+    void fillRect(Rect<int> rect, const Gradient& paint) {
+        fillRectPaint(rect.x, rect.y, rect.w, rect.h, paint);
+    }
+
+    void fillCircle(Vec2<int> center, int radius, const Gradient& paint) {
+        fillEllipsePaint(center.x - radius, center.y - radius, center.x + radius, center.y + radius, paint);
+    }
+
+    void fillEllipse(Vec2<int> center, Vec2<int> radius, const Gradient& paint) {
+        fillEllipsePaint(center.x - radius.x, center.y - radius.y, center.x + radius.x, center.y + radius.y, paint);
+    }
+
+    void fillEllipse(Rect<int> bounds, const Gradient& paint) {
+        fillEllipse(Vec2<int>(bounds.x + bounds.w/2, bounds.y + bounds.h/2), Vec2<int>(bounds.w/2, bounds.h/2), paint);
+    }
+
+    void fillPolygon(const Vec2<int>* points, int count, const Gradient& paint) {
+        fillPolygonPaint(points, count, paint);
+    }
+
+    void fillPolygon(const Vec2<float>* points, int count, const Gradient& paint) {
+        fillPolygonPaint(points, count, paint);
+    }
+
+    // ===== PATH =====
+    // Kurva di-flatten dengan error <= 0.25 pixel pada skala transform saat ini; hasilnya
+    // di-cache per (path, bucket skala), jadi path yang sama di frame berikutnya cukup di-transform.
+    // Lewat rasterizer software di kedua backend (satu fill scanline, tanpa pen per segmen).
+
+    void fillPath(const Path& path, COLORREF fillColor = RGB(255, 255, 255), FillRule rule = FillRule::NonZero) {
+        fillPathInternal(path, rule, toPixel(fillColor), nullptr);
+    }
+
+    void fillPath(const Path& path, PackedColor fillColor, FillRule rule = FillRule::NonZero) {
+        fillPath(path, fillColor.colorRef(), rule);
+    }
+
+    void fillPath(const Path& path, const Gradient& paint, FillRule rule = FillRule::NonZero) {
+        fillPathInternal(path, rule, 0, &paint);
+    }
+
+    // Contour terbuka tetap terbuka; ketebalan > 1 di-stroke seperti drawPolyline (default join dan cap bulat)
+    void strokePath(const Path& path, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1,
+                    LineJoin join = LineJoin::Round, LineCap cap = LineCap::Round) {
+        strokePathInternal(path, toPixel(strokeColor), strokeWidth, join, cap);
+    }
+
+    void strokePath(const Path& path, PackedColor strokeColor, int strokeWidth = 1,
+                    LineJoin join = LineJoin::Round, LineCap cap = LineCap::Round) {
+        strokePath(path, strokeColor.colorRef(), strokeWidth, join, cap);
+    }
+
+    // 0 = tanpa cache (path yang selalu berubah tiap frame)
+    void setPathCacheCapacity(size_t capacity) {
+        m_pathCache.setCapacity(capacity);
+    }
+
+    const FlattenCacheStats& pathCacheStats() const {
+        return m_pathCache.stats();
+    }
+
+    // ===== SERIES =====
+    // Plot deret nilai (index sampel -> nilai) di area. x = jendela index sampel yang terlihat
+    // (tepi kiri/kanan area), y = nilai di tepi bawah/atas area. MinMax: satu span vertikal
+    // per kolom pixel, tersambung ke kolom sebelumnya; Lttb: polyline 1 pixel lewat satu titik
+    // per kolom. Kalau sampel per kolom < 2, sampel digambar langsung sebagai polyline.
+    // Versi pointer memindai semua sampel yang terlihat setiap panggilan (SIMD); dengan
+    // SeriesPyramid MinMax cukup O(lebar x log n), jadi pan/zoom tidak tergantung jumlah sampel.
+
+    void drawSeries(const float* values, size_t count, SeriesRange x, SeriesRange y, Rect<int> area,
+                    COLORREF color = RGB(255, 255, 255), SeriesMode mode = SeriesMode::MinMax) {
+        drawSeriesInternal(SeriesPyramid::view(values, count), x, y, area, toPixel(color), mode);
+    }
+
+    void drawSeries(const SeriesPyramid& series, SeriesRange x, SeriesRange y, Rect<int> area,
+                    COLORREF color = RGB(255, 255, 255), SeriesMode mode = SeriesMode::MinMax) {
+        drawSeriesInternal(series, x, y, area, toPixel(color), mode);
+    }
+
+    // ===== HEATMAP =====
+    // Scatter plot padat. accumulatePoints menambah count pixel device tiap titik (lewat
+    // transform; heatmap disamakan dulu dengan ukuran canvas), drawHeatmap memetakan count
+    // ke warna palette di dalam clip. Binning dan tone mapping memakai jobs dari setJobs().
+
+    void accumulatePoints(Heatmap& heat, const Vec2<float>* points, size_t count) {
+        if (heat.width() != m_width || heat.height() != m_height)
+            heat.resize(m_width, m_height);
+        heat.add(points, count, m_transform, m_jobs);
+    }
+
+    void drawHeatmap(Heatmap& heat, const Gradient& palette, HeatScale scale = HeatScale::Log, uint32_t maxCount = 0) {
+        toneMapHeat(heat, surface(), m_clip, palette, scale, maxCount, m_jobs);
+    }
+
+    // ===== FLOOD FILL =====
+    // Bucket fill dari seed (koordinat canvas lewat transform) langsung di back buffer, dibatasi clip.
+    // tolerance = selisih R/G/B terbesar terhadap warna seed. Mengembalikan jumlah pixel yang diisi.
+
+    size_t floodFill(Vec2<int> seed, COLORREF color, int tolerance = 0, Connectivity connectivity = Connectivity::Four) {
+        return floodFillInternal(seed, toPixel(color), tolerance, connectivity);
+    }
+
+    size_t floodFill(Vec2<int> seed, Color<unsigned char> color, int tolerance = 0, Connectivity connectivity = Connectivity::Four) {
+        return floodFillInternal(seed, toPixel(color), tolerance, connectivity);
+    }
+
+    size_t floodFill(Vec2<int> seed, PackedColor color, int tolerance = 0, Connectivity connectivity = Connectivity::Four) {
+        return floodFillInternal(seed, toPixel(color), tolerance, connectivity);
+    }
+
+    // ===== BATCH DRAWING =====
+
+    // Daftar segitiga (setiap 3 vertex satu segitiga, sisa yang tidak lengkap diabaikan),
+    // masing-masing diisi penuh; vertex ditransformasi sekaligus dengan SIMD
+    void drawTriangles(const Vec2<float>* vertices, int count, COLORREF fillColor = RGB(255, 255, 255)) {
+        if (count < 3) return;
+        ArenaScope scratch;
+        Vec2<float>* device = scratch.arena().allocateArray<Vec2<float>>(static_cast<size_t>(count));
+        simd::transform(m_transform, vertices, device, static_cast<size_t>(count));
+        // Buang segitiga yang seluruhnya di luar clip (dipadatkan di tempat)
+        int kept = 0;
+        for (int i = 0; i + 2 < count; i += 3) {
+            float minX = std::min({ device[i].x, device[i + 1].x, device[i + 2].x });
+            float minY = std::min({ device[i].y, device[i + 1].y, device[i + 2].y });
+            float maxX = std::max({ device[i].x, device[i + 1].x, device[i + 2].x });
+            float maxY = std::max({ device[i].y, device[i + 1].y, device[i + 2].y });
+            if (!accept(boundsOf(minX, minY, maxX, maxY, 0))) continue;
+            if (kept != i)
+                std::copy(device + i, device + i + 3, device + kept);
+            kept += 3;
+        }
+        if (kept > 0)
+            drawTrianglesDevice(device, kept, fillColor);
+    }
+
+    void drawTriangles(const Vec2<float>* vertices, int count, PackedColor fillColor) {
+        drawTriangles(vertices, count, fillColor.colorRef());
+    }
+
+    // Banyak pixel satu warna (scatter plot, particle)
+    void drawPixels(const Vec2<int>* points, int count, COLORREF color = RGB(255, 255, 255)) {
+        if (count <= 0) return;
+        ArenaScope scratch;
+        Vec2<int>* device = scratch.arena().allocateArray<Vec2<int>>(static_cast<size_t>(count));
+        simd::transform(m_transform, points, device, static_cast<size_t>(count));
+        drawPixelsDevice(device, keepVisible(device, count), color);
+    }
+
+    void drawPixels(const Vec2<float>* points, int count, COLORREF color = RGB(255, 255, 255)) {
+        if (count <= 0) return;
+        ArenaScope scratch;
+        Vec2<int>* device = scratch.arena().allocateArray<Vec2<int>>(static_cast<size_t>(count));
+        simd::transform(m_transform, points, device, static_cast<size_t>(count));
+        drawPixelsDevice(device, keepVisible(device, count), color);
+    }
+
+    void drawPixels(const Vec2<int>* points, int count, PackedColor color) {
+        drawPixels(points, count, color.colorRef());
+    }
+
+    void drawPixels(const Vec2<float>* points, int count, PackedColor color) {
+        drawPixels(points, count, color.colorRef());
+    }
+
+    // Banyak titik SoA dengan warna ARGB sendiri-sendiri, di-blend ke back buffer.
+    // Alpha tiap titik = alpha warna * weights[i] (0..1, null = 1). Posisi lewat transform dan
+    // dibulatkan seperti drawPixels; size (pixel device, tidak ikut skala) adalah sisi kotak per titik.
+    // Cull clip dan transform dalam satu pass, tanpa salinan (lihat detail::blendPoints).
+    void drawPoints(const float* xs, const float* ys, const Pixel* colors, const float* weights, size_t count, int size = 1) {
+        if (count == 0 || size <= 0) return;
+        size_t visible = detail::blendPoints(surface(), m_clip, m_transform, xs, ys, colors, weights, count, size);
+        m_frameStats.primitives += count;
+        m_frameStats.rejected += count - visible;
+    }
+
+    // ===== IMAGE =====
+    // Blit langsung ke back buffer memakai blendMode() / colorKey() milik image.
+    // drawImage tidak menskalakan atau memutar: hanya posisi kiri-atas yang lewat transform.
+    // drawImageScaled memetakan seluruh rect dest (rotasi/shear: bounding box-nya).
+
+    void drawImage(const Image& image, Vec2<int> position) {
+        drawSubImage(image, image.bounds(), position);
+    }
+
+    void drawImage(const Image& image, int x, int y) {
+        drawSubImage(image, image.bounds(), Vec2<int>(x, y));
+    }
+
+    // Bagian source dari image (mis. region dari TextureAtlas)
+    void drawSubImage(const Image& image, Rect<int> source, Vec2<int> position) {
+        Vec2<int> p = mapPoint(position.x, position.y);
+        if (!accept(Rect<int>(p.x, p.y, source.w, source.h))) return;
+        blit(surface(), m_clip, image, source, p);
+    }
+
+    // Banyak sprite dari satu atlas: satu flush GDI, source tetap di cache
+    void drawSprites(const Image& atlas, const Sprite* sprites, int count) {
+        if (count <= 0) return;
+        Surface target = surface();
         for (int i = 0; i < count; i++) {
-            winPoints[i].x = points[i].x;
-            winPoints[i].y = points[i].y;
+            Vec2<int> p = mapPoint(sprites[i].position.x, sprites[i].position.y);
+            if (!accept(Rect<int>(p.x, p.y, sprites[i].source.w, sprites[i].source.h))) continue;
+            blit(target, m_clip, atlas, sprites[i].source, p);
         }
-        fillPolygon(winPoints, count, fillColor);
-        delete[] winPoints;
     }
 
+    // Image (atau bagian source-nya) diregangkan ke rect dest
+    void drawImageScaled(const Image& image, Rect<int> dest, Filter filter = Filter::Bilinear) {
+        drawImageScaled(image, image.bounds(), dest, filter);
+    }
+
+    void drawImageScaled(const Image& image, Rect<int> source, Rect<int> dest, Filter filter = Filter::Bilinear) {
+        Rect<int> device = mapRect(dest.x, dest.y, dest.right(), dest.bottom());
+        if (!accept(device)) return;
+        blitScaled(surface(), m_clip, image, source, device, filter, m_jobs);
+    }
+
+    // ===== TEXT =====
+    // Glyph dari atlas Font (default Font::builtin()) di-blit dengan alpha, tanpa GDI TextOut.
+    // Setiap teks dirender sekali ke TextCache: label statis per frame cukup satu lookup.
+    // position = kiri-atas baris pertama; seperti drawImage hanya posisi yang lewat transform.
+
+    void drawText(Vec2<int> position, std::string_view text, COLORREF color = RGB(255, 255, 255)) {
+        drawTextInternal(position, text, toPixel(color));
+    }
+
+    void drawText(Vec2<int> position, std::string_view text, Color<unsigned char> color) {
+        drawTextInternal(position, text, toPixel(color));
+    }
+
+    void drawText(Vec2<int> position, std::string_view text, PackedColor color) {
+        drawTextInternal(position, text, color.pixel());
+    }
+
+    void drawText(int x, int y, std::string_view text, COLORREF color = RGB(255, 255, 255)) {
+        drawTextInternal(Vec2<int>(x, y), text, toPixel(color));
+    }
+
+    Vec2<int> measureText(std::string_view text) const {
+        return m_font->measure(text);
+    }
+
+    // Font harus tetap hidup selama dipakai canvas; cache label dikosongkan
+    void setFont(const Font& font) { m_font = &font; }
+    const Font& getFont() const { return *m_font; }
+    const TextCacheStats& textCacheStats() const { return m_textCache.stats(); }
+
+    // ===== FILTER =====
+    // Blur isi back buffer di region (koordinat canvas lewat transform, rotasi: bounding box),
+    // dipotong ke clip. Radius / sigma ikut diskalakan transform. Memakai jobs dari setJobs().
+
+    void boxBlur(Rect<int> region, int radius) {
+        int deviceRadius = m_transformKind == TransformKind::Offset ? radius : static_cast<int>(std::lround(radius * transformScale()));
+        z::boxBlur(surface(), mapRect(region.x, region.y, region.right(), region.bottom()).intersect(m_clip), deviceRadius, m_jobs);
+    }
+
+    void gaussianBlur(Rect<int> region, float sigma) {
+        z::gaussianBlur(surface(), mapRect(region.x, region.y, region.right(), region.bottom()).intersect(m_clip), sigma * transformScale(), m_jobs);
+    }
+
+    // ===== TRANSFORM =====
+    // Berlaku untuk semua primitive berikutnya, termasuk draw(DrawList); clear() tidak terpengaruh.
+    // translate/scale/rotate dikalikan di kanan seperti canvas HTML: operasi terakhir
+    // diterapkan paling dulu ke titik. Stroke ikut diskalakan (akar determinan).
+
+    void pushTransform() {
+        m_transformStack.push_back(m_transform);
+    }
+
+    // Simpan transform sekarang lalu gabungkan dengan transform
+    void pushTransform(const Affine& transform) {
+        pushTransform();
+        concat(transform);
+    }
+
+    // Pop tanpa push sebelumnya diabaikan
+    void popTransform() {
+        if (m_transformStack.empty()) return;
+        setTransform(m_transformStack.back());
+        m_transformStack.pop_back();
+    }
+
+    void setTransform(const Affine& transform) {
+        m_transform = transform;
+        updateTransformKind();
+    }
+
+    void resetTransform() {
+        setTransform(Affine());
+    }
+
+    const Affine& getTransform() const { return m_transform; }
+
+    void concat(const Affine& transform) {
+        setTransform(m_transform * transform);
+    }
+
+    void translate(float x, float y) {
+        concat(Affine::translation(x, y));
+    }
+
+    void translate(Vec2<float> offset) {
+        translate(offset.x, offset.y);
+    }
+
+    void scale(float sx, float sy) {
+        concat(Affine::scaling(sx, sy));
+    }
+
+    void scale(float factor) {
+        scale(factor, factor);
+    }
+
+    void rotate(float radians) {
+        concat(Affine::rotation(radians));
+    }
+
+    // Koordinat canvas -> pixel, dan sebaliknya (mis. posisi mouse ke koordinat plot)
+    Vec2<float> toDevice(Vec2<float> point) const {
+        return m_transform * point;
+    }
+
+    Vec2<float> fromDevice(Vec2<float> point) const {
+        return m_transform.inverse() * point;
+    }
+
+    // ===== CLIP =====
+    // Semua gambar (termasuk clear()) hanya mengenai area clip. pushClip() selalu mengiris
+    // clip sekarang, jadi tidak bisa memperluasnya. Rect dalam koordinat canvas (lewat
+    // transform); kalau transform berotasi, dipakai bounding box-nya di device.
+    // Primitive yang bounding box-nya di luar clip langsung ditolak (lihat frameStats()).
+
+    void pushClip(Rect<int> rect) {
+        Rect<int> device = mapRect(rect.x, rect.y, rect.right(), rect.bottom());
+        m_clipStack.push_back(m_clipStack.empty() ? device : m_clipStack.back().intersect(device));
+        updateClip();
+    }
+
+    // Pop tanpa push sebelumnya diabaikan
+    void popClip() {
+        if (m_clipStack.empty()) return;
+        m_clipStack.pop_back();
+        updateClip();
+    }
+
+    // Clip efektif dalam pixel device (sudah diiris dengan ukuran canvas)
+    Rect<int> getClip() const { return m_clip; }
+
+    // Statistik frame berjalan / frame sebelum present() terakhir
+    const CanvasStats& frameStats() const { return m_frameStats; }
+    const CanvasStats& lastFrameStats() const { return m_lastFrameStats; }
+
     // ===== UTILITY FUNCTIONS =====
 
     // Convert Color to COLORREF
@@ -335,37 +777,618 @@ public:
 
     // Get canvas size
     Vec2<int> getSize() const {
+#if Z_PLATFORM_WIN32
         RECT rect;
         GetClientRect(m_hwnd, &rect);
         return Vec2<int>(rect.right - rect.left, rect.bottom - rect.top);
+#else
+        return m_hwnd->clientSize();
+#endif
     }
 
     // Get canvas bounds
     Rect<int> getBounds() const {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        return Rect<int>(0, 0, static_cast<int>(rect.right - rect.left), static_cast<int>(rect.bottom - rect.top));
+        Vec2<int> size = getSize();
+        return Rect<int>(0, 0, size.x, size.y);
     }
 
 private:
+    // Salin Vec2 ke POINT di scratch arena (dibebaskan oleh ArenaScope pemanggil)
+    static POINT* toPoints(FrameArena& arena, const Vec2<int>* points, int count) {
+        POINT* out = arena.allocateArray<POINT>(count > 0 ? static_cast<size_t>(count) : 0);
+        for (int i = 0; i < count; i++) {
+            out[i].x = points[i].x;
+            out[i].y = points[i].y;
+        }
+        return out;
+    }
+
+    // ===== TRANSFORM KE DEVICE =====
+    // Offset: translasi bulat (termasuk identity), cukup tambah integer.
+    // Axis: scale + translasi, rect/ellipse tetap rect/ellipse.
+    // General: ada rotasi/shear, rect dan ellipse menjadi polygon.
+    enum class TransformKind { Offset, Axis, General };
+
+    void updateTransformKind() {
+        const Affine& m = m_transform;
+        if (m.isTranslation() && m.tx == std::floor(m.tx) && m.ty == std::floor(m.ty) && std::fabs(m.tx) < 1e9f && std::fabs(m.ty) < 1e9f) {
+            m_transformKind = TransformKind::Offset;
+            m_offset = Vec2<int>(static_cast<int>(m.tx), static_cast<int>(m.ty));
+        } else {
+            m_transformKind = m.isAxisAligned() ? TransformKind::Axis : TransformKind::General;
+        }
+    }
+
+    // Pembulatan sama dengan simd::transform (Rounding::Nearest)
+    Vec2<int> mapPoint(int x, int y) const {
+        if (m_transformKind == TransformKind::Offset)
+            return Vec2<int>(x + m_offset.x, y + m_offset.y);
+        Vec2<float> p = m_transform * Vec2<int>(x, y);
+        return Vec2<int>(static_cast<int>(std::nearbyint(p.x)), static_cast<int>(std::nearbyint(p.y)));
+    }
+
+    // Skala panjang transform (akar determinan), 1 untuk Offset
+    float transformScale() const {
+        return m_transformKind == TransformKind::Offset ? 1.0f : std::sqrt(std::fabs(m_transform.determinant()));
+    }
+
+    int mapWidth(int width) const {
+        if (m_transformKind == TransformKind::Offset) return width;
+        float scaled = static_cast<float>(width) * transformScale();
+        return std::max(1, static_cast<int>(std::nearbyint(scaled)));
+    }
+
+    // Box device [minX, maxX] x [minY, maxY] (inklusif) diperlebar setengah stroke + 1 pixel
+    static Rect<int> boundsOf(float minX, float minY, float maxX, float maxY, int strokeWidth) {
+        float pad = strokeWidth * 0.5f + 1.0f;
+        float left = std::max(std::floor(minX - pad), -1e9f), top = std::max(std::floor(minY - pad), -1e9f);
+        float right = std::min(std::ceil(maxX + pad), 1e9f), bottom = std::min(std::ceil(maxY + pad), 1e9f);
+        if (!(left < right && top < bottom)) return Rect<int>();      // NaN
+        return Rect<int>(static_cast<int>(left), static_cast<int>(top), static_cast<int>(right - left), static_cast<int>(bottom - top));
+    }
+
+    // Hitung primitive; false kalau box device seluruhnya di luar clip (tidak perlu digambar)
+    bool accept(Rect<int> box) {
+        m_frameStats.primitives++;
+        if (box.overlaps(m_clip)) return true;
+        m_frameStats.rejected++;
+        return false;
+    }
+
+    // Padatkan pixel di dalam clip ke awal array, return jumlahnya
+    int keepVisible(Vec2<int>* points, int count) {
+        int kept = 0;
+        for (int i = 0; i < count; i++)
+            if (m_clip.contains(points[i]))
+                points[kept++] = points[i];
+        m_frameStats.primitives += static_cast<size_t>(count);
+        m_frameStats.rejected += static_cast<size_t>(count - kept);
+        return kept;
+    }
+
+    void drawTextInternal(Vec2<int> position, std::string_view text, Pixel color) {
+        if (text.empty()) return;
+        Vec2<int> p = mapPoint(position.x, position.y);
+        const Image& label = m_textCache.get(*m_font, text);
+        if (!accept(Rect<int>(p.x, p.y, label.width(), label.height()))) return;
+        blitTinted(surface(), m_clip, label, label.bounds(), p, color);
+    }
+
+    size_t floodFillInternal(Vec2<int> seed, Pixel color, int tolerance, Connectivity connectivity) {
+        Vec2<int> p = mapPoint(seed.x, seed.y);
+        m_frameStats.primitives++;
+        if (!m_clip.contains(p)) {
+            m_frameStats.rejected++;
+            return 0;
+        }
+        return m_floodFill.fill(surface(), m_clip, p, color, tolerance, connectivity);
+    }
+
+    void drawPixelInternal(int x, int y, COLORREF color) {
+        Vec2<int> p = mapPoint(x, y);
+        m_frameStats.primitives++;
+        if (!m_clip.contains(p)) {
+            m_frameStats.rejected++;
+            return;
+        }
+        drawPixelDevice(p.x, p.y, color);
+    }
+
+    void drawLineInternal(int x1, int y1, int x2, int y2, COLORREF color, int width) {
+        Vec2<int> a = mapPoint(x1, y1);
+        Vec2<int> b = mapPoint(x2, y2);
+        int deviceWidth = mapWidth(width);
+        Rect<int> box = boundsOf(static_cast<float>(std::min(a.x, b.x)), static_cast<float>(std::min(a.y, b.y)),
+                                 static_cast<float>(std::max(a.x, b.x)), static_cast<float>(std::max(a.y, b.y)), deviceWidth);
+        if (!accept(box)) return;
+        // Garis miring yang box-nya menyentuh clip tapi garisnya sendiri lewat di samping
+        float pad = deviceWidth * 0.5f + 1.0f, t0, t1;
+        Rect<float> area(m_clip.x - pad, m_clip.y - pad, m_clip.w + pad * 2.0f, m_clip.h + pad * 2.0f);
+        if (!clipSegment(Vec2<float>(a), Vec2<float>(b), area, t0, t1)) {
+            m_frameStats.rejected++;
+            return;
+        }
+        drawLineDevice(a.x, a.y, b.x, b.y, color, deviceWidth);
+    }
+
+    void drawRectInternal(int x, int y, int width, int height, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        if (m_transformKind == TransformKind::General) {
+            Vec2<int> corners[4] = { Vec2<int>(x, y), Vec2<int>(x + width, y), Vec2<int>(x + width, y + height), Vec2<int>(x, y + height) };
+            drawPolygonInternal(corners, 4, fillColor, strokeColor, hasFill, hasStroke, strokeWidth);
+            return;
+        }
+        Rect<int> r = mapBox(x, y, x + width, y + height);
+        int deviceWidth = mapWidth(strokeWidth);
+        if (!accept(boundsOf(static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.right()), static_cast<float>(r.bottom()), hasStroke ? deviceWidth : 0)))
+            return;
+        drawRectDevice(r.x, r.y, r.w, r.h, fillColor, strokeColor, hasFill, hasStroke, deviceWidth);
+    }
+
+    void drawEllipseInternal(int left, int top, int right, int bottom, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        if (m_transformKind == TransformKind::General) {
+            // Rotasi/shear: ellipse jadi polygon
+            ArenaScope scratch;
+            int segments = 0;
+            Vec2<float>* points = ellipsePolygon(scratch.arena(), left, top, right, bottom, segments);
+            drawPolygonInternal(points, segments, fillColor, strokeColor, hasFill, hasStroke, strokeWidth);
+            return;
+        }
+        Rect<int> r = mapBox(left, top, right, bottom);
+        int deviceWidth = mapWidth(strokeWidth);
+        if (!accept(boundsOf(static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.right()), static_cast<float>(r.bottom()), hasStroke ? deviceWidth : 0)))
+            return;
+        drawEllipseDevice(r.x, r.y, r.x + r.w, r.y + r.h, fillColor, strokeColor, hasFill, hasStroke, deviceWidth);
+    }
+
+    // Ellipse yang diputar/shear: polygon, jumlah segmen mengikuti ukuran di layar
+    Vec2<float>* ellipsePolygon(FrameArena& arena, int left, int top, int right, int bottom, int& segments) const {
+        float cx = (left + right) * 0.5f, cy = (top + bottom) * 0.5f;
+        float rx = (right - left) * 0.5f, ry = (bottom - top) * 0.5f;
+        float size = (std::fabs(rx) + std::fabs(ry)) * std::sqrt(std::fabs(m_transform.determinant()));
+        segments = std::min(std::max(static_cast<int>(size), 12), 256);
+        Vec2<float>* points = arena.allocateArray<Vec2<float>>(static_cast<size_t>(segments));
+        for (int i = 0; i < segments; i++) {
+            float t = 6.28318530718f * static_cast<float>(i) / static_cast<float>(segments);
+            points[i] = Vec2<float>(cx + rx * std::cos(t), cy + ry * std::sin(t));
+        }
+        return points;
+    }
+
+    // ===== PAINT FILL =====
+    // Sama dengan jalur fill solid (transform, accept, clip), tapi span diserahkan ke GradientSpan
+
+    void fillRectPaint(int x, int y, int width, int height, const Gradient& paint) {
+        if (m_transformKind == TransformKind::General) {
+            Vec2<int> corners[4] = { Vec2<int>(x, y), Vec2<int>(x + width, y), Vec2<int>(x + width, y + height), Vec2<int>(x, y + height) };
+            fillPolygonPaint(corners, 4, paint);
+            return;
+        }
+        Rect<int> r = mapBox(x, y, x + width, y + height);
+        if (!accept(boundsOf(static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.right()), static_cast<float>(r.bottom()), 0)))
+            return;
+        withPaint(paint, [&](GradientSpan& span) { m_raster.rectSpans(r.x, r.y, r.w, r.h, span); });
+    }
+
+    void fillEllipsePaint(int left, int top, int right, int bottom, const Gradient& paint) {
+        if (m_transformKind == TransformKind::General) {
+            ArenaScope scratch;
+            int segments = 0;
+            Vec2<float>* points = ellipsePolygon(scratch.arena(), left, top, right, bottom, segments);
+            fillPolygonPaint(points, segments, paint);
+            return;
+        }
+        Rect<int> r = mapBox(left, top, right, bottom);
+        if (!accept(boundsOf(static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.right()), static_cast<float>(r.bottom()), 0)))
+            return;
+        // Sama dengan Raster::ellipse
+        withPaint(paint, [&](GradientSpan& span) {
+            m_raster.ellipseSpans(r.x + r.w * 0.5f, r.y + r.h * 0.5f, r.w * 0.5f, r.h * 0.5f, span);
+        });
+    }
+
+    template <typename T>
+    void fillPolygonPaint(const Vec2<T>* points, int count, const Gradient& paint) {
+        if (count <= 0) return;
+        ArenaScope scratch;
+        Vec2<int>* device = scratch.arena().allocateArray<Vec2<int>>(static_cast<size_t>(count));
+        simd::transform(m_transform, points, device, static_cast<size_t>(count));
+        if (!accept(polygonBounds(device, count, 0)) || count < 3) return;
+        withPaint(paint, [&](GradientSpan& span) {
+            m_raster.beginPath();
+            m_raster.addContour(device, count);
+            m_raster.fillPath(FillRule::EvenOdd, span);
+        });
+    }
+
+    // Regangan terbesar transform (nilai singular terbesar), untuk toleransi flatten
+    float transformStretch() const {
+        const Affine& m = m_transform;
+        float sum = m.a * m.a + m.b * m.b + m.c * m.c + m.d * m.d;
+        float det = m.determinant();
+        return std::sqrt(0.5f * (sum + std::sqrt(std::max(sum * sum - 4.0f * det * det, 0.0f))));
+    }
+
+    // Flatten lewat cache lalu transform ke device (float, subpixel tetap dipakai rasterizer)
+    Vec2<float>* devicePath(FrameArena& arena, const FlatPath& flat) const {
+        Vec2<float>* device = arena.allocateArray<Vec2<float>>(flat.points.size());
+        simd::transform(m_transform, flat.points.data(), device, flat.points.size());
+        return device;
+    }
+
+    void fillPathInternal(const Path& path, FillRule rule, Pixel color, const Gradient* paint) {
+        const FlatPath& flat = m_pathCache.get(path, transformStretch());
+        if (flat.contours.empty()) return;
+        ArenaScope scratch;
+        const Vec2<float>* device = devicePath(scratch.arena(), flat);
+        if (!accept(polygonBounds(device, static_cast<int>(flat.points.size()), 0))) return;
+        auto fill = [&](auto& span) {
+            m_raster.beginPath();
+            for (const FlatPath::Contour& c : flat.contours)
+                m_raster.addContour(device + c.begin, static_cast<int>(c.count));
+            m_raster.fillPath(rule, span);
+        };
+        if (paint) {
+            withPaint(*paint, fill);
+            return;
+        }
+        SolidSpan span(surface(), color);
+        m_raster.setClip(m_clip);
+        fill(span);
+    }
+
+    void strokePathInternal(const Path& path, Pixel color, int strokeWidth, LineJoin join, LineCap cap) {
+        const FlatPath& flat = m_pathCache.get(path, transformStretch());
+        if (flat.contours.empty()) return;
+        ArenaScope scratch;
+        const Vec2<float>* device = devicePath(scratch.arena(), flat);
+        const int deviceWidth = mapWidth(strokeWidth);
+        if (!accept(polygonBounds(device, static_cast<int>(flat.points.size()), deviceWidth))) return;
+        m_raster.setClip(m_clip);
+        if (deviceWidth <= 1) {
+            for (const FlatPath::Contour& c : flat.contours)
+                hairline(device + c.begin, static_cast<int>(c.count), c.closed, color);
+            return;
+        }
+        StrokeStyle style;
+        style.width = static_cast<float>(deviceWidth);
+        style.join = join;
+        style.cap = cap;
+        m_outline.clear();
+        for (const FlatPath::Contour& c : flat.contours)
+            m_stroker.stroke(device + c.begin, static_cast<int>(c.count), c.closed, style, m_outline);
+        fillOutline(color);
+    }
+
+    void drawPolylineInternal(const Vec2<float>* points, int count, bool closed, Pixel color, const StrokeStyle& style) {
+        if (count <= 0) return;
+        ArenaScope scratch;
+        Vec2<float>* device = scratch.arena().allocateArray<Vec2<float>>(static_cast<size_t>(count));
+        simd::transform(m_transform, points, device, static_cast<size_t>(count));
+        const float deviceWidth = style.width * transformScale();
+        if (!accept(polygonBounds(device, count, static_cast<int>(std::ceil(deviceWidth * std::max(style.miterLimit, 1.5f)))))) return;
+        m_raster.setClip(m_clip);
+        if (deviceWidth <= 1.0f) {
+            hairline(device, count, closed, color);
+            return;
+        }
+        StrokeStyle deviceStyle = style;
+        deviceStyle.width = deviceWidth;
+        m_outline.clear();
+        m_stroker.stroke(device, count, closed, deviceStyle, m_outline);
+        fillOutline(color);
+    }
+
+    // Bresenham tanpa pixel terakhir: titik sambungan tidak digambar dua kali.
+    // Raster menulis langsung ke DIB, jadi antrian GDI di-flush dulu lewat surface()
+    void hairline(const Vec2<float>* p, int count, bool closed, Pixel color) {
+        surface();
+        m_raster.polyline(p, count, closed, color);
+    }
+
+    void fillOutline(Pixel color) {
+        if (m_outline.contours.empty()) return;
+        SolidSpan span(surface(), color);
+        m_raster.beginPath();
+        for (const FlatPath::Contour& c : m_outline.contours)
+            m_raster.addContour(m_outline.points.data() + c.begin, static_cast<int>(c.count));
+        m_raster.fillPath(FillRule::NonZero, span);
+    }
+
+    // ===== SERIES =====
+
+    void drawSeriesInternal(const SeriesPyramid& series, SeriesRange x, SeriesRange y, Rect<int> area, Pixel color, SeriesMode mode) {
+        if (series.size() == 0 || area.w <= 0 || area.h <= 0 || !(x.end > x.begin) || !(y.end != y.begin)) return;
+        if (!accept(mapRect(area.x, area.y, area.right(), area.bottom()))) return;
+        const int columns = m_transformKind == TransformKind::General
+            ? std::max(1, static_cast<int>(std::lround(area.w * transformScale())))
+            : mapRect(area.x, area.y, area.right(), area.bottom()).w;
+        if (columns <= 0) return;
+
+        // Koordinat user: sampel i di x area.x + (i - x.begin) * sx, nilai high di pusat baris teratas
+        const double sx = area.w / (x.end - x.begin);
+        const float sy = static_cast<float>((area.h - 1) / (y.end - y.begin));
+        const float top = static_cast<float>(area.y) + 0.5f, high = static_cast<float>(y.end);
+        auto userY = [&](float v) { return top + (high - v) * sy; };
+        auto userPoint = [&](size_t i) {
+            return Vec2<float>(static_cast<float>(area.x + (static_cast<double>(i) - x.begin) * sx), userY(series.data()[i]));
+        };
+
+        pushClip(area);
+        ArenaScope scratch;
+        FrameArena& arena = scratch.arena();
+        const double perColumn = (x.end - x.begin) / columns;
+        const size_t first = static_cast<size_t>(std::clamp(std::floor(x.begin), 0.0, static_cast<double>(series.size() - 1)));
+        const size_t last = static_cast<size_t>(std::clamp(std::ceil(x.end), 0.0, static_cast<double>(series.size() - 1))) + 1;
+
+        if (perColumn < 2.0 || mode == SeriesMode::Lttb) {
+            // Sampel (atau hasil LTTB) + satu sampel di luar tiap sisi supaya garis sampai ke tepi area
+            size_t* picked = arena.allocateArray<size_t>(last - first);
+            size_t count = perColumn < 2.0 ? lttb(series.data(), first, last, 0, picked)
+                                           : lttb(series.data(), first, last, static_cast<size_t>(columns), picked);
+            // NaN = celah: polyline diputus
+            Vec2<float>* points = arena.allocateArray<Vec2<float>>(count);
+            size_t run = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (std::isnan(series.data()[picked[i]])) {
+                    seriesPolyline(points, run, color);
+                    run = 0;
+                    continue;
+                }
+                points[run++] = userPoint(picked[i]);
+            }
+            seriesPolyline(points, run, color);
+        } else {
+            SeriesColumn* envelope = arena.allocateArray<SeriesColumn>(static_cast<size_t>(columns));
+            seriesEnvelope(series, x, columns, envelope);
+            if (m_transformKind == TransformKind::General)
+                seriesEnvelopePolyline(arena, envelope, columns, area, userY, color);
+            else
+                seriesEnvelopeSpans(envelope, columns, area, userY, color);
+        }
+        popClip();
+    }
+
+    // Span vertikal per kolom device; kolom juga menjangkau nilai terakhir kolom sebelumnya
+    // supaya envelope tersambung (kolom kosong / NaN memutus sambungan)
+    template <typename UserY>
+    void seriesEnvelopeSpans(const SeriesColumn* envelope, int columns, Rect<int> area, UserY userY, Pixel color) {
+        const Affine& m = m_transform;
+        const Rect<int> device = mapRect(area.x, area.y, area.right(), area.bottom());
+        const bool mirrored = m.a < 0.0f;
+        const float limitTop = static_cast<float>(m_clip.y - 1), limitBottom = static_cast<float>(m_clip.y + m_clip.h + 1);
+        auto row = [&](float v) {
+            return static_cast<int>(std::floor(std::clamp(m.d * userY(v) + m.ty, limitTop, limitBottom)));
+        };
+        surface();      // flush GDI: fillRect di bawah menulis langsung ke DIB
+        m_raster.setClip(m_clip);
+        float previous = std::numeric_limits<float>::quiet_NaN();
+        for (int c = 0; c < columns; c++) {
+            const SeriesColumn& column = envelope[c];
+            if (!(column.low <= column.high)) {
+                previous = std::numeric_limits<float>::quiet_NaN();
+                continue;
+            }
+            float low = column.low, high = column.high;
+            if (!std::isnan(previous)) {
+                low = std::min(low, previous);
+                high = std::max(high, previous);
+            }
+            previous = column.last;
+            int r0 = row(low), r1 = row(high);
+            if (r0 > r1) std::swap(r0, r1);
+            int px = mirrored ? device.x + device.w - 1 - c : device.x + c;
+            m_raster.fillRect(px, r0, 1, r1 - r0 + 1, color);
+        }
+    }
+
+    // Transform berotasi: envelope jadi polyline (first, low, high, last per kolom) di koordinat user
+    template <typename UserY>
+    void seriesEnvelopePolyline(FrameArena& arena, const SeriesColumn* envelope, int columns, Rect<int> area, UserY userY, Pixel color) {
+        Vec2<float>* points = arena.allocateArray<Vec2<float>>(static_cast<size_t>(columns) * 4);
+        size_t count = 0;
+        auto flush = [&] {
+            seriesPolyline(points, count, color);
+            count = 0;
+        };
+        for (int c = 0; c < columns; c++) {
+            const SeriesColumn& column = envelope[c];
+            if (!(column.low <= column.high)) {
+                flush();
+                continue;
+            }
+            float px = area.x + (c + 0.5f) * area.w / columns;
+            for (float v : { column.first, column.low, column.high, column.last })
+                if (!std::isnan(v)) points[count++] = Vec2<float>(px, userY(v));
+        }
+        flush();
+    }
+
+    // Polyline 1 pixel dari koordinat user (tanpa accept: sudah dihitung drawSeries).
+    // GDI di-flush oleh hairline sebelum raster menulis
+    void seriesPolyline(const Vec2<float>* points, size_t count, Pixel color) {
+        if (count == 0) return;
+        ArenaScope scratch;
+        Vec2<float>* device = scratch.arena().allocateArray<Vec2<float>>(count);
+        simd::transform(m_transform, points, device, count);
+        m_raster.setClip(m_clip);
+        hairline(device, static_cast<int>(count), false, color);
+    }
+
+    // Raster dipakai langsung ke back buffer; clip-nya disamakan dulu (di Win32 clip aktif ada di DC)
+    template <typename Fn>
+    void withPaint(const Gradient& paint, Fn&& fill) {
+        if (m_transform.determinant() == 0.0f) return;
+        ArenaScope scratch;
+        GradientSpan span(surface(), paint, m_transform.inverse(), scratch.arena());
+        m_raster.setClip(m_clip);
+        fill(span);
+    }
+
+    // Box [left, right) x [top, bottom) lewat transform tanpa rotasi, dinormalisasi (scale negatif = cermin)
+    Rect<int> mapBox(int left, int top, int right, int bottom) const {
+        Vec2<int> a = mapPoint(left, top);
+        Vec2<int> b = mapPoint(right, bottom);
+        return Rect<int>(std::min(a.x, b.x), std::min(a.y, b.y), std::abs(b.x - a.x), std::abs(b.y - a.y));
+    }
+
+    // Seperti mapBox, tapi dengan rotasi/shear: bounding box keempat sudut
+    Rect<int> mapRect(int left, int top, int right, int bottom) const {
+        if (m_transformKind != TransformKind::General)
+            return mapBox(left, top, right, bottom);
+        Vec2<int> c[4] = { mapPoint(left, top), mapPoint(right, top), mapPoint(right, bottom), mapPoint(left, bottom) };
+        Rect<int> box(c[0].x, c[0].y, 0, 0);
+        int maxX = c[0].x, maxY = c[0].y;
+        for (int i = 1; i < 4; i++) {
+            box.x = std::min(box.x, c[i].x);
+            box.y = std::min(box.y, c[i].y);
+            maxX = std::max(maxX, c[i].x);
+            maxY = std::max(maxY, c[i].y);
+        }
+        box.w = maxX - box.x;
+        box.h = maxY - box.y;
+        return box;
+    }
+
+    template <typename P>
+    Rect<int> polygonBounds(const P* points, int count, int strokeWidth) const {
+        float minX = static_cast<float>(points[0].x), maxX = minX;
+        float minY = static_cast<float>(points[0].y), maxY = minY;
+        for (int i = 1; i < count; i++) {
+            minX = std::min(minX, static_cast<float>(points[i].x));
+            maxX = std::max(maxX, static_cast<float>(points[i].x));
+            minY = std::min(minY, static_cast<float>(points[i].y));
+            maxY = std::max(maxY, static_cast<float>(points[i].y));
+        }
+        return boundsOf(minX, minY, maxX, maxY, strokeWidth);
+    }
+
+    void drawPolygonInternal(const POINT* points, int count, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        if (m_transformKind == TransformKind::Offset && m_offset == Vec2<int>(0, 0)) {
+            if (count > 0 && accept(polygonBounds(points, count, hasStroke ? strokeWidth : 0)))
+                drawPolygonDevice(points, count, fillColor, strokeColor, hasFill, hasStroke, strokeWidth);
+            return;
+        }
+        ArenaScope scratch;
+        Vec2<int>* copy = scratch.arena().allocateArray<Vec2<int>>(count > 0 ? static_cast<size_t>(count) : 0);
+        for (int i = 0; i < count; i++)
+            copy[i] = Vec2<int>(static_cast<int>(points[i].x), static_cast<int>(points[i].y));
+        drawPolygonInternal(copy, count, fillColor, strokeColor, hasFill, hasStroke, strokeWidth);
+    }
+
+    template <typename T>
+    void drawPolygonInternal(const Vec2<T>* points, int count, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        if (count <= 0) return;
+        ArenaScope scratch;
+        Vec2<int>* device = scratch.arena().allocateArray<Vec2<int>>(static_cast<size_t>(count));
+        simd::transform(m_transform, points, device, static_cast<size_t>(count));
+        int deviceWidth = mapWidth(strokeWidth);
+        if (!accept(polygonBounds(device, count, hasStroke ? deviceWidth : 0))) return;
+        POINT* winPoints = toPoints(scratch.arena(), device, count);
+        drawPolygonDevice(winPoints, count, fillColor, strokeColor, hasFill, hasStroke, deviceWidth);
+    }
+
+#if Z_PLATFORM_WIN32
     HWND m_hwnd;
     HDC m_hdc;
     HDC m_memDC;
     HBITMAP m_memBitmap;
     HBITMAP m_oldBitmap;
+    Pixel* m_pixels = nullptr;      // bits DIB section
+#else
+    platform::HeadlessWindow* m_hwnd;
+    std::vector<Pixel> m_pixels;
+#endif
+    int m_width = 0;
+    int m_height = 0;
+    int m_stride = 0;       // = kapasitas pool, bisa lebih lebar dari m_width
+    SurfacePool m_pool;
+    Raster m_raster;
+    Affine m_transform;
+    std::vector<Affine> m_transformStack;
+    TransformKind m_transformKind = TransformKind::Offset;
+    Vec2<int> m_offset;
+    std::vector<Rect<int>> m_clipStack;     // setiap entri sudah diiris dengan entri sebelumnya
+    Rect<int> m_clip;
+    CanvasStats m_frameStats;
+    CanvasStats m_lastFrameStats;
+    const Font* m_font = &Font::builtin();
+    TextCache m_textCache;
+    Jobs* m_jobs = nullptr;
+    FlattenCache m_pathCache;
+    Stroker m_stroker;
+    FloodFill m_floodFill;
+    FlatPath m_outline;     // outline stroke, kapasitasnya dipakai ulang antar panggilan
+
+    static double secondsNow() {
+        return static_cast<double>(platform::ticks()) / static_cast<double>(platform::tickFrequency());
+    }
+
+    // Ukuran yang dilayani pool -> surface raster + clip
+    void applySize() {
+        Vec2<int> size = m_stride > 0 ? m_pool.size() : Vec2<int>(0, 0);
+        m_width = size.x;
+        m_height = size.y;
+        m_raster.setTarget(Surface(pixelData(), m_width, m_height, m_stride));
+        updateClip();
+    }
+
+    // Salin bagian frame lama yang masih muat ke storage baru
+    void copyFrame(Pixel* target, int stride, Vec2<int> capacity) const {
+        int width = std::min(m_width, capacity.x);
+        int height = std::min(m_height, capacity.y);
+        const Pixel* source = const_cast<Canvas*>(this)->pixelData();
+        for (int y = 0; y < height; y++)
+            std::copy(source + static_cast<size_t>(y) * m_stride, source + static_cast<size_t>(y) * m_stride + width, target + static_cast<size_t>(y) * stride);
+    }
+
+    // Clip efektif = puncak stack diiris ukuran canvas (ikut berubah saat resize)
+    void updateClip() {
+        m_clip = Rect<int>(0, 0, m_width, m_height);
+        if (!m_clipStack.empty())
+            m_clip = m_clip.intersect(m_clipStack.back());
+        applyClipDevice();
+    }
+
+#if Z_PLATFORM_WIN32
+    Pixel* pixelData() { return m_pixels; }
 
+    // Memory DC dibuat sekali; bitmap-nya diganti setiap storage dialokasi ulang
     void setupDoubleBuffering() {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        
         m_memDC = CreateCompatibleDC(m_hdc);
-        m_memBitmap = CreateCompatibleBitmap(m_hdc, rect.right, rect.bottom);
-        m_oldBitmap = (HBITMAP)SelectObject(m_memDC, m_memBitmap);
-        
-        // Clear background
-        HBRUSH bg = CreateSolidBrush(RGB(0, 0, 0));
-        FillRect(m_memDC, &rect, bg);
-        DeleteObject(bg);
+    }
+
+    // DIB section 32-bit top-down seukuran kapasitas supaya back buffer bisa diakses langsung
+    void reallocateStorage(Vec2<int> capacity) {
+        BITMAPINFO bmi = {};
+        bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bmi.bmiHeader.biWidth = capacity.x;
+        bmi.bmiHeader.biHeight = -capacity.y;
+        bmi.bmiHeader.biPlanes = 1;
+        bmi.bmiHeader.biBitCount = 32;
+        bmi.bmiHeader.biCompression = BI_RGB;
+
+        void* bits = nullptr;
+        HBITMAP bitmap = capacity.x > 0 && capacity.y > 0 ? CreateDIBSection(m_hdc, &bmi, DIB_RGB_COLORS, &bits, nullptr, 0) : nullptr;
+        Pixel* pixels = bitmap ? static_cast<Pixel*>(bits) : nullptr;
+        if (pixels && m_pixels) {
+            GdiFlush();
+            copyFrame(pixels, capacity.x, capacity);     // sisanya hitam (DIB baru berisi nol)
+        }
+
+        if (bitmap) {
+            HBITMAP previous = (HBITMAP)SelectObject(m_memDC, bitmap);
+            if (!m_oldBitmap)
+                m_oldBitmap = previous;
+        } else if (m_oldBitmap) {
+            SelectObject(m_memDC, m_oldBitmap);
+            m_oldBitmap = nullptr;
+        }
+        if (m_memBitmap)
+            DeleteObject(m_memBitmap);
+
+        m_memBitmap = bitmap;
+        m_pixels = pixels;
+        m_stride = pixels ? capacity.x : 0;
     }
 
     void cleanup() {
@@ -381,9 +1404,43 @@ private:
             DeleteObject(m_memBitmap);
             m_memBitmap = nullptr;
         }
+        m_pixels = nullptr;
+        m_width = m_height = m_stride = 0;
     }
 
-    void drawRectInternal(int x, int y, int width, int height, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+    // ===== GDI BACKEND =====
+
+    // Selalu dipasang: bitmap bisa lebih besar dari ukuran canvas
+    void applyClipDevice() {
+        SelectClipRgn(m_memDC, nullptr);
+        IntersectClipRect(m_memDC, m_clip.x, m_clip.y, m_clip.right(), m_clip.bottom());
+    }
+
+    void clearInternal(COLORREF color) {
+        RECT rect = { 0, 0, m_width, m_height };
+        HBRUSH bg = CreateSolidBrush(color);
+        FillRect(m_memDC, &rect, bg);
+        DeleteObject(bg);
+    }
+
+    void drawPixelDevice(int x, int y, COLORREF color) {
+        SetPixel(m_memDC, x, y, color);
+    }
+
+    void drawLineDevice(int x1, int y1, int x2, int y2, COLORREF color, int width) {
+        HPEN pen = CreatePen(PS_SOLID, width, color);
+        HPEN oldPen = (HPEN)SelectObject(m_memDC, pen);
+        
+        MoveToEx(m_memDC, x1, y1, nullptr);
+        LineTo(m_memDC, x2, y2);
+        
+        SelectObject(m_memDC, oldPen);
+        DeleteObject(pen);
+    }
+
+    // Pilih brush/pen sesuai flag, jalankan draw, lalu kembalikan object lama
+    template <typename DrawFn>
+    void withBrushAndPen(COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth, DrawFn draw) {
         HBRUSH brush = nullptr;
         HPEN pen = nullptr;
         HBRUSH oldBrush = nullptr;
@@ -403,7 +1460,7 @@ private:
             oldPen = (HPEN)SelectObject(m_memDC, GetStockObject(NULL_PEN));
         }
 
-        Rectangle(m_memDC, x, y, x + width, y + height);
+        draw();
 
         SelectObject(m_memDC, oldBrush);
         SelectObject(m_memDC, oldPen);
@@ -411,6 +1468,107 @@ private:
         if (brush) DeleteObject(brush);
         if (pen) DeleteObject(pen);
     }
+
+    void drawRectDevice(int x, int y, int width, int height, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        withBrushAndPen(fillColor, strokeColor, hasFill, hasStroke, strokeWidth, [&] {
+            Rectangle(m_memDC, x, y, x + width, y + height);
+        });
+    }
+
+    void drawEllipseDevice(int left, int top, int right, int bottom, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        withBrushAndPen(fillColor, strokeColor, hasFill, hasStroke, strokeWidth, [&] {
+            Ellipse(m_memDC, left, top, right, bottom);
+        });
+    }
+
+    void drawPolygonDevice(const POINT* points, int count, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        withBrushAndPen(fillColor, strokeColor, hasFill, hasStroke, strokeWidth, [&] {
+            Polygon(m_memDC, points, count);
+        });
+    }
+
+    void drawTrianglesDevice(const Vec2<float>* vertices, int count, COLORREF fillColor) {
+        withBrushAndPen(fillColor, RGB(0, 0, 0), true, false, 1, [&] {
+            for (int i = 0; i + 2 < count; i += 3) {
+                POINT tri[3];
+                for (int k = 0; k < 3; k++) {
+                    tri[k].x = static_cast<LONG>(std::nearbyint(vertices[i + k].x));
+                    tri[k].y = static_cast<LONG>(std::nearbyint(vertices[i + k].y));
+                }
+                Polygon(m_memDC, tri, 3);
+            }
+        });
+    }
+
+    void drawPixelsDevice(const Vec2<int>* points, int count, COLORREF color) {
+        for (int i = 0; i < count; i++)
+            SetPixelV(m_memDC, points[i].x, points[i].y, color);
+    }
+#else
+    Pixel* pixelData() { return m_pixels.data(); }
+
+    void setupDoubleBuffering() {}
+
+    void reallocateStorage(Vec2<int> capacity) {
+        std::vector<Pixel> pixels(static_cast<size_t>(capacity.x) * static_cast<size_t>(capacity.y), makePixel(0, 0, 0));
+        if (!pixels.empty())
+            copyFrame(pixels.data(), capacity.x, capacity);
+        m_pixels.swap(pixels);
+        m_stride = m_pixels.empty() ? 0 : capacity.x;
+    }
+
+    void cleanup() {
+        m_pixels.clear();
+        m_width = m_height = m_stride = 0;
+        m_raster.setTarget(Surface());
+    }
+
+    // ===== SOFTWARE BACKEND =====
+
+    void applyClipDevice() {
+        m_raster.setClip(m_clip);
+    }
+
+    void clearInternal(COLORREF color) {
+        m_raster.fill(toPixel(color));
+    }
+
+    void drawPixelDevice(int x, int y, COLORREF color) {
+        m_raster.plot(x, y, toPixel(color));
+    }
+
+    void drawLineDevice(int x1, int y1, int x2, int y2, COLORREF color, int width) {
+        m_raster.line(x1, y1, x2, y2, toPixel(color), width);
+    }
+
+    void drawRectDevice(int x, int y, int width, int height, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        if (hasFill)
+            m_raster.fillRect(x, y, width, height, toPixel(fillColor));
+        if (hasStroke)
+            m_raster.frameRect(x, y, width, height, toPixel(strokeColor), strokeWidth);
+    }
+
+    void drawEllipseDevice(int left, int top, int right, int bottom, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        m_raster.ellipse(left, top, right, bottom, toPixel(fillColor), toPixel(strokeColor), hasFill, hasStroke, strokeWidth);
+    }
+
+    void drawPolygonDevice(const POINT* points, int count, COLORREF fillColor, COLORREF strokeColor, bool hasFill, bool hasStroke, int strokeWidth) {
+        m_raster.polygon(points, count, toPixel(fillColor), toPixel(strokeColor), hasFill, hasStroke, strokeWidth);
+    }
+
+    // Subpixel langsung dari float, setiap segitiga di-fill sendiri (tumpang tindih tidak saling hapus)
+    void drawTrianglesDevice(const Vec2<float>* vertices, int count, COLORREF fillColor) {
+        Pixel pixel = toPixel(fillColor);
+        for (int i = 0; i + 2 < count; i += 3)
+            m_raster.polygon(vertices + i, 3, pixel, pixel, true, false, 1, FillRule::NonZero);
+    }
+
+    void drawPixelsDevice(const Vec2<int>* points, int count, COLORREF color) {
+        Pixel pixel = toPixel(color);
+        for (int i = 0; i < count; i++)
+            m_raster.plot(points[i].x, points[i].y, pixel);
+    }
+#endif
 };
 
-} // namespace z
\ No newline at end of file
+} // namespace z
@@ -0,0 +1,595 @@
+#pragma once
+#include "z_platform.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_simd.h"
+
+namespace z {
+
+// Warna 32-bit terpacking 0xAARRGGBB, layout sama dengan Pixel, jadi konversi
+// ke back buffer gratis. Bisa dipertukarkan dengan Color<unsigned char>.
+// Semua operasi per channel saturating dan dikerjakan sekaligus dalam satu
+// register (SWAR); versi array di bawah memakai SSE2 untuk 4 warna per instruksi.
+struct PackedColor {
+    uint32_t value = 0xFF000000u;
+
+    constexpr PackedColor() noexcept = default;
+
+    constexpr PackedColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) noexcept
+        : value(makePixel(r, g, b, a)) {}
+
+    constexpr PackedColor(Color<unsigned char> color) noexcept
+        : value(makePixel(color.r, color.g, color.b, color.a)) {}
+
+    static constexpr PackedColor fromPixel(Pixel pixel) noexcept {
+        PackedColor c;
+        c.value = pixel;
+        return c;
+    }
+
+    static constexpr PackedColor fromColorRef(COLORREF color, uint8_t a = 255) noexcept {
+        return fromPixel((static_cast<uint32_t>(a) << 24) | ((color & 0xFFu) << 16) | (color & 0xFF00u) | ((color >> 16) & 0xFFu));
+    }
+
+    constexpr uint8_t r() const noexcept { return static_cast<uint8_t>(value >> 16); }
+    constexpr uint8_t g() const noexcept { return static_cast<uint8_t>(value >> 8); }
+    constexpr uint8_t b() const noexcept { return static_cast<uint8_t>(value); }
+    constexpr uint8_t a() const noexcept { return static_cast<uint8_t>(value >> 24); }
+
+    constexpr PackedColor withAlpha(uint8_t alpha) const noexcept {
+        return fromPixel((value & 0x00FFFFFFu) | (static_cast<uint32_t>(alpha) << 24));
+    }
+
+    // ===== KONVERSI =====
+
+    constexpr Pixel pixel() const noexcept { return value; }
+
+    // COLORREF (0x00BBGGRR), tanpa lewat RGB() per channel
+    constexpr COLORREF colorRef() const noexcept {
+        return static_cast<COLORREF>(((value >> 16) & 0xFFu) | (value & 0xFF00u) | ((value & 0xFFu) << 16));
+    }
+
+    constexpr operator Color<unsigned char>() const noexcept {
+        return Color<unsigned char>(r(), g(), b(), a());
+    }
+
+    // ===== ARITMATIKA SATURATING (SWAR) =====
+    //
+    // Channel disebar ke lane 16-bit dalam satu uint64 (A_G_ dan R_B_),
+    // jadi carry/borrow tidak pernah melewati batas channel.
+
+    constexpr PackedColor operator+(PackedColor other) const noexcept {
+        uint64_t sum = spread(value) + spread(other.value);
+        uint64_t over = (sum >> 8) & LANE_LOW_BIT;
+        return fromPixel(gather(sum | (over * 0xFF)));
+    }
+
+    constexpr PackedColor operator-(PackedColor other) const noexcept {
+        uint64_t diff = (spread(value) | LANE_BORROW) - spread(other.value);
+        uint64_t keep = (diff >> 8) & LANE_LOW_BIT;     // bit 8 hilang = underflow
+        return fromPixel(gather(diff & (keep * 0xFF)));
+    }
+
+    // Modulasi: a * b / 255 dengan pembulatan, tepat untuk semua 0..255
+    constexpr PackedColor operator*(PackedColor other) const noexcept {
+        uint64_t a = spread(value);
+        uint64_t b = spread(other.value);
+        uint64_t p = 0;
+        for (int lane = 0; lane < 4; lane++) {
+            uint64_t shift = lane * 16;
+            uint64_t x = ((a >> shift) & 0xFF) * ((b >> shift) & 0xFF) + 128;
+            p |= ((x + (x >> 8)) >> 8) << shift;
+        }
+        return fromPixel(gather(p));
+    }
+
+    constexpr PackedColor& operator+=(PackedColor other) noexcept { return *this = *this + other; }
+    constexpr PackedColor& operator-=(PackedColor other) noexcept { return *this = *this - other; }
+    constexpr PackedColor& operator*=(PackedColor other) noexcept { return *this = *this * other; }
+
+    constexpr bool operator==(PackedColor other) const noexcept { return value == other.value; }
+    constexpr bool operator!=(PackedColor other) const noexcept { return value != other.value; }
+
+    // Kalikan semua channel (termasuk alpha) dengan s / 255
+    constexpr PackedColor scale(uint8_t s) const noexcept {
+        return *this * fromPixel(0x01010101u * s);
+    }
+
+    // Interpolasi dengan t 0..256 (256 = other persis)
+    constexpr PackedColor lerp256(PackedColor other, uint32_t t) const noexcept {
+        uint64_t mixed = spread(value) * (256 - t) + spread(other.value) * t;
+        return fromPixel(gather(mixed >> 8));
+    }
+
+    // Interpolasi dengan t 0..1 (di-clamp)
+    constexpr PackedColor lerp(PackedColor other, float t) const noexcept {
+        return lerp256(other, lerpWeight(t));
+    }
+
+    static constexpr uint32_t lerpWeight(float t) noexcept {
+        return t <= 0.0f ? 0u : t >= 1.0f ? 256u : static_cast<uint32_t>(t * 256.0f + 0.5f);
+    }
+
+private:
+    static constexpr uint64_t LANE_LOW_BIT = 0x0001000100010001ull;
+    static constexpr uint64_t LANE_BORROW = 0x0100010001000100ull;
+
+    // 0xAARRGGBB -> lane [A, G, R, B] masing-masing 16-bit
+    static constexpr uint64_t spread(uint32_t v) noexcept {
+        return (static_cast<uint64_t>(v & 0xFF00FF00u) << 24) | (v & 0x00FF00FFu);
+    }
+
+    static constexpr uint32_t gather(uint64_t lanes) noexcept {
+        lanes &= 0x00FF00FF00FF00FFull;
+        return static_cast<uint32_t>(lanes | (lanes >> 24));
+    }
+};
+
+static_assert(sizeof(PackedColor) == sizeof(Pixel), "PackedColor harus 32-bit");
+
+inline constexpr Pixel toPixel(PackedColor color) noexcept {
+    return color.pixel();
+}
+
+// ===== ARRAY (SSE2, 4 warna per iterasi) =====
+//
+// out boleh sama dengan input (in-place). Sisa yang bukan kelipatan 4
+// memakai operator SWAR dengan hasil identik.
+
+inline void addColors(const PackedColor* a, const PackedColor* b, PackedColor* out, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    for (; i + 4 <= count; i += 4) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_adds_epu8(va, vb));
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = a[i] + b[i];
+}
+
+inline void subColors(const PackedColor* a, const PackedColor* b, PackedColor* out, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    for (; i + 4 <= count; i += 4) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_subs_epu8(va, vb));
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = a[i] - b[i];
+}
+
+#if Z_HAS_SSE2
+namespace detail {
+
+// (x * y + 128 + ((x * y + 128) >> 8)) >> 8 untuk lane 16-bit
+inline __m128i mulDiv255(__m128i x, __m128i y) {
+    __m128i p = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+}
+
+// Tukar byte 0 dan 2 setiap lane 32-bit (R <-> B)
+inline __m128i swapRedBlue(__m128i v) {
+    const __m128i keep = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i low = _mm_set1_epi32(0x000000FF);
+    return _mm_or_si128(_mm_and_si128(v, keep),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), low), _mm_slli_epi32(_mm_and_si128(v, low), 16)));
+}
+
+} // namespace detail
+#endif
+
+inline void multiplyColors(const PackedColor* a, const PackedColor* b, PackedColor* out, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i lo = detail::mulDiv255(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vb, zero));
+        __m128i hi = detail::mulDiv255(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vb, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = a[i] * b[i];
+}
+
+// out = a + (b - a) * t, t 0..1 sama untuk semua elemen
+inline void lerpColors(const PackedColor* a, const PackedColor* b, float t, PackedColor* out, size_t count) {
+    const uint32_t w = PackedColor::lerpWeight(t);
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wb = _mm_set1_epi16(static_cast<short>(w));
+    const __m128i wa = _mm_set1_epi16(static_cast<short>(256 - w));
+    for (; i + 4 <= count; i += 4) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        // Maksimum 255 * 256 = 65280, muat di lane 16-bit unsigned
+        __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), wa),
+                                                  _mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wb)), 8);
+        __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), wa),
+                                                  _mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wb)), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = a[i].lerp256(b[i], w);
+}
+
+// ===== SWIZZLE =====
+
+// BGRA <-> RGBA untuk buffer 32-bit (tukar byte 0 dan 2, bisa in-place)
+inline void swizzleRedBlue(const uint32_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), detail::swapRedBlue(v));
+    }
+#endif
+    for (; i < count; i++) {
+        uint32_t v = src[i];
+        dst[i] = (v & 0xFF00FF00u) | ((v >> 16) & 0xFFu) | ((v & 0xFFu) << 16);
+    }
+}
+
+static_assert(sizeof(Color<unsigned char>) == 4, "pack/unpack mengandalkan Color<unsigned char> 4 byte");
+
+// Color<unsigned char> (byte R,G,B,A) <-> PackedColor (byte B,G,R,A): cukup tukar R dan B
+inline void packColors(const Color<unsigned char>* colors, PackedColor* out, size_t count) {
+    swizzleRedBlue(reinterpret_cast<const uint32_t*>(colors), reinterpret_cast<uint32_t*>(out), count);
+}
+
+inline void unpackColors(const PackedColor* colors, Color<unsigned char>* out, size_t count) {
+    swizzleRedBlue(reinterpret_cast<const uint32_t*>(colors), reinterpret_cast<uint32_t*>(out), count);
+}
+
+// ===== sRGB <-> LINEAR =====
+//
+// Color<float> dianggap linear, 8-bit dianggap sRGB (gamma). Alpha selalu linear.
+// sRGB -> linear: tabel 256 float. Linear -> sRGB: tabel yang diindeks langsung
+// dari bit float (exponent + 9 bit mantissa teratas), jadi resolusinya relatif dan
+// sama halusnya di dekat hitam maupun putih. Setiap bucket menyimpan kode awal dan
+// titik di mana kode naik satu, sehingga hasilnya dibulatkan tepat seperti rumus.
+
+// Rumus referensi (IEC 61966-2-1)
+inline float srgbToLinear(float s) {
+    return s <= 0.04045f ? s / 12.92f : std::pow((s + 0.055f) / 1.055f, 2.4f);
+}
+
+inline float linearToSrgb(float l) {
+    return l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+}
+
+namespace detail {
+
+struct SrgbTables {
+    // Di bawah 2^-13, 12.92 * 255 * l < 0.5 jadi semua menjadi 0
+    static constexpr uint32_t MIN_BITS = 0x39000000u;   // 2^-13
+    static constexpr uint32_t MAX_BITS = 0x3F800000u;   // 1.0
+    static constexpr int SHIFT = 14;                     // 23 - 9 bit mantissa
+    static constexpr uint32_t OFFSET_MASK = (1u << SHIFT) - 1;
+    static constexpr size_t SIZE = ((MAX_BITS - MIN_BITS) >> SHIFT) + 1;
+
+    float toLinear[256];
+    uint32_t toSrgb[SIZE];      // kode awal (8 bit) | offset bit float tempat kode naik (<< 8)
+
+    SrgbTables() {
+        for (int i = 0; i < 256; i++)
+            toLinear[i] = static_cast<float>(srgbToLinearExact(i / 255.0));
+        for (size_t i = 0; i < SIZE; i++) {
+            uint32_t start = MIN_BITS + (static_cast<uint32_t>(i) << SHIFT);
+            uint32_t code = static_cast<uint32_t>(std::floor(linearToSrgbExact(fromBits(start)) * 255.0 + 0.5));
+            // Float terkecil yang sudah dibulatkan ke code + 1 (satu bucket naik paling banyak satu kode)
+            uint32_t offset = OFFSET_MASK + 1;
+            if (code < 255) {
+                double threshold = srgbToLinearExact((code + 0.5) / 255.0);
+                float t = static_cast<float>(threshold);
+                if (t < threshold) t = std::nextafter(t, 2.0f);
+                uint32_t bits = toBits(t);
+                if (bits - start <= OFFSET_MASK) offset = bits - start;
+            }
+            toSrgb[i] = code | (offset << 8);
+        }
+    }
+
+    static double srgbToLinearExact(double s) {
+        return s <= 0.04045 ? s / 12.92 : std::pow((s + 0.055) / 1.055, 2.4);
+    }
+
+    static double linearToSrgbExact(double l) {
+        return l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+    }
+
+    static double fromBits(uint32_t bits) {
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    static uint32_t toBits(float f) {
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+    // bits sudah di-clamp ke [MIN_BITS, MAX_BITS]
+    uint32_t lookup(uint32_t bits) const {
+        uint32_t e = toSrgb[(bits - MIN_BITS) >> SHIFT];
+        return (e & 0xFF) + ((bits & OFFSET_MASK) >= (e >> 8));
+    }
+};
+
+inline const SrgbTables& srgbTables() {
+    static const SrgbTables tables;
+    return tables;
+}
+
+inline uint32_t linearToSrgbByte(const SrgbTables& t, float l) {
+    l = l > 1.0f / 8192.0f ? std::min(l, 1.0f) : 1.0f / 8192.0f;    // NaN juga menjadi 0
+    return t.lookup(SrgbTables::toBits(l));
+}
+
+inline uint32_t alphaByte(float a) {
+    a = a > 0.0f ? std::min(a, 1.0f) : 0.0f;
+    return static_cast<uint32_t>(a * 255.0f + 0.5f);
+}
+
+// rShift/bShift memilih urutan keluaran: PackedColor (16/0) atau Color<unsigned char> (0/16)
+inline void linearToSrgbSpanScalar(const Color<float>* colors, uint32_t* out, size_t count, int rShift, int bShift) {
+    const SrgbTables& t = srgbTables();
+    for (size_t i = 0; i < count; i++) {
+        const Color<float>& c = colors[i];
+        out[i] = (alphaByte(c.a) << 24) | (linearToSrgbByte(t, c.r) << rShift)
+               | (linearToSrgbByte(t, c.g) << 8) | (linearToSrgbByte(t, c.b) << bShift);
+    }
+}
+
+inline void srgbToLinearSpanScalar(const uint32_t* colors, Color<float>* out, size_t count, int rShift, int bShift) {
+    const SrgbTables& t = srgbTables();
+    for (size_t i = 0; i < count; i++) {
+        uint32_t v = colors[i];
+        Color<float>& c = out[i];
+        c.r = t.toLinear[(v >> rShift) & 0xFF];
+        c.g = t.toLinear[(v >> 8) & 0xFF];
+        c.b = t.toLinear[(v >> bShift) & 0xFF];
+        c.a = static_cast<float>(v >> 24) * (1.0f / 255.0f);
+    }
+}
+
+#if Z_HAS_SSE2
+// Clamp 4 channel sekaligus, lookup tetap per channel (SSE2 tidak punya gather)
+inline void linearToSrgbSpanSse(const Color<float>* colors, uint32_t* out, size_t count, int rShift, int bShift) {
+    const SrgbTables& t = srgbTables();
+    const __m128 lo = _mm_set1_ps(1.0f / 8192.0f);
+    const __m128 hi = _mm_set1_ps(1.0f);
+    const __m128 scale255 = _mm_set1_ps(255.0f);
+    alignas(16) uint32_t idx[4];     // bit float hasil clamp
+    for (size_t i = 0; i < count; i++) {
+        __m128 v = _mm_loadu_ps(&colors[i].r);
+        __m128 clamped = _mm_min_ps(_mm_max_ps(v, lo), hi);
+        _mm_store_si128(reinterpret_cast<__m128i*>(idx), _mm_castps_si128(clamped));
+        // Alpha linear: round(a * 255) dari lane ke-4
+        __m128 alpha = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), hi), scale255), _mm_set1_ps(0.5f));
+        int a = _mm_cvtsi128_si32(_mm_shuffle_epi32(_mm_cvttps_epi32(alpha), 0xFF));
+        out[i] = (static_cast<uint32_t>(a) << 24) | (t.lookup(idx[0]) << rShift)
+               | (t.lookup(idx[1]) << 8) | (t.lookup(idx[2]) << bShift);
+    }
+}
+#endif
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+
+// Dua pixel per register (r g b a | r g b a). Lookup lewat gather, lane alpha tidak memakai
+// tabel: hasilnya sama persis dengan versi skalar
+Z_TARGET_AVX2 inline __m256i linearToSrgbPair(const SrgbTables& t, __m256 v, __m256i order) {
+    const __m256 hi = _mm256_set1_ps(1.0f);
+    __m256i bits = _mm256_castps_si256(_mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(1.0f / 8192.0f)), hi));
+    __m256i slot = _mm256_srli_epi32(_mm256_sub_epi32(bits, _mm256_set1_epi32(static_cast<int>(SrgbTables::MIN_BITS))), SrgbTables::SHIFT);
+    __m256i e = _mm256_i32gather_epi32(reinterpret_cast<const int*>(t.toSrgb), slot, 4);
+    // (e & 0xFF) + (offset >= e >> 8): cmpgt bernilai -1 kalau kode belum naik
+    __m256i code = _mm256_add_epi32(_mm256_add_epi32(_mm256_and_si256(e, _mm256_set1_epi32(0xFF)), _mm256_set1_epi32(1)),
+                                    _mm256_cmpgt_epi32(_mm256_srli_epi32(e, 8), _mm256_and_si256(bits, _mm256_set1_epi32(SrgbTables::OFFSET_MASK))));
+    __m256 alpha = _mm256_add_ps(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(v, _mm256_setzero_ps()), hi), _mm256_set1_ps(255.0f)), _mm256_set1_ps(0.5f));
+    return _mm256_permutevar8x32_epi32(_mm256_blend_epi32(code, _mm256_cvttps_epi32(alpha), 0x88), order);
+}
+
+Z_TARGET_AVX2 inline void linearToSrgbSpanAvx(const Color<float>* colors, uint32_t* out, size_t count, int rShift, int bShift) {
+    const SrgbTables& t = srgbTables();
+    // Urutan byte keluaran per pixel: B,G,R,A (PackedColor) atau R,G,B,A
+    const __m256i order = rShift == 16 ? _mm256_setr_epi32(2, 1, 0, 3, 6, 5, 4, 7) : _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    // Setelah dua kali pack: dword 0, 4, 1, 5 = pixel 0, 1, 2, 3
+    const __m256i gather = _mm256_setr_epi32(0, 4, 1, 5, 0, 4, 1, 5);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i a = linearToSrgbPair(t, _mm256_loadu_ps(&colors[i].r), order);
+        __m256i b = linearToSrgbPair(t, _mm256_loadu_ps(&colors[i + 2].r), order);
+        __m256i words = _mm256_packus_epi32(a, b);
+        __m256i packed = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(words, words), gather);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_castsi256_si128(packed));
+    }
+    linearToSrgbSpanScalar(colors + i, out + i, count - i, rShift, bShift);
+}
+
+// Dua pixel: byte -> index r,g,b,a (order), gather kurva sRGB, lane alpha a / 255 seperti skalar
+Z_TARGET_AVX2 inline __m256 srgbToLinearPair(const SrgbTables& t, const uint32_t* src, __m256i order) {
+    __m256i idx = _mm256_permutevar8x32_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))), order);
+    return _mm256_blend_ps(_mm256_i32gather_ps(t.toLinear, idx, 4), _mm256_mul_ps(_mm256_cvtepi32_ps(idx), _mm256_set1_ps(1.0f / 255.0f)), 0x88);
+}
+
+Z_TARGET_AVX2 inline void srgbToLinearSpanAvx(const uint32_t* colors, Color<float>* out, size_t count, int rShift, int bShift) {
+    const SrgbTables& t = srgbTables();
+    // Byte di memori B,G,R,A (PackedColor) atau R,G,B,A
+    const __m256i order = rShift == 16 ? _mm256_setr_epi32(2, 1, 0, 3, 6, 5, 4, 7) : _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256 a = srgbToLinearPair(t, colors + i, order), b = srgbToLinearPair(t, colors + i + 2, order);
+        _mm256_storeu_ps(&out[i].r, a);
+        _mm256_storeu_ps(&out[i + 2].r, b);
+    }
+    srgbToLinearSpanScalar(colors + i, out + i, count - i, rShift, bShift);
+}
+
+#endif // Z_SIMD_AVX2
+
+inline void linearToSrgbSpan(const Color<float>* colors, uint32_t* out, size_t count, int rShift, int bShift) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: linearToSrgbSpanAvx(colors, out, count, rShift, bShift); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: linearToSrgbSpanSse(colors, out, count, rShift, bShift); return;
+#endif
+        default: linearToSrgbSpanScalar(colors, out, count, rShift, bShift); return;
+    }
+}
+
+// SSE2 tidak punya gather, jadi di bawah AVX2 tetap skalar (load tabel per channel)
+inline void srgbToLinearSpan(const uint32_t* colors, Color<float>* out, size_t count, int rShift, int bShift) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+    if (simd::level() == simd::Level::AVX2) {
+        srgbToLinearSpanAvx(colors, out, count, rShift, bShift);
+        return;
+    }
+#endif
+    srgbToLinearSpanScalar(colors, out, count, rShift, bShift);
+}
+
+} // namespace detail
+
+static_assert(sizeof(Color<float>) == 4 * sizeof(float), "kernel sRGB mengandalkan Color<float> 4 float berurutan");
+
+inline void linearToSrgb(const Color<float>* colors, PackedColor* out, size_t count) {
+    detail::linearToSrgbSpan(colors, reinterpret_cast<uint32_t*>(out), count, 16, 0);
+}
+
+inline void linearToSrgb(const Color<float>* colors, Color<unsigned char>* out, size_t count) {
+    detail::linearToSrgbSpan(colors, reinterpret_cast<uint32_t*>(out), count, 0, 16);
+}
+
+inline void srgbToLinear(const PackedColor* colors, Color<float>* out, size_t count) {
+    detail::srgbToLinearSpan(reinterpret_cast<const uint32_t*>(colors), out, count, 16, 0);
+}
+
+inline void srgbToLinear(const Color<unsigned char>* colors, Color<float>* out, size_t count) {
+    detail::srgbToLinearSpan(reinterpret_cast<const uint32_t*>(colors), out, count, 0, 16);
+}
+
+// ===== PREMULTIPLIED ALPHA =====
+
+// rgb = round(rgb * a / 255), alpha tetap
+inline void premultiply(const PackedColor* colors, PackedColor* out, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgbMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaLane = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);     // alpha * 255 / 255 = alpha
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        // Broadcast alpha (lane 3 dan 7) ke channel rgb pixel-nya
+        __m128i alo = _mm_or_si128(_mm_and_si128(_mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xFF), 0xFF), rgbMask), alphaLane);
+        __m128i ahi = _mm_or_si128(_mm_and_si128(_mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xFF), 0xFF), rgbMask), alphaLane);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_packus_epi16(detail::mulDiv255(lo, alo), detail::mulDiv255(hi, ahi)));
+    }
+#endif
+    for (; i < count; i++) {
+        uint8_t a = colors[i].a();
+        out[i] = (colors[i] * PackedColor(a, a, a, 255));
+    }
+}
+
+// rgb = min(255, round(rgb * 255 / a)), a == 0 -> hitam transparan
+inline void unpremultiply(const PackedColor* colors, PackedColor* out, size_t count) {
+    // Reciprocal 16.16 per alpha, jadi pembagian menjadi perkalian. high/low: bagian bulat dan
+    // pecahan k untuk 4 lane 16-bit satu pixel (B, G, R, lalu A dikali 1.0 supaya tetap)
+    static const struct Reciprocal {
+        uint32_t value[256];
+        uint64_t high[256];
+        uint64_t low[256];
+        Reciprocal() {
+            for (uint32_t a = 0; a < 256; a++) {
+                value[a] = a ? (255u * 65536u + a / 2) / a : 0;
+                uint64_t kh = value[a] >> 16, kl = value[a] & 0xFFFF;
+                high[a] = kh | (kh << 16) | (kh << 32) | (1ull << 48);
+                low[a] = kl | (kl << 16) | (kl << 32);
+            }
+        }
+    } recip;
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i limit = _mm_set1_epi16(255);
+    // (c * k + 32768) >> 16 = c * kh + hi16(c * kl) + bit 15 dari lo16(c * kl), lalu min 255
+    auto scale = [&](__m128i c, __m128i kh, __m128i kl) {
+        __m128i frac = _mm_add_epi16(_mm_mulhi_epu16(c, kl), _mm_srli_epi16(_mm_mullo_epi16(c, kl), 15));
+        __m128i v = _mm_add_epi16(_mm_mullo_epi16(c, kh), frac);
+        return _mm_sub_epi16(v, _mm_subs_epu16(v, limit));
+    };
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i));
+        const uint32_t a0 = colors[i].value >> 24, a1 = colors[i + 1].value >> 24;
+        const uint32_t a2 = colors[i + 2].value >> 24, a3 = colors[i + 3].value >> 24;
+        __m128i lo = scale(_mm_unpacklo_epi8(v, zero), _mm_set_epi64x(static_cast<long long>(recip.high[a1]), static_cast<long long>(recip.high[a0])),
+                           _mm_set_epi64x(static_cast<long long>(recip.low[a1]), static_cast<long long>(recip.low[a0])));
+        __m128i hi = scale(_mm_unpackhi_epi8(v, zero), _mm_set_epi64x(static_cast<long long>(recip.high[a3]), static_cast<long long>(recip.high[a2])),
+                           _mm_set_epi64x(static_cast<long long>(recip.low[a3]), static_cast<long long>(recip.low[a2])));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < count; i++) {
+        uint32_t v = colors[i].value;
+        uint32_t a = v >> 24;
+        uint32_t k = recip.value[a];
+        uint32_t r = std::min((((v >> 16) & 0xFF) * k + 32768) >> 16, 255u);
+        uint32_t g = std::min((((v >> 8) & 0xFF) * k + 32768) >> 16, 255u);
+        uint32_t b = std::min(((v & 0xFF) * k + 32768) >> 16, 255u);
+        out[i].value = (a << 24) | (r << 16) | (g << 8) | b;
+    }
+}
+
+inline void premultiply(const Color<float>* colors, Color<float>* out, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128 alphaOne = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    for (; i < count; i++) {
+        __m128 v = _mm_loadu_ps(&colors[i].r);
+        __m128 a = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+        // rgb * a, alpha tetap
+        __m128 m = _mm_or_ps(_mm_andnot_ps(alphaOne, _mm_mul_ps(v, a)), _mm_and_ps(alphaOne, v));
+        _mm_storeu_ps(&out[i].r, m);
+    }
+#endif
+    for (; i < count; i++) {
+        float a = colors[i].a;
+        out[i].r = colors[i].r * a;
+        out[i].g = colors[i].g * a;
+        out[i].b = colors[i].b * a;
+        out[i].a = a;
+    }
+}
+
+inline void unpremultiply(const Color<float>* colors, Color<float>* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float a = colors[i].a;
+        float inv = a > 0.0f ? 1.0f / a : 0.0f;
+        out[i].r = std::min(colors[i].r * inv, 1.0f);
+        out[i].g = std::min(colors[i].g * inv, 1.0f);
+        out[i].b = std::min(colors[i].b * inv, 1.0f);
+        out[i].a = a;
+    }
+}
+
+} // namespace z
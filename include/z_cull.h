@@ -0,0 +1,127 @@
+#pragma once
+#include "z_platform.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "z_unit.h"
+
+#if Z_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace z {
+
+// Kumpulan rect dalam bentuk structure-of-arrays (left, top, right, bottom),
+// untuk culling ribuan widget sekaligus. Right/bottom disimpan langsung supaya
+// tes overlap cukup empat perbandingan per rect tanpa penjumlahan.
+class RectArray {
+public:
+    RectArray() = default;
+    explicit RectArray(size_t capacity) { reserve(capacity); }
+
+    void reserve(size_t capacity) {
+        m_left.reserve(capacity);
+        m_top.reserve(capacity);
+        m_right.reserve(capacity);
+        m_bottom.reserve(capacity);
+    }
+
+    void clear() {
+        m_left.clear();
+        m_top.clear();
+        m_right.clear();
+        m_bottom.clear();
+    }
+
+    size_t size() const { return m_left.size(); }
+    bool empty() const { return m_left.empty(); }
+
+    // Return index rect yang baru ditambahkan
+    uint32_t add(Rect<int> rect) {
+        m_left.push_back(rect.x);
+        m_top.push_back(rect.y);
+        m_right.push_back(rect.x + rect.w);
+        m_bottom.push_back(rect.y + rect.h);
+        return static_cast<uint32_t>(m_left.size() - 1);
+    }
+
+    void set(size_t index, Rect<int> rect) {
+        m_left[index] = rect.x;
+        m_top[index] = rect.y;
+        m_right[index] = rect.x + rect.w;
+        m_bottom[index] = rect.y + rect.h;
+    }
+
+    Rect<int> get(size_t index) const {
+        return Rect<int>(m_left[index], m_top[index], m_right[index] - m_left[index], m_bottom[index] - m_top[index]);
+    }
+
+    const int32_t* left() const { return m_left.data(); }
+    const int32_t* top() const { return m_top.data(); }
+    const int32_t* right() const { return m_right.data(); }
+    const int32_t* bottom() const { return m_bottom.data(); }
+
+private:
+    std::vector<int32_t> m_left;
+    std::vector<int32_t> m_top;
+    std::vector<int32_t> m_right;
+    std::vector<int32_t> m_bottom;
+};
+
+// Tulis index rect yang overlap dengan clip ke visible (urut naik), return jumlahnya.
+// visible harus muat rects.size() elemen. Rect kosong (w/h <= 0) tidak pernah terlihat,
+// aturan sama dengan Rect::overlaps.
+inline size_t cullRects(const RectArray& rects, Rect<int> clip, uint32_t* visible) {
+    const size_t count = rects.size();
+    if (clip.empty()) return 0;
+
+    const int32_t* l = rects.left();
+    const int32_t* t = rects.top();
+    const int32_t* r = rects.right();
+    const int32_t* b = rects.bottom();
+    const int32_t clipL = clip.x;
+    const int32_t clipT = clip.y;
+    const int32_t clipR = clip.right();
+    const int32_t clipB = clip.bottom();
+
+    size_t n = 0;
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i vl = _mm_set1_epi32(clipL);
+    const __m128i vt = _mm_set1_epi32(clipT);
+    const __m128i vr = _mm_set1_epi32(clipR);
+    const __m128i vb = _mm_set1_epi32(clipB);
+    for (; i + 4 <= count; i += 4) {
+        __m128i rl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l + i));
+        __m128i rt = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t + i));
+        __m128i rr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + i));
+        __m128i rb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        // left < clipR && right > clipL && top < clipB && bottom > clipT && right > left && bottom > top
+        __m128i m = _mm_and_si128(_mm_cmplt_epi32(rl, vr), _mm_cmpgt_epi32(rr, vl));
+        m = _mm_and_si128(m, _mm_and_si128(_mm_cmplt_epi32(rt, vb), _mm_cmpgt_epi32(rb, vt)));
+        m = _mm_and_si128(m, _mm_and_si128(_mm_cmpgt_epi32(rr, rl), _mm_cmpgt_epi32(rb, rt)));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(m));
+        if (mask == 0) continue;
+        // Kompaksi tanpa cabang: selalu tulis, maju hanya kalau terlihat
+        uint32_t base = static_cast<uint32_t>(i);
+        visible[n] = base;     n += mask & 1;
+        visible[n] = base + 1; n += (mask >> 1) & 1;
+        visible[n] = base + 2; n += (mask >> 2) & 1;
+        visible[n] = base + 3; n += (mask >> 3) & 1;
+    }
+#endif
+    for (; i < count; i++) {
+        bool hit = l[i] < clipR && r[i] > clipL && t[i] < clipB && b[i] > clipT && r[i] > l[i] && b[i] > t[i];
+        if (hit) visible[n++] = static_cast<uint32_t>(i);
+    }
+    return n;
+}
+
+inline size_t cullRects(const RectArray& rects, Rect<int> clip, std::vector<uint32_t>& visible) {
+    visible.resize(rects.size());
+    size_t n = cullRects(rects, clip, visible.data());
+    visible.resize(n);
+    return n;
+}
+
+} // namespace z
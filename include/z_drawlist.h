@@ -0,0 +1,151 @@
+#pragma once
+#include "z_platform.h"
+#include <vector>
+#include <cstdint>
+#include "z_unit.h"
+
+namespace z {
+
+// Rekaman perintah gambar satu frame.
+// API-nya mengikuti Canvas, tapi hanya menyimpan perintah; Canvas::draw(list)
+// yang mengeksekusinya. clear() mempertahankan kapasitas, jadi setelah
+// beberapa frame perekaman tidak alokasi lagi.
+class DrawList {
+public:
+    enum class Op : uint8_t {
+        Clear,
+        Pixel,
+        Line,
+        Rect,
+        Ellipse,
+        Polygon
+    };
+
+    // a,b,c,d: Line = x1,y1,x2,y2 | Rect = x,y,w,h | Ellipse = left,top,right,bottom
+    // Polygon: a = offset ke points(), b = jumlah titik
+    struct Command {
+        Op op;
+        bool hasFill;
+        bool hasStroke;
+        int a, b, c, d;
+        COLORREF fill;
+        COLORREF stroke;
+        int width;
+    };
+
+    void clear() {
+        m_commands.clear();
+        m_points.clear();
+    }
+
+    bool empty() const { return m_commands.empty(); }
+    size_t size() const { return m_commands.size(); }
+
+    const std::vector<Command>& commands() const { return m_commands; }
+    const std::vector<POINT>& points() const { return m_points; }
+
+    // ===== RECORDING =====
+
+    void clearColor(COLORREF color = RGB(0, 0, 0)) {
+        push(Op::Clear, 0, 0, 0, 0, color, 0, true, false, 0);
+    }
+
+    void drawPixel(int x, int y, COLORREF color = RGB(255, 255, 255)) {
+        push(Op::Pixel, x, y, 0, 0, color, 0, true, false, 1);
+    }
+
+    void drawLine(int x1, int y1, int x2, int y2, COLORREF color = RGB(255, 255, 255), int width = 1) {
+        push(Op::Line, x1, y1, x2, y2, 0, color, false, true, width);
+    }
+
+    void drawLine(Vec2<int> start, Vec2<int> end, COLORREF color = RGB(255, 255, 255), int width = 1) {
+        drawLine(start.x, start.y, end.x, end.y, color, width);
+    }
+
+    void drawRect(int x, int y, int width, int height, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
+        push(Op::Rect, x, y, width, height, 0, strokeColor, false, true, strokeWidth);
+    }
+
+    void fillRect(int x, int y, int width, int height, COLORREF fillColor = RGB(255, 255, 255)) {
+        push(Op::Rect, x, y, width, height, fillColor, 0, true, false, 1);
+    }
+
+    void fillRect(int x, int y, int width, int height, COLORREF fillColor, COLORREF strokeColor, int strokeWidth = 1) {
+        push(Op::Rect, x, y, width, height, fillColor, strokeColor, true, true, strokeWidth);
+    }
+
+    void fillRect(Rect<int> rect, COLORREF fillColor = RGB(255, 255, 255)) {
+        fillRect(rect.x, rect.y, rect.w, rect.h, fillColor);
+    }
+
+    void drawCircle(int centerX, int centerY, int radius, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
+        push(Op::Ellipse, centerX - radius, centerY - radius, centerX + radius, centerY + radius, 0, strokeColor, false, true, strokeWidth);
+    }
+
+    void fillCircle(int centerX, int centerY, int radius, COLORREF fillColor = RGB(255, 255, 255)) {
+        push(Op::Ellipse, centerX - radius, centerY - radius, centerX + radius, centerY + radius, fillColor, 0, true, false, 1);
+    }
+
+    void fillCircle(int centerX, int centerY, int radius, COLORREF fillColor, COLORREF strokeColor, int strokeWidth = 1) {
+        push(Op::Ellipse, centerX - radius, centerY - radius, centerX + radius, centerY + radius, fillColor, strokeColor, true, true, strokeWidth);
+    }
+
+    void drawEllipse(int centerX, int centerY, int radiusX, int radiusY, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
+        push(Op::Ellipse, centerX - radiusX, centerY - radiusY, centerX + radiusX, centerY + radiusY, 0, strokeColor, false, true, strokeWidth);
+    }
+
+    void fillEllipse(int centerX, int centerY, int radiusX, int radiusY, COLORREF fillColor = RGB(255, 255, 255)) {
+        push(Op::Ellipse, centerX - radiusX, centerY - radiusY, centerX + radiusX, centerY + radiusY, fillColor, 0, true, false, 1);
+    }
+
+    // Titik polygon disalin ke list, pemanggil boleh membuang array-nya
+    void drawPolygon(const POINT* points, int count, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
+        pushPolygon(points, count, 0, strokeColor, false, true, strokeWidth);
+    }
+
+    void drawPolygon(const Vec2<int>* points, int count, COLORREF strokeColor = RGB(255, 255, 255), int strokeWidth = 1) {
+        pushPolygon(points, count, 0, strokeColor, false, true, strokeWidth);
+    }
+
+    void fillPolygon(const POINT* points, int count, COLORREF fillColor = RGB(255, 255, 255)) {
+        pushPolygon(points, count, fillColor, 0, true, false, 1);
+    }
+
+    void fillPolygon(const Vec2<int>* points, int count, COLORREF fillColor = RGB(255, 255, 255)) {
+        pushPolygon(points, count, fillColor, 0, true, false, 1);
+    }
+
+private:
+    std::vector<Command> m_commands;
+    std::vector<POINT> m_points;
+
+    void push(Op op, int a, int b, int c, int d, COLORREF fill, COLORREF stroke, bool hasFill, bool hasStroke, int width) {
+        Command cmd;
+        cmd.op = op;
+        cmd.hasFill = hasFill;
+        cmd.hasStroke = hasStroke;
+        cmd.a = a;
+        cmd.b = b;
+        cmd.c = c;
+        cmd.d = d;
+        cmd.fill = fill;
+        cmd.stroke = stroke;
+        cmd.width = width;
+        m_commands.push_back(cmd);
+    }
+
+    template <typename P>
+    void pushPolygon(const P* points, int count, COLORREF fill, COLORREF stroke, bool hasFill, bool hasStroke, int width) {
+        if (count <= 0) return;
+        int offset = static_cast<int>(m_points.size());
+        for (int i = 0; i < count; i++) {
+            POINT p;
+            p.x = points[i].x;
+            p.y = points[i].y;
+            m_points.push_back(p);
+        }
+        push(Op::Polygon, offset, count, 0, 0, fill, stroke, hasFill, hasStroke, width);
+    }
+};
+
+} // namespace z
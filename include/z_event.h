@@ -1,6 +1,5 @@
 #pragma once
-#include <windows.h>
-#include <windowsx.h>
+#include "z_platform.h"
 #include "z_unit.h"
 
 namespace z {
@@ -13,7 +12,9 @@ enum class EventType {
     MouseMove,
     MouseDown,
     MouseUp,
-    Resize
+    Resize,
+    ResizeBegin,    // mulai drag border / move (WM_ENTERSIZEMOVE)
+    ResizeEnd       // drag selesai (WM_EXITSIZEMOVE)
 };
 
 enum class MouseButton {
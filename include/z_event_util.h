@@ -4,6 +4,7 @@
 
 namespace z {
 
+#if defined(_WIN32)
 // Fungsi konversi WinAPI ke Event
 inline Event translateWinEvent(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
     Event ev;
@@ -66,6 +67,14 @@ inline Event translateWinEvent(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
             ev.resize.height = HIWORD(lp);
             break;
 
+        case WM_ENTERSIZEMOVE:
+            ev.type = EventType::ResizeBegin;
+            break;
+
+        case WM_EXITSIZEMOVE:
+            ev.type = EventType::ResizeEnd;
+            break;
+
         default:
             ev.type = EventType::None;
             break;
@@ -73,6 +82,7 @@ inline Event translateWinEvent(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
 
     return ev;
 }
+#endif
 
 // Helper functions for working with Events and z_unit types
 inline Vec2<int> getEventPosition(const Event& event) {
@@ -0,0 +1,150 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <cassert>
+#include "z_unit.h"
+#include "z_surface.h"
+
+namespace z {
+
+enum class Connectivity {
+    Four,       // kiri/kanan/atas/bawah: dinding diagonal menahan fill
+    Eight       // juga diagonal
+};
+
+// ===== FLOOD FILL =====
+// Scanline berbasis span (Heckbert): setiap run pixel yang cocok di satu baris diisi
+// sekaligus, lalu satu segmen {baris berikut, rentang run} masuk stack. Stack eksplisit
+// di heap (dipakai ulang antar panggilan), jadi kedalaman tidak dibatasi stack thread.
+// Batas stack: segmen untuk satu baris + arah berasal dari run berbeda di baris tetangga
+// (setiap run diisi sekali, paling banyak dua rentang ke baris/arah yang sama), dan run
+// satu baris selalu dipisah pixel yang tidak cocok. Jadi segmen yang tertunda per baris per
+// arah saling lepas dan tidak bersebelahan: <= ceil(w / 2), total <= stackBound(clip).
+// Kapasitas tidak pernah tumbuh melewati batas itu.
+// Cocok = selisih R, G, B terbesar terhadap warna seed <= tolerance (alpha diabaikan).
+// Kalau warna fill sendiri cocok, pixel yang sudah diisi ditandai di mask supaya tidak diulang.
+
+class FloodFill {
+public:
+    // Mengembalikan jumlah pixel yang diisi; clip sudah dipotong ke surface oleh pemanggil
+    size_t fill(const Surface& surface, Rect<int> clip, Vec2<int> seed, Pixel color, int tolerance, Connectivity connectivity) {
+        if (!clip.contains(seed)) return 0;
+        const Pixel target = surface.at(seed.x, seed.y);
+        tolerance = std::max(tolerance, 0);
+        const bool exact = tolerance == 0;
+        const bool revisit = matches(color, target, tolerance);
+        if (exact && revisit) return 0;        // warna sama: tidak ada yang berubah
+
+        m_surface = surface;
+        m_clip = clip;
+        m_color = color;
+        m_eight = connectivity == Connectivity::Eight;
+        if (revisit) m_mask.assign(static_cast<size_t>(clip.w) * static_cast<size_t>(clip.h), 0);
+
+        // Predikat dipilih sekali: versi exact / tanpa mask tidak punya cabang tambahan di loop
+        if (exact)
+            return run<false>(seed, [target](Pixel p) { return ((p ^ target) & 0xFFFFFFu) == 0; });
+        auto near = [target, tolerance](Pixel p) { return matches(p, target, tolerance); };
+        return revisit ? run<true>(seed, near) : run<false>(seed, near);
+    }
+
+    // Kapasitas stack terbesar yang pernah dipakai (segmen)
+    size_t stackCapacity() const { return m_stack.capacity(); }
+
+    // Segmen tertunda paling banyak untuk clip ini: 2 arah x h baris x ceil(w / 2)
+    static size_t stackBound(Rect<int> clip) {
+        return 2 * static_cast<size_t>(std::max(clip.h, 0)) * ((static_cast<size_t>(std::max(clip.w, 0)) + 1) / 2);
+    }
+
+private:
+    // Baris y dipindai di kolom x1..x2 yang bertetangga dengan pixel terisi di baris y - dy
+    struct Segment {
+        int y, x1, x2, dy;
+    };
+
+    Surface m_surface;
+    Rect<int> m_clip;
+    Pixel m_color = 0;
+    bool m_eight = false;
+    std::vector<Segment> m_stack;
+    std::vector<uint8_t> m_mask;
+
+    static bool matches(Pixel p, Pixel target, int tolerance) {
+        for (int shift = 0; shift < 24; shift += 8) {
+            int delta = static_cast<int>((p >> shift) & 0xFF) - static_cast<int>((target >> shift) & 0xFF);
+            if (std::abs(delta) > tolerance) return false;
+        }
+        return true;
+    }
+
+    void push(int y, int x1, int x2, int dy) {
+        if (y < m_clip.y || y >= m_clip.bottom()) return;
+        // Tumbuh dua kali lipat seperti vector, tapi dipotong di stackBound(clip)
+        if (m_stack.size() == m_stack.capacity())
+            m_stack.reserve(std::min(std::max<size_t>(64, m_stack.capacity() * 2), stackBound(m_clip)));
+        assert(m_stack.size() < m_stack.capacity());
+        m_stack.push_back(Segment{y, x1, x2, dy});
+    }
+
+    template <bool useMask, typename Match>
+    size_t run(Vec2<int> seed, Match match) {
+        const int left = m_clip.x, right = m_clip.right() - 1;
+        size_t filled = 0;
+        Pixel* row = nullptr;
+        uint8_t* mask = nullptr;
+        auto select = [&](int y) {
+            row = m_surface.row(y);
+            if (useMask) mask = m_mask.data() + static_cast<size_t>(y - m_clip.y) * static_cast<size_t>(m_clip.w) - left;
+        };
+        auto inside = [&](int x) { return (!useMask || !mask[x]) && match(row[x]); };
+        auto paint = [&](int l, int r) {
+            std::fill(row + l, row + r + 1, m_color);
+            if (useMask) std::fill(mask + l, mask + r + 1, uint8_t(1));
+            filled += static_cast<size_t>(r - l + 1);
+        };
+
+        // Run seed diisi langsung, lalu kedua arah
+        select(seed.y);
+        int l = seed.x, r = seed.x;
+        while (l > left && inside(l - 1)) l--;
+        while (r < right && inside(r + 1)) r++;
+        paint(l, r);
+        m_stack.clear();
+        push(seed.y + 1, l, r, 1);
+        push(seed.y - 1, l, r, -1);
+
+        while (!m_stack.empty()) {
+            const Segment s = m_stack.back();
+            m_stack.pop_back();
+            select(s.y);
+            // 8 arah: diagonal di ujung rentang induk ikut bertetangga
+            const int x1 = m_eight ? std::max(s.x1 - 1, left) : s.x1;
+            const int x2 = m_eight ? std::min(s.x2 + 1, right) : s.x2;
+            int x = x1;
+            while (x <= x2) {
+                if (!inside(x)) {
+                    x++;
+                    continue;
+                }
+                // Run bisa melebar keluar rentang induk di kedua sisi
+                l = x;
+                if (x == x1)
+                    while (l > left && inside(l - 1)) l--;
+                r = x;
+                while (r < right && inside(r + 1)) r++;
+                paint(l, r);
+                push(s.y + s.dy, l, r, s.dy);
+                // Bagian run di luar rentang induk: baris induk di atasnya belum dipindai
+                if (l < s.x1) push(s.y - s.dy, l, s.x1 - 1, -s.dy);
+                if (r > s.x2) push(s.y - s.dy, s.x2 + 1, r, -s.dy);
+                x = r + 2;
+            }
+        }
+        return filled;
+    }
+};
+
+} // namespace z
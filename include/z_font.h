@@ -0,0 +1,267 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_image.h"
+#include "z_atlas.h"
+#include "z_cache.h"
+
+namespace z {
+
+namespace detail {
+
+// font8x8_basic (public domain, dari font BIOS IBM), ASCII 0x20..0x7E.
+// Satu byte per baris, bit 0 = pixel paling kiri.
+inline constexpr uint8_t builtinFont8x8[95][8] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },     // ' '
+    { 0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00 },     // '!'
+    { 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },     // '"'
+    { 0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00 },     // '#'
+    { 0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00 },     // '$'
+    { 0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00 },     // '%'
+    { 0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00 },     // '&'
+    { 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },     // '''
+    { 0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00 },     // '('
+    { 0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00 },     // ')'
+    { 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00 },     // '*'
+    { 0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00 },     // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06 },     // ','
+    { 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00 },     // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00 },     // '.'
+    { 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 },     // '/'
+    { 0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00 },     // '0'
+    { 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00 },     // '1'
+    { 0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00 },     // '2'
+    { 0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00 },     // '3'
+    { 0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00 },     // '4'
+    { 0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00 },     // '5'
+    { 0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00 },     // '6'
+    { 0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00 },     // '7'
+    { 0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00 },     // '8'
+    { 0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00 },     // '9'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00 },     // ':'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06 },     // ';'
+    { 0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00 },     // '<'
+    { 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00 },     // '='
+    { 0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00 },     // '>'
+    { 0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00 },     // '?'
+    { 0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00 },     // '@'
+    { 0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00 },     // 'A'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00 },     // 'B'
+    { 0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00 },     // 'C'
+    { 0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00 },     // 'D'
+    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00 },     // 'E'
+    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00 },     // 'F'
+    { 0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00 },     // 'G'
+    { 0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00 },     // 'H'
+    { 0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },     // 'I'
+    { 0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00 },     // 'J'
+    { 0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00 },     // 'K'
+    { 0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00 },     // 'L'
+    { 0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00 },     // 'M'
+    { 0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00 },     // 'N'
+    { 0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00 },     // 'O'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00 },     // 'P'
+    { 0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00 },     // 'Q'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00 },     // 'R'
+    { 0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00 },     // 'S'
+    { 0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },     // 'T'
+    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00 },     // 'U'
+    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 },     // 'V'
+    { 0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00 },     // 'W'
+    { 0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00 },     // 'X'
+    { 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00 },     // 'Y'
+    { 0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00 },     // 'Z'
+    { 0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00 },     // '['
+    { 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00 },     // '\'
+    { 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00 },     // ']'
+    { 0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00 },     // '^'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF },     // '_'
+    { 0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },     // '`'
+    { 0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00 },     // 'a'
+    { 0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00 },     // 'b'
+    { 0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00 },     // 'c'
+    { 0x38, 0x30, 0x30, 0x3E, 0x33, 0x33, 0x6E, 0x00 },     // 'd'
+    { 0x00, 0x00, 0x1E, 0x33, 0x3F, 0x03, 0x1E, 0x00 },     // 'e'
+    { 0x1C, 0x36, 0x06, 0x0F, 0x06, 0x06, 0x0F, 0x00 },     // 'f'
+    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F },     // 'g'
+    { 0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00 },     // 'h'
+    { 0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },     // 'i'
+    { 0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E },     // 'j'
+    { 0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00 },     // 'k'
+    { 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 },     // 'l'
+    { 0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00 },     // 'm'
+    { 0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00 },     // 'n'
+    { 0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00 },     // 'o'
+    { 0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F },     // 'p'
+    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78 },     // 'q'
+    { 0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00 },     // 'r'
+    { 0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00 },     // 's'
+    { 0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00 },     // 't'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00 },     // 'u'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 },     // 'v'
+    { 0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00 },     // 'w'
+    { 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00 },     // 'x'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F },     // 'y'
+    { 0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00 },     // 'z'
+    { 0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00 },     // '{'
+    { 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },     // '|'
+    { 0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00 },     // '}'
+    { 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },     // '~'
+};
+
+} // namespace detail
+
+struct Glyph {
+    Rect<int> region;       // di Font::atlas()
+    int advance = 0;
+};
+
+// Font bitmap yang di-rasterisasi sekali ke atlas glyph: coverage di alpha, rgb putih.
+// Teks dianggap UTF-8; karakter di luar ASCII cetak digambar sebagai '?'.
+// '\n' pindah baris, '\t' selebar 4 spasi.
+class Font {
+public:
+    static constexpr uint32_t firstChar = 0x20;
+    static constexpr uint32_t lastChar = 0x7E;
+
+    // Font 8x8 bawaan diperbesar scale kali, tanpa file eksternal
+    explicit Font(int scale = 1)
+        : m_atlas(128 * std::max(scale, 1), 128 * std::max(scale, 1), 1) {
+        scale = std::max(scale, 1);
+        const int size = 8 * scale;
+        Image cell(size, size);
+        for (uint32_t c = firstChar; c <= lastChar; c++) {
+            const uint8_t* rows = detail::builtinFont8x8[c - firstChar];
+            for (int y = 0; y < size; y++)
+                for (int x = 0; x < size; x++)
+                    cell.at(x, y) = (rows[y / scale] >> (x / scale)) & 1 ? makePixel(255, 255, 255, 255) : makePixel(255, 255, 255, 0);
+            m_glyphs[c - firstChar] = Glyph{ m_atlas.add(cell), size };
+        }
+        m_atlas.image().setBlendMode(BlendMode::Opaque);
+        m_lineHeight = size;
+    }
+
+    // Instance 8x8 bersama, dibuat saat pertama dipakai
+    static const Font& builtin() {
+        static const Font font(1);
+        return font;
+    }
+
+    const Glyph& glyph(uint32_t codepoint) const {
+        if (codepoint < firstChar || codepoint > lastChar) codepoint = '?';
+        return m_glyphs[codepoint - firstChar];
+    }
+
+    int lineHeight() const { return m_lineHeight; }
+    const Image& atlas() const { return m_atlas.image(); }
+
+    // Ukuran teks (lebar baris terpanjang x jumlah baris); teks kosong (0, 0)
+    Vec2<int> measure(std::string_view text) const {
+        if (text.empty()) return Vec2<int>();
+        int width = 0, lines = 1;
+        int x = 0;
+        layout(text, [&](const Glyph* glyph) {
+            if (!glyph) {
+                width = std::max(width, x);
+                x = 0;
+                lines++;
+            } else {
+                x += glyph->advance;
+            }
+        });
+        return Vec2<int>(std::max(width, x), lines * m_lineHeight);
+    }
+
+    // Seluruh teks sebagai satu mask coverage (lihat blitTinted)
+    Image render(std::string_view text) const {
+        Vec2<int> size = measure(text);
+        Image label(size.x, size.y);
+        Surface target = label.surface();
+        Vec2<int> pen;
+        layout(text, [&](const Glyph* glyph) {
+            if (!glyph) {
+                pen = Vec2<int>(0, pen.y + m_lineHeight);
+            } else {
+                blit(target, label.bounds(), m_atlas.image(), glyph->region, pen);
+                pen.x += glyph->advance;
+            }
+        });
+        return label;
+    }
+
+private:
+    TextureAtlas m_atlas;
+    Glyph m_glyphs[lastChar - firstChar + 1];
+    int m_lineHeight = 0;
+
+    // fn(glyph) per glyph, fn(nullptr) di setiap '\n'
+    template <typename Fn>
+    void layout(std::string_view text, Fn fn) const {
+        for (char ch : text) {
+            unsigned char c = static_cast<unsigned char>(ch);
+            if (c == '\n') {
+                fn(nullptr);
+            } else if (c == '\t') {
+                for (int i = 0; i < 4; i++) fn(&glyph(' '));
+            } else if ((c & 0xC0) != 0x80) {        // byte lanjutan UTF-8 tidak menambah glyph
+                fn(&glyph(c));
+            }
+        }
+    }
+};
+
+struct TextCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;          // label yang dirender ulang
+    size_t entries = 0;
+};
+
+// Label yang sudah dirender, dicari lewat hash teks: label statis cukup satu lookup per frame
+// tanpa alokasi. Entry disimpan di GenerationCache (dua generasi, LRU kasar tanpa list).
+class TextCache {
+public:
+    explicit TextCache(size_t capacity = 256) : m_cache(std::max<size_t>(capacity, 1)) {}
+
+    // Reference berlaku sampai get() / clear() berikutnya
+    const Image& get(const Font& font, std::string_view text) {
+        if (&font != m_font) {
+            clear();
+            m_font = &font;
+        }
+        const size_t key = std::hash<std::string_view>()(text);
+        if (Entry* cached = m_cache.find(key, [text](const Entry& entry) { return entry.text == text; })) {
+            m_stats.hits++;
+            m_stats.entries = m_cache.size();       // hit dari previous bisa memutar generasi
+            return cached->label;
+        }
+        m_stats.misses++;
+        // Hash sama dengan teks lain: ditimpa
+        Entry& slot = m_cache.insert(key, Entry{ std::string(text), font.render(text) });
+        m_stats.entries = m_cache.size();
+        return slot.label;
+    }
+
+    void clear() {
+        m_cache.clear();
+        m_stats.entries = 0;
+    }
+
+    const TextCacheStats& stats() const { return m_stats; }
+
+private:
+    struct Entry {
+        std::string text;
+        Image label;
+    };
+
+    const Font* m_font = nullptr;
+    GenerationCache<size_t, Entry> m_cache;
+    TextCacheStats m_stats;
+};
+
+} // namespace z
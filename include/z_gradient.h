@@ -0,0 +1,380 @@
+#pragma once
+#include "z_platform.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_image.h"
+#include "z_simd.h"
+#include "z_arena.h"
+#include "z_cache.h"
+
+namespace z {
+
+enum class GradientKind {
+    Linear,     // t = proyeksi ke garis start -> end
+    Radial      // t = jarak ke center / radius
+};
+
+// Perilaku t di luar [0, 1]
+enum class Spread {
+    Pad,        // warna stop ujung diteruskan
+    Repeat,
+    Reflect
+};
+
+struct GradientStop {
+    float offset;       // 0..1
+    Pixel color;
+};
+
+// Paint gradient multi-stop. Warna dibaca dari LUT 1024 entri yang dibangun ulang
+// setiap stop berubah; interpolasi antar stop per channel (alpha tidak premultiplied).
+// Dither (ordered 4x4) memakai LUT kedua dengan presisi 8.8 per channel.
+class Gradient {
+public:
+    static constexpr int lutBits = 10;
+    static constexpr int lutSize = 1 << lutBits;
+
+    // Geometri di koordinat user: ikut transform Canvas seperti shape yang di-fill
+    static Gradient linear(Vec2<float> start, Vec2<float> end, Pixel from, Pixel to) {
+        Gradient g(GradientKind::Linear);
+        float dx = end.x - start.x, dy = end.y - start.y;
+        float length2 = dx * dx + dy * dy;
+        if (length2 > 0.0f)
+            g.m_unit = Affine(dx / length2, 0.0f, dy / length2, 0.0f, -(start.x * dx + start.y * dy) / length2, 0.0f);
+        else
+            g.m_unit = Affine(0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f);     // titik: semua warna stop terakhir
+        g.addStop(0.0f, from);
+        g.addStop(1.0f, to);
+        return g;
+    }
+
+    static Gradient radial(Vec2<float> center, float radius, Pixel inner, Pixel outer) {
+        Gradient g(GradientKind::Radial);
+        float inv = radius > 0.0f ? 1.0f / radius : 0.0f;
+        g.m_unit = Affine(inv, 0.0f, 0.0f, inv, -center.x * inv, -center.y * inv);
+        if (!(radius > 0.0f))
+            g.m_unit.tx = 1.0f;
+        g.addStop(0.0f, inner);
+        g.addStop(1.0f, outer);
+        return g;
+    }
+
+    // Stop dengan offset sama disimpan berurutan (transisi tajam)
+    Gradient& addStop(float offset, Pixel color) {
+        offset = std::clamp(offset, 0.0f, 1.0f);
+        auto at = std::upper_bound(m_stops.begin(), m_stops.end(), offset, [](float o, const GradientStop& s) { return o < s.offset; });
+        m_stops.insert(at, GradientStop{offset, color});
+        buildLut();
+        return *this;
+    }
+
+    void clearStops(Pixel color) {
+        m_stops.assign(1, GradientStop{0.0f, color});
+        buildLut();
+    }
+
+    Gradient& setSpread(Spread spread) { m_spread = spread; return *this; }
+    Gradient& setDither(bool dither) { m_dither = dither; return *this; }
+
+    GradientKind kind() const { return m_kind; }
+    Spread spread() const { return m_spread; }
+    bool dither() const { return m_dither; }
+    bool opaque() const { return m_opaque; }
+    const std::vector<GradientStop>& stops() const { return m_stops; }
+
+    // Koordinat user -> ruang gradient (linear: t = u.x, radial: t = |u|)
+    const Affine& unitTransform() const { return m_unit; }
+
+    const Pixel* lut() const { return m_lut.data(); }
+    // Berubah setiap LUT dibangun ulang (addStop / clearStops): kunci cache turunan LUT
+    uint64_t id() const { return m_id; }
+    const uint16_t* lut16() const { return m_lut16.data(); }       // 4 channel B,G,R,A per entri, nilai * 256
+
+    // Warna di t (tanpa dither), sama dengan yang dipakai span
+    Pixel colorAt(float t) const;
+
+private:
+    explicit Gradient(GradientKind kind) : m_kind(kind), m_lut(lutSize), m_lut16(lutSize * 4) {}
+
+    void buildLut() {
+        m_id = detail::nextContentId();
+        m_opaque = true;
+        for (int i = 0; i < lutSize; i++) {
+            float t = (static_cast<float>(i) + 0.5f) / static_cast<float>(lutSize);
+            // Segmen pertama yang ujungnya >= t
+            size_t hi = 0;
+            while (hi < m_stops.size() && m_stops[hi].offset < t) hi++;
+            Pixel a, b;
+            float w = 0.0f;
+            if (hi == 0) {
+                a = b = m_stops.front().color;
+            } else if (hi == m_stops.size()) {
+                a = b = m_stops.back().color;
+            } else {
+                const GradientStop& s0 = m_stops[hi - 1];
+                const GradientStop& s1 = m_stops[hi];
+                a = s0.color;
+                b = s1.color;
+                w = (t - s0.offset) / (s1.offset - s0.offset);
+            }
+            Pixel packed = 0;
+            for (int c = 0; c < 4; c++) {
+                float value = static_cast<float>((a >> (c * 8)) & 0xFF) * (1.0f - w) + static_cast<float>((b >> (c * 8)) & 0xFF) * w;
+                value = std::clamp(value, 0.0f, 255.0f);
+                packed |= static_cast<Pixel>(std::nearbyint(value)) << (c * 8);
+                m_lut16[static_cast<size_t>(i) * 4 + c] = static_cast<uint16_t>(std::nearbyint(value * 256.0f));
+            }
+            m_lut[i] = packed;
+            m_opaque = m_opaque && (packed >> 24) == 255;
+        }
+    }
+
+    GradientKind m_kind;
+    Spread m_spread = Spread::Pad;
+    bool m_dither = false;
+    bool m_opaque = true;
+    Affine m_unit;
+    std::vector<GradientStop> m_stops;
+    std::vector<Pixel> m_lut;
+    std::vector<uint16_t> m_lut16;
+    uint64_t m_id = 0;
+};
+
+namespace detail {
+
+// ===== INDEX LUT =====
+// Pixel ke-k span: u = origin + k * step (float, urutan operasi sama di semua level),
+// t -> f = t * lutSize -> index sesuai spread. Hasil semua level identik.
+
+// Ambang Bayer 4x4 dalam satuan 1/256 (0..255), ditambahkan ke warna 8.8 sebelum >> 8
+inline constexpr uint16_t bayer4x4[4][4] = {
+    {   8, 136,  40, 168 },
+    { 200,  72, 232, 104 },
+    {  56, 184,  24, 152 },
+    { 248, 120, 216,  88 },
+};
+
+struct GradientRow {
+    const Gradient* gradient;
+    float ux, uy;           // u di tengah pixel pertama
+    float dux, duy;         // per pixel ke kanan
+    int x, y;               // posisi device pixel pertama (untuk dither)
+};
+
+// Semantik sama dengan _mm_max_ps / _mm_min_ps (NaN -> operand kedua)
+inline float maxps(float a, float b) { return a > b ? a : b; }
+inline float minps(float a, float b) { return a < b ? a : b; }
+
+inline int32_t lutIndex(float f, Spread spread) {
+    constexpr int32_t n = Gradient::lutSize;
+    if (spread == Spread::Pad)
+        return static_cast<int32_t>(minps(maxps(f, 0.0f), static_cast<float>(n - 1)));
+    f = minps(maxps(f, -1073741824.0f), 1073741824.0f);
+    int32_t i = static_cast<int32_t>(f);
+    if (static_cast<float>(i) > f) i--;                 // floor
+    if (spread == Spread::Repeat)
+        return i & (n - 1);
+    int32_t m = i & (2 * n - 1);
+    return (m & n) ? m ^ (2 * n - 1) : m;
+}
+
+inline float gradientT(const GradientRow& row, int k) {
+    float ux = row.ux + static_cast<float>(k) * row.dux;
+    if (row.gradient->kind() == GradientKind::Linear)
+        return ux;
+    float uy = row.uy + static_cast<float>(k) * row.duy;
+    return std::sqrt(ux * ux + uy * uy);
+}
+
+inline Pixel ditherEntry(const uint16_t* entry, uint16_t threshold) {
+    Pixel p = 0;
+    for (int c = 0; c < 4; c++)
+        p |= static_cast<Pixel>((entry[c] + threshold) >> 8) << (c * 8);
+    return p;
+}
+
+inline void gradientSpanScalar(const GradientRow& row, Pixel* out, int begin, int n) {
+    const Gradient& g = *row.gradient;
+    const float scale = static_cast<float>(Gradient::lutSize);
+    for (int k = begin; k < n; k++) {
+        int32_t index = lutIndex(gradientT(row, k) * scale, g.spread());
+        if (g.dither())
+            out[k] = ditherEntry(g.lut16() + static_cast<size_t>(index) * 4, bayer4x4[row.y & 3][(row.x + k) & 3]);
+        else
+            out[k] = g.lut()[index];
+    }
+}
+
+#if Z_HAS_SSE2
+
+// floor(f) untuk 4 lane, f sudah dijepit ke +-2^30
+inline __m128i floorQuad(__m128 f) {
+    __m128i i = _mm_cvttps_epi32(f);
+    return _mm_add_epi32(i, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(i), f)));
+}
+
+inline __m128i lutIndexQuad(__m128 f, Spread spread) {
+    constexpr int32_t n = Gradient::lutSize;
+    if (spread == Spread::Pad)
+        return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(f, _mm_setzero_ps()), _mm_set1_ps(static_cast<float>(n - 1))));
+    f = _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(-1073741824.0f)), _mm_set1_ps(1073741824.0f));
+    __m128i i = floorQuad(f);
+    if (spread == Spread::Repeat)
+        return _mm_and_si128(i, _mm_set1_epi32(n - 1));
+    __m128i m = _mm_and_si128(i, _mm_set1_epi32(2 * n - 1));
+    __m128i upper = _mm_cmpeq_epi32(_mm_and_si128(m, _mm_set1_epi32(n)), _mm_set1_epi32(n));
+    return _mm_xor_si128(m, _mm_and_si128(upper, _mm_set1_epi32(2 * n - 1)));
+}
+
+inline __m128 gradientTQuad(const GradientRow& row, __m128 k) {
+    __m128 ux = _mm_add_ps(_mm_set1_ps(row.ux), _mm_mul_ps(k, _mm_set1_ps(row.dux)));
+    if (row.gradient->kind() == GradientKind::Linear)
+        return ux;
+    __m128 uy = _mm_add_ps(_mm_set1_ps(row.uy), _mm_mul_ps(k, _mm_set1_ps(row.duy)));
+    return _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ux, ux), _mm_mul_ps(uy, uy)));
+}
+
+inline void gradientSpanSse(const GradientRow& row, Pixel* out, int n) {
+    const Gradient& g = *row.gradient;
+    const __m128 scale = _mm_set1_ps(static_cast<float>(Gradient::lutSize));
+    const Pixel* lut = g.lut();
+    const uint16_t* lut16 = g.lut16();
+
+    // Ambang dither per lane tetap untuk seluruh span (blok 4 pixel sejajar x & 3)
+    const uint16_t* bayer = bayer4x4[row.y & 3];
+    const __m128i t01 = _mm_unpacklo_epi64(_mm_set1_epi16(static_cast<short>(bayer[row.x & 3])), _mm_set1_epi16(static_cast<short>(bayer[(row.x + 1) & 3])));
+    const __m128i t23 = _mm_unpacklo_epi64(_mm_set1_epi16(static_cast<short>(bayer[(row.x + 2) & 3])), _mm_set1_epi16(static_cast<short>(bayer[(row.x + 3) & 3])));
+
+    __m128 k = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 four = _mm_set1_ps(4.0f);
+    alignas(16) int32_t index[4];
+    int i = 0;
+    for (; i + 4 <= n; i += 4, k = _mm_add_ps(k, four)) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(index), lutIndexQuad(_mm_mul_ps(gradientTQuad(row, k), scale), g.spread()));
+        __m128i color;
+        if (g.dither()) {
+            __m128i e01 = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut16 + static_cast<size_t>(index[0]) * 4)),
+                                             _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut16 + static_cast<size_t>(index[1]) * 4)));
+            __m128i e23 = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut16 + static_cast<size_t>(index[2]) * 4)),
+                                             _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lut16 + static_cast<size_t>(index[3]) * 4)));
+            // Maksimum 255 * 256 + 255 = 65535, tidak overflow
+            e01 = _mm_srli_epi16(_mm_add_epi16(e01, t01), 8);
+            e23 = _mm_srli_epi16(_mm_add_epi16(e23, t23), 8);
+            color = _mm_packus_epi16(e01, e23);
+        } else {
+            color = _mm_setr_epi32(static_cast<int>(lut[index[0]]), static_cast<int>(lut[index[1]]),
+                                   static_cast<int>(lut[index[2]]), static_cast<int>(lut[index[3]]));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), color);
+    }
+    gradientSpanScalar(row, out, i, n);
+}
+
+#endif // Z_HAS_SSE2
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+
+// 8 index per langkah dan gather langsung dari LUT; dither lewat jalur SSE2
+Z_TARGET_AVX2 inline void gradientSpanAvx(const GradientRow& row, Pixel* out, int n) {
+    const Gradient& g = *row.gradient;
+    constexpr int32_t size = Gradient::lutSize;
+    const __m256 scale = _mm256_set1_ps(static_cast<float>(size));
+    const __m256 ux0 = _mm256_set1_ps(row.ux), dux = _mm256_set1_ps(row.dux);
+    const __m256 uy0 = _mm256_set1_ps(row.uy), duy = _mm256_set1_ps(row.duy);
+    const bool radial = g.kind() == GradientKind::Radial;
+    const int* lut = reinterpret_cast<const int*>(g.lut());
+
+    __m256 k = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    const __m256 eight = _mm256_set1_ps(8.0f);
+    int i = 0;
+    for (; i + 8 <= n; i += 8, k = _mm256_add_ps(k, eight)) {
+        // mul lalu add terpisah (bukan FMA) supaya sama dengan skalar
+        __m256 t = _mm256_add_ps(ux0, _mm256_mul_ps(k, dux));
+        if (radial) {
+            __m256 uy = _mm256_add_ps(uy0, _mm256_mul_ps(k, duy));
+            __m256 xx = _mm256_mul_ps(t, t), yy = _mm256_mul_ps(uy, uy);
+            t = _mm256_sqrt_ps(_mm256_add_ps(xx, yy));
+        }
+        __m256 f = _mm256_mul_ps(t, scale);
+        __m256i index;
+        if (g.spread() == Spread::Pad) {
+            index = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(f, _mm256_setzero_ps()), _mm256_set1_ps(static_cast<float>(size - 1))));
+        } else {
+            f = _mm256_min_ps(_mm256_max_ps(f, _mm256_set1_ps(-1073741824.0f)), _mm256_set1_ps(1073741824.0f));
+            __m256i fl = _mm256_cvttps_epi32(f);
+            fl = _mm256_add_epi32(fl, _mm256_castps_si256(_mm256_cmp_ps(_mm256_cvtepi32_ps(fl), f, _CMP_GT_OQ)));
+            if (g.spread() == Spread::Repeat) {
+                index = _mm256_and_si256(fl, _mm256_set1_epi32(size - 1));
+            } else {
+                __m256i m = _mm256_and_si256(fl, _mm256_set1_epi32(2 * size - 1));
+                __m256i upper = _mm256_cmpeq_epi32(_mm256_and_si256(m, _mm256_set1_epi32(size)), _mm256_set1_epi32(size));
+                index = _mm256_xor_si256(m, _mm256_and_si256(upper, _mm256_set1_epi32(2 * size - 1)));
+            }
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi32(lut, index, 4));
+    }
+    gradientSpanScalar(row, out, i, n);
+}
+
+#endif // Z_SIMD_AVX2
+
+inline void gradientSpan(const GradientRow& row, Pixel* out, int n) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2:
+            if (!row.gradient->dither()) {
+                gradientSpanAvx(row, out, n);
+                return;
+            }
+            gradientSpanSse(row, out, n);
+            return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: gradientSpanSse(row, out, n); return;
+#endif
+        default: gradientSpanScalar(row, out, 0, n); return;
+    }
+}
+
+} // namespace detail
+
+inline Pixel Gradient::colorAt(float t) const {
+    return m_lut[detail::lutIndex(t * static_cast<float>(lutSize), m_spread)];
+}
+
+// Callback span untuk Raster: isi [x0, x1) dengan gradient. deviceToUser = invers
+// transform Canvas. Gradient yang tidak opaque di-blend lewat buffer scratch (blitAlpha).
+class GradientSpan {
+public:
+    GradientSpan(const Surface& target, const Gradient& gradient, const Affine& deviceToUser, FrameArena& arena)
+        : m_target(target), m_gradient(gradient), m_toUnit(gradient.unitTransform() * deviceToUser) {
+        if (!gradient.opaque())
+            m_scratch = arena.allocateArray<Pixel>(static_cast<size_t>(std::max(target.width, 0)));
+    }
+
+    void operator()(int y, int x0, int x1) const {
+        // Tengah pixel pertama; langkah per pixel = kolom x transform
+        Vec2<float> u = m_toUnit * Vec2<float>(static_cast<float>(x0) + 0.5f, static_cast<float>(y) + 0.5f);
+        detail::GradientRow row{ &m_gradient, u.x, u.y, m_toUnit.a, m_toUnit.b, x0, y };
+        Pixel* dst = m_target.row(y) + x0;
+        if (m_scratch) {
+            detail::gradientSpan(row, m_scratch, x1 - x0);
+            blitAlpha(m_scratch, dst, static_cast<size_t>(x1 - x0));
+        } else {
+            detail::gradientSpan(row, dst, x1 - x0);
+        }
+    }
+
+private:
+    Surface m_target;
+    const Gradient& m_gradient;
+    Affine m_toUnit;
+    Pixel* m_scratch = nullptr;
+};
+
+} // namespace z
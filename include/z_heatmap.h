@@ -0,0 +1,346 @@
+#pragma once
+#include "z_platform.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_image.h"
+#include "z_simd.h"
+#include "z_jobs.h"
+#include "z_gradient.h"
+
+#if Z_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace z {
+
+// Pemetaan count -> posisi di palette
+enum class HeatScale {
+    Linear,     // t = count / max
+    Sqrt,
+    Log         // t = log(1 + count) / log(1 + max): titik jarang tetap terlihat
+};
+
+namespace detail {
+
+// ===== BINNING =====
+// Titik -> index count (y * width + x) pixel terdekat setelah transform m, .5 ke genap:
+// sama dengan pixel yang dinyalakan drawPixels(Vec2<float>). Titik di luar buffer (juga NaN)
+// diarahkan ke slot buang di index width * height, jadi loop increment tanpa cabang.
+// Urutan operasi transform sama dengan simd::transform; AVX2 (FMA) bisa beda 1 ulp.
+
+inline void heatBinScalar(const float* p, size_t n, const Affine& m, int width, int height, uint32_t* counts) {
+    const uint32_t trash = static_cast<uint32_t>(width) * static_cast<uint32_t>(height);
+    for (size_t i = 0; i < n; i++) {
+        float x = p[2 * i], y = p[2 * i + 1];
+        float fx = std::nearbyint(m.a * x + m.c * y + m.tx);
+        float fy = std::nearbyint(m.d * y + m.b * x + m.ty);
+        bool inside = fx >= 0.0f && fx < static_cast<float>(width) && fy >= 0.0f && fy < static_cast<float>(height);
+        counts[inside ? static_cast<uint32_t>(fy) * static_cast<uint32_t>(width) + static_cast<uint32_t>(fx) : trash]++;
+    }
+}
+
+#if Z_HAS_SSE2
+
+// mullo_epi32 belum ada di SSE2: dua mul_epu32 (lane genap / ganjil) lalu disusun ulang
+inline __m128i heatMulLo(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// Empat titik per iterasi: x/y dipisah, transform, cvtps (nearest), cek batas di integer
+// (NaN / di luar jangkauan int jadi 0x80000000 = negatif), index dipilih tanpa cabang
+inline void heatBinSse(const float* p, size_t n, const Affine& m, int width, int height, uint32_t* counts) {
+    const __m128 a = _mm_set1_ps(m.a), b = _mm_set1_ps(m.b), c = _mm_set1_ps(m.c), d = _mm_set1_ps(m.d);
+    const __m128 tx = _mm_set1_ps(m.tx), ty = _mm_set1_ps(m.ty);
+    const __m128i w = _mm_set1_epi32(width), h = _mm_set1_epi32(height), minusOne = _mm_set1_epi32(-1);
+    const __m128i trash = _mm_set1_epi32(width * height);
+    alignas(16) uint32_t index[4];
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 v0 = _mm_loadu_ps(p + 2 * i), v1 = _mm_loadu_ps(p + 2 * i + 4);
+        __m128 xs = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 ys = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        __m128i xi = _mm_cvtps_epi32(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, xs), _mm_mul_ps(c, ys)), tx));
+        __m128i yi = _mm_cvtps_epi32(_mm_add_ps(_mm_add_ps(_mm_mul_ps(d, ys), _mm_mul_ps(b, xs)), ty));
+        __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(xi, minusOne), _mm_cmpgt_epi32(w, xi)),
+                                       _mm_and_si128(_mm_cmpgt_epi32(yi, minusOne), _mm_cmpgt_epi32(h, yi)));
+        __m128i idx = _mm_add_epi32(heatMulLo(yi, w), xi);
+        idx = _mm_or_si128(_mm_and_si128(inside, idx), _mm_andnot_si128(inside, trash));
+        _mm_store_si128(reinterpret_cast<__m128i*>(index), idx);
+        counts[index[0]]++;
+        counts[index[1]]++;
+        counts[index[2]]++;
+        counts[index[3]]++;
+    }
+    heatBinScalar(p + 2 * i, n - i, m, width, height, counts);
+}
+
+#endif
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+
+// Delapan titik per iterasi. shuffle_ps bekerja per lane 128-bit sehingga urutan titik
+// teracak (x0 x1 x4 x5 | x2 x3 x6 x7), tapi sama untuk x dan y: hasil count tidak berubah
+Z_TARGET_AVX2 inline void heatBinAvx(const float* p, size_t n, const Affine& m, int width, int height, uint32_t* counts) {
+    const __m256 a = _mm256_set1_ps(m.a), b = _mm256_set1_ps(m.b), c = _mm256_set1_ps(m.c), d = _mm256_set1_ps(m.d);
+    const __m256 tx = _mm256_set1_ps(m.tx), ty = _mm256_set1_ps(m.ty);
+    const __m256i w = _mm256_set1_epi32(width), h = _mm256_set1_epi32(height), minusOne = _mm256_set1_epi32(-1);
+    const __m256i trash = _mm256_set1_epi32(width * height);
+    alignas(32) uint32_t index[8];
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v0 = _mm256_loadu_ps(p + 2 * i), v1 = _mm256_loadu_ps(p + 2 * i + 8);
+        __m256 xs = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 ys = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256i xi = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, xs), _mm256_mul_ps(c, ys)), tx));
+        __m256i yi = _mm256_cvtps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(d, ys), _mm256_mul_ps(b, xs)), ty));
+        __m256i inside = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(xi, minusOne), _mm256_cmpgt_epi32(w, xi)),
+                                          _mm256_and_si256(_mm256_cmpgt_epi32(yi, minusOne), _mm256_cmpgt_epi32(h, yi)));
+        __m256i idx = _mm256_blendv_epi8(trash, _mm256_add_epi32(_mm256_mullo_epi32(yi, w), xi), inside);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(index), idx);
+        for (int k = 0; k < 8; k++)
+            counts[index[k]]++;
+    }
+    heatBinScalar(p + 2 * i, n - i, m, width, height, counts);
+}
+
+#endif
+
+inline void heatBin(const float* p, size_t n, const Affine& m, int width, int height, uint32_t* counts) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: heatBinAvx(p, n, m, width, height, counts); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: heatBinSse(p, n, m, width, height, counts); return;
+#endif
+        default: heatBinScalar(p, n, m, width, height, counts); return;
+    }
+}
+
+// ===== REDUKSI =====
+// dst += src lalu src dinolkan: buffer per partisi langsung siap dipakai lagi
+
+inline void heatReduceScalar(uint32_t* dst, uint32_t* src, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] += src[i];
+        src[i] = 0;
+    }
+}
+
+#if Z_HAS_SSE2
+inline void heatReduceSse(uint32_t* dst, uint32_t* src, size_t n) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i* d = reinterpret_cast<__m128i*>(dst + i);
+        __m128i* s = reinterpret_cast<__m128i*>(src + i);
+        _mm_storeu_si128(d, _mm_add_epi32(_mm_loadu_si128(d), _mm_loadu_si128(s)));
+        _mm_storeu_si128(s, zero);
+    }
+    heatReduceScalar(dst + i, src + i, n - i);
+}
+#endif
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+Z_TARGET_AVX2 inline void heatReduceAvx(uint32_t* dst, uint32_t* src, size_t n) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i* d = reinterpret_cast<__m256i*>(dst + i);
+        __m256i* s = reinterpret_cast<__m256i*>(src + i);
+        _mm256_storeu_si256(d, _mm256_add_epi32(_mm256_loadu_si256(d), _mm256_loadu_si256(s)));
+        _mm256_storeu_si256(s, zero);
+    }
+    heatReduceScalar(dst + i, src + i, n - i);
+}
+#endif
+
+inline void heatReduce(uint32_t* dst, uint32_t* src, size_t n) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: heatReduceAvx(dst, src, n); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: heatReduceSse(dst, src, n); return;
+#endif
+        default: heatReduceScalar(dst, src, n); return;
+    }
+}
+
+// Count -> index LUT palette; count di atas top memakai ujung palette
+inline int heatLutIndex(uint32_t count, double top, HeatScale scale) {
+    double c = std::min(static_cast<double>(count), top), t;
+    switch (scale) {
+        case HeatScale::Linear: t = c / top; break;
+        case HeatScale::Sqrt: t = std::sqrt(c / top); break;
+        default: t = std::log1p(c) / std::log1p(top); break;
+    }
+    return std::min(static_cast<int>(t * Gradient::lutSize), Gradient::lutSize - 1);
+}
+
+} // namespace detail
+
+// ===== HEATMAP =====
+// Buffer akumulasi count uint32 per pixel untuk scatter plot padat: setiap titik menambah
+// count pixel-nya, jadi kepadatan tetap terbaca (drawPixels hanya menimpa satu warna).
+// add() dengan Jobs membagi titik ke beberapa partisi, masing-masing dengan buffer sendiri
+// (tanpa atomic), lalu buffer partisi dijumlahkan per baris ke buffer utama.
+// Count wrap setelah 2^32 titik di satu pixel.
+
+class Heatmap {
+public:
+    // Titik minimal per partisi: di bawah ini biaya reduksi buffer lebih mahal dari binning
+    static constexpr size_t partitionPoints = 1 << 16;
+
+    Heatmap() = default;
+    Heatmap(int width, int height) { resize(width, height); }
+
+    // Isi dinolkan; buffer partisi dilepas
+    void resize(int width, int height) {
+        m_width = std::max(width, 0);
+        m_height = std::max(height, 0);
+        m_counts.assign(pixels() + 1, 0);
+        m_partials.clear();
+    }
+
+    void clear() {
+        std::fill(m_counts.begin(), m_counts.end(), 0u);
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+
+    // width * height count, baris rapat
+    const uint32_t* data() const { return m_counts.data(); }
+    uint32_t at(int x, int y) const { return m_counts[static_cast<size_t>(y) * static_cast<size_t>(m_width) + static_cast<size_t>(x)]; }
+
+    uint32_t maxCount() const {
+        return pixels() ? *std::max_element(m_counts.begin(), m_counts.begin() + static_cast<std::ptrdiff_t>(pixels())) : 0;
+    }
+
+    // Buffer utama + buffer partisi yang masih disimpan untuk add() berikutnya
+    size_t memoryBytes() const {
+        return (m_counts.capacity() + m_partials.size() * (pixels() + 1)) * sizeof(uint32_t);
+    }
+
+    // Tabel count -> Pixel untuk count 0..min(maxCount, 65535) yang dipakai toneMapHeat.
+    // Disimpan di heatmap dan hanya dibangun ulang kalau palette (Gradient::id()), scale, atau
+    // maxCount berubah; buffer-nya dipakai ulang. Mengubah cache, jadi seperti add(): jangan
+    // dipanggil bersamaan dari beberapa thread untuk heatmap yang sama.
+    const std::vector<Pixel>& prepareTone(const Gradient& palette, HeatScale scale, uint32_t maxCount) {
+        if (m_tone.builds != 0 && m_tone.palette == palette.id() && m_tone.scale == scale && m_tone.maxCount == maxCount)
+            return m_tone.table;
+        const Pixel* lut = palette.lut();
+        const double top = static_cast<double>(maxCount);
+        m_tone.table.resize(std::min<size_t>(maxCount, 65535) + 1);
+        m_tone.table[0] = 0;
+        for (size_t c = 1; c < m_tone.table.size(); c++)
+            m_tone.table[c] = lut[detail::heatLutIndex(static_cast<uint32_t>(c), top, scale)];
+        m_tone.palette = palette.id();
+        m_tone.scale = scale;
+        m_tone.maxCount = maxCount;
+        m_tone.builds++;
+        return m_tone.table;
+    }
+
+    // Berapa kali tabel tone map dibangun (cache miss)
+    size_t toneTableBuilds() const { return m_tone.builds; }
+
+    // Titik dipetakan lewat m ke pixel buffer; di luar buffer dibuang
+    void add(const Vec2<float>* points, size_t count, const Affine& m = Affine(), Jobs* jobs = nullptr) {
+        if (count == 0 || pixels() == 0) return;
+        const float* p = &points[0].x;
+        size_t parts = jobs ? std::min<size_t>(jobs->threadCount(), count / partitionPoints) : 1;
+        if (parts <= 1) {
+            detail::heatBin(p, count, m, m_width, m_height, m_counts.data());
+            return;
+        }
+
+        // Partisi 0 langsung ke buffer utama, sisanya ke buffer sendiri (sudah nol dari reduksi sebelumnya)
+        while (m_partials.size() < parts - 1)
+            m_partials.emplace_back(pixels() + 1, 0u);
+        jobs->parallelFor(0, parts, [&](size_t begin, size_t end) {
+            for (size_t part = begin; part < end; part++) {
+                size_t first = count * part / parts, last = count * (part + 1) / parts;
+                uint32_t* counts = part == 0 ? m_counts.data() : m_partials[part - 1].data();
+                detail::heatBin(p + 2 * first, last - first, m, m_width, m_height, counts);
+            }
+        }, 1);
+
+        // Reduksi per potongan baris: setiap thread membaca semua partisi untuk baris yang sama
+        const size_t rowPixels = static_cast<size_t>(m_width);
+        jobs->parallelFor(0, static_cast<size_t>(m_height), [&](size_t begin, size_t end) {
+            for (size_t k = 0; k + 1 < parts; k++)
+                detail::heatReduce(m_counts.data() + begin * rowPixels, m_partials[k].data() + begin * rowPixels, (end - begin) * rowPixels);
+        });
+        m_counts[pixels()] = 0;
+        for (size_t k = 0; k + 1 < parts; k++)
+            m_partials[k][pixels()] = 0;
+    }
+
+private:
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<uint32_t> m_counts{0u};                 // + 1 slot buang di akhir
+    std::vector<std::vector<uint32_t>> m_partials;
+
+    struct ToneTable {
+        uint64_t palette = 0;
+        HeatScale scale = HeatScale::Log;
+        uint32_t maxCount = 0;
+        size_t builds = 0;
+        std::vector<Pixel> table;
+    };
+    ToneTable m_tone;               // cache tone map, bukan isi heatmap
+
+    size_t pixels() const { return static_cast<size_t>(m_width) * static_cast<size_t>(m_height); }
+};
+
+// ===== TONE MAPPING =====
+// Count -> warna palette (LUT Gradient, t sesuai scale), digambar ke region surface
+// (koordinat heatmap = koordinat surface). Count 0 tidak menyentuh pixel; palette tidak
+// opaque di-blend. maxCount 0 = count terbesar di heatmap, count di atasnya memakai ujung palette.
+// Count kecil (mayoritas pixel) lewat tabel count -> Pixel milik heatmap (Heatmap::prepareTone,
+// dipakai ulang antar frame), sisanya dihitung langsung. Karena tabel itu bisa dibangun ulang,
+// heat tidak const: satu heatmap jangan di-map dari beberapa thread bersamaan.
+
+inline void toneMapHeat(Heatmap& heat, const Surface& surface, Rect<int> region, const Gradient& palette,
+                        HeatScale scale = HeatScale::Log, uint32_t maxCount = 0, Jobs* jobs = nullptr) {
+    region = region.intersect(Rect<int>(0, 0, std::min(heat.width(), surface.width), std::min(heat.height(), surface.height)));
+    if (region.w <= 0 || region.h <= 0) return;
+    if (maxCount == 0) maxCount = heat.maxCount();
+    if (maxCount == 0) return;
+
+    const double top = static_cast<double>(maxCount);
+    const Pixel* lut = palette.lut();
+    const Pixel* table = heat.prepareTone(palette, scale, maxCount).data();
+    const uint32_t tableMax = std::min<uint32_t>(maxCount, 65535);
+    const bool opaque = palette.opaque();
+
+    auto rows = [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; y++) {
+            const uint32_t* counts = heat.data() + (static_cast<size_t>(region.y) + y) * static_cast<size_t>(heat.width()) + static_cast<size_t>(region.x);
+            Pixel* out = surface.row(region.y + static_cast<int>(y)) + region.x;
+            for (int x = 0; x < region.w; x++) {
+                uint32_t count = counts[x];
+                if (count == 0) continue;
+                Pixel color = count <= tableMax ? table[count] : lut[detail::heatLutIndex(count, top, scale)];
+                out[x] = opaque ? color : blendPixel(color, out[x]);
+            }
+        }
+    };
+    const size_t h = static_cast<size_t>(region.h);
+    if (jobs && jobs->threadCount() > 1 && static_cast<size_t>(region.w) * h >= 128 * 1024)
+        jobs->parallelFor(0, h, rows);
+    else
+        rows(0, h);
+}
+
+} // namespace z
@@ -0,0 +1,264 @@
+#pragma once
+#include "z_platform.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_color.h"
+
+#if Z_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace z {
+
+// Cara image digabung ke target saat di-blit
+enum class BlendMode {
+    Opaque,     // salin apa adanya, alpha diabaikan
+    ColorKey,   // pixel yang rgb-nya sama dengan colorKey dilewati
+    Alpha       // source-over, alpha tidak premultiplied
+};
+
+// ===== SPAN KERNEL =====
+//
+// Satu baris count pixel dari src ke dst (tidak boleh tumpang tindih).
+// Jalur SSE2 4 pixel per iterasi, sisanya skalar dengan hasil identik.
+
+inline void blitOpaque(const Pixel* src, Pixel* dst, size_t count) {
+    std::memcpy(dst, src, count * sizeof(Pixel));
+}
+
+inline void blitColorKey(const Pixel* src, Pixel* dst, size_t count, Pixel key) {
+    const Pixel rgbKey = key & 0x00FFFFFFu;
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i vkey = _mm_set1_epi32(static_cast<int>(rgbKey));
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i skip = _mm_cmpeq_epi32(_mm_and_si128(s, rgbMask), vkey);
+        int mask = _mm_movemask_epi8(skip);
+        if (mask == 0xFFFF) continue;
+        if (mask == 0) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), s);
+            continue;
+        }
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(_mm_and_si128(skip, d), _mm_andnot_si128(skip, s)));
+    }
+#endif
+    for (; i < count; i++)
+        if ((src[i] & 0x00FFFFFFu) != rgbKey)
+            dst[i] = src[i];
+}
+
+// Per channel: round((s * a + d * (255 - a)) / 255); alpha hasil = a + d.a * (255 - a) / 255
+inline Pixel blendPixel(Pixel src, Pixel dst) {
+    const uint32_t a = src >> 24;
+    if (a == 255) return src;
+    if (a == 0) return dst;
+    const uint32_t inv = 255 - a;
+    const uint32_t s = src | 0xFF000000u;       // alpha diperlakukan sebagai 255 * a
+    Pixel out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t x = ((s >> shift) & 0xFF) * a + ((dst >> shift) & 0xFF) * inv + 128;
+        out |= ((x + (x >> 8)) >> 8) << shift;
+    }
+    return out;
+}
+
+#if Z_HAS_SSE2
+namespace detail {
+
+// blendPixel untuk 4 pixel sekaligus (tanpa jalan pintas alpha 0 / 255)
+inline __m128i blendQuad(__m128i s, __m128i d) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i c255 = _mm_set1_epi16(255);
+    __m128i s2 = _mm_or_si128(s, opaque);
+    __m128i slo = _mm_unpacklo_epi8(s2, zero), shi = _mm_unpackhi_epi8(s2, zero);
+    __m128i dlo = _mm_unpacklo_epi8(d, zero), dhi = _mm_unpackhi_epi8(d, zero);
+    // Broadcast alpha asli (lane 3 dan 7) ke keempat channel pixel-nya
+    __m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_unpacklo_epi8(s, zero), 0xFF), 0xFF);
+    __m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_unpackhi_epi8(s, zero), 0xFF), 0xFF);
+    // Maksimum 255 * 255 + 128, muat di lane 16-bit unsigned
+    __m128i xlo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(slo, alo), _mm_mullo_epi16(dlo, _mm_sub_epi16(c255, alo))), c128);
+    __m128i xhi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(shi, ahi), _mm_mullo_epi16(dhi, _mm_sub_epi16(c255, ahi))), c128);
+    xlo = _mm_srli_epi16(_mm_add_epi16(xlo, _mm_srli_epi16(xlo, 8)), 8);
+    xhi = _mm_srli_epi16(_mm_add_epi16(xhi, _mm_srli_epi16(xhi, 8)), 8);
+    return _mm_packus_epi16(xlo, xhi);
+}
+
+} // namespace detail
+#endif
+
+inline void blitAlpha(const Pixel* src, Pixel* dst, size_t count) {
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i alpha = _mm_and_si128(s, opaque);
+        // Empat pixel transparan / opaque penuh (umum di sprite): tanpa aritmatika
+        int clear = _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero));
+        if (clear == 0xFFFF) continue;
+        int solid = _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, opaque));
+        if (solid == 0xFFFF) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), s);
+            continue;
+        }
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), detail::blendQuad(s, d));
+    }
+#endif
+    for (; i < count; i++)
+        dst[i] = blendPixel(src[i], dst[i]);
+}
+
+// Alpha src sebagai coverage (mask glyph): rgb dari color, alpha = round(coverage * color.a / 255),
+// lalu source-over seperti blitAlpha. rgb src diabaikan.
+inline void blitCoverage(const Pixel* src, Pixel* dst, size_t count, Pixel color) {
+    const Pixel rgb = color & 0x00FFFFFFu;
+    const uint32_t colorAlpha = color >> 24;
+    size_t i = 0;
+#if Z_HAS_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vrgb = _mm_set1_epi32(static_cast<int>(rgb));
+    const __m128i valpha = _mm_set1_epi32(static_cast<int>(colorAlpha));
+    const __m128i c128 = _mm_set1_epi32(128);
+    for (; i + 4 <= count; i += 4) {
+        __m128i coverage = _mm_srli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), 24);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(coverage, zero)) == 0xFFFF) continue;
+        // coverage * alpha <= 65025 muat di 16 bit bawah setiap lane 32-bit
+        __m128i x = _mm_add_epi32(_mm_mullo_epi16(coverage, valpha), c128);
+        __m128i a = _mm_srli_epi32(_mm_add_epi32(x, _mm_srli_epi32(x, 8)), 8);
+        __m128i s = _mm_or_si128(vrgb, _mm_slli_epi32(a, 24));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), detail::blendQuad(s, d));
+    }
+#endif
+    for (; i < count; i++) {
+        uint32_t x = (src[i] >> 24) * colorAlpha + 128;
+        dst[i] = blendPixel(rgb | (((x + (x >> 8)) >> 8) << 24), dst[i]);
+    }
+}
+
+// ===== IMAGE =====
+
+// Buffer pixel 32-bit (0xAARRGGBB, sama dengan back buffer) milik sendiri.
+// blendMode/colorKey dipakai saat image di-blit (Canvas::drawImage, blit()).
+class Image {
+public:
+    Image() = default;
+
+    Image(int width, int height, Pixel fill = makePixel(0, 0, 0, 0)) {
+        resize(width, height, fill);
+    }
+
+    // Salin dari buffer lain (stride dalam pixel)
+    Image(const Pixel* pixels, int width, int height, int stride) {
+        resize(width, height);
+        for (int y = 0; y < m_height; y++)
+            std::copy(pixels + static_cast<size_t>(y) * stride, pixels + static_cast<size_t>(y) * stride + m_width, row(y));
+    }
+
+    void resize(int width, int height, Pixel fill = makePixel(0, 0, 0, 0)) {
+        m_width = std::max(width, 0);
+        m_height = std::max(height, 0);
+        m_pixels.assign(static_cast<size_t>(m_width) * m_height, fill);
+    }
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    Vec2<int> size() const { return Vec2<int>(m_width, m_height); }
+    Rect<int> bounds() const { return Rect<int>(0, 0, m_width, m_height); }
+    bool empty() const { return m_pixels.empty(); }
+
+    Pixel* data() { return m_pixels.data(); }
+    const Pixel* data() const { return m_pixels.data(); }
+    Pixel* row(int y) { return m_pixels.data() + static_cast<size_t>(y) * m_width; }
+    const Pixel* row(int y) const { return m_pixels.data() + static_cast<size_t>(y) * m_width; }
+    Pixel& at(int x, int y) { return row(y)[x]; }
+    Pixel at(int x, int y) const { return row(y)[x]; }
+
+    // View untuk Raster atau kernel lain
+    Surface surface() { return Surface(m_pixels.data(), m_width, m_height, m_width); }
+
+    void fill(Pixel color) { std::fill(m_pixels.begin(), m_pixels.end(), color); }
+
+    BlendMode blendMode() const { return m_blendMode; }
+    void setBlendMode(BlendMode mode) { m_blendMode = mode; }
+
+    // Sekaligus mengaktifkan BlendMode::ColorKey
+    Pixel colorKey() const { return m_colorKey; }
+    void setColorKey(PackedColor key) {
+        m_colorKey = key.pixel();
+        m_blendMode = BlendMode::ColorKey;
+    }
+
+private:
+    std::vector<Pixel> m_pixels;
+    int m_width = 0;
+    int m_height = 0;
+    BlendMode m_blendMode = BlendMode::Alpha;
+    Pixel m_colorKey = makePixel(255, 0, 255);
+};
+
+// Satu gambar dari atlas: bagian source image digambar di position
+struct Sprite {
+    Rect<int> source;
+    Vec2<int> position;
+};
+
+namespace detail {
+
+// Potong source ke image dan tujuan ke clip, lalu row(from, to, width) per baris
+template <typename RowFn>
+inline void blitRows(const Surface& target, Rect<int> clip, const Image& image, Rect<int> source, Vec2<int> position, RowFn row) {
+    Rect<int> src = source.intersect(image.bounds());
+    position = position + Vec2<int>(src.x - source.x, src.y - source.y);
+    Rect<int> dst = Rect<int>(position.x, position.y, src.w, src.h).intersect(clip);
+    if (dst.empty()) return;
+
+    const int sx = src.x + dst.x - position.x;
+    const int sy = src.y + dst.y - position.y;
+    const size_t width = static_cast<size_t>(dst.w);
+    for (int y = 0; y < dst.h; y++)
+        row(image.row(sy + y) + sx, target.row(dst.y + y) + dst.x, width);
+}
+
+} // namespace detail
+
+// Blit bagian source dari image ke target dengan kiri-atas di position,
+// dipotong ke image dan ke clip (clip harus berada di dalam target)
+inline void blit(const Surface& target, Rect<int> clip, const Image& image, Rect<int> source, Vec2<int> position) {
+    switch (image.blendMode()) {
+        case BlendMode::Opaque:
+            detail::blitRows(target, clip, image, source, position, blitOpaque);
+            break;
+        case BlendMode::ColorKey: {
+            const Pixel key = image.colorKey();
+            detail::blitRows(target, clip, image, source, position, [key](const Pixel* from, Pixel* to, size_t width) {
+                blitColorKey(from, to, width, key);
+            });
+            break;
+        }
+        case BlendMode::Alpha:
+            detail::blitRows(target, clip, image, source, position, blitAlpha);
+            break;
+    }
+}
+
+// Seperti blit(), tapi image dipakai sebagai mask coverage yang diwarnai color (teks, icon)
+inline void blitTinted(const Surface& target, Rect<int> clip, const Image& mask, Rect<int> source, Vec2<int> position, Pixel color) {
+    detail::blitRows(target, clip, mask, source, position, [color](const Pixel* from, Pixel* to, size_t width) {
+        blitCoverage(from, to, width, color);
+    });
+}
+
+} // namespace z
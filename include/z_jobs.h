@@ -0,0 +1,442 @@
+#pragma once
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace z {
+
+// Deque Chase-Lev: owner push/pop di bottom (LIFO), thread lain steal di top (FIFO).
+// Implementasi mengikuti Le et al. 2013 (versi C11 atomics).
+// Array lama disimpan sampai deque dihancurkan supaya steal yang sedang
+// membaca array lama tetap aman.
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque hanya untuk tipe trivially copyable (mis. pointer)");
+
+public:
+    explicit WorkStealingDeque(int64_t capacity = 256) {
+        int64_t cap = 1;
+        while (cap < capacity) cap <<= 1;
+        m_arrays.push_back(std::make_unique<Array>(cap));
+        m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Hanya owner
+    void push(T item) {
+        int64_t b = m_bottom.load(std::memory_order_relaxed);
+        int64_t t = m_top.load(std::memory_order_acquire);
+        Array* a = m_array.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1)
+            a = grow(a, t, b);
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Hanya owner
+    bool pop(T& item) {
+        int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        Array* a = m_array.load(std::memory_order_relaxed);
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = a->get(b);
+        if (t == b) {
+            // Elemen terakhir: balapan dengan thief
+            bool won = m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Thread mana pun
+    bool steal(T& item) {
+        int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = m_bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return false;
+
+        Array* a = m_array.load(std::memory_order_acquire);
+        item = a->get(t);
+        return m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    bool empty() const {
+        return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Array {
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> data;
+
+        explicit Array(int64_t capacity)
+            : capacity(capacity), mask(capacity - 1), data(new std::atomic<T>[static_cast<size_t>(capacity)]) {}
+
+        T get(int64_t i) const { return data[i & mask].load(std::memory_order_relaxed); }
+        void put(int64_t i, T item) { data[i & mask].store(item, std::memory_order_relaxed); }
+    };
+
+    alignas(64) std::atomic<int64_t> m_top{0};
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+    alignas(64) std::atomic<Array*> m_array{nullptr};
+    std::vector<std::unique_ptr<Array>> m_arrays;   // hanya disentuh owner
+
+    Array* grow(Array* old, int64_t top, int64_t bottom) {
+        m_arrays.push_back(std::make_unique<Array>(old->capacity * 2));
+        Array* a = m_arrays.back().get();
+        for (int64_t i = top; i < bottom; i++)
+            a->put(i, old->get(i));
+        m_array.store(a, std::memory_order_release);
+        return a;
+    }
+};
+
+// Counter job: bertambah saat job dijadwalkan, berkurang saat selesai.
+// Nol = semua job yang memakai counter ini sudah selesai.
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    int pending() const { return m_pending.load(std::memory_order_acquire); }
+    bool done() const { return pending() == 0; }
+
+private:
+    friend class Jobs;
+    std::atomic<int> m_pending{0};
+};
+
+// Job system work-stealing.
+// Setiap worker punya deque Chase-Lev sendiri; job dari thread luar masuk
+// antrian injeksi. Worker yang kosong mencuri dari worker lain.
+// wait() tidak memblok thread pemanggil: selama menunggu ia ikut mengerjakan job.
+// Node job diambil dari pool (free list) dan callable kecil disimpan inline, jadi setelah
+// pool hangat run() tidak mengalokasi. Worker yang menganggur tidur di condition variable
+// sampai ada job siap (deque lokal maupun antrian injeksi).
+class Jobs {
+public:
+    // workerCount 0 = hardware_concurrency - 1 (thread pemanggil ikut bekerja saat wait)
+    explicit Jobs(unsigned workerCount = 0) {
+        if (workerCount == 0) {
+            unsigned hw = std::thread::hardware_concurrency();
+            workerCount = hw > 1 ? hw - 1 : 0;
+        }
+
+        m_queues.reserve(workerCount);
+        for (unsigned i = 0; i < workerCount; i++)
+            m_queues.push_back(std::make_unique<WorkStealingDeque<Job*>>());
+
+        m_threads.reserve(workerCount);
+        for (unsigned i = 0; i < workerCount; i++)
+            m_threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ~Jobs() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop = true;
+        }
+        m_sleepCv.notify_all();
+        for (std::thread& t : m_threads)
+            t.join();
+
+        // Job yang belum sempat jalan dibuang (callable-nya tetap dihancurkan)
+        Job* job = nullptr;
+        for (auto& q : m_queues)
+            while (q->pop(job)) job->destroy(*job);
+        for (Job* j : m_injected) j->destroy(*j);
+        for (Job* j : m_deferred) j->destroy(*j);
+    }
+
+    Jobs(const Jobs&) = delete;
+    Jobs& operator=(const Jobs&) = delete;
+
+    // Jumlah thread yang mengerjakan job (worker + thread pemanggil wait)
+    unsigned threadCount() const { return static_cast<unsigned>(m_threads.size()) + 1; }
+
+    // Jadwalkan job. counter (opsional) ditandai selesai setelah fn jalan.
+    // dependency (opsional): job baru dimulai setelah dependency->done().
+    // fn sampai Job::inlineSize byte disimpan di node; yang lebih besar dialokasikan terpisah.
+    template <typename Fn>
+    void run(Fn&& fn, JobCounter* counter = nullptr, const JobCounter* dependency = nullptr) {
+        using F = std::decay_t<Fn>;
+        if (counter)
+            counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        Job* job = acquireJob();
+        if constexpr (sizeof(F) <= Job::inlineSize && alignof(F) <= alignof(std::max_align_t)) {
+            new (job->storage) F(std::forward<Fn>(fn));
+            job->invoke = [](Job& j) { (*std::launder(reinterpret_cast<F*>(j.storage)))(); };
+            job->destroy = [](Job& j) { std::launder(reinterpret_cast<F*>(j.storage))->~F(); };
+        } else {
+            F* heap = new F(std::forward<Fn>(fn));
+            std::memcpy(job->storage, &heap, sizeof(heap));
+            job->invoke = [](Job& j) { F* f; std::memcpy(&f, j.storage, sizeof(f)); (*f)(); };
+            job->destroy = [](Job& j) { F* f; std::memcpy(&f, j.storage, sizeof(f)); delete f; };
+        }
+        job->counter = counter;
+        job->dependency = dependency;
+        schedule(job);
+    }
+
+    // Jumlah node job yang sudah dialokasikan pool (tidak turun sampai Jobs dihancurkan)
+    size_t jobCapacity() const {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        return m_jobCapacity;
+    }
+
+    // Tunggu counter nol sambil ikut mengerjakan job
+    void wait(const JobCounter& counter) {
+        while (!counter.done()) {
+            if (!runOne(currentWorker()))
+                std::this_thread::yield();
+        }
+    }
+
+    // Bagi [begin, end) menjadi chunk dan jalankan fn(chunkBegin, chunkEnd) paralel.
+    // grain 0 = otomatis (sekitar 8 chunk per thread, minimal 1 elemen).
+    template <typename Fn>
+    void parallelFor(size_t begin, size_t end, Fn&& fn, size_t grain = 0) {
+        if (end <= begin) return;
+        size_t count = end - begin;
+
+        if (grain == 0)
+            grain = std::max<size_t>(1, count / (static_cast<size_t>(threadCount()) * 8));
+
+        if (count <= grain || threadCount() == 1) {
+            fn(begin, end);
+            return;
+        }
+
+        JobCounter counter;
+        size_t chunkBegin = begin;
+        // Chunk pertama dikerjakan pemanggil setelah yang lain dijadwalkan
+        size_t firstEnd = std::min(begin + grain, end);
+        for (chunkBegin = firstEnd; chunkBegin < end; chunkBegin += grain) {
+            size_t chunkEnd = std::min(chunkBegin + grain, end);
+            run([&fn, chunkBegin, chunkEnd] { fn(chunkBegin, chunkEnd); }, &counter);
+        }
+        fn(begin, firstEnd);
+        wait(counter);
+    }
+
+private:
+    struct Job {
+        static constexpr size_t inlineSize = 48;
+        alignas(std::max_align_t) unsigned char storage[inlineSize];
+        void (*invoke)(Job&);
+        void (*destroy)(Job&);
+        JobCounter* counter;
+        const JobCounter* dependency;
+        Job* next;          // free list pool
+    };
+
+    static constexpr size_t jobBlock = 64;
+
+    mutable std::mutex m_poolMutex;
+    Job* m_freeJobs = nullptr;
+    std::vector<std::unique_ptr<Job[]>> m_jobBlocks;
+    size_t m_jobCapacity = 0;
+
+    std::vector<std::unique_ptr<WorkStealingDeque<Job*>>> m_queues;
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_injectMutex;
+    std::deque<Job*> m_injected;
+    std::atomic<int> m_injectedCount{0};
+
+    std::mutex m_deferredMutex;
+    std::vector<Job*> m_deferred;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCv;
+    std::atomic<int> m_sleepers{0};
+    std::atomic<int> m_queued{0};       // job siap di deque lokal + antrian injeksi
+    bool m_stop = false;
+
+    // Index worker thread ini di scheduler ini, -1 kalau bukan worker
+    int currentWorker() const {
+        return t_owner == this ? t_worker : -1;
+    }
+
+    static thread_local const Jobs* t_owner;
+    static thread_local int t_worker;
+
+    Job* acquireJob() {
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        if (!m_freeJobs) {
+            m_jobBlocks.push_back(std::make_unique<Job[]>(jobBlock));
+            Job* block = m_jobBlocks.back().get();
+            for (size_t i = 0; i < jobBlock; i++)
+                block[i].next = i + 1 < jobBlock ? &block[i + 1] : nullptr;
+            m_freeJobs = block;
+            m_jobCapacity += jobBlock;
+        }
+        Job* job = m_freeJobs;
+        m_freeJobs = job->next;
+        return job;
+    }
+
+    void recycleJob(Job* job) {
+        job->destroy(*job);
+        std::lock_guard<std::mutex> lock(m_poolMutex);
+        job->next = m_freeJobs;
+        m_freeJobs = job;
+    }
+
+    void schedule(Job* job) {
+        if (job->dependency && !job->dependency->done()) {
+            std::lock_guard<std::mutex> lock(m_deferredMutex);
+            // Cek ulang di dalam lock: release() memindai deferred di bawah lock yang sama
+            if (!job->dependency->done()) {
+                m_deferred.push_back(job);
+                return;
+            }
+        }
+
+        int worker = currentWorker();
+        if (worker >= 0) {
+            m_queues[worker]->push(job);
+        } else {
+            std::lock_guard<std::mutex> lock(m_injectMutex);
+            m_injected.push_back(job);
+            m_injectedCount.fetch_add(1, std::memory_order_release);
+        }
+
+        // Pasangan seq_cst dengan workerLoop: worker menaikkan m_sleepers lalu membaca m_queued
+        // di bawah m_sleepMutex, di sini sebaliknya. Salah satu pasti melihat yang lain, dan
+        // notify di bawah mutex tidak bisa jatuh di antara cek predicate dan wait.
+        m_queued.fetch_add(1, std::memory_order_seq_cst);
+        if (m_sleepers.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_sleepCv.notify_one();
+        }
+    }
+
+    bool popInjected(Job*& job) {
+        if (m_injectedCount.load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(m_injectMutex);
+        if (m_injected.empty())
+            return false;
+        job = m_injected.front();
+        m_injected.pop_front();
+        m_injectedCount.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool findJob(int worker, Job*& job) {
+        if (worker >= 0 && m_queues[worker]->pop(job))
+            return true;
+        if (popInjected(job))
+            return true;
+
+        // Curi mulai dari tetangga supaya thief tidak menumpuk di victim yang sama
+        size_t n = m_queues.size();
+        size_t start = worker >= 0 ? static_cast<size_t>(worker) + 1 : 0;
+        for (size_t i = 0; i < n; i++) {
+            size_t victim = (start + i) % n;
+            if (static_cast<int>(victim) != worker && m_queues[victim]->steal(job))
+                return true;
+        }
+        return false;
+    }
+
+    bool runOne(int worker) {
+        Job* job = nullptr;
+        if (!findJob(worker, job))
+            return false;
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+
+        job->invoke(*job);
+        JobCounter* counter = job->counter;
+        recycleJob(job);
+        if (counter)
+            release(*counter);
+        return true;
+    }
+
+    void release(JobCounter& counter) {
+        if (counter.m_pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        // Counter baru saja nol: jadwalkan job yang menunggunya
+        std::vector<Job*> ready;
+        {
+            std::lock_guard<std::mutex> lock(m_deferredMutex);
+            for (size_t i = 0; i < m_deferred.size();) {
+                if (m_deferred[i]->dependency->done()) {
+                    ready.push_back(m_deferred[i]);
+                    m_deferred[i] = m_deferred.back();
+                    m_deferred.pop_back();
+                } else {
+                    i++;
+                }
+            }
+        }
+        for (Job* job : ready)
+            schedule(job);
+    }
+
+    void workerLoop(unsigned index) {
+        t_owner = this;
+        t_worker = static_cast<int>(index);
+
+        int idleSpins = 0;
+        for (;;) {
+            if (runOne(t_worker)) {
+                idleSpins = 0;
+                continue;
+            }
+
+            // Spin sebentar sebelum tidur supaya parallelFor beruntun tidak kena latency wakeup
+            if (++idleSpins < 64) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Tidur sampai schedule() menaikkan m_queued (lihat komentar di sana)
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            if (m_stop)
+                return;
+            m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+            m_sleepCv.wait(lock, [this] {
+                return m_stop || m_queued.load(std::memory_order_seq_cst) > 0;
+            });
+            m_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+            if (m_stop)
+                return;
+            idleSpins = 0;
+        }
+    }
+};
+
+inline thread_local const Jobs* Jobs::t_owner = nullptr;
+inline thread_local int Jobs::t_worker = -1;
+
+} // namespace z
@@ -0,0 +1,178 @@
+#pragma once
+#include "z_platform.h"
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_points.h"
+#include "z_canvas.h"
+
+#if Z_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace z {
+
+// Particle system structure-of-arrays dengan kapasitas tetap (pool).
+// Setiap atribut disimpan di array sendiri supaya update bisa diproses
+// 4 partikel sekaligus (SSE2). Partikel mati dihapus dengan swap-remove,
+// jadi urutan partikel tidak dijaga.
+class ParticleSystem {
+public:
+    explicit ParticleSystem(size_t capacity) : m_capacity(capacity) {
+        m_x.resize(capacity);
+        m_y.resize(capacity);
+        m_vx.resize(capacity);
+        m_vy.resize(capacity);
+        m_life.resize(capacity);
+        m_color.resize(capacity);
+    }
+
+    size_t size() const { return m_count; }
+    size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_count == 0; }
+    bool full() const { return m_count == m_capacity; }
+
+    void clear() { m_count = 0; }
+
+    // Tambah partikel. Return false kalau pool penuh
+    bool emit(float x, float y, float vx, float vy, Pixel color, float life = 1.0f) {
+        if (m_count == m_capacity) return false;
+        size_t i = m_count++;
+        m_x[i] = x;
+        m_y[i] = y;
+        m_vx[i] = vx;
+        m_vy[i] = vy;
+        m_life[i] = life;
+        m_color[i] = color;
+        return true;
+    }
+
+    bool emit(Vec2<float> position, Vec2<float> velocity, Color<unsigned char> color, float life = 1.0f) {
+        return emit(position.x, position.y, velocity.x, velocity.y, toPixel(color), life);
+    }
+
+    // ===== UPDATE =====
+
+    // Gravitasi (unit/detik^2) dan kecepatan fade (life per detik)
+    void setGravity(Vec2<float> gravity) { m_gravity = gravity; }
+    void setFadeRate(float rate) { m_fadeRate = rate; }
+
+    Vec2<float> gravity() const { return m_gravity; }
+    float fadeRate() const { return m_fadeRate; }
+
+    // Integrasi + fade, lalu buang partikel yang life <= 0
+    void update(float dt) {
+        integrate(0, m_count, dt);
+        compact();
+    }
+
+    // Hanya integrasi + fade untuk [begin, end), tanpa compact.
+    // Bisa dipanggil paralel per range (mis. Jobs::parallelFor) lalu compact() sekali.
+    void integrate(size_t begin, size_t end, float dt) {
+        end = std::min(end, m_count);
+        const float gx = m_gravity.x * dt;
+        const float gy = m_gravity.y * dt;
+        const float fade = m_fadeRate * dt;
+        float* x = m_x.data();
+        float* y = m_y.data();
+        float* vx = m_vx.data();
+        float* vy = m_vy.data();
+        float* life = m_life.data();
+
+        size_t i = begin;
+#if Z_HAS_SSE2
+        const __m128 vdt = _mm_set1_ps(dt);
+        const __m128 vgx = _mm_set1_ps(gx);
+        const __m128 vgy = _mm_set1_ps(gy);
+        const __m128 vfade = _mm_set1_ps(fade);
+        for (; i + 4 <= end; i += 4) {
+            __m128 pvx = _mm_add_ps(_mm_loadu_ps(vx + i), vgx);
+            __m128 pvy = _mm_add_ps(_mm_loadu_ps(vy + i), vgy);
+            _mm_storeu_ps(vx + i, pvx);
+            _mm_storeu_ps(vy + i, pvy);
+            _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(pvx, vdt)));
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(pvy, vdt)));
+            _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), vfade));
+        }
+#endif
+        for (; i < end; i++) {
+            vx[i] += gx;
+            vy[i] += gy;
+            x[i] += vx[i] * dt;
+            y[i] += vy[i] * dt;
+            life[i] -= fade;
+        }
+    }
+
+    // Swap-remove semua partikel dengan life <= 0
+    void compact() {
+        size_t i = 0;
+        while (i < m_count) {
+#if Z_HAS_SSE2
+            // Lewati 4 partikel hidup sekaligus
+            if (i + 4 <= m_count) {
+                __m128 dead = _mm_cmple_ps(_mm_loadu_ps(m_life.data() + i), _mm_setzero_ps());
+                if (_mm_movemask_ps(dead) == 0) {
+                    i += 4;
+                    continue;
+                }
+            }
+#endif
+            if (m_life[i] > 0.0f) {
+                i++;
+                continue;
+            }
+            // Partikel terakhir dipindah ke slot ini lalu dicek ulang
+            size_t last = --m_count;
+            m_x[i] = m_x[last];
+            m_y[i] = m_y[last];
+            m_vx[i] = m_vx[last];
+            m_vy[i] = m_vy[last];
+            m_life[i] = m_life[last];
+            m_color[i] = m_color[last];
+        }
+    }
+
+    // ===== DRAW =====
+
+    // Gambar semua partikel sebagai kotak size x size, alpha = life (0..1) * alpha warna.
+    // Posisi dibulatkan ke pixel terdekat; kotak di tepi surface dipotong.
+    // Array SoA langsung dipakai kernel (detail::blendPoints), tanpa salinan per partikel.
+    void draw(const Surface& target, int size = 1) const {
+        detail::blendPoints(target, target.bounds(), Affine(), m_x.data(), m_y.data(), m_color.data(), m_life.data(), m_count, size);
+    }
+
+    // Lewat Canvas: posisi ikut transform, clip dan CanvasStats dihormati. Hasil sama dengan
+    // draw(Surface) kalau transform identitas dan clip penuh.
+    void draw(Canvas& canvas, int size = 1) const {
+        canvas.drawPoints(m_x.data(), m_y.data(), m_color.data(), m_life.data(), m_count, size);
+    }
+
+    // ===== DATA ACCESS (SoA) =====
+
+    const float* x() const { return m_x.data(); }
+    const float* y() const { return m_y.data(); }
+    const float* vx() const { return m_vx.data(); }
+    const float* vy() const { return m_vy.data(); }
+    const float* life() const { return m_life.data(); }
+    const Pixel* colors() const { return m_color.data(); }
+
+    Vec2<float> position(size_t i) const { return Vec2<float>(m_x[i], m_y[i]); }
+    Vec2<float> velocity(size_t i) const { return Vec2<float>(m_vx[i], m_vy[i]); }
+
+private:
+    size_t m_capacity;
+    size_t m_count = 0;
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_vx;
+    std::vector<float> m_vy;
+    std::vector<float> m_life;
+    std::vector<Pixel> m_color;
+    Vec2<float> m_gravity = Vec2<float>(0.0f, 0.0f);
+    float m_fadeRate = 0.5f;    // default: hilang dalam 2 detik (sama dengan demo 1)
+};
+
+} // namespace z
@@ -0,0 +1,260 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_cache.h"
+
+namespace z {
+
+enum class PathVerb : uint8_t {
+    Move,       // 1 titik
+    Line,       // 1 titik
+    Quad,       // 2 titik: kontrol, ujung
+    Cubic,      // 3 titik: kontrol 1, kontrol 2, ujung
+    Close       // 0 titik
+};
+
+// Path di koordinat user. Setiap perubahan memberi id baru (counter global, tidak
+// pernah dipakai ulang), jadi hasil flatten bisa di-cache per id. Copy berbagi id
+// selama geometrinya sama.
+class Path {
+public:
+    Path() = default;
+
+    Path& moveTo(Vec2<float> p) { return add(PathVerb::Move, &p, 1); }
+    Path& lineTo(Vec2<float> p) { return add(PathVerb::Line, &p, 1); }
+
+    Path& quadTo(Vec2<float> control, Vec2<float> end) {
+        Vec2<float> p[2] = { control, end };
+        return add(PathVerb::Quad, p, 2);
+    }
+
+    Path& cubicTo(Vec2<float> control1, Vec2<float> control2, Vec2<float> end) {
+        Vec2<float> p[3] = { control1, control2, end };
+        return add(PathVerb::Cubic, p, 3);
+    }
+
+    Path& close() { return add(PathVerb::Close, nullptr, 0); }
+
+    void clear() {
+        m_verbs.clear();
+        m_points.clear();
+        m_id = detail::nextContentId();
+    }
+
+    bool empty() const { return m_verbs.empty(); }
+    uint64_t id() const { return m_id; }
+    const std::vector<PathVerb>& verbs() const { return m_verbs; }
+    const std::vector<Vec2<float>>& points() const { return m_points; }
+
+private:
+    std::vector<PathVerb> m_verbs;
+    std::vector<Vec2<float>> m_points;
+    uint64_t m_id = detail::nextContentId();
+
+    // Segmen tanpa moveTo sebelumnya mulai di titik (0, 0)
+    Path& add(PathVerb verb, const Vec2<float>* p, int count) {
+        if (verb != PathVerb::Move && m_verbs.empty()) {
+            m_verbs.push_back(PathVerb::Move);
+            m_points.push_back(Vec2<float>());
+        }
+        m_verbs.push_back(verb);
+        m_points.insert(m_points.end(), p, p + count);
+        m_id = detail::nextContentId();
+        return *this;
+    }
+};
+
+// Path yang sudah dipecah jadi garis lurus, masih di koordinat user
+struct FlatPath {
+    struct Contour {
+        uint32_t begin;     // index titik pertama di points
+        uint32_t count;
+        bool closed;
+    };
+
+    std::vector<Vec2<float>> points;
+    std::vector<Contour> contours;
+
+    void clear() {
+        points.clear();
+        contours.clear();
+    }
+};
+
+// ===== FLATTEN =====
+// Jumlah segmen seragam dari batas error chord: quad |p0 - 2p1 + p2| / (8n^2) <= tol,
+// cubic (Wang) 3/4 * max|turunan kedua diskret| / n^2 <= tol. Kurva yang lurus tetap 1 segmen.
+
+namespace detail {
+
+inline constexpr int maxCurveSegments = 1024;
+
+inline int curveSegments(float deviation, float tolerance) {
+    float n = std::ceil(std::sqrt(deviation / tolerance));
+    if (!(n >= 1.0f)) return 1;                 // NaN / nol
+    return static_cast<int>(std::min(n, static_cast<float>(maxCurveSegments)));
+}
+
+inline float length(Vec2<float> v) {
+    return std::sqrt(v.x * v.x + v.y * v.y);
+}
+
+} // namespace detail
+
+inline void flatten(const Path& path, float tolerance, FlatPath& out) {
+    out.clear();
+    tolerance = std::max(tolerance, 1e-4f);
+    const std::vector<Vec2<float>>& p = path.points();
+    size_t at = 0;
+    Vec2<float> current, start;
+
+    // Contour yang sedang dibangun ditutup saat moveTo / close / akhir path
+    auto finish = [&](bool closed) {
+        if (out.contours.empty()) return;
+        FlatPath::Contour& c = out.contours.back();
+        c.count = static_cast<uint32_t>(out.points.size()) - c.begin;
+        c.closed = c.closed || closed;
+    };
+    auto begin = [&](Vec2<float> at) {
+        out.contours.push_back(FlatPath::Contour{ static_cast<uint32_t>(out.points.size()), 0, false });
+        out.points.push_back(at);
+    };
+
+    for (PathVerb verb : path.verbs()) {
+        switch (verb) {
+            case PathVerb::Move:
+                finish(false);
+                current = start = p[at++];
+                begin(current);
+                break;
+            case PathVerb::Line:
+                current = p[at++];
+                out.points.push_back(current);
+                break;
+            case PathVerb::Quad: {
+                const Vec2<float> p0 = current, p1 = p[at], p2 = p[at + 1];
+                at += 2;
+                Vec2<float> dd(p0.x - 2.0f * p1.x + p2.x, p0.y - 2.0f * p1.y + p2.y);
+                int n = detail::curveSegments(detail::length(dd) * 0.125f, tolerance);
+                for (int i = 1; i < n; i++) {
+                    float t = static_cast<float>(i) / static_cast<float>(n), u = 1.0f - t;
+                    out.points.push_back(Vec2<float>(u * u * p0.x + 2.0f * u * t * p1.x + t * t * p2.x,
+                                                     u * u * p0.y + 2.0f * u * t * p1.y + t * t * p2.y));
+                }
+                out.points.push_back(current = p2);
+                break;
+            }
+            case PathVerb::Cubic: {
+                const Vec2<float> p0 = current, p1 = p[at], p2 = p[at + 1], p3 = p[at + 2];
+                at += 3;
+                Vec2<float> d1(p0.x - 2.0f * p1.x + p2.x, p0.y - 2.0f * p1.y + p2.y);
+                Vec2<float> d2(p1.x - 2.0f * p2.x + p3.x, p1.y - 2.0f * p2.y + p3.y);
+                int n = detail::curveSegments(0.75f * std::max(detail::length(d1), detail::length(d2)), tolerance);
+                for (int i = 1; i < n; i++) {
+                    float t = static_cast<float>(i) / static_cast<float>(n), u = 1.0f - t;
+                    float b0 = u * u * u, b1 = 3.0f * u * u * t, b2 = 3.0f * u * t * t, b3 = t * t * t;
+                    out.points.push_back(Vec2<float>(b0 * p0.x + b1 * p1.x + b2 * p2.x + b3 * p3.x,
+                                                     b0 * p0.y + b1 * p1.y + b2 * p2.y + b3 * p3.y));
+                }
+                out.points.push_back(current = p3);
+                break;
+            }
+            case PathVerb::Close:
+                finish(true);
+                // Segmen setelah close tanpa moveTo mulai lagi dari titik awal contour
+                current = start;
+                begin(current);
+                break;
+        }
+    }
+    finish(false);
+
+    // Contour kosong (moveTo berturut-turut, close di akhir) dibuang
+    size_t kept = 0;
+    for (const FlatPath::Contour& c : out.contours)
+        if (c.count >= 2)
+            out.contours[kept++] = c;
+    out.contours.resize(kept);
+}
+
+// Bucket skala seperempat oktaf. Tolerance diambil dari skala teratas bucket,
+// jadi error di layar tetap <= deviceTolerance untuk semua skala di bucket itu.
+inline int scaleBucket(float scale) {
+    return static_cast<int>(std::ceil(std::log2(std::max(scale, 1e-6f)) * 4.0f));
+}
+
+inline float bucketTolerance(int bucket, float deviceTolerance) {
+    return deviceTolerance / std::exp2(static_cast<float>(bucket) * 0.25f);
+}
+
+struct FlattenCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;          // path yang di-flatten ulang
+    size_t entries = 0;
+};
+
+// Hasil flatten per (id path, bucket skala), GenerationCache seperti TextCache.
+// capacity 0 = tanpa cache, setiap get() flatten ulang.
+class FlattenCache {
+public:
+    static constexpr float deviceTolerance = 0.25f;     // pixel
+
+    explicit FlattenCache(size_t capacity = 512) : m_cache(capacity) {}
+
+    // scale = regangan terbesar transform (lihat Canvas); reference berlaku sampai get() berikutnya
+    const FlatPath& get(const Path& path, float scale) {
+        const int bucket = scaleBucket(scale);
+        const Key key{ path.id(), bucket };
+        if (m_cache.capacity() == 0) {
+            m_stats.misses++;
+            flatten(path, bucketTolerance(bucket, deviceTolerance), m_scratch);
+            return m_scratch;
+        }
+        if (FlatPath* cached = m_cache.find(key)) {
+            m_stats.hits++;
+            m_stats.entries = m_cache.size();       // hit dari previous bisa memutar generasi
+            return *cached;
+        }
+        m_stats.misses++;
+        FlatPath flat;
+        flatten(path, bucketTolerance(bucket, deviceTolerance), flat);
+        FlatPath& slot = m_cache.insert(key, std::move(flat));
+        m_stats.entries = m_cache.size();
+        return slot;
+    }
+
+    void setCapacity(size_t capacity) {
+        m_cache.setCapacity(capacity);
+        m_stats.entries = 0;
+    }
+
+    void clear() {
+        m_cache.clear();
+        m_stats.entries = 0;
+    }
+
+    const FlattenCacheStats& stats() const { return m_stats; }
+
+private:
+    struct Key {
+        uint64_t id;
+        int bucket;
+        bool operator==(const Key& other) const { return id == other.id && bucket == other.bucket; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            return std::hash<uint64_t>()(k.id * 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(static_cast<uint32_t>(k.bucket)));
+        }
+    };
+
+    GenerationCache<Key, FlatPath, KeyHash> m_cache;
+    FlatPath m_scratch;
+    FlattenCacheStats m_stats;
+};
+
+} // namespace z
@@ -0,0 +1,131 @@
+#pragma once
+
+// ===== PLATFORM DETECTION =====
+//
+// Z_PLATFORM_WIN32     backend window/canvas memakai Win32 + GDI
+// Z_PLATFORM_HEADLESS  backend tanpa layar: surface di memori, event sintetis
+//
+// Headless otomatis dipakai di luar Windows. Di Windows bisa dipaksa dengan
+// mendefinisikan Z_HEADLESS sebelum include (berguna untuk benchmark/CI).
+
+#if defined(Z_HEADLESS) || !defined(_WIN32)
+    #define Z_PLATFORM_HEADLESS 1
+    #define Z_PLATFORM_WIN32 0
+#else
+    #define Z_PLATFORM_HEADLESS 0
+    #define Z_PLATFORM_WIN32 1
+#endif
+
+// ===== SIMD =====
+//
+// Z_HAS_SSE2   SSE2 tersedia saat compile (selalu di x64). Tanpa SSE2 kernel
+//              memakai jalur skalar dengan hasil yang sama.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define Z_HAS_SSE2 1
+#else
+    #define Z_HAS_SSE2 0
+#endif
+
+#include <cstdint>
+#include <ctime>
+#include <chrono>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <windowsx.h>
+#else
+
+// Kosakata Win32 minimal yang dipakai API publik (warna, titik, virtual key),
+// supaya kode user tetap sama di semua platform.
+typedef uint32_t COLORREF;
+typedef unsigned long DWORD;
+
+struct POINT {
+    long x;
+    long y;
+};
+
+struct RECT {
+    long left;
+    long top;
+    long right;
+    long bottom;
+};
+
+#define RGB(r, g, b) ((COLORREF)(((uint8_t)(r)) | ((uint32_t)((uint8_t)(g)) << 8) | ((uint32_t)((uint8_t)(b)) << 16)))
+#define GetRValue(rgb) ((uint8_t)(rgb))
+#define GetGValue(rgb) ((uint8_t)(((uint32_t)(rgb)) >> 8))
+#define GetBValue(rgb) ((uint8_t)(((uint32_t)(rgb)) >> 16))
+
+#define VK_BACK     0x08
+#define VK_TAB      0x09
+#define VK_RETURN   0x0D
+#define VK_SHIFT    0x10
+#define VK_CONTROL  0x11
+#define VK_ESCAPE   0x1B
+#define VK_SPACE    0x20
+#define VK_LEFT     0x25
+#define VK_UP       0x26
+#define VK_RIGHT    0x27
+#define VK_DOWN     0x28
+#define VK_DELETE   0x2E
+
+#endif
+
+namespace z {
+namespace platform {
+
+// Counter waktu resolusi tinggi
+inline int64_t ticks() {
+#if defined(_WIN32)
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return now.QuadPart;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline int64_t tickFrequency() {
+#if defined(_WIN32)
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    return freq.QuadPart;
+#else
+    return 1000000000;
+#endif
+}
+
+inline void sleepMilliseconds(int ms) {
+#if defined(_WIN32)
+    Sleep(static_cast<DWORD>(ms));
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+}
+
+// CPU time proses dalam detik (user + kernel)
+inline double processCpuSeconds() {
+#if defined(_WIN32)
+    FILETIME creation, exitTime, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exitTime, &kernel, &user))
+        return 0.0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return static_cast<double>(k.QuadPart + u.QuadPart) * 1e-7;  // satuan 100ns
+#else
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+} // namespace platform
+} // namespace z
@@ -0,0 +1,621 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include "z_surface.h"
+
+namespace z {
+
+enum class FillRule {
+    EvenOdd,    // sama dengan ALTERNATE di GDI
+    NonZero     // sama dengan WINDING di GDI
+};
+
+// Callback span paling sederhana: isi dengan satu warna
+struct SolidSpan {
+    Surface target;
+    Pixel color;
+
+    SolidSpan(const Surface& target, Pixel color) : target(target), color(color) {}
+
+    void operator()(int y, int x0, int x1) const {
+        Pixel* row = target.row(y);
+        std::fill(row + x0, row + x1, color);
+    }
+};
+
+// Liang-Barsky: potong segmen a + t * (b - a), t di [0, 1], ke rect clip (tepi ikut).
+// Return false kalau segmen tidak menyentuh clip; kalau menyentuh, [t0, t1] = bagian di dalam.
+inline bool clipSegment(Vec2<float> a, Vec2<float> b, Rect<float> clip, float& t0, float& t1) {
+    t0 = 0.0f;
+    t1 = 1.0f;
+    const float d[2] = { b.x - a.x, b.y - a.y };
+    const float lo[2] = { clip.x - a.x, clip.y - a.y };
+    const float hi[2] = { clip.x + clip.w - a.x, clip.y + clip.h - a.y };
+    for (int k = 0; k < 2; k++) {
+        if (d[k] == 0.0f) {
+            if (lo[k] > 0.0f || hi[k] < 0.0f) return false;
+            continue;
+        }
+        float ta = lo[k] / d[k], tb = hi[k] / d[k];
+        if (ta > tb) std::swap(ta, tb);
+        t0 = std::max(t0, ta);
+        t1 = std::min(t1, tb);
+        if (!(t0 <= t1)) return false;
+    }
+    return true;
+}
+
+// Software rasterizer di atas Surface.
+// Setiap shape dipecah jadi span horizontal [x0, x1) per baris yang sudah
+// di-clip, lalu diserahkan ke callback fn(y, x0, x1). Fill solid hanya salah
+// satu callback; paint lain cukup menulis callback sendiri.
+// Sampling di tengah pixel (x + 0.5, y + 0.5), aturan top-left.
+class Raster {
+public:
+    Raster() = default;
+    explicit Raster(Surface target) { setTarget(target); }
+
+    void setTarget(Surface target) {
+        m_target = target;
+        m_clip = target.bounds();
+    }
+
+    const Surface& target() const { return m_target; }
+
+    // Clip selalu berada di dalam surface
+    void setClip(Rect<int> clip) {
+        int x0 = std::max(clip.x, 0);
+        int y0 = std::max(clip.y, 0);
+        int x1 = std::min(clip.x + clip.w, m_target.width);
+        int y1 = std::min(clip.y + clip.h, m_target.height);
+        m_clip = Rect<int>(x0, y0, std::max(x1 - x0, 0), std::max(y1 - y0, 0));
+    }
+
+    Rect<int> clip() const { return m_clip; }
+
+    // ===== SOLID PRIMITIVES =====
+
+    void plot(int x, int y, Pixel color) {
+        if (x >= m_clip.x && x < m_clip.x + m_clip.w && y >= m_clip.y && y < m_clip.y + m_clip.h)
+            m_target.at(x, y) = color;
+    }
+
+    void fillSpan(int y, int x0, int x1, Pixel color) {
+        SolidSpan solid(m_target, color);
+        emit(y, x0, x1, solid);
+    }
+
+    void fill(Pixel color) {
+        fillRect(m_clip.x, m_clip.y, m_clip.w, m_clip.h, color);
+    }
+
+    void fillRect(int x, int y, int width, int height, Pixel color) {
+        rectSpans(x, y, width, height, SolidSpan(m_target, color));
+    }
+
+    // Outline rect dengan ketebalan, tumbuh ke luar untuk stroke tebal (mirip pen GDI)
+    void frameRect(int x, int y, int width, int height, Pixel color, int thickness = 1) {
+        if (thickness < 1) thickness = 1;
+        int grow = thickness / 2;
+        x -= grow;
+        y -= grow;
+        width += grow * 2;
+        height += grow * 2;
+        fillRect(x, y, width, thickness, color);
+        fillRect(x, y + height - thickness, width, thickness, color);
+        fillRect(x, y + thickness, thickness, height - thickness * 2, color);
+        fillRect(x + width - thickness, y + thickness, thickness, height - thickness * 2, color);
+    }
+
+    // Garis; width 1 = Bresenham tanpa pixel terakhir (seperti LineTo),
+    // lebih tebal = quad dengan cap bulat (seperti pen geometric GDI)
+    void line(int x0, int y0, int x1, int y1, Pixel color, int width = 1) {
+        if (width <= 1) {
+            const int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+            const int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+            const int steps = std::max(dx, -dy);
+            if (steps == 0 || m_clip.empty()) return;
+
+            // Hanya langkah yang bisa mengenai clip yang dijalani (Liang-Barsky, margin 1 pixel),
+            // jadi garis panjang yang sebagian besar di luar layar tetap murah
+            float t0, t1;
+            Rect<float> area(m_clip.x - 1.0f, m_clip.y - 1.0f, m_clip.w + 2.0f, m_clip.h + 2.0f);
+            if (!clipSegment(Vec2<float>(x0 + 0.5f, y0 + 0.5f), Vec2<float>(x1 + 0.5f, y1 + 0.5f), area, t0, t1)) return;
+            const int first = std::max(static_cast<int>(std::floor(t0 * steps)) - 1, 0);
+            const int last = std::min(static_cast<int>(std::ceil(t1 * steps)) + 1, steps);
+
+            // Status Bresenham setelah first langkah dihitung langsung: sumbu utama maju tiap langkah,
+            // sumbu lain n = floor((2 * minor * k + major) / (2 * major)). Pixel sama persis dengan loop penuh.
+            const int64_t major = steps, minor = std::min(dx, -dy);
+            const int64_t k = first;
+            const int64_t n = (2 * minor * k + major) / (2 * major);
+            const int64_t nx = dx >= -dy ? k : n;
+            const int64_t ny = dx >= -dy ? n : k;
+            int x = x0 + sx * static_cast<int>(nx);
+            int y = y0 + sy * static_cast<int>(ny);
+            int err = static_cast<int>(dx * (1 + ny) + dy * (1 + nx));
+            for (int i = first; i < last; i++) {
+                plot(x, y, color);
+                int e2 = 2 * err;
+                if (e2 >= dy) { err += dy; x += sx; }
+                if (e2 <= dx) { err += dx; y += sy; }
+            }
+            return;
+        }
+
+        float ax = x0 + 0.5f, ay = y0 + 0.5f;
+        float bx = x1 + 0.5f, by = y1 + 0.5f;
+        float half = width * 0.5f;
+        float len = std::sqrt((bx - ax) * (bx - ax) + (by - ay) * (by - ay));
+        if (len > 0.0f) {
+            float nx = -(by - ay) / len * half;
+            float ny = (bx - ax) / len * half;
+            Vec2<float> quad[4] = {
+                Vec2<float>(ax + nx, ay + ny), Vec2<float>(bx + nx, by + ny),
+                Vec2<float>(bx - nx, by - ny), Vec2<float>(ax - nx, ay - ny)
+            };
+            beginPath();
+            addContour(quad, 4);
+            fillPath(FillRule::NonZero, SolidSpan(m_target, color));
+        }
+        ellipseSpans(ax, ay, half, half, SolidSpan(m_target, color));
+        ellipseSpans(bx, by, half, half, SolidSpan(m_target, color));
+    }
+
+    // Polyline 1 pixel dari titik float: pixel sama persis dengan line() per segmen.
+    // Segmen pendek (data series, random walk) didominasi overhead per segmen, jadi titik
+    // dibulatkan sekali saja dan segmen yang kedua ujungnya di dalam clip dijalani langsung
+    // di memori tanpa Liang-Barsky dan tanpa cek clip per pixel (semua pixel Bresenham ada di
+    // dalam kotak kedua ujung). Sisanya lewat line().
+    void polyline(const Vec2<float>* p, int count, bool closed, Pixel color) {
+        if (count < 2 || m_clip.empty()) return;
+        auto round = [](Vec2<float> v) {
+            return Vec2<int>(static_cast<int>(std::nearbyint(v.x)), static_cast<int>(std::nearbyint(v.y)));
+        };
+        const int left = m_clip.x, top = m_clip.y, right = m_clip.right(), bottom = m_clip.bottom();
+        auto inside = [&](Vec2<int> v) { return v.x >= left && v.x < right && v.y >= top && v.y < bottom; };
+        const ptrdiff_t stride = m_target.stride;
+        auto segment = [&](Vec2<int> a, Vec2<int> b) {
+            if (!inside(a) || !inside(b)) {
+                line(a.x, a.y, b.x, b.y, color, 1);
+                return;
+            }
+            const int dx = std::abs(b.x - a.x), dy = -std::abs(b.y - a.y);
+            const int sx = a.x < b.x ? 1 : -1;
+            const ptrdiff_t sy = a.y < b.y ? stride : -stride;
+            const int steps = std::max(dx, -dy);
+            Pixel* at = &m_target.at(a.x, a.y);
+            int err = dx + dy;
+            for (int i = 0; i < steps; i++) {
+                *at = color;
+                int e2 = 2 * err;
+                if (e2 >= dy) { err += dy; at += sx; }
+                if (e2 <= dx) { err += dx; at += sy; }
+            }
+        };
+        Vec2<int> first = round(p[0]), a = first;
+        for (int i = 1; i < count; i++) {
+            Vec2<int> b = round(p[i]);
+            segment(a, b);
+            a = b;
+        }
+        if (closed)
+            segment(a, first);
+    }
+
+    // Ellipse dalam bounding box [left, right) x [top, bottom) seperti Ellipse() GDI
+    void ellipse(int left, int top, int right, int bottom, Pixel fillColor, Pixel strokeColor, bool hasFill, bool hasStroke, int strokeWidth = 1) {
+        float cx = (left + right) * 0.5f;
+        float cy = (top + bottom) * 0.5f;
+        float rx = (right - left) * 0.5f;
+        float ry = (bottom - top) * 0.5f;
+
+        if (hasFill)
+            ellipseSpans(cx, cy, rx, ry, SolidSpan(m_target, fillColor));
+        if (hasStroke)
+            ellipseRingSpans(cx, cy, rx, ry, static_cast<float>(std::max(strokeWidth, 1)), SolidSpan(m_target, strokeColor));
+    }
+
+    template <typename P>
+    void polygon(const P* points, int count, Pixel fillColor, Pixel strokeColor, bool hasFill, bool hasStroke, int strokeWidth = 1, FillRule rule = FillRule::EvenOdd) {
+        if (count < 2) return;
+
+        if (hasFill && count >= 3) {
+            beginPath();
+            addContour(points, count);
+            fillPath(rule, SolidSpan(m_target, fillColor));
+        }
+
+        if (hasStroke) {
+            for (int i = 0; i < count; i++) {
+                const P& a = points[i];
+                const P& b = points[(i + 1) % count];
+                line(static_cast<int>(a.x), static_cast<int>(a.y), static_cast<int>(b.x), static_cast<int>(b.y), strokeColor, strokeWidth);
+            }
+        }
+    }
+
+    // ===== SPAN GENERATORS =====
+
+    template <typename Fn>
+    void rectSpans(int x, int y, int width, int height, Fn&& fn) {
+        int y0 = std::max(y, m_clip.y);
+        int y1 = std::min(y + height, m_clip.y + m_clip.h);
+        for (int row = y0; row < y1; row++)
+            emit(row, x, x + width, fn);
+    }
+
+    template <typename Fn>
+    void ellipseSpans(float cx, float cy, float rx, float ry, Fn&& fn) {
+        if (rx <= 0.0f || ry <= 0.0f) return;
+        int y0 = std::max(static_cast<int>(std::floor(cy - ry)), m_clip.y);
+        int y1 = std::min(static_cast<int>(std::ceil(cy + ry)), m_clip.y + m_clip.h);
+        for (int y = y0; y < y1; y++) {
+            int x0, x1;
+            if (ellipseRow(cx, cy, rx, ry, y, x0, x1))
+                emit(y, x0, x1, fn);
+        }
+    }
+
+    // Cincin ellipse: outline setebal thickness, berpusat di garis tepi
+    template <typename Fn>
+    void ellipseRingSpans(float cx, float cy, float rx, float ry, float thickness, Fn&& fn) {
+        float half = thickness * 0.5f;
+        float orx = rx + half, ory = ry + half;
+        float irx = rx - half, iry = ry - half;
+        if (orx <= 0.0f || ory <= 0.0f) return;
+
+        int y0 = std::max(static_cast<int>(std::floor(cy - ory)), m_clip.y);
+        int y1 = std::min(static_cast<int>(std::ceil(cy + ory)), m_clip.y + m_clip.h);
+        for (int y = y0; y < y1; y++) {
+            int ox0, ox1, ix0, ix1;
+            if (!ellipseRow(cx, cy, orx, ory, y, ox0, ox1))
+                continue;
+            if (irx > 0.0f && iry > 0.0f && ellipseRow(cx, cy, irx, iry, y, ix0, ix1) && ix0 < ix1) {
+                emit(y, ox0, ix0, fn);
+                emit(y, ix1, ox1, fn);
+            } else {
+                emit(y, ox0, ox1, fn);
+            }
+        }
+    }
+
+    // Path polygon: beginPath(), addContour() berkali-kali, lalu fillPath()
+    // Path yang dimulai dengan contour Vec2<Fixed> di-raster seluruhnya dengan integer
+    // (hasil bit-exact di semua compiler); koordinat harus dalam +-2^22 pixel.
+    void beginPath() {
+        m_edges.clear();
+        m_fixedEdges.clear();
+    }
+
+    template <typename P>
+    void addContour(const P* points, int count) {
+        if (count < 2) return;
+        for (int i = 0; i < count; i++) {
+            const P& a = points[i];
+            const P& b = points[(i + 1) % count];
+            addEdge(static_cast<float>(a.x), static_cast<float>(a.y), static_cast<float>(b.x), static_cast<float>(b.y));
+        }
+    }
+
+    void addContour(const Vec2<Fixed>* points, int count) {
+        if (count < 2) return;
+        for (int i = 0; i < count; i++) {
+            const Vec2<Fixed>& a = points[i];
+            const Vec2<Fixed>& b = points[(i + 1) % count];
+            if (m_edges.empty())
+                addEdge(a.x, a.y, b.x, b.y);
+            else
+                addEdge(static_cast<float>(a.x), static_cast<float>(a.y), static_cast<float>(b.x), static_cast<float>(b.y));
+        }
+    }
+
+    void addEdge(Fixed ax, Fixed ay, Fixed bx, Fixed by) {
+        if (ay == by) return;
+        int winding = 1;
+        if (ay > by) {
+            std::swap(ax, bx);
+            std::swap(ay, by);
+            winding = -1;
+        }
+        m_fixedEdges.push_back(FixedEdge{ax.raw, ay.raw, bx.raw, by.raw, winding, 0, 0, 0, 0});
+    }
+
+    void addEdge(float ax, float ay, float bx, float by) {
+        if (!m_fixedEdges.empty()) {
+            addEdge(Fixed(ax), Fixed(ay), Fixed(bx), Fixed(by));
+            return;
+        }
+        if (ay == by) return;
+        int winding = 1;
+        if (ay > by) {
+            std::swap(ax, bx);
+            std::swap(ay, by);
+            winding = -1;
+        }
+        m_edges.push_back(Edge{ax, ay, by, (bx - ax) / (by - ay), winding, 0});
+    }
+
+    // Scanline dengan active edge list; path dikosongkan setelah dipakai
+    template <typename Fn>
+    void fillPath(FillRule rule, Fn&& fn) {
+        if (!m_fixedEdges.empty()) {
+            fillFixedPath(rule, fn);
+            return;
+        }
+        if (m_edges.empty()) return;
+
+        // Counting sort per baris pertama yang dilewati edge: O(n), dan edge yang tidak
+        // melewati pusat baris mana pun (pendek/landai) atau di luar clip vertikal langsung dibuang
+        const float clipTop = static_cast<float>(m_clip.y), clipBottom = static_cast<float>(m_clip.y + m_clip.h);
+        int yStart = m_clip.y + m_clip.h, yEnd = m_clip.y;
+        size_t kept = 0;
+        for (const Edge& e : m_edges) {
+            int row0 = ceilClamped(e.y0 - 0.5f, clipTop, clipBottom);
+            int row1 = ceilClamped(e.y1 - 0.5f, clipTop, clipBottom);
+            if (row0 >= row1) continue;
+            Edge& k = m_edges[kept++];
+            k = e;
+            k.row = row0;
+            yStart = std::min(yStart, row0);
+            yEnd = std::max(yEnd, row1);
+        }
+        m_edges.resize(kept);
+        if (kept == 0) return;
+
+        m_rowStart.assign(static_cast<size_t>(yEnd - yStart) + 1, 0);
+        for (const Edge& e : m_edges)
+            m_rowStart[static_cast<size_t>(e.row - yStart) + 1]++;
+        for (size_t r = 1; r < m_rowStart.size(); r++)
+            m_rowStart[r] += m_rowStart[r - 1];
+        m_sorted.resize(kept);
+        for (const Edge& e : m_edges)
+            m_sorted[m_rowStart[static_cast<size_t>(e.row - yStart)]++] = e;
+        m_edges.swap(m_sorted);
+
+        // Edge aktif disalin (bukan index) supaya loop per baris membaca memori berurutan
+        size_t next = 0;
+        m_activeEdges.clear();
+
+        for (int y = yStart; y < yEnd; y++) {
+            float sy = y + 0.5f;
+
+            while (next < m_edges.size() && m_edges[next].row == y)
+                m_activeEdges.push_back(m_edges[next++]);
+
+            // Banyak crossing (stroke panjang, polyline jutaan titik): tanpa sort, lihat denseRow
+            if (m_activeEdges.size() * 16 > static_cast<size_t>(m_clip.w)) {
+                denseRow(y, sy, rule, fn);
+                continue;
+            }
+
+            m_crossings.clear();
+            size_t keep = 0;
+            for (size_t i = 0; i < m_activeEdges.size(); i++) {
+                const Edge& e = m_activeEdges[i];
+                if (e.y1 <= sy) continue;
+                m_crossings.push_back(Crossing{e.x0 + (sy - e.y0) * e.dxdy, e.winding});
+                m_activeEdges[keep++] = e;
+            }
+            m_activeEdges.resize(keep);
+
+            if (m_crossings.size() < 2) continue;
+            std::sort(m_crossings.begin(), m_crossings.end(), [](const Crossing& a, const Crossing& b) { return a.x < b.x; });
+
+            if (rule == FillRule::EvenOdd) {
+                for (size_t i = 0; i + 1 < m_crossings.size(); i += 2)
+                    emit(y, pixelEdge(m_crossings[i].x), pixelEdge(m_crossings[i + 1].x), fn);
+            } else {
+                int winding = 0;
+                float start = 0.0f;
+                for (const Crossing& c : m_crossings) {
+                    int before = winding;
+                    winding += c.winding;
+                    if (before == 0 && winding != 0)
+                        start = c.x;
+                    else if (before != 0 && winding == 0)
+                        emit(y, pixelEdge(start), pixelEdge(c.x), fn);
+                }
+            }
+        }
+
+        m_edges.clear();
+    }
+
+private:
+    // Edge fixed point; posisi x tepat di baris aktif = x + rem / dy (dalam raw),
+    // dimajukan per baris dengan step integer tanpa pembagian
+    struct FixedEdge {
+        int32_t x0, y0, x1, y1;
+        int winding;
+        int64_t x, rem, stepX, stepRem;
+    };
+
+    struct FixedCrossing {
+        int x;
+        int winding;
+    };
+
+    struct Edge {
+        float x0, y0, y1;
+        float dxdy;
+        int winding;
+        int row;        // baris pertama yang disampling (diisi fillPath)
+    };
+
+    struct Crossing {
+        float x;
+        int winding;
+    };
+
+    Surface m_target;
+    Rect<int> m_clip;
+    std::vector<Edge> m_edges;
+    std::vector<Edge> m_sorted;
+    std::vector<size_t> m_rowStart;
+    std::vector<size_t> m_active;
+    std::vector<Edge> m_activeEdges;
+    std::vector<Crossing> m_crossings;
+    std::vector<int> m_coverage;
+    std::vector<FixedEdge> m_fixedEdges;
+    std::vector<FixedCrossing> m_fixedCrossings;
+
+    // Clip span ke clip rect lalu teruskan ke callback
+    template <typename Fn>
+    void emit(int y, int x0, int x1, Fn& fn) const {
+        if (y < m_clip.y || y >= m_clip.y + m_clip.h) return;
+        if (x0 < m_clip.x) x0 = m_clip.x;
+        if (x1 > m_clip.x + m_clip.w) x1 = m_clip.x + m_clip.w;
+        if (x0 < x1) fn(y, x0, x1);
+    }
+
+    // Baris dengan banyak edge aktif: crossing tidak di-sort, winding dijumlah per pixel clip
+    // lalu di-prefix sum. Pixel yang terisi sama persis dengan jalur sort karena keduanya
+    // menilai winding di pusat pixel; hanya pembagian span-nya yang bisa berbeda.
+    template <typename Fn>
+    void denseRow(int y, float sy, FillRule rule, Fn& fn) {
+        const int left = m_clip.x, right = m_clip.x + m_clip.w;
+        const float leftEdge = static_cast<float>(left) - 1.0f, rightEdge = static_cast<float>(right) + 0.5f;
+        const float clipLeft = static_cast<float>(left), clipRight = static_cast<float>(right);
+        m_coverage.assign(static_cast<size_t>(m_clip.w), 0);
+        size_t keep = 0;
+        for (size_t i = 0; i < m_activeEdges.size(); i++) {
+            const Edge& e = m_activeEdges[i];
+            if (e.y1 <= sy) continue;
+            float cx = e.x0 + (sy - e.y0) * e.dxdy;
+            if (cx < rightEdge) {
+                int x = ceilClamped(std::max(cx, leftEdge) - 0.5f, clipLeft, clipRight);
+                if (x < right)
+                    m_coverage[static_cast<size_t>(x - left)] += rule == FillRule::EvenOdd ? 1 : e.winding;
+            }
+            m_activeEdges[keep++] = e;
+        }
+        m_activeEdges.resize(keep);
+
+        int winding = 0, start = -1;
+        for (int x = 0; x < m_clip.w; x++) {
+            winding += m_coverage[static_cast<size_t>(x)];
+            bool inside = rule == FillRule::EvenOdd ? (winding & 1) != 0 : winding != 0;
+            if (inside && start < 0) {
+                start = x;
+            } else if (!inside && start >= 0) {
+                fn(y, left + start, left + x);
+                start = -1;
+            }
+        }
+        if (start >= 0) fn(y, left + start, right);
+    }
+
+    // Sama dengan fillPath versi float, tapi semua posisi dihitung tepat dengan integer
+    template <typename Fn>
+    void fillFixedPath(FillRule rule, Fn& fn) {
+        const int64_t half = Fixed::ONE / 2;
+        std::sort(m_fixedEdges.begin(), m_fixedEdges.end(), [](const FixedEdge& a, const FixedEdge& b) { return a.y0 < b.y0; });
+        int32_t maxY = m_fixedEdges.front().y1;
+        for (const FixedEdge& e : m_fixedEdges)
+            maxY = std::max(maxY, e.y1);
+
+        // Baris y disampling di y * 256 + 128
+        int yStart = std::max(static_cast<int>(ceilDiv(m_fixedEdges.front().y0 - half, Fixed::ONE)), m_clip.y);
+        int yEnd = std::min(static_cast<int>(ceilDiv(maxY - half, Fixed::ONE)), m_clip.y + m_clip.h);
+
+        size_t next = 0;
+        m_active.clear();
+
+        for (int y = yStart; y < yEnd; y++) {
+            const int64_t sy = static_cast<int64_t>(y) * Fixed::ONE + half;
+
+            while (next < m_fixedEdges.size() && m_fixedEdges[next].y0 <= sy) {
+                FixedEdge& e = m_fixedEdges[next];
+                const int64_t dy = e.y1 - e.y0;
+                const int64_t dx = static_cast<int64_t>(e.x1) - e.x0;
+                const int64_t num = (sy - e.y0) * dx;
+                const int64_t q = floorDiv(num, dy);
+                e.x = e.x0 + q;
+                e.rem = num - q * dy;
+                e.stepX = floorDiv(dx * Fixed::ONE, dy);
+                e.stepRem = dx * Fixed::ONE - e.stepX * dy;
+                m_active.push_back(next++);
+            }
+
+            m_fixedCrossings.clear();
+            size_t keep = 0;
+            for (size_t i = 0; i < m_active.size(); i++) {
+                FixedEdge& e = m_fixedEdges[m_active[i]];
+                if (e.y1 <= sy) continue;
+                m_active[keep++] = m_active[i];
+                // Pixel pertama yang tengahnya >= x tepat (x + rem / dy)
+                const int64_t cx = e.x - half;
+                const int64_t px = floorDiv(cx, Fixed::ONE);
+                m_fixedCrossings.push_back(FixedCrossing{static_cast<int>(px + (cx != px * Fixed::ONE || e.rem != 0)), e.winding});
+                e.x += e.stepX;
+                e.rem += e.stepRem;
+                if (e.rem >= e.y1 - e.y0) {
+                    e.rem -= e.y1 - e.y0;
+                    e.x++;
+                }
+            }
+            m_active.resize(keep);
+
+            if (m_fixedCrossings.size() < 2) continue;
+            std::sort(m_fixedCrossings.begin(), m_fixedCrossings.end(), [](const FixedCrossing& a, const FixedCrossing& b) {
+                return a.x != b.x ? a.x < b.x : a.winding < b.winding;
+            });
+
+            if (rule == FillRule::EvenOdd) {
+                for (size_t i = 0; i + 1 < m_fixedCrossings.size(); i += 2)
+                    emit(y, m_fixedCrossings[i].x, m_fixedCrossings[i + 1].x, fn);
+            } else {
+                int winding = 0;
+                int start = 0;
+                for (const FixedCrossing& c : m_fixedCrossings) {
+                    int before = winding;
+                    winding += c.winding;
+                    if (before == 0 && winding != 0)
+                        start = c.x;
+                    else if (before != 0 && winding == 0)
+                        emit(y, start, c.x, fn);
+                }
+            }
+        }
+
+        m_fixedEdges.clear();
+    }
+
+    // Pembagian bulat ke bawah / ke atas, pembagi selalu positif
+    static int64_t floorDiv(int64_t a, int64_t b) {
+        return a >= 0 ? a / b : -((-a + b - 1) / b);
+    }
+
+    static int64_t ceilDiv(int64_t a, int64_t b) {
+        return -floorDiv(-a, b);
+    }
+
+    // Pixel pertama yang tengahnya berada di kanan x
+    // ceil tanpa panggilan libm (tanpa SSE4.1 std::ceil tidak di-inline), hasil di [lo, hi]
+    static int ceilClamped(float v, float lo, float hi) {
+        v = std::min(std::max(v, lo), hi);
+        int i = static_cast<int>(v);
+        return i + (static_cast<float>(i) < v ? 1 : 0);
+    }
+
+    static int pixelEdge(float x) {
+        return static_cast<int>(std::ceil(x - 0.5f));
+    }
+
+    static bool ellipseRow(float cx, float cy, float rx, float ry, int y, int& x0, int& x1) {
+        float dy = (y + 0.5f - cy) / ry;
+        float t = 1.0f - dy * dy;
+        if (t < 0.0f) return false;
+        float half = rx * std::sqrt(t);
+        x0 = pixelEdge(cx - half);
+        x1 = pixelEdge(cx + half);
+        return x0 < x1;
+    }
+};
+
+} // namespace z
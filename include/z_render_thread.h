@@ -0,0 +1,264 @@
+#pragma once
+#include "z_platform.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cstdint>
+#include "z_drawlist.h"
+#include "z_canvas.h"
+
+namespace z {
+
+// Triple buffer lock-free satu produser / satu konsumer.
+// Produser menulis back(), publish() menukar back dengan slot "ready".
+// Konsumer acquire() menukar front dengan ready kalau ada frame baru.
+// Tidak ada yang saling menunggu: frame yang belum sempat diambil ditimpa (dropped).
+template <typename T>
+class FrameMailbox {
+public:
+    FrameMailbox() = default;
+    FrameMailbox(const FrameMailbox&) = delete;
+    FrameMailbox& operator=(const FrameMailbox&) = delete;
+
+    // Produser
+    T& back() { return m_slots[m_back]; }
+
+    // Return true kalau frame sebelumnya belum diambil dan ditimpa;
+    // slot frame itu menjadi back() yang baru.
+    bool publish() {
+        uint8_t prev = m_ready.exchange(static_cast<uint8_t>(m_back | NEW_FLAG), std::memory_order_acq_rel);
+        bool replaced = (prev & NEW_FLAG) != 0;
+        if (replaced)
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        m_back = prev & INDEX_MASK;
+        m_published.fetch_add(1, std::memory_order_relaxed);
+        return replaced;
+    }
+
+    // Konsumer. Return false kalau tidak ada frame baru sejak acquire() terakhir
+    bool acquire() {
+        if (!(m_ready.load(std::memory_order_acquire) & NEW_FLAG))
+            return false;
+        uint8_t prev = m_ready.exchange(static_cast<uint8_t>(m_front), std::memory_order_acq_rel);
+        m_front = prev & INDEX_MASK;
+        return true;
+    }
+
+    const T& front() const { return m_slots[m_front]; }
+
+    uint64_t published() const { return m_published.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t NEW_FLAG = 0x4;
+
+    T m_slots[3];
+    uint8_t m_back = 0;                     // hanya produser
+    uint8_t m_front = 1;                    // hanya konsumer
+    std::atomic<uint8_t> m_ready{2};        // index slot + NEW_FLAG
+    std::atomic<uint64_t> m_published{0};
+    std::atomic<uint64_t> m_dropped{0};
+};
+
+// Snapshot satu frame yang diserahkan ke render thread
+struct RenderFrame {
+    DrawList list;
+    uint64_t id = 0;
+    int64_t inputTicks = 0;     // 0 = frame ini tidak membawa input baru
+};
+
+// Statistik render thread, waktu dalam milidetik
+struct RenderStats {
+    uint64_t submitted = 0;
+    uint64_t presented = 0;
+    uint64_t dropped = 0;           // ditimpa frame lebih baru sebelum sempat digambar
+
+    uint64_t latencySamples = 0;    // frame yang membawa input
+    double lastLatencyMs = 0.0;     // input diterima -> present selesai
+    double maxLatencyMs = 0.0;
+    double totalLatencyMs = 0.0;
+
+    double lastRenderMs = 0.0;      // draw + present
+    double totalRenderMs = 0.0;
+
+    double averageLatencyMs() const {
+        return latencySamples ? totalLatencyMs / static_cast<double>(latencySamples) : 0.0;
+    }
+
+    double averageRenderMs() const {
+        return presented ? totalRenderMs / static_cast<double>(presented) : 0.0;
+    }
+};
+
+// Render thread opsional: Canvas dibuat dan dipakai hanya di thread ini.
+// Thread UI merekam DrawList lewat beginFrame()/submit() tanpa pernah menunggu
+// rasterisasi; render thread selalu mengambil frame terbaru dari mailbox.
+//
+//   z::RenderThread renderer(window.handle());
+//   DrawList& list = renderer.beginFrame();
+//   list.clearColor(RGB(20, 20, 30));
+//   renderer.submit(window.takeInputTicks());
+class RenderThread {
+public:
+    explicit RenderThread(NativeHandle window) : m_window(window) {
+        m_freq = platform::tickFrequency();
+        m_thread = std::thread([this] { threadMain(); });
+    }
+
+    ~RenderThread() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wakeCv.notify_one();
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // List kosong untuk frame berikutnya (slot back mailbox, hanya thread UI)
+    DrawList& beginFrame() {
+        DrawList& list = m_mailbox.back().list;
+        list.clear();
+        return list;
+    }
+
+    // Serahkan frame ke render thread. inputTicks dari Window::takeInputTicks()
+    void submit(int64_t inputTicks = 0) {
+        // m_submittedId hanya ditulis thread UI, jadi boleh dibaca tanpa lock di sini
+        uint64_t id = m_submittedId + 1;
+        RenderFrame& frame = m_mailbox.back();
+        frame.id = id;
+        frame.inputTicks = earliestTicks(inputTicks, m_carryInputTicks);
+        m_carryInputTicks = 0;
+
+        // Input dari frame yang ditimpa dibawa ke frame berikutnya supaya latency tetap terukur
+        if (m_mailbox.publish())
+            m_carryInputTicks = m_mailbox.back().inputTicks;
+
+        // Signal setelah publish, supaya render thread yang bangun pasti melihat frame ini
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_submittedId = id;
+            m_signaled = true;
+        }
+        m_wakeCv.notify_one();
+    }
+
+    // Canvas di-resize di render thread sebelum frame berikutnya
+    void resize() {
+        m_resizePending.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_signaled = true;
+        }
+        m_wakeCv.notify_one();
+    }
+
+    // Tunggu sampai frame terakhir yang di-submit sudah di-present.
+    // Untuk test/screenshot; loop normal tidak perlu memanggil ini.
+    void flush() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCv.wait(lock, [this] { return m_presentedId >= m_submittedId; });
+    }
+
+    RenderStats stats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        RenderStats stats = m_stats;
+        stats.submitted = m_submittedId - m_statsBaseSubmitted;
+        stats.dropped = m_mailbox.dropped() - m_statsBaseDropped;
+        return stats;
+    }
+
+    void resetStats() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats = RenderStats();
+        m_statsBaseSubmitted = m_submittedId;
+        m_statsBaseDropped = m_mailbox.dropped();
+    }
+
+private:
+    NativeHandle m_window;
+    std::thread m_thread;
+    FrameMailbox<RenderFrame> m_mailbox;
+    std::atomic<bool> m_resizePending{false};
+    int64_t m_freq = 1;
+    int64_t m_carryInputTicks = 0;      // hanya thread UI
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeCv;
+    std::condition_variable m_doneCv;
+    bool m_signaled = false;
+    bool m_stop = false;
+    uint64_t m_submittedId = 0;
+    uint64_t m_presentedId = 0;
+    RenderStats m_stats;
+    uint64_t m_statsBaseSubmitted = 0;
+    uint64_t m_statsBaseDropped = 0;
+
+    static int64_t earliestTicks(int64_t a, int64_t b) {
+        if (a == 0) return b;
+        if (b == 0) return a;
+        return std::min(a, b);
+    }
+
+    double ticksToMs(int64_t ticks) const {
+        return static_cast<double>(ticks) * 1000.0 / static_cast<double>(m_freq);
+    }
+
+    void threadMain() {
+        Canvas canvas(m_window);
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeCv.wait(lock, [this] { return m_signaled || m_stop; });
+                if (m_stop)
+                    break;
+                m_signaled = false;
+            }
+
+            if (m_resizePending.exchange(false, std::memory_order_acq_rel))
+                canvas.resize();
+
+            if (!m_mailbox.acquire())
+                continue;
+
+            const RenderFrame& frame = m_mailbox.front();
+            int64_t start = platform::ticks();
+            canvas.draw(frame.list);
+            canvas.present();
+            int64_t end = platform::ticks();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stats.presented++;
+                m_stats.lastRenderMs = ticksToMs(end - start);
+                m_stats.totalRenderMs += m_stats.lastRenderMs;
+                if (frame.inputTicks != 0) {
+                    double latency = ticksToMs(end - frame.inputTicks);
+                    m_stats.latencySamples++;
+                    m_stats.lastLatencyMs = latency;
+                    m_stats.totalLatencyMs += latency;
+                    m_stats.maxLatencyMs = std::max(m_stats.maxLatencyMs, latency);
+                }
+                m_presentedId = frame.id;
+            }
+            m_doneCv.notify_all();
+        }
+
+        // Jangan biarkan flush() menunggu selamanya setelah stop
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_presentedId = m_submittedId;
+        }
+        m_doneCv.notify_all();
+    }
+};
+
+} // namespace z
@@ -0,0 +1,284 @@
+#pragma once
+#include "z_platform.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+#include "z_image.h"
+#include "z_simd.h"
+#include "z_arena.h"
+#include "z_jobs.h"
+
+namespace z {
+
+enum class Filter {
+    Nearest,
+    Bilinear    // 2x2 tap, bobot 8-bit; downscale > 2x mulai aliasing
+};
+
+namespace detail {
+
+// ===== KERNEL BARIS =====
+// Bobot w = 0..255 (per 256). Per channel: (a * (256 - w) + b * w + 128) >> 8,
+// maksimum 255 * 256 + 128 muat di lane 16-bit unsigned. Semua level hasilnya identik.
+
+inline Pixel lerpPixel(Pixel a, Pixel b, uint32_t w) {
+    Pixel out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t x = ((a >> shift) & 0xFF) * (256 - w) + ((b >> shift) & 0xFF) * w + 128;
+        out |= (x >> 8) << shift;
+    }
+    return out;
+}
+
+// out[i] = lerp(a[i], b[i], w)
+inline void lerpRowScalar(const Pixel* a, const Pixel* b, uint32_t w, Pixel* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = lerpPixel(a[i], b[i], w);
+}
+
+// out[i] = lerp(row[ix[i]], row[ix[i] + 1], w[i])
+inline void lerpColumnsScalar(const Pixel* row, const int32_t* ix, const int32_t* w, Pixel* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = lerpPixel(row[ix[i]], row[ix[i] + 1], static_cast<uint32_t>(w[i]));
+}
+
+inline void gatherScalar(const Pixel* row, const int32_t* ix, Pixel* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = row[ix[i]];
+}
+
+#if Z_HAS_SSE2
+
+// a, b 4 pixel; wlo/whi bobot per channel untuk pixel 0-1 / 2-3
+inline __m128i lerpQuad(__m128i a, __m128i b, __m128i wlo, __m128i whi) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c256 = _mm_set1_epi16(256);
+    const __m128i c128 = _mm_set1_epi16(128);
+    __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_sub_epi16(c256, wlo)),
+                                             _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), wlo)), c128);
+    __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_sub_epi16(c256, whi)),
+                                             _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), whi)), c128);
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+inline void lerpRowSse(const Pixel* a, const Pixel* b, uint32_t w, Pixel* out, size_t n) {
+    const __m128i vw = _mm_set1_epi16(static_cast<short>(w));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i pa = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i pb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), lerpQuad(pa, pb, vw, vw));
+    }
+    lerpRowScalar(a + i, b + i, w, out + i, n - i);
+}
+
+inline void lerpColumnsSse(const Pixel* row, const int32_t* ix, const int32_t* w, Pixel* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        // Pasangan (row[ix], row[ix + 1]) dengan satu load 64-bit
+        __m128i q01 = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + ix[i])),
+                                         _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + ix[i + 1])));
+        __m128i q23 = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + ix[i + 2])),
+                                         _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + ix[i + 3])));
+        q01 = _mm_shuffle_epi32(q01, _MM_SHUFFLE(3, 1, 2, 0));     // a0 a1 b0 b1
+        q23 = _mm_shuffle_epi32(q23, _MM_SHUFFLE(3, 1, 2, 0));     // a2 a3 b2 b3
+        __m128i a = _mm_unpacklo_epi64(q01, q23);
+        __m128i b = _mm_unpackhi_epi64(q01, q23);
+        __m128i vw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + i));
+        vw = _mm_or_si128(vw, _mm_slli_epi32(vw, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), lerpQuad(a, b, _mm_unpacklo_epi32(vw, vw), _mm_unpackhi_epi32(vw, vw)));
+    }
+    lerpColumnsScalar(row, ix + i, w + i, out + i, n - i);
+}
+
+#endif // Z_HAS_SSE2
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+
+Z_TARGET_AVX2 inline __m256i lerpOct(__m256i a, __m256i b, __m256i wlo, __m256i whi) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i c256 = _mm256_set1_epi16(256);
+    const __m256i c128 = _mm256_set1_epi16(128);
+    __m256i lo = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_sub_epi16(c256, wlo)),
+                                                   _mm256_mullo_epi16(_mm256_unpacklo_epi8(b, zero), wlo)), c128);
+    __m256i hi = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_sub_epi16(c256, whi)),
+                                                   _mm256_mullo_epi16(_mm256_unpackhi_epi8(b, zero), whi)), c128);
+    return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+Z_TARGET_AVX2 inline void lerpRowAvx(const Pixel* a, const Pixel* b, uint32_t w, Pixel* out, size_t n) {
+    const __m256i vw = _mm256_set1_epi16(static_cast<short>(w));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i pa = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i pb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), lerpOct(pa, pb, vw, vw));
+    }
+    lerpRowSse(a + i, b + i, w, out + i, n - i);
+}
+
+Z_TARGET_AVX2 inline void lerpColumnsAvx(const Pixel* row, const int32_t* ix, const int32_t* w, Pixel* out, size_t n) {
+    const int* base = reinterpret_cast<const int*>(row);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ix + i));
+        __m256i a = _mm256_i32gather_epi32(base, index, 4);
+        __m256i b = _mm256_i32gather_epi32(base + 1, index, 4);
+        __m256i vw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+        vw = _mm256_or_si256(vw, _mm256_slli_epi32(vw, 16));
+        // unpack per lane 128-bit cocok dengan urutan unpack pixel di lerpOct
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), lerpOct(a, b, _mm256_unpacklo_epi32(vw, vw), _mm256_unpackhi_epi32(vw, vw)));
+    }
+    lerpColumnsSse(row, ix + i, w + i, out + i, n - i);
+}
+
+Z_TARGET_AVX2 inline void gatherAvx(const Pixel* row, const int32_t* ix, Pixel* out, size_t n) {
+    const int* base = reinterpret_cast<const int*>(row);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ix + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi32(base, index, 4));
+    }
+    gatherScalar(row, ix + i, out + i, n - i);
+}
+
+#endif // Z_SIMD_AVX2
+
+inline void lerpRow(const Pixel* a, const Pixel* b, uint32_t w, Pixel* out, size_t n) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: lerpRowAvx(a, b, w, out, n); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: lerpRowSse(a, b, w, out, n); return;
+#endif
+        default: lerpRowScalar(a, b, w, out, n); return;
+    }
+}
+
+inline void lerpColumns(const Pixel* row, const int32_t* ix, const int32_t* w, Pixel* out, size_t n) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: lerpColumnsAvx(row, ix, w, out, n); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: lerpColumnsSse(row, ix, w, out, n); return;
+#endif
+        default: lerpColumnsScalar(row, ix, w, out, n); return;
+    }
+}
+
+inline void gather(const Pixel* row, const int32_t* ix, Pixel* out, size_t n) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+    if (simd::level() == simd::Level::AVX2) {
+        gatherAvx(row, ix, out, n);
+        return;
+    }
+#endif
+    gatherScalar(row, ix, out, n);
+}
+
+// ===== PEMETAAN 16.16 =====
+// Pusat pixel tujuan i dipetakan ke pusat pixel source: pos = origin + (i + 0.5) * step.
+// Nearest memakai floor(pos); bilinear memakai pos - 0.5, dijepit ke tepi source.
+
+struct Sample {
+    int32_t index;
+    int32_t weight;     // 0..255, bobot untuk index + 1
+};
+
+inline Sample sampleAt(int64_t origin, int64_t step, int i, int lo, int hi, Filter filter) {
+    int64_t pos = origin + step * i + step / 2;
+    if (filter == Filter::Nearest)
+        return Sample{ static_cast<int32_t>(std::clamp<int64_t>(pos >> 16, lo, hi - 1)), 0 };
+    pos -= 0x8000;
+    if (pos < static_cast<int64_t>(lo) << 16) return Sample{ lo, 0 };
+    int64_t index = pos >> 16;
+    if (index >= hi - 1) return Sample{ hi - 1, 0 };
+    return Sample{ static_cast<int32_t>(index), static_cast<int32_t>((pos >> 8) & 0xFF) };
+}
+
+// Di atas ini baris dibagi ke Jobs (kalau ada)
+inline constexpr int scaleParallelPixels = 256 * 256;
+
+} // namespace detail
+
+// Gambar bagian source dari image diskalakan ke rect dest (device), dipotong ke clip
+// (clip harus di dalam target). Hasil filter lalu digabung sesuai blendMode() image;
+// ColorKey selalu memakai Nearest supaya warna key tidak tercampur ke tepi.
+// Bilinear pada alpha tidak premultiplied: tepi pixel transparan ikut memberi warna.
+// jobs (opsional): dest besar dikerjakan per potongan baris secara paralel.
+inline void blitScaled(const Surface& target, Rect<int> clip, const Image& image, Rect<int> source, Rect<int> dest,
+                       Filter filter = Filter::Bilinear, Jobs* jobs = nullptr) {
+    Rect<int> src = source.intersect(image.bounds());
+    if (src.empty() || source.w <= 0 || source.h <= 0 || dest.w <= 0 || dest.h <= 0) return;
+    Rect<int> visible = dest.intersect(clip);
+    if (visible.empty()) return;
+    if (image.blendMode() == BlendMode::ColorKey) filter = Filter::Nearest;
+
+    // Step dari rect source yang diminta; sampel di luar image dijepit ke tepi
+    const int64_t stepX = (static_cast<int64_t>(source.w) << 16) / dest.w;
+    const int64_t stepY = (static_cast<int64_t>(source.h) << 16) / dest.h;
+    const int64_t originX = static_cast<int64_t>(source.x) << 16;
+    const int64_t originY = static_cast<int64_t>(source.y) << 16;
+    const size_t width = static_cast<size_t>(visible.w);
+    const int firstColumn = visible.x - dest.x;
+    const int firstRow = visible.y - dest.y;
+
+    // Kolom dipakai semua baris: index relatif ke kolom source pertama yang terpakai
+    ArenaScope scratch;
+    int32_t* ix = scratch.arena().allocateArray<int32_t>(width);
+    int32_t* wx = scratch.arena().allocateArray<int32_t>(width);
+    for (size_t i = 0; i < width; i++) {
+        detail::Sample s = detail::sampleAt(originX, stepX, firstColumn + static_cast<int>(i), src.x, src.right(), filter);
+        ix[i] = s.index;
+        wx[i] = s.weight;
+    }
+    const int columnBegin = ix[0];
+    const int columnEnd = std::min(ix[width - 1] + 2, src.right());     // eksklusif
+    const size_t span = static_cast<size_t>(columnEnd - columnBegin);
+    if (filter == Filter::Bilinear)
+        for (size_t i = 0; i < width; i++) ix[i] -= columnBegin;
+
+    const BlendMode mode = image.blendMode();
+    const Pixel key = image.colorKey();
+
+    auto rows = [&](size_t begin, size_t end) {
+        ArenaScope rowScratch;
+        Pixel* line = rowScratch.arena().allocateArray<Pixel>(width);
+        Pixel* column = rowScratch.arena().allocateArray<Pixel>(span + 1);
+        for (size_t r = begin; r < end; r++) {
+            const int y = visible.y + static_cast<int>(r);
+            Pixel* to = target.row(y) + visible.x;
+            Pixel* out = mode == BlendMode::Opaque ? to : line;
+            detail::Sample sy = detail::sampleAt(originY, stepY, firstRow + static_cast<int>(r), src.y, src.bottom(), filter);
+            if (filter == Filter::Nearest) {
+                detail::gather(image.row(sy.index), ix, out, width);
+            } else {
+                // Vertikal sekali per kolom source, lalu horizontal per pixel tujuan
+                const Pixel* top = image.row(sy.index) + columnBegin;
+                if (sy.weight == 0)
+                    std::memcpy(column, top, span * sizeof(Pixel));
+                else
+                    detail::lerpRow(top, image.row(sy.index + 1) + columnBegin, static_cast<uint32_t>(sy.weight), column, span);
+                column[span] = column[span - 1];        // ix + 1 di kolom terakhir (bobotnya 0)
+                detail::lerpColumns(column, ix, wx, out, width);
+            }
+            if (mode == BlendMode::Alpha)
+                blitAlpha(line, to, width);
+            else if (mode == BlendMode::ColorKey)
+                blitColorKey(line, to, width, key);
+        }
+    };
+
+    const size_t height = static_cast<size_t>(visible.h);
+    if (jobs && jobs->threadCount() > 1 && width * height >= static_cast<size_t>(detail::scaleParallelPixels))
+        jobs->parallelFor(0, height, rows, std::max<size_t>(16, height / (jobs->threadCount() * 4)));
+    else
+        rows(0, height);
+}
+
+} // namespace z
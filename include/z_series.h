@@ -0,0 +1,382 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "z_simd.h"
+#include "z_jobs.h"
+
+namespace z {
+
+enum class SeriesMode {
+    MinMax,     // envelope min/max per kolom pixel, semua puncak terlihat
+    Lttb        // Largest-Triangle-Three-Buckets: satu titik per kolom, bentuk kurva terjaga
+};
+
+// Rentang [begin, end]: index sampel (x) atau nilai (y). double supaya index di atas 2^24 tetap tepat.
+struct SeriesRange {
+    double begin = 0.0;
+    double end = 0.0;
+
+    SeriesRange() = default;
+    SeriesRange(double begin, double end) : begin(begin), end(end) {}
+};
+
+// ===== MIN/MAX =====
+// NaN dianggap celah (diabaikan); rentang tanpa nilai valid memberi low > high.
+
+namespace detail {
+
+inline void seriesMinMaxScalar(const float* p, size_t n, float& low, float& high) {
+    for (size_t i = 0; i < n; i++) {
+        low = simd::detail::MinOp::scalar(low, p[i]);
+        high = simd::detail::MaxOp::scalar(high, p[i]);
+    }
+}
+
+#if Z_HAS_SSE2
+inline void seriesMinMaxSse(const float* p, size_t n, float& low, float& high) {
+    size_t i = 0;
+    if (n >= 8) {
+        __m128 lo0 = _mm_set1_ps(low), lo1 = lo0, hi0 = _mm_set1_ps(high), hi1 = hi0;
+        for (; i + 8 <= n; i += 8) {
+            __m128 a = _mm_loadu_ps(p + i), b = _mm_loadu_ps(p + i + 4);
+            lo0 = simd::detail::MinOp::sse(lo0, a);
+            lo1 = simd::detail::MinOp::sse(lo1, b);
+            hi0 = simd::detail::MaxOp::sse(hi0, a);
+            hi1 = simd::detail::MaxOp::sse(hi1, b);
+        }
+        alignas(16) float lo[4], hi[4];
+        _mm_store_ps(lo, simd::detail::MinOp::sse(lo0, lo1));
+        _mm_store_ps(hi, simd::detail::MaxOp::sse(hi0, hi1));
+        for (int k = 0; k < 4; k++) {
+            low = simd::detail::MinOp::scalar(low, lo[k]);
+            high = simd::detail::MaxOp::scalar(high, hi[k]);
+        }
+    }
+    seriesMinMaxScalar(p + i, n - i, low, high);
+}
+#endif
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+Z_TARGET_AVX2 inline void seriesMinMaxAvx(const float* p, size_t n, float& low, float& high) {
+    size_t i = 0;
+    if (n >= 16) {
+        __m256 lo0 = _mm256_set1_ps(low), lo1 = lo0, hi0 = _mm256_set1_ps(high), hi1 = hi0;
+        for (; i + 16 <= n; i += 16) {
+            __m256 a = _mm256_loadu_ps(p + i), b = _mm256_loadu_ps(p + i + 8);
+            lo0 = simd::detail::MinOp::avx(lo0, a);
+            lo1 = simd::detail::MinOp::avx(lo1, b);
+            hi0 = simd::detail::MaxOp::avx(hi0, a);
+            hi1 = simd::detail::MaxOp::avx(hi1, b);
+        }
+        alignas(32) float lo[8], hi[8];
+        _mm256_store_ps(lo, simd::detail::MinOp::avx(lo0, lo1));
+        _mm256_store_ps(hi, simd::detail::MaxOp::avx(hi0, hi1));
+        for (int k = 0; k < 8; k++) {
+            low = simd::detail::MinOp::scalar(low, lo[k]);
+            high = simd::detail::MaxOp::scalar(high, hi[k]);
+        }
+    }
+    seriesMinMaxScalar(p + i, n - i, low, high);
+}
+#endif
+
+// Min/max per blok 32 sampel utuh (level daun pyramid): reduksi horizontal di register,
+// tanpa store + loop scalar per blok
+inline void seriesLeavesScalar(const float* p, size_t blocks, float* low, float* high) {
+    for (size_t b = 0; b < blocks; b++) {
+        float lo = std::numeric_limits<float>::infinity(), hi = -lo;
+        seriesMinMaxScalar(p + b * 32, 32, lo, hi);
+        low[b] = lo;
+        high[b] = hi;
+    }
+}
+
+#if Z_HAS_SSE2
+inline void seriesLeavesSse(const float* p, size_t blocks, float* low, float* high) {
+    const __m128 inf = _mm_set1_ps(std::numeric_limits<float>::infinity()), ninf = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+    for (size_t b = 0; b < blocks; b++, p += 32) {
+        // Akumulator mulai dari +-inf supaya NaN di data tidak pernah masuk lane
+        __m128 lo = inf, hi = ninf;
+        for (int k = 0; k < 32; k += 4) {
+            __m128 v = _mm_loadu_ps(p + k);
+            lo = simd::detail::MinOp::sse(lo, v);
+            hi = simd::detail::MaxOp::sse(hi, v);
+        }
+        lo = _mm_min_ps(lo, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(1, 0, 3, 2)));
+        hi = _mm_max_ps(hi, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(1, 0, 3, 2)));
+        lo = _mm_min_ps(lo, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(2, 3, 0, 1)));
+        hi = _mm_max_ps(hi, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(2, 3, 0, 1)));
+        low[b] = _mm_cvtss_f32(lo);
+        high[b] = _mm_cvtss_f32(hi);
+    }
+}
+#endif
+
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+Z_TARGET_AVX2 inline void seriesLeavesAvx(const float* p, size_t blocks, float* low, float* high) {
+    const __m256 inf = _mm256_set1_ps(std::numeric_limits<float>::infinity()), ninf = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+    for (size_t b = 0; b < blocks; b++, p += 32) {
+        __m256 v0 = _mm256_loadu_ps(p), v1 = _mm256_loadu_ps(p + 8), v2 = _mm256_loadu_ps(p + 16), v3 = _mm256_loadu_ps(p + 24);
+        __m256 lo01 = simd::detail::MinOp::avx(simd::detail::MinOp::avx(inf, v0), v1);
+        __m256 lo23 = simd::detail::MinOp::avx(simd::detail::MinOp::avx(inf, v2), v3);
+        __m256 hi01 = simd::detail::MaxOp::avx(simd::detail::MaxOp::avx(ninf, v0), v1);
+        __m256 hi23 = simd::detail::MaxOp::avx(simd::detail::MaxOp::avx(ninf, v2), v3);
+        __m256 lo8 = _mm256_min_ps(lo01, lo23), hi8 = _mm256_max_ps(hi01, hi23);
+        __m128 lo = _mm_min_ps(_mm256_castps256_ps128(lo8), _mm256_extractf128_ps(lo8, 1));
+        __m128 hi = _mm_max_ps(_mm256_castps256_ps128(hi8), _mm256_extractf128_ps(hi8, 1));
+        lo = _mm_min_ps(lo, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(1, 0, 3, 2)));
+        hi = _mm_max_ps(hi, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(1, 0, 3, 2)));
+        lo = _mm_min_ps(lo, _mm_shuffle_ps(lo, lo, _MM_SHUFFLE(2, 3, 0, 1)));
+        hi = _mm_max_ps(hi, _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(2, 3, 0, 1)));
+        low[b] = _mm_cvtss_f32(lo);
+        high[b] = _mm_cvtss_f32(hi);
+    }
+}
+#endif
+
+inline void seriesLeaves(const float* p, size_t blocks, float* low, float* high) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: seriesLeavesAvx(p, blocks, low, high); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: seriesLeavesSse(p, blocks, low, high); return;
+#endif
+        default: seriesLeavesScalar(p, blocks, low, high); return;
+    }
+}
+
+// Akumulasi ke low/high yang sudah ada (awal: +inf / -inf)
+inline void seriesMinMax(const float* p, size_t n, float& low, float& high) {
+    switch (simd::level()) {
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+        case simd::Level::AVX2: seriesMinMaxAvx(p, n, low, high); return;
+#endif
+#if Z_HAS_SSE2
+        case simd::Level::SSE2: seriesMinMaxSse(p, n, low, high); return;
+#endif
+        default: seriesMinMaxScalar(p, n, low, high); return;
+    }
+}
+
+} // namespace detail
+
+// ===== PYRAMID =====
+// Data tidak di-copy (pointer harus hidup selama pyramid dipakai). Level 1 = min/max per
+// 32 sampel, setiap level berikutnya 8x lebih kasar sampai tersisa <= 8 blok; total
+// memori ~1/14 data. Query min/max [begin, end) membaca paling banyak 2 x 31 sampel
+// mentah plus 2 x 7 blok per level, jadi biayanya O(log n), tidak tergantung panjang rentang.
+
+class SeriesPyramid {
+public:
+    static constexpr size_t leafBlock = 32;
+    static constexpr size_t fanout = 8;
+
+    SeriesPyramid() = default;
+
+    SeriesPyramid(const float* values, size_t count, Jobs* jobs = nullptr) {
+        build(values, count, jobs);
+    }
+
+    // Tanpa level: query memindai data mentah (SIMD), untuk data yang berubah tiap frame
+    static SeriesPyramid view(const float* values, size_t count) {
+        SeriesPyramid pyramid;
+        pyramid.m_values = values;
+        pyramid.m_count = count;
+        return pyramid;
+    }
+
+    // Level 1 dibangun paralel per potongan kalau jobs ada
+    void build(const float* values, size_t count, Jobs* jobs = nullptr) {
+        m_values = values;
+        m_count = count;
+        m_levels.clear();
+        if (count <= leafBlock) return;
+
+        Level leaf;
+        const size_t blocks = (count + leafBlock - 1) / leafBlock;
+        leaf.low.resize(blocks);
+        leaf.high.resize(blocks);
+        static_assert(leafBlock == 32, "seriesLeaves memproses blok 32 sampel");
+        const size_t complete = count / leafBlock;
+        auto leafRange = [&](size_t begin, size_t end) {
+            size_t full = std::min(end, complete);
+            if (full > begin)
+                detail::seriesLeaves(values + begin * leafBlock, full - begin, leaf.low.data() + begin, leaf.high.data() + begin);
+            // Blok terakhir yang tidak penuh
+            for (size_t b = std::max(begin, complete); b < end; b++) {
+                float low = std::numeric_limits<float>::infinity(), high = -low;
+                detail::seriesMinMax(values + b * leafBlock, count - b * leafBlock, low, high);
+                leaf.low[b] = low;
+                leaf.high[b] = high;
+            }
+        };
+        if (jobs && jobs->threadCount() > 1 && blocks >= 4096)
+            jobs->parallelFor(0, blocks, leafRange, std::max<size_t>(1024, blocks / (jobs->threadCount() * 4)));
+        else
+            leafRange(0, blocks);
+        m_levels.push_back(std::move(leaf));
+
+        while (m_levels.back().low.size() > fanout) {
+            const Level& below = m_levels.back();
+            Level next;
+            const size_t n = (below.low.size() + fanout - 1) / fanout;
+            next.low.resize(n);
+            next.high.resize(n);
+            for (size_t b = 0; b < n; b++) {
+                float low = std::numeric_limits<float>::infinity(), high = -low;
+                size_t first = b * fanout, last = std::min(first + fanout, below.low.size());
+                for (size_t k = first; k < last; k++) {
+                    low = simd::detail::MinOp::scalar(low, below.low[k]);
+                    high = simd::detail::MaxOp::scalar(high, below.high[k]);
+                }
+                next.low[b] = low;
+                next.high[b] = high;
+            }
+            m_levels.push_back(std::move(next));
+        }
+    }
+
+    const float* data() const { return m_values; }
+    size_t size() const { return m_count; }
+    int levels() const { return static_cast<int>(m_levels.size()); }
+
+    size_t memoryBytes() const {
+        size_t bytes = 0;
+        for (const Level& level : m_levels)
+            bytes += (level.low.size() + level.high.size()) * sizeof(float);
+        return bytes;
+    }
+
+    // Min/max [begin, end), diakumulasi ke low/high
+    void minMax(size_t begin, size_t end, float& low, float& high) const {
+        end = std::min(end, m_count);
+        if (begin >= end) return;
+        // Level 0 = data mentah; di setiap level bagian yang tidak memenuhi satu blok
+        // level atas dipindai, sisanya naik satu level
+        size_t ratio = leafBlock;
+        for (int level = 0;; level++) {
+            if (level == levels()) {
+                scan(level, begin, end, low, high);
+                return;
+            }
+            size_t alignedBegin = (begin + ratio - 1) / ratio * ratio, alignedEnd = end / ratio * ratio;
+            if (alignedBegin >= alignedEnd) {
+                scan(level, begin, end, low, high);
+                return;
+            }
+            scan(level, begin, alignedBegin, low, high);
+            scan(level, alignedEnd, end, low, high);
+            begin = alignedBegin / ratio;
+            end = alignedEnd / ratio;
+            ratio = fanout;
+        }
+    }
+
+private:
+    struct Level {
+        std::vector<float> low;
+        std::vector<float> high;
+    };
+
+    const float* m_values = nullptr;
+    size_t m_count = 0;
+    std::vector<Level> m_levels;
+
+    void scan(int level, size_t begin, size_t end, float& low, float& high) const {
+        if (begin >= end) return;
+        if (level == 0) {
+            detail::seriesMinMax(m_values + begin, end - begin, low, high);
+            return;
+        }
+        const Level& l = m_levels[static_cast<size_t>(level - 1)];
+        for (size_t k = begin; k < end; k++) {
+            low = simd::detail::MinOp::scalar(low, l.low[k]);
+            high = simd::detail::MaxOp::scalar(high, l.high[k]);
+        }
+    }
+};
+
+// ===== DECIMATION =====
+
+// Satu kolom envelope; kolom tanpa sampel valid: low > high (first/last boleh NaN)
+struct SeriesColumn {
+    float low, high;
+    float first, last;      // sampel pertama/terakhir kolom, untuk menyambung ke kolom sebelah
+};
+
+// Index sampel [begin, end) kolom ke-c dari count kolom selebar x (sampel i ada di posisi i)
+inline void seriesColumnSpan(SeriesRange x, int count, int c, size_t n, size_t& begin, size_t& end) {
+    const double step = (x.end - x.begin) / count;
+    auto index = [&](double at) {
+        double i = std::ceil(at);
+        return i <= 0.0 ? size_t(0) : (i >= static_cast<double>(n) ? n : static_cast<size_t>(i));
+    };
+    begin = index(x.begin + step * c);
+    end = index(x.begin + step * (c + 1));
+}
+
+inline void seriesEnvelope(const SeriesPyramid& series, SeriesRange x, int columns, SeriesColumn* out) {
+    const float* values = series.data();
+    for (int c = 0; c < columns; c++) {
+        size_t begin, end;
+        seriesColumnSpan(x, columns, c, series.size(), begin, end);
+        SeriesColumn& column = out[c];
+        column.low = std::numeric_limits<float>::infinity();
+        column.high = -column.low;
+        column.first = column.last = std::numeric_limits<float>::quiet_NaN();
+        if (begin >= end) continue;
+        series.minMax(begin, end, column.low, column.high);
+        column.first = values[begin];
+        column.last = values[end - 1];
+    }
+}
+
+// LTTB atas sampel [begin, end): index sampel terpilih ditulis ke out (urut), return jumlahnya.
+// Sampel pertama dan terakhir selalu ikut; threshold < 3 atau sampel <= threshold = semua sampel.
+inline size_t lttb(const float* values, size_t begin, size_t end, size_t threshold, size_t* out) {
+    const size_t count = end > begin ? end - begin : 0;
+    if (count <= threshold || threshold < 3) {
+        for (size_t i = 0; i < count; i++) out[i] = begin + i;
+        return count;
+    }
+    const double every = static_cast<double>(count - 2) / static_cast<double>(threshold - 2);
+    size_t written = 0, a = begin;
+    out[written++] = a;
+    for (size_t b = 0; b + 2 < threshold; b++) {
+        // Rata-rata bucket berikutnya (bucket terakhir = titik akhir)
+        size_t nextBegin = begin + static_cast<size_t>((b + 1) * every) + 1;
+        size_t nextEnd = std::min(begin + static_cast<size_t>((b + 2) * every) + 1, end);
+        if (nextBegin >= nextEnd) { nextBegin = end - 1; nextEnd = end; }
+        double avgX = 0.0, avgY = 0.0;
+        for (size_t i = nextBegin; i < nextEnd; i++) {
+            avgX += static_cast<double>(i);
+            avgY += values[i];
+        }
+        avgX /= static_cast<double>(nextEnd - nextBegin);
+        avgY /= static_cast<double>(nextEnd - nextBegin);
+
+        // Titik bucket ini yang membentuk segitiga terluas dengan a dan rata-rata berikutnya
+        size_t first = begin + static_cast<size_t>(b * every) + 1;
+        size_t last = begin + static_cast<size_t>((b + 1) * every) + 1;
+        const double ax = static_cast<double>(a), ay = values[a];
+        double best = -1.0;
+        size_t chosen = first;
+        for (size_t i = first; i < last; i++) {
+            double area = std::fabs((ax - avgX) * (values[i] - ay) - (ax - static_cast<double>(i)) * (avgY - ay));
+            if (area > best) {
+                best = area;
+                chosen = i;
+            }
+        }
+        out[written++] = a = chosen;
+    }
+    out[written++] = end - 1;
+    return written;
+}
+
+} // namespace z
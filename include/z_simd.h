@@ -0,0 +1,763 @@
+#pragma once
+#include "z_platform.h"
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include "z_unit.h"
+
+#if Z_HAS_SSE2
+    #include <emmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+    // AVX2 dikompilasi per fungsi (target attribute) dan dipilih saat runtime,
+    // jadi binary tetap jalan di CPU tanpa AVX2.
+    #if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+        #include <immintrin.h>
+        #define Z_SIMD_AVX2 1
+    #endif
+#endif
+
+#ifndef Z_SIMD_AVX2
+    #define Z_SIMD_AVX2 0
+#endif
+
+#if Z_SIMD_AVX2 && (defined(__GNUC__) || defined(__clang__))
+    #define Z_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+    #define Z_TARGET_AVX2
+#endif
+
+namespace z {
+namespace simd {
+
+static_assert(sizeof(Vec2<float>) == 2 * sizeof(float), "Vec2<float> harus dua float berurutan");
+static_assert(sizeof(Vec2<int>) == 2 * sizeof(int), "Vec2<int> harus dua int berurutan");
+
+// Level instruksi yang dipakai kernel
+enum class Level {
+    Scalar,
+    SSE2,
+    AVX2        // AVX2 + FMA
+};
+
+// Mode pembulatan konversi float -> int
+enum class Rounding {
+    Nearest,    // ke bilangan terdekat, .5 ke genap (mode default FPU)
+    Truncate,   // ke arah nol, sama dengan static_cast<int> / Vec2<int>(Vec2<float>)
+    Floor,
+    Ceil
+};
+
+inline const char* levelName(Level level) {
+    switch (level) {
+        case Level::SSE2: return "SSE2";
+        case Level::AVX2: return "AVX2";
+        default: return "Scalar";
+    }
+}
+
+// Level terbaik yang didukung CPU ini
+inline Level detectLevel() {
+#if Z_SIMD_AVX2 && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return Level::AVX2;
+    return Level::SSE2;
+#elif Z_SIMD_AVX2 && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (osxsave && avx && fma && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5))
+            return Level::AVX2;
+    }
+    return Level::SSE2;
+#elif Z_HAS_SSE2
+    return Level::SSE2;
+#else
+    return Level::Scalar;
+#endif
+}
+
+namespace detail {
+    inline std::atomic<Level>& levelStorage() {
+        static std::atomic<Level> level{detectLevel()};
+        return level;
+    }
+}
+
+// Level yang sedang dipakai semua kernel
+inline Level level() {
+    return detail::levelStorage().load(std::memory_order_relaxed);
+}
+
+// Paksa level tertentu (untuk test/benchmark). Dibatasi ke yang didukung CPU.
+// Return level yang benar-benar dipakai.
+inline Level setLevel(Level requested) {
+    Level best = detectLevel();
+    Level chosen = static_cast<int>(requested) > static_cast<int>(best) ? best : requested;
+    detail::levelStorage().store(chosen, std::memory_order_relaxed);
+    return chosen;
+}
+
+namespace detail {
+
+// ===== OPERASI PER KOMPONEN =====
+// Vec2 array diperlakukan sebagai array float datar (x0, y0, x1, y1, ...)
+
+struct AddOp {
+    static float scalar(float a, float b) { return a + b; }
+#if Z_HAS_SSE2
+    static __m128 sse(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+#endif
+#if Z_SIMD_AVX2
+    Z_TARGET_AVX2 static __m256 avx(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+#endif
+};
+
+struct SubOp {
+    static float scalar(float a, float b) { return a - b; }
+#if Z_HAS_SSE2
+    static __m128 sse(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+#endif
+#if Z_SIMD_AVX2
+    Z_TARGET_AVX2 static __m256 avx(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+#endif
+};
+
+struct MulOp {
+    static float scalar(float a, float b) { return a * b; }
+#if Z_HAS_SSE2
+    static __m128 sse(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+#endif
+#if Z_SIMD_AVX2
+    Z_TARGET_AVX2 static __m256 avx(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+#endif
+};
+
+// min/max mengikuti std::min/std::max(a, b): kalau sama atau NaN, hasilnya a
+struct MinOp {
+    static float scalar(float a, float b) { return b < a ? b : a; }
+#if Z_HAS_SSE2
+    static __m128 sse(__m128 a, __m128 b) { return _mm_min_ps(b, a); }
+#endif
+#if Z_SIMD_AVX2
+    Z_TARGET_AVX2 static __m256 avx(__m256 a, __m256 b) { return _mm256_min_ps(b, a); }
+#endif
+};
+
+struct MaxOp {
+    static float scalar(float a, float b) { return a < b ? b : a; }
+#if Z_HAS_SSE2
+    static __m128 sse(__m128 a, __m128 b) { return _mm_max_ps(b, a); }
+#endif
+#if Z_SIMD_AVX2
+    Z_TARGET_AVX2 static __m256 avx(__m256 a, __m256 b) { return _mm256_max_ps(b, a); }
+#endif
+};
+
+template <typename Op>
+inline void binaryScalar(const float* a, const float* b, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = Op::scalar(a[i], b[i]);
+}
+
+#if Z_HAS_SSE2
+template <typename Op>
+inline void binarySse(const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(out + i, Op::sse(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    binaryScalar<Op>(a + i, b + i, out + i, n - i);
+}
+#endif
+
+#if Z_SIMD_AVX2
+template <typename Op>
+Z_TARGET_AVX2 inline void binaryAvx(const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(out + i, Op::avx(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    binaryScalar<Op>(a + i, b + i, out + i, n - i);
+}
+#endif
+
+template <typename Op>
+inline void binary(const float* a, const float* b, float* out, size_t n) {
+    switch (level()) {
+#if Z_SIMD_AVX2
+        case Level::AVX2: binaryAvx<Op>(a, b, out, n); return;
+#endif
+#if Z_HAS_SSE2
+        case Level::SSE2: binarySse<Op>(a, b, out, n); return;
+#endif
+        default: binaryScalar<Op>(a, b, out, n); return;
+    }
+}
+
+// Konstanta per komponen (x, y) diulang di register: x y x y ...
+inline void scaleScalar(const float* a, float sx, float sy, float* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++) {
+        out[2 * i] = a[2 * i] * sx;
+        out[2 * i + 1] = a[2 * i + 1] * sy;
+    }
+}
+
+// x' = a * x + c * y + tx, y' = d * y + b * x + ty (urutan sama dengan Affine * Vec2)
+inline void transformScalar(const float* p, const Affine& m, float* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++) {
+        float x = p[2 * i];
+        float y = p[2 * i + 1];
+        out[2 * i] = m.a * x + m.c * y + m.tx;
+        out[2 * i + 1] = m.d * y + m.b * x + m.ty;
+    }
+}
+
+inline void translateScalar(const float* p, float tx, float ty, float* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++) {
+        out[2 * i] = p[2 * i] + tx;
+        out[2 * i + 1] = p[2 * i + 1] + ty;
+    }
+}
+
+inline void translateIntScalar(const int* p, int tx, int ty, int* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++) {
+        out[2 * i] = p[2 * i] + tx;
+        out[2 * i + 1] = p[2 * i + 1] + ty;
+    }
+}
+
+// out = a * b + c
+inline void fmaScalar(const float* a, const float* b, const float* c, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] * b[i] + c[i];
+}
+
+// out = a + (b - a) * t
+inline void lerpScalar(const float* a, const float* b, float t, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+inline void dotScalar(const float* a, const float* b, float* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++)
+        out[i] = a[2 * i] * b[2 * i] + a[2 * i + 1] * b[2 * i + 1];
+}
+
+inline void lengthScalar(const float* a, float* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++)
+        out[i] = std::sqrt(a[2 * i] * a[2 * i] + a[2 * i + 1] * a[2 * i + 1]);
+}
+
+inline void normalizeScalar(const float* a, float* out, size_t pairs) {
+    for (size_t i = 0; i < pairs; i++) {
+        float x = a[2 * i];
+        float y = a[2 * i + 1];
+        float len = std::sqrt(x * x + y * y);
+        if (len > 0.0f) {
+            out[2 * i] = x / len;
+            out[2 * i + 1] = y / len;
+        } else {
+            out[2 * i] = 0.0f;
+            out[2 * i + 1] = 0.0f;
+        }
+    }
+}
+
+inline int roundScalar(float v, Rounding mode) {
+    switch (mode) {
+        case Rounding::Nearest: return static_cast<int>(std::nearbyint(v));
+        case Rounding::Floor: return static_cast<int>(std::floor(v));
+        case Rounding::Ceil: return static_cast<int>(std::ceil(v));
+        default: return static_cast<int>(v);
+    }
+}
+
+inline void toIntScalar(const float* a, int* out, size_t n, Rounding mode) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = roundScalar(a[i], mode);
+}
+
+inline void toFloatScalar(const int* a, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = static_cast<float>(a[i]);
+}
+
+inline void addIntScalar(const int* a, const int* b, int* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] + b[i];
+}
+
+inline void subIntScalar(const int* a, const int* b, int* out, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        out[i] = a[i] - b[i];
+}
+
+// ===== SSE2 =====
+#if Z_HAS_SSE2
+
+inline void scaleSse(const float* a, float sx, float sy, float* out, size_t pairs) {
+    const __m128 s = _mm_setr_ps(sx, sy, sx, sy);
+    size_t i = 0;
+    for (; i + 2 <= pairs; i += 2)
+        _mm_storeu_ps(out + 2 * i, _mm_mul_ps(_mm_loadu_ps(a + 2 * i), s));
+    scaleScalar(a + 2 * i, sx, sy, out + 2 * i, pairs - i);
+}
+
+// Dua Vec2 per register: p = x0 y0 x1 y1, swap = y0 x0 y1 x1
+inline void transformSse(const float* p, const Affine& m, float* out, size_t pairs) {
+    const __m128 ad = _mm_setr_ps(m.a, m.d, m.a, m.d);
+    const __m128 cb = _mm_setr_ps(m.c, m.b, m.c, m.b);
+    const __m128 t = _mm_setr_ps(m.tx, m.ty, m.tx, m.ty);
+    size_t i = 0;
+    for (; i + 2 <= pairs; i += 2) {
+        __m128 v = _mm_loadu_ps(p + 2 * i);
+        __m128 swap = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_ps(out + 2 * i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(v, ad), _mm_mul_ps(swap, cb)), t));
+    }
+    transformScalar(p + 2 * i, m, out + 2 * i, pairs - i);
+}
+
+inline void translateSse(const float* p, float tx, float ty, float* out, size_t pairs) {
+    const __m128 t = _mm_setr_ps(tx, ty, tx, ty);
+    size_t i = 0;
+    for (; i + 2 <= pairs; i += 2)
+        _mm_storeu_ps(out + 2 * i, _mm_add_ps(_mm_loadu_ps(p + 2 * i), t));
+    translateScalar(p + 2 * i, tx, ty, out + 2 * i, pairs - i);
+}
+
+inline void translateIntSse(const int* p, int tx, int ty, int* out, size_t pairs) {
+    const __m128i t = _mm_setr_epi32(tx, ty, tx, ty);
+    size_t i = 0;
+    for (; i + 2 <= pairs; i += 2)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i)), t));
+    translateIntScalar(p + 2 * i, tx, ty, out + 2 * i, pairs - i);
+}
+
+inline void fmaSse(const float* a, const float* b, const float* c, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)), _mm_loadu_ps(c + i)));
+    fmaScalar(a + i, b + i, c + i, out + i, n - i);
+}
+
+inline void lerpSse(const float* a, const float* b, float t, float* out, size_t n) {
+    const __m128 vt = _mm_set1_ps(t);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 va = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + i), va), vt)));
+    }
+    lerpScalar(a + i, b + i, t, out + i, n - i);
+}
+
+// Jumlah pasangan x*x', y*y' untuk 4 Vec2: p0 = vec 0-1, p1 = vec 2-3
+inline __m128 pairSumSse(__m128 p0, __m128 p1) {
+    __m128 xs = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 ys = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+    return _mm_add_ps(xs, ys);
+}
+
+inline void dotSse(const float* a, const float* b, float* out, size_t pairs) {
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4) {
+        __m128 p0 = _mm_mul_ps(_mm_loadu_ps(a + 2 * i), _mm_loadu_ps(b + 2 * i));
+        __m128 p1 = _mm_mul_ps(_mm_loadu_ps(a + 2 * i + 4), _mm_loadu_ps(b + 2 * i + 4));
+        _mm_storeu_ps(out + i, pairSumSse(p0, p1));
+    }
+    dotScalar(a + 2 * i, b + 2 * i, out + i, pairs - i);
+}
+
+inline void lengthSse(const float* a, float* out, size_t pairs) {
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4) {
+        __m128 v0 = _mm_loadu_ps(a + 2 * i);
+        __m128 v1 = _mm_loadu_ps(a + 2 * i + 4);
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(pairSumSse(_mm_mul_ps(v0, v0), _mm_mul_ps(v1, v1))));
+    }
+    lengthScalar(a + 2 * i, out + i, pairs - i);
+}
+
+inline void normalizeSse(const float* a, float* out, size_t pairs) {
+    const __m128 zero = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4) {
+        __m128 v0 = _mm_loadu_ps(a + 2 * i);
+        __m128 v1 = _mm_loadu_ps(a + 2 * i + 4);
+        __m128 len = _mm_sqrt_ps(pairSumSse(_mm_mul_ps(v0, v0), _mm_mul_ps(v1, v1)));
+        // len per vec diduplikasi ke x dan y: l0 l0 l1 l1 | l2 l2 l3 l3
+        __m128 len0 = _mm_unpacklo_ps(len, len);
+        __m128 len1 = _mm_unpackhi_ps(len, len);
+        // Panjang nol menghasilkan (0, 0), bukan NaN
+        __m128 r0 = _mm_and_ps(_mm_div_ps(v0, len0), _mm_cmpgt_ps(len0, zero));
+        __m128 r1 = _mm_and_ps(_mm_div_ps(v1, len1), _mm_cmpgt_ps(len1, zero));
+        _mm_storeu_ps(out + 2 * i, r0);
+        _mm_storeu_ps(out + 2 * i + 4, r1);
+    }
+    normalizeScalar(a + 2 * i, out + 2 * i, pairs - i);
+}
+
+inline __m128i roundSse(__m128 v, Rounding mode) {
+    switch (mode) {
+        case Rounding::Nearest:
+            return _mm_cvtps_epi32(v);
+        case Rounding::Floor: {
+            __m128i t = _mm_cvttps_epi32(v);
+            // Truncate membulatkan negatif ke atas: kurangi 1 kalau hasilnya > v
+            __m128 adjust = _mm_cmpgt_ps(_mm_cvtepi32_ps(t), v);
+            return _mm_add_epi32(t, _mm_castps_si128(adjust));
+        }
+        case Rounding::Ceil: {
+            __m128i t = _mm_cvttps_epi32(v);
+            __m128 adjust = _mm_cmplt_ps(_mm_cvtepi32_ps(t), v);
+            return _mm_sub_epi32(t, _mm_castps_si128(adjust));
+        }
+        default:
+            return _mm_cvttps_epi32(v);
+    }
+}
+
+inline void toIntSse(const float* a, int* out, size_t n, Rounding mode) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), roundSse(_mm_loadu_ps(a + i), mode));
+    toIntScalar(a + i, out + i, n - i, mode);
+}
+
+inline void toFloatSse(const int* a, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_ps(out + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i))));
+    toFloatScalar(a + i, out + i, n - i);
+}
+
+inline void addIntSse(const int* a, const int* b, int* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+            _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i))));
+    addIntScalar(a + i, b + i, out + i, n - i);
+}
+
+inline void subIntSse(const int* a, const int* b, int* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+            _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i))));
+    subIntScalar(a + i, b + i, out + i, n - i);
+}
+
+#endif // Z_HAS_SSE2
+
+// ===== AVX2 =====
+#if Z_SIMD_AVX2
+
+Z_TARGET_AVX2 inline void scaleAvx(const float* a, float sx, float sy, float* out, size_t pairs) {
+    const __m256 s = _mm256_setr_ps(sx, sy, sx, sy, sx, sy, sx, sy);
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4)
+        _mm256_storeu_ps(out + 2 * i, _mm256_mul_ps(_mm256_loadu_ps(a + 2 * i), s));
+    scaleScalar(a + 2 * i, sx, sy, out + 2 * i, pairs - i);
+}
+
+// Memakai FMA seperti fmaAvx: bisa beda 1 ulp dari jalur skalar/SSE2
+Z_TARGET_AVX2 inline void transformAvx(const float* p, const Affine& m, float* out, size_t pairs) {
+    const __m256 ad = _mm256_setr_ps(m.a, m.d, m.a, m.d, m.a, m.d, m.a, m.d);
+    const __m256 cb = _mm256_setr_ps(m.c, m.b, m.c, m.b, m.c, m.b, m.c, m.b);
+    const __m256 t = _mm256_setr_ps(m.tx, m.ty, m.tx, m.ty, m.tx, m.ty, m.tx, m.ty);
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4) {
+        __m256 v = _mm256_loadu_ps(p + 2 * i);
+        __m256 swap = _mm256_permute_ps(v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm256_storeu_ps(out + 2 * i, _mm256_fmadd_ps(v, ad, _mm256_fmadd_ps(swap, cb, t)));
+    }
+    transformScalar(p + 2 * i, m, out + 2 * i, pairs - i);
+}
+
+Z_TARGET_AVX2 inline void translateAvx(const float* p, float tx, float ty, float* out, size_t pairs) {
+    const __m256 t = _mm256_setr_ps(tx, ty, tx, ty, tx, ty, tx, ty);
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4)
+        _mm256_storeu_ps(out + 2 * i, _mm256_add_ps(_mm256_loadu_ps(p + 2 * i), t));
+    translateScalar(p + 2 * i, tx, ty, out + 2 * i, pairs - i);
+}
+
+Z_TARGET_AVX2 inline void translateIntAvx(const int* p, int tx, int ty, int* out, size_t pairs) {
+    const __m256i t = _mm256_setr_epi32(tx, ty, tx, ty, tx, ty, tx, ty);
+    size_t i = 0;
+    for (; i + 4 <= pairs; i += 4)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 2 * i)), t));
+    translateIntScalar(p + 2 * i, tx, ty, out + 2 * i, pairs - i);
+}
+
+// Memakai instruksi FMA: satu pembulatan, jadi bisa beda 1 ulp dari jalur skalar/SSE2
+Z_TARGET_AVX2 inline void fmaAvx(const float* a, const float* b, const float* c, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), _mm256_loadu_ps(c + i)));
+    fmaScalar(a + i, b + i, c + i, out + i, n - i);
+}
+
+Z_TARGET_AVX2 inline void lerpAvx(const float* a, const float* b, float t, float* out, size_t n) {
+    const __m256 vt = _mm256_set1_ps(t);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 va = _mm256_loadu_ps(a + i);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(b + i), va), vt)));
+    }
+    lerpScalar(a + i, b + i, t, out + i, n - i);
+}
+
+// 8 Vec2: p0 = vec 0-3, p1 = vec 4-7. Hasil urutan per lane 128-bit:
+// [d0 d1 d4 d5 | d2 d3 d6 d7]
+Z_TARGET_AVX2 inline __m256 pairSumAvx(__m256 p0, __m256 p1) {
+    __m256 xs = _mm256_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 ys = _mm256_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1));
+    return _mm256_add_ps(xs, ys);
+}
+
+// Urutkan hasil pairSumAvx menjadi d0..d7
+Z_TARGET_AVX2 inline __m256 pairOrderAvx(__m256 v) {
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(v), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+Z_TARGET_AVX2 inline void dotAvx(const float* a, const float* b, float* out, size_t pairs) {
+    size_t i = 0;
+    for (; i + 8 <= pairs; i += 8) {
+        __m256 p0 = _mm256_mul_ps(_mm256_loadu_ps(a + 2 * i), _mm256_loadu_ps(b + 2 * i));
+        __m256 p1 = _mm256_mul_ps(_mm256_loadu_ps(a + 2 * i + 8), _mm256_loadu_ps(b + 2 * i + 8));
+        _mm256_storeu_ps(out + i, pairOrderAvx(pairSumAvx(p0, p1)));
+    }
+    dotScalar(a + 2 * i, b + 2 * i, out + i, pairs - i);
+}
+
+Z_TARGET_AVX2 inline void lengthAvx(const float* a, float* out, size_t pairs) {
+    size_t i = 0;
+    for (; i + 8 <= pairs; i += 8) {
+        __m256 v0 = _mm256_loadu_ps(a + 2 * i);
+        __m256 v1 = _mm256_loadu_ps(a + 2 * i + 8);
+        __m256 len = _mm256_sqrt_ps(pairSumAvx(_mm256_mul_ps(v0, v0), _mm256_mul_ps(v1, v1)));
+        _mm256_storeu_ps(out + i, pairOrderAvx(len));
+    }
+    lengthScalar(a + 2 * i, out + i, pairs - i);
+}
+
+Z_TARGET_AVX2 inline void normalizeAvx(const float* a, float* out, size_t pairs) {
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= pairs; i += 8) {
+        __m256 v0 = _mm256_loadu_ps(a + 2 * i);
+        __m256 v1 = _mm256_loadu_ps(a + 2 * i + 8);
+        __m256 len = _mm256_sqrt_ps(pairSumAvx(_mm256_mul_ps(v0, v0), _mm256_mul_ps(v1, v1)));
+        // Urutan lane [d0 d1 d4 d5 | d2 d3 d6 d7] pas untuk unpack per lane:
+        // lo = l0 l0 l1 l1 | l2 l2 l3 l3 (v0), hi = l4 l4 l5 l5 | l6 l6 l7 l7 (v1)
+        __m256 len0 = _mm256_unpacklo_ps(len, len);
+        __m256 len1 = _mm256_unpackhi_ps(len, len);
+        __m256 r0 = _mm256_and_ps(_mm256_div_ps(v0, len0), _mm256_cmp_ps(len0, zero, _CMP_GT_OQ));
+        __m256 r1 = _mm256_and_ps(_mm256_div_ps(v1, len1), _mm256_cmp_ps(len1, zero, _CMP_GT_OQ));
+        _mm256_storeu_ps(out + 2 * i, r0);
+        _mm256_storeu_ps(out + 2 * i + 8, r1);
+    }
+    normalizeScalar(a + 2 * i, out + 2 * i, pairs - i);
+}
+
+Z_TARGET_AVX2 inline void toIntAvx(const float* a, int* out, size_t n, Rounding mode) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(a + i);
+        __m256i r;
+        switch (mode) {
+            case Rounding::Nearest: r = _mm256_cvtps_epi32(v); break;
+            case Rounding::Floor: r = _mm256_cvttps_epi32(_mm256_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)); break;
+            case Rounding::Ceil: r = _mm256_cvttps_epi32(_mm256_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)); break;
+            default: r = _mm256_cvttps_epi32(v); break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+    }
+    toIntScalar(a + i, out + i, n - i, mode);
+}
+
+Z_TARGET_AVX2 inline void toFloatAvx(const int* a, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i))));
+    toFloatScalar(a + i, out + i, n - i);
+}
+
+Z_TARGET_AVX2 inline void addIntAvx(const int* a, const int* b, int* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+            _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i))));
+    addIntScalar(a + i, b + i, out + i, n - i);
+}
+
+Z_TARGET_AVX2 inline void subIntAvx(const int* a, const int* b, int* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+            _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i))));
+    subIntScalar(a + i, b + i, out + i, n - i);
+}
+
+#endif // Z_SIMD_AVX2
+
+inline const float* flat(const Vec2<float>* v) { return reinterpret_cast<const float*>(v); }
+inline float* flat(Vec2<float>* v) { return reinterpret_cast<float*>(v); }
+inline const int* flat(const Vec2<int>* v) { return reinterpret_cast<const int*>(v); }
+inline int* flat(Vec2<int>* v) { return reinterpret_cast<int*>(v); }
+
+} // namespace detail
+
+// Pilih kernel sesuai level aktif
+#if Z_SIMD_AVX2 && Z_HAS_SSE2
+    #define Z_SIMD_DISPATCH(name, ...) \
+        switch (level()) { \
+            case Level::AVX2: detail::name##Avx(__VA_ARGS__); return; \
+            case Level::SSE2: detail::name##Sse(__VA_ARGS__); return; \
+            default: detail::name##Scalar(__VA_ARGS__); return; \
+        }
+#elif Z_HAS_SSE2
+    #define Z_SIMD_DISPATCH(name, ...) \
+        if (level() != Level::Scalar) { detail::name##Sse(__VA_ARGS__); return; } \
+        detail::name##Scalar(__VA_ARGS__);
+#else
+    #define Z_SIMD_DISPATCH(name, ...) detail::name##Scalar(__VA_ARGS__);
+#endif
+
+// ===== BATCH Vec2<float> =====
+// Semua fungsi menerima count = jumlah Vec2. out boleh sama dengan input (in-place).
+
+inline void add(const Vec2<float>* a, const Vec2<float>* b, Vec2<float>* out, size_t count) {
+    detail::binary<detail::AddOp>(detail::flat(a), detail::flat(b), detail::flat(out), count * 2);
+}
+
+inline void sub(const Vec2<float>* a, const Vec2<float>* b, Vec2<float>* out, size_t count) {
+    detail::binary<detail::SubOp>(detail::flat(a), detail::flat(b), detail::flat(out), count * 2);
+}
+
+// Perkalian per komponen (sama dengan Vec2 operator*)
+inline void mul(const Vec2<float>* a, const Vec2<float>* b, Vec2<float>* out, size_t count) {
+    detail::binary<detail::MulOp>(detail::flat(a), detail::flat(b), detail::flat(out), count * 2);
+}
+
+inline void scale(const Vec2<float>* a, Vec2<float> factor, Vec2<float>* out, size_t count) {
+    Z_SIMD_DISPATCH(scale, detail::flat(a), factor.x, factor.y, detail::flat(out), count)
+}
+
+inline void scale(const Vec2<float>* a, float factor, Vec2<float>* out, size_t count) {
+    scale(a, Vec2<float>(factor), out, count);
+}
+
+// out = a * b + c (per komponen)
+inline void fma(const Vec2<float>* a, const Vec2<float>* b, const Vec2<float>* c, Vec2<float>* out, size_t count) {
+    Z_SIMD_DISPATCH(fma, detail::flat(a), detail::flat(b), detail::flat(c), detail::flat(out), count * 2)
+}
+
+// out = a + (b - a) * t
+inline void lerp(const Vec2<float>* a, const Vec2<float>* b, float t, Vec2<float>* out, size_t count) {
+    Z_SIMD_DISPATCH(lerp, detail::flat(a), detail::flat(b), t, detail::flat(out), count * 2)
+}
+
+inline void min(const Vec2<float>* a, const Vec2<float>* b, Vec2<float>* out, size_t count) {
+    detail::binary<detail::MinOp>(detail::flat(a), detail::flat(b), detail::flat(out), count * 2);
+}
+
+inline void max(const Vec2<float>* a, const Vec2<float>* b, Vec2<float>* out, size_t count) {
+    detail::binary<detail::MaxOp>(detail::flat(a), detail::flat(b), detail::flat(out), count * 2);
+}
+
+// out[i] = a[i].x * b[i].x + a[i].y * b[i].y
+inline void dot(const Vec2<float>* a, const Vec2<float>* b, float* out, size_t count) {
+    Z_SIMD_DISPATCH(dot, detail::flat(a), detail::flat(b), out, count)
+}
+
+inline void length(const Vec2<float>* a, float* out, size_t count) {
+    Z_SIMD_DISPATCH(length, detail::flat(a), out, count)
+}
+
+// Vec2 dengan panjang 0 menjadi (0, 0)
+inline void normalize(const Vec2<float>* a, Vec2<float>* out, size_t count) {
+    Z_SIMD_DISPATCH(normalize, detail::flat(a), detail::flat(out), count)
+}
+
+// ===== KONVERSI =====
+// Nilai di luar jangkauan int tidak didefinisikan (sama seperti static_cast)
+
+inline void toInt(const Vec2<float>* a, Vec2<int>* out, size_t count, Rounding mode = Rounding::Truncate) {
+    Z_SIMD_DISPATCH(toInt, detail::flat(a), detail::flat(out), count * 2, mode)
+}
+
+inline void toFloat(const Vec2<int>* a, Vec2<float>* out, size_t count) {
+    Z_SIMD_DISPATCH(toFloat, detail::flat(a), detail::flat(out), count * 2)
+}
+
+// ===== BATCH Vec2<int> =====
+
+inline void add(const Vec2<int>* a, const Vec2<int>* b, Vec2<int>* out, size_t count) {
+    Z_SIMD_DISPATCH(addInt, detail::flat(a), detail::flat(b), detail::flat(out), count * 2)
+}
+
+inline void sub(const Vec2<int>* a, const Vec2<int>* b, Vec2<int>* out, size_t count) {
+    Z_SIMD_DISPATCH(subInt, detail::flat(a), detail::flat(b), detail::flat(out), count * 2)
+}
+
+// ===== TRANSFORM =====
+// out[i] = m * a[i]. Transform yang hanya translasi cukup menambah offset.
+// Skalar/SSE2 sama persis dengan Affine * Vec2, AVX2 (FMA) bisa beda 1 ulp.
+
+inline void transform(const Affine& m, const Vec2<float>* a, Vec2<float>* out, size_t count) {
+    if (m.isTranslation()) {
+        Z_SIMD_DISPATCH(translate, detail::flat(a), m.tx, m.ty, detail::flat(out), count)
+    } else {
+        Z_SIMD_DISPATCH(transform, detail::flat(a), m, detail::flat(out), count)
+    }
+}
+
+namespace detail {
+    inline bool isIntegral(float v) {
+        return v >= -2147483648.0f && v < 2147483648.0f && v == static_cast<float>(static_cast<int>(v));
+    }
+
+    inline void translateInt(const int* a, int tx, int ty, int* out, size_t pairs) {
+        Z_SIMD_DISPATCH(translateInt, a, tx, ty, out, pairs)
+    }
+}
+
+// Titik integer: translasi bulat tetap di integer (tepat), selain itu lewat float
+// per blok kecil di stack lalu dibulatkan dengan mode yang diminta
+inline void transform(const Affine& m, const Vec2<int>* a, Vec2<int>* out, size_t count, Rounding mode = Rounding::Nearest) {
+    if (m.isTranslation() && detail::isIntegral(m.tx) && detail::isIntegral(m.ty)) {
+        detail::translateInt(detail::flat(a), static_cast<int>(m.tx), static_cast<int>(m.ty), detail::flat(out), count);
+        return;
+    }
+    const size_t block = 256;
+    Vec2<float> buffer[block];
+    for (size_t i = 0; i < count; i += block) {
+        size_t n = std::min(block, count - i);
+        toFloat(a + i, buffer, n);
+        transform(m, buffer, buffer, n);
+        toInt(buffer, out + i, n, mode);
+    }
+}
+
+// Hasil langsung dibulatkan ke int (mis. untuk POINT / pixel)
+inline void transform(const Affine& m, const Vec2<float>* a, Vec2<int>* out, size_t count, Rounding mode = Rounding::Nearest) {
+    const size_t block = 256;
+    Vec2<float> buffer[block];
+    for (size_t i = 0; i < count; i += block) {
+        size_t n = std::min(block, count - i);
+        transform(m, a + i, buffer, n);
+        toInt(buffer, out + i, n, mode);
+    }
+}
+
+#undef Z_SIMD_DISPATCH
+
+} // namespace simd
+} // namespace z
@@ -0,0 +1,248 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_path.h"
+
+namespace z {
+
+enum class LineJoin {
+    Miter,      // jatuh ke Bevel kalau panjang miter > miterLimit * setengah lebar
+    Round,
+    Bevel
+};
+
+enum class LineCap {
+    Butt,       // berhenti tepat di titik ujung
+    Round,
+    Square      // diperpanjang setengah lebar
+};
+
+struct StrokeStyle {
+    float width = 1.0f;
+    LineJoin join = LineJoin::Miter;
+    LineCap cap = LineCap::Butt;
+    float miterLimit = 4.0f;        // sama dengan default SVG
+};
+
+// ===== STROKER =====
+// Polyline -> outline tertutup untuk fill NonZero. Polyline terbuka: satu contour
+// (sisi kiri maju, cap ujung, sisi kiri polyline terbalik, cap awal). Tertutup: dua contour
+// berlawanan arah. Di sisi dalam belokan outline lewat titik sudutnya, jadi winding-nya sama
+// dengan gabungan quad per segmen ditambah geometri join di sisi luar: setiap pixel ditulis
+// sekali walaupun segmen saling tumpang tindih.
+
+class Stroker {
+public:
+    // tolerance = error maksimum busur round join/cap (satuan koordinat points)
+    explicit Stroker(float tolerance = 0.25f) : m_tolerance(tolerance) {}
+
+    // Outline ditambahkan ke out (tidak dikosongkan dulu)
+    void stroke(const Vec2<float>* points, int count, bool closed, const StrokeStyle& style, FlatPath& out) {
+        m_half = style.width * 0.5f;
+        if (!(m_half > 0.0f) || count <= 0) return;
+        m_style = style;
+        m_out = &out;
+
+        // Titik berurutan yang sama dibuang supaya setiap segmen punya arah
+        m_points.clear();
+        for (int i = 0; i < count; i++)
+            if (m_points.empty() || points[i].x != m_points.back().x || points[i].y != m_points.back().y)
+                m_points.push_back(points[i]);
+        if (closed && m_points.size() > 1 && m_points.back().x == m_points.front().x && m_points.back().y == m_points.front().y)
+            m_points.pop_back();
+
+        const size_t n = m_points.size();
+        if (n == 1) {
+            dot(m_points[0]);
+            return;
+        }
+        if (closed && n == 2) closed = false;       // bolak-balik: sama dengan segmen terbuka
+
+        // Normal kiri (-dy, dx) * half per segmen, dihitung sekali untuk kedua sisi
+        const size_t segments = closed ? n : n - 1;
+        m_normals.resize(segments);
+        for (size_t i = 0; i < segments; i++) {
+            Vec2<float> a = m_points[i], b = m_points[(i + 1) % n];
+            float dx = b.x - a.x, dy = b.y - a.y;
+            float scale = m_half / std::sqrt(dx * dx + dy * dy);
+            m_normals[i] = Vec2<float>(-dy * scale, dx * scale);
+        }
+
+        if (closed) {
+            begin();
+            side(closed, false);
+            end();
+            begin();
+            side(closed, true);
+            end();
+            return;
+        }
+        begin();
+        side(false, false);
+        cap(m_points[n - 1], m_normals[segments - 1], 1.0f);
+        side(false, true);
+        cap(m_points[0], m_normals[0], -1.0f);
+        end();
+    }
+
+private:
+    float m_tolerance;
+    float m_half = 0.5f;
+    StrokeStyle m_style;
+    FlatPath* m_out = nullptr;
+    std::vector<Vec2<float>> m_points;
+    std::vector<Vec2<float>> m_normals;
+
+    void begin() {
+        m_out->contours.push_back(FlatPath::Contour{ static_cast<uint32_t>(m_out->points.size()), 0, true });
+    }
+
+    void end() {
+        FlatPath::Contour& c = m_out->contours.back();
+        c.count = static_cast<uint32_t>(m_out->points.size()) - c.begin;
+        if (c.count < 3) {
+            m_out->points.resize(c.begin);
+            m_out->contours.pop_back();
+        }
+    }
+
+    void emit(Vec2<float> p) {
+        m_out->points.push_back(p);
+    }
+
+    static Vec2<float> offset(Vec2<float> p, Vec2<float> n, float sign) {
+        return Vec2<float>(p.x + n.x * sign, p.y + n.y * sign);
+    }
+
+    // Sisi kiri polyline (reverse: sisi kiri polyline terbalik = sisi kanan, normal dibalik)
+    void side(bool closed, bool reverse) {
+        const size_t n = m_points.size();
+        const size_t segments = m_normals.size();
+        const float sign = reverse ? -1.0f : 1.0f;
+        auto point = [&](size_t i) { return m_points[reverse ? n - 1 - i : i]; };
+        // Normal segmen ke-i dalam urutan jalan (segmen terbalik memakai normal segmen asal, dinegasikan)
+        auto normal = [&](size_t i) {
+            if (!reverse) return m_normals[i];
+            size_t original = closed ? (2 * n - 2 - i) % n : segments - 1 - i;
+            return m_normals[original];
+        };
+
+        if (!closed) {
+            emit(offset(point(0), normal(0), sign));
+            for (size_t i = 1; i + 1 < n; i++)
+                join(point(i), normal(i - 1), normal(i), sign);
+            emit(offset(point(n - 1), normal(segments - 1), sign));
+            return;
+        }
+        for (size_t i = 0; i < n; i++)
+            join(point(i), normal((i + segments - 1) % segments), normal(i), sign);
+    }
+
+    // Sambungan di p dari segmen bernormal n0 ke segmen bernormal n1, di sisi sign.
+    // cross tidak dikali sign: normal sisi kanan = -normal, cross(-a, -b) = cross(a, b),
+    // dan urutan segmen yang terbalik sudah membalik arah beloknya
+    void join(Vec2<float> p, Vec2<float> n0, Vec2<float> n1, float sign) {
+        const float hh = m_half * m_half;
+        const float cross = (n0.x * n1.y - n0.y * n1.x) / hh;
+        const float dot = (n0.x * n1.x + n0.y * n1.y) / hh;
+        const Vec2<float> a = offset(p, n0, sign), b = offset(p, n1, sign);
+
+        // Hampir lurus: satu titik cukup (selisih ujung offset jauh di bawah toleransi)
+        if (dot > 0.0f && std::fabs(cross) * m_half < m_tolerance * 0.25f) {
+            emit(Vec2<float>((a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f));
+            return;
+        }
+        // Belok ke arah normal: sisi ini bagian dalam, lewat titik sudut
+        if (cross > 0.0f) {
+            emit(a);
+            emit(p);
+            emit(b);
+            return;
+        }
+        emit(a);
+        switch (m_style.join) {
+            case LineJoin::Miter: {
+                // Panjang miter / half = 1 / cos(sudut / 2)
+                float cosHalf = std::sqrt(std::max((1.0f + dot) * 0.5f, 0.0f));
+                if (cosHalf > 0.0f && 1.0f / cosHalf <= m_style.miterLimit) {
+                    float mx = n0.x + n1.x, my = n0.y + n1.y;
+                    float scale = sign / (std::sqrt(mx * mx + my * my) * cosHalf) * m_half;
+                    emit(Vec2<float>(p.x + mx * scale, p.y + my * scale));
+                }
+                break;
+            }
+            case LineJoin::Round:
+                // Busur luar selalu condong ke arah datang (juga untuk putar balik 180 derajat)
+                arc(p, a, b, Vec2<float>(n0.y * sign, -n0.x * sign));
+                break;
+            case LineJoin::Bevel:
+                break;
+        }
+        emit(b);
+    }
+
+    // Titik-titik di antara from dan to (tidak termasuk keduanya) pada lingkaran berpusat center.
+    // Dari dua kemungkinan arah putar dipilih yang titik tengahnya searah hint.
+    void arc(Vec2<float> center, Vec2<float> from, Vec2<float> to, Vec2<float> hint) {
+        const float pi = 3.14159265359f;
+        float a0 = std::atan2(from.y - center.y, from.x - center.x);
+        float a1 = std::atan2(to.y - center.y, to.x - center.x);
+        float sweep = a1 - a0;
+        if (sweep > pi) sweep -= 2.0f * pi;
+        if (sweep < -pi) sweep += 2.0f * pi;
+        float mid = a0 + sweep * 0.5f;
+        if (std::cos(mid) * hint.x + std::sin(mid) * hint.y < 0.0f)
+            sweep += sweep > 0.0f ? -2.0f * pi : 2.0f * pi;
+        arcPoints(center, a0, sweep);
+    }
+
+    void arcPoints(Vec2<float> center, float a0, float sweep) {
+        float step = 2.0f * std::acos(std::max(1.0f - m_tolerance / m_half, -1.0f));
+        int steps = std::min(static_cast<int>(std::ceil(std::fabs(sweep) / std::max(step, 1e-3f))), 256);
+        for (int i = 1; i < steps; i++) {
+            float t = a0 + sweep * static_cast<float>(i) / static_cast<float>(steps);
+            emit(Vec2<float>(center.x + m_half * std::cos(t), center.y + m_half * std::sin(t)));
+        }
+    }
+
+    // Cap di ujung p; n = normal segmen terakhir (arah jalan), dari sisi kiri ke kanan.
+    // direction 1 = ujung akhir, -1 = ujung awal (dilihat dari polyline asal)
+    void cap(Vec2<float> p, Vec2<float> n, float direction) {
+        const Vec2<float> left = offset(p, n, direction), right = offset(p, n, -direction);
+        // Arah keluar dari polyline = normal diputar -90 derajat
+        const Vec2<float> out(n.y * direction, -n.x * direction);
+        switch (m_style.cap) {
+            case LineCap::Butt:
+                break;
+            case LineCap::Square:
+                emit(Vec2<float>(left.x + out.x, left.y + out.y));
+                emit(Vec2<float>(right.x + out.x, right.y + out.y));
+                break;
+            case LineCap::Round:
+                arc(p, left, right, out);
+                break;
+        }
+    }
+
+    // Polyline satu titik: cap bulat = lingkaran, square = persegi, butt tidak menggambar apa-apa
+    void dot(Vec2<float> p) {
+        if (m_style.cap == LineCap::Butt) return;
+        const float h = m_half;
+        begin();
+        if (m_style.cap == LineCap::Square) {
+            emit(Vec2<float>(p.x - h, p.y - h));
+            emit(Vec2<float>(p.x + h, p.y - h));
+            emit(Vec2<float>(p.x + h, p.y + h));
+            emit(Vec2<float>(p.x - h, p.y + h));
+        } else {
+            emit(Vec2<float>(p.x + h, p.y));
+            arcPoints(p, 0.0f, 6.28318530718f);
+        }
+        end();
+    }
+};
+
+} // namespace z
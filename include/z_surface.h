@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "z_platform.h"
+#include "z_unit.h"
+
+namespace z {
+
+// Pixel 32-bit 0xAARRGGBB, urutan byte di memori B,G,R,A
+// (sama dengan DIB section 32bpp yang dipakai Canvas di Win32)
+using Pixel = uint32_t;
+
+inline constexpr Pixel makePixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) {
+    return (static_cast<Pixel>(a) << 24) | (static_cast<Pixel>(r) << 16) | (static_cast<Pixel>(g) << 8) | static_cast<Pixel>(b);
+}
+
+inline Pixel toPixel(COLORREF color) {
+    return makePixel(GetRValue(color), GetGValue(color), GetBValue(color));
+}
+
+inline Pixel toPixel(Color<unsigned char> color) {
+    return makePixel(color.r, color.g, color.b, color.a);
+}
+
+inline COLORREF pixelToColorRef(Pixel pixel) {
+    return RGB((pixel >> 16) & 0xFF, (pixel >> 8) & 0xFF, pixel & 0xFF);
+}
+
+// View ke buffer pixel (tidak memiliki memori)
+struct Surface {
+    Pixel* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    int stride = 0;     // dalam pixel, bukan byte
+
+    Surface() = default;
+    Surface(Pixel* pixels, int width, int height, int stride)
+        : pixels(pixels), width(width), height(height), stride(stride) {}
+
+    bool valid() const { return pixels != nullptr && width > 0 && height > 0; }
+
+    Pixel* row(int y) const { return pixels + static_cast<ptrdiff_t>(y) * stride; }
+    Pixel& at(int x, int y) const { return row(y)[x]; }
+
+    Vec2<int> size() const { return Vec2<int>(width, height); }
+    Rect<int> bounds() const { return Rect<int>(0, 0, width, height); }
+};
+
+} // namespace z
@@ -0,0 +1,138 @@
+#pragma once
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include "z_unit.h"
+#include "z_surface.h"
+
+namespace z {
+
+struct SurfacePoolConfig {
+    int sizeClass = 128;            // kapasitas per sumbu dibulatkan ke atas kelipatan ini (pixel)
+    float headroom = 0.25f;         // ruang tambahan saat tumbuh (0.25 = +25%)
+    float shrinkRatio = 0.5f;       // shrink kalau area terpakai < shrinkRatio * kapasitas ...
+    double shrinkDelay = 2.0;       // ... terus-menerus selama sekian detik
+};
+
+// Statistik storage back buffer sejak SurfacePool dibuat
+struct SurfacePoolStats {
+    size_t reallocations = 0;       // storage baru dialokasi (termasuk yang pertama)
+    size_t shrinks = 0;             // bagian dari reallocations yang mengecilkan storage
+    size_t reuses = 0;              // resize yang muat di storage lama
+    size_t deferred = 0;            // resize yang tidak muat tapi ditunda karena interactive resize
+    size_t bytes = 0;               // ukuran storage sekarang
+    size_t peakBytes = 0;           // storage terbesar yang pernah dialokasi
+};
+
+// Kebijakan kapasitas back buffer Canvas (storage-nya sendiri dialokasi backend).
+// Ukuran client bisa lebih kecil dari kapasitas: surface memakai stride = capacity().x.
+// - Tumbuh: kapasitas = ukuran + headroom, dibulatkan ke sizeClass, jadi drag yang
+//   memperbesar window sedikit demi sedikit tidak alokasi setiap langkah.
+// - Muat: storage lama dipakai ulang.
+// - Shrink: hanya setelah ukuran tetap jauh lebih kecil selama shrinkDelay detik (update()).
+// - Interactive resize (drag border): resize yang tidak muat ditunda, client dipotong
+//   ke kapasitas sampai endInteractive().
+// Fungsi yang return true berarti storage harus dialokasi ulang ke capacity().
+class SurfacePool {
+public:
+    explicit SurfacePool(SurfacePoolConfig config = SurfacePoolConfig()) : m_config(config) {}
+
+    const SurfacePoolConfig& config() const { return m_config; }
+    void setConfig(const SurfacePoolConfig& config) { m_config = config; }
+
+    Vec2<int> capacity() const { return m_capacity; }
+    Vec2<int> size() const { return m_size; }           // ukuran yang dilayani storage sekarang
+    Vec2<int> requested() const { return m_requested; } // ukuran client terakhir
+    bool interactive() const { return m_interactive; }
+    const SurfacePoolStats& stats() const { return m_stats; }
+
+    bool resize(Vec2<int> size, double now) {
+        m_requested = Vec2<int>(std::max(size.x, 0), std::max(size.y, 0));
+        if (fits(m_requested)) {
+            m_size = m_requested;
+            m_stats.reuses++;
+            trackShrink(now);
+            return false;
+        }
+        m_shrinkPending = false;
+        if (m_interactive && m_capacity.x > 0 && m_capacity.y > 0) {
+            m_size = Vec2<int>(std::min(m_requested.x, m_capacity.x), std::min(m_requested.y, m_capacity.y));
+            m_stats.deferred++;
+            return false;
+        }
+        // Sumbu yang masih muat tidak ikut diperbesar
+        Vec2<int> grown = withHeadroom(m_requested);
+        allocate(Vec2<int>(m_requested.x <= m_capacity.x ? m_capacity.x : grown.x, m_requested.y <= m_capacity.y ? m_capacity.y : grown.y));
+        return true;
+    }
+
+    // Per frame: ukuran yang tertunda, lalu shrink yang sudah cukup lama
+    bool update(double now) {
+        if (m_interactive) return false;
+        if (m_size != m_requested)
+            return resize(m_requested, now);
+        if (m_shrinkPending && now - m_shrinkSince >= m_config.shrinkDelay) {
+            m_shrinkPending = false;
+            m_stats.shrinks++;
+            allocate(withHeadroom(m_requested));
+            return true;
+        }
+        return false;
+    }
+
+    void beginInteractive() { m_interactive = true; }
+
+    bool endInteractive(double now) {
+        m_interactive = false;
+        return update(now);
+    }
+
+private:
+    SurfacePoolConfig m_config;
+    SurfacePoolStats m_stats;
+    Vec2<int> m_capacity;
+    Vec2<int> m_size;
+    Vec2<int> m_requested;
+    bool m_interactive = false;
+    bool m_shrinkPending = false;
+    double m_shrinkSince = 0.0;
+
+    bool fits(Vec2<int> size) const {
+        return size.x <= m_capacity.x && size.y <= m_capacity.y;
+    }
+
+    Vec2<int> withHeadroom(Vec2<int> size) const {
+        return Vec2<int>(roundUp(size.x), roundUp(size.y));
+    }
+
+    int roundUp(int n) const {
+        if (n <= 0) return 0;
+        int step = std::max(m_config.sizeClass, 1);
+        double wanted = static_cast<double>(n) * (1.0 + std::max(m_config.headroom, 0.0f));
+        double rounded = std::ceil(wanted / step) * step;
+        return static_cast<int>(std::min(rounded, 1073741824.0));
+    }
+
+    // Timer shrink mulai saat ukuran pertama kali jauh lebih kecil, batal kalau membesar lagi
+    void trackShrink(double now) {
+        double used = static_cast<double>(m_size.x) * m_size.y;
+        double total = static_cast<double>(m_capacity.x) * m_capacity.y;
+        bool small = used < m_config.shrinkRatio * total && withHeadroom(m_size) != m_capacity;
+        if (!small) {
+            m_shrinkPending = false;
+        } else if (!m_shrinkPending) {
+            m_shrinkPending = true;
+            m_shrinkSince = now;
+        }
+    }
+
+    void allocate(Vec2<int> capacity) {
+        m_capacity = capacity;
+        m_size = m_requested;
+        m_stats.reallocations++;
+        m_stats.bytes = static_cast<size_t>(capacity.x) * static_cast<size_t>(capacity.y) * sizeof(Pixel);
+        m_stats.peakBytes = std::max(m_stats.peakBytes, m_stats.bytes);
+    }
+};
+
+} // namespace z
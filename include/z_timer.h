@@ -1,5 +1,5 @@
 #pragma once
-#include <windows.h>
+#include "z_platform.h"
 
 namespace z {
 
@@ -12,12 +12,12 @@ class Timer {
 public:
     Timer(TimerMode mode = TimerMode::Simple)
         : m_mode(mode) {
-        QueryPerformanceFrequency(&m_freq);
+        m_freq = platform::tickFrequency();
         start();
     }
 
     void start() {
-        QueryPerformanceCounter(&m_startTime);
+        m_startTime = platform::ticks();
         m_prevTime = m_startTime;
         m_currTime = m_startTime;
         m_deltaTime = 0.0f;
@@ -28,8 +28,8 @@ public:
     }
 
     void tick() {
-        QueryPerformanceCounter(&m_currTime);
-        m_deltaTime = static_cast<float>(m_currTime.QuadPart - m_prevTime.QuadPart) / m_freq.QuadPart;
+        m_currTime = platform::ticks();
+        m_deltaTime = static_cast<float>(m_currTime - m_prevTime) / m_freq;
         m_prevTime = m_currTime;
     }
 
@@ -38,11 +38,11 @@ public:
     }
 
     float totalTime() const {
-        return static_cast<float>(m_currTime.QuadPart - m_startTime.QuadPart) / m_freq.QuadPart;
+        return static_cast<float>(m_currTime - m_startTime) / m_freq;
     }
 
     void delayMilliseconds(int ms) {
-        Sleep(ms);
+        platform::sleepMilliseconds(ms);
     }
 
     void sleepToFps(float targetFps) {
@@ -52,19 +52,17 @@ public:
         if (waitTime <= 0.0f) return;
 
         if (m_mode == TimerMode::Simple) {
-            Sleep(static_cast<DWORD>(waitTime * 1000));
+            platform::sleepMilliseconds(static_cast<int>(waitTime * 1000));
         } else {
             // Hybrid: sleep sebagian, busy-wait sisanya
             if (waitTime > 0.002f)
-                Sleep(static_cast<DWORD>((waitTime - 0.001f) * 1000));
+                platform::sleepMilliseconds(static_cast<int>((waitTime - 0.001f) * 1000));
 
-            LARGE_INTEGER start, now;
-            QueryPerformanceCounter(&start);
+            int64_t start = platform::ticks();
             float elapsed = 0.0f;
 
             do {
-                QueryPerformanceCounter(&now);
-                elapsed = static_cast<float>(now.QuadPart - start.QuadPart) / m_freq.QuadPart;
+                elapsed = static_cast<float>(platform::ticks() - start) / m_freq;
             } while (elapsed < waitTime);
         }
     }
@@ -72,10 +70,10 @@ public:
 private:
     TimerMode m_mode;
 
-    LARGE_INTEGER m_freq;
-    LARGE_INTEGER m_startTime;
-    LARGE_INTEGER m_prevTime;
-    LARGE_INTEGER m_currTime;
+    int64_t m_freq;
+    int64_t m_startTime;
+    int64_t m_prevTime;
+    int64_t m_currTime;
 
     float m_deltaTime = 0.0f;
 };
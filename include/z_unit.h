@@ -1,14 +1,252 @@
 #pragma once
 #include <type_traits>
 #include <algorithm>
-#include <windows.h>
+#include <exception>
+#include <cassert>
+#include <cstdint>
+#include <cmath>
+
+// Perilaku pembagian dengan nol (dan overflow Fixed), dipilih saat compile:
+//   Z_UNIT_DIVISION_THROW     : cek pembagi, throw zero_division / fixed_overflow (default)
+//   Z_UNIT_DIVISION_ASSERT    : cek pembagi dengan assert (hilang di NDEBUG)
+//   Z_UNIT_DIVISION_UNCHECKED : tanpa cek, pembagian langsung
+// Contoh: -DZ_UNIT_DIVISION=Z_UNIT_DIVISION_UNCHECKED
+#define Z_UNIT_DIVISION_THROW 0
+#define Z_UNIT_DIVISION_ASSERT 1
+#define Z_UNIT_DIVISION_UNCHECKED 2
+
+#ifndef Z_UNIT_DIVISION
+	#define Z_UNIT_DIVISION Z_UNIT_DIVISION_THROW
+#endif
+
+#if Z_UNIT_DIVISION != Z_UNIT_DIVISION_THROW && Z_UNIT_DIVISION != Z_UNIT_DIVISION_ASSERT && Z_UNIT_DIVISION != Z_UNIT_DIVISION_UNCHECKED
+	#error "Z_UNIT_DIVISION must be Z_UNIT_DIVISION_THROW, Z_UNIT_DIVISION_ASSERT or Z_UNIT_DIVISION_UNCHECKED"
+#endif
+
+// Hanya mode throw yang membuat operator/ (dan operasi Fixed yang dicek) tidak noexcept
+#define Z_UNIT_DIVISION_NOEXCEPT noexcept(Z_UNIT_DIVISION != Z_UNIT_DIVISION_THROW)
+
+struct zero_division : std::exception {
+	const char* what() const noexcept override {
+		return "Division by zero" ;
+	}
+
+	const char* operator()() const noexcept {
+		return what() ;
+	}
+} ;
+
+struct fixed_overflow : std::exception {
+	const char* what() const noexcept override {
+		return "Fixed point overflow" ;
+	}
 
-struct zero_division {
 	const char* operator()() const noexcept {
-		return "Division by zero in Color" ;
+		return what() ;
 	}
 } ;
 
+// Overload skalar (Vec2(T n), operator+(const T&), ...) hanya untuk tipe aritmatika,
+// supaya tipe lain yang bisa dikonversi (mis. z::PackedColor) memakai konversinya sendiri
+template <typename T> using z_unit_scalar = std::enable_if_t<std::is_arithmetic_v<T>, int> ;
+
+// Di constant expression, pembagi nol selalu menjadi compile error (throw / assert gagal,
+// atau pembagian integer dengan nol di mode unchecked)
+constexpr void zero_division_check(bool zero) Z_UNIT_DIVISION_NOEXCEPT {
+#if Z_UNIT_DIVISION == Z_UNIT_DIVISION_THROW
+	if(zero) throw zero_division() ;
+#elif Z_UNIT_DIVISION == Z_UNIT_DIVISION_ASSERT
+	assert(!zero && "Division by zero") ;
+	(void)zero ;
+#else
+	(void)zero ;
+#endif
+}
+
+// Hasil Fixed yang tidak muat 32 bit memakai kebijakan yang sama dengan pembagi nol
+constexpr void fixed_overflow_check(bool overflow) Z_UNIT_DIVISION_NOEXCEPT {
+#if Z_UNIT_DIVISION == Z_UNIT_DIVISION_THROW
+	if(overflow) throw fixed_overflow() ;
+#elif Z_UNIT_DIVISION == Z_UNIT_DIVISION_ASSERT
+	assert(!overflow && "Fixed point overflow") ;
+	(void)overflow ;
+#else
+	(void)overflow ;
+#endif
+}
+
+// floor(v / 2^bits) tanpa bergantung pada shift kanan bilangan negatif
+constexpr int64_t fixed_shift_floor(int64_t v, int bits) noexcept {
+	return v >= 0 ? v >> bits : ~(~v >> bits) ;
+}
+
+// ===== Fixed =====
+// Fixed point 24.8 (1/256 pixel) untuk koordinat subpixel rasterizer.
+// Semua operasi memakai integer dengan pembulatan yang terdefinisi, jadi hasilnya
+// sama persis di compiler dan flag optimasi apa pun, tidak seperti float.
+//   konversi dari float : tepat, dibulatkan ke terdekat (setengah menjauhi nol)
+//   ke int              : floor, seperti posisi pixel
+//   + dan -             : wrap 32 bit tanpa cek
+//   * dan /             : dihitung 64 bit, overflow dicek (lihat Z_UNIT_DIVISION)
+struct Fixed {
+	static constexpr int FRACTION_BITS = 8 ;
+	static constexpr int32_t ONE = 1 << FRACTION_BITS ;
+	static constexpr int32_t INT_MIN_VALUE = -(1 << (31 - FRACTION_BITS)) ;
+	static constexpr int32_t INT_MAX_VALUE = (1 << (31 - FRACTION_BITS)) - 1 ;
+	int32_t raw ;
+	constexpr Fixed() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Fixed(T n) Z_UNIT_DIVISION_NOEXCEPT ;
+	static constexpr Fixed fromRaw(int32_t raw) noexcept ;
+	constexpr Fixed operator-() const noexcept ;
+	constexpr Fixed operator+(Fixed other) const noexcept ;
+	constexpr Fixed operator-(Fixed other) const noexcept ;
+	constexpr Fixed operator*(Fixed other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Fixed operator/(Fixed other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Fixed& operator+=(Fixed other) noexcept ;
+	constexpr Fixed& operator-=(Fixed other) noexcept ;
+	constexpr Fixed& operator*=(Fixed other) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Fixed& operator/=(Fixed other) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(Fixed other) const noexcept ;
+	constexpr bool operator!=(Fixed other) const noexcept ;
+	constexpr bool operator<(Fixed other) const noexcept ;
+	constexpr bool operator<=(Fixed other) const noexcept ;
+	constexpr bool operator>(Fixed other) const noexcept ;
+	constexpr bool operator>=(Fixed other) const noexcept ;
+	constexpr int floor() const noexcept ;
+	constexpr int ceil() const noexcept ;
+	constexpr int round() const noexcept ;
+	explicit constexpr operator int() const noexcept ;
+	explicit constexpr operator float() const noexcept ;
+} ;
+
+// Fixed implementation
+
+constexpr Fixed::Fixed() noexcept : raw(0) {
+}
+
+template <typename T, z_unit_scalar<T>> constexpr Fixed::Fixed(T n) Z_UNIT_DIVISION_NOEXCEPT : raw(0) {
+	if constexpr (std::is_floating_point_v<T>) {
+		// Kali 256 tepat di double, pembulatan dikerjakan sendiri supaya tidak
+		// tergantung mode rounding FPU atau -ffast-math
+		const double scaled = static_cast<double>(n) * ONE ;
+		if(!(scaled > -2147483648.5 && scaled < 2147483647.5)) {
+			fixed_overflow_check(true) ;
+			raw = scaled > 0.0 ? INT32_MAX : scaled < 0.0 ? INT32_MIN : 0 ;
+			return ;
+		}
+		int64_t whole = static_cast<int64_t>(scaled) ;
+		const double frac = scaled - static_cast<double>(whole) ;
+		if(frac >= 0.5) whole++ ;
+		else if(frac <= -0.5) whole-- ;
+		raw = static_cast<int32_t>(whole) ;
+	}
+	else if constexpr (std::is_signed_v<T>) {
+		fixed_overflow_check(n < INT_MIN_VALUE || n > INT_MAX_VALUE) ;
+		raw = static_cast<int32_t>(static_cast<int64_t>(n) * ONE) ;
+	}
+	else {
+		fixed_overflow_check(static_cast<uint64_t>(n) > static_cast<uint64_t>(INT_MAX_VALUE)) ;
+		raw = static_cast<int32_t>(static_cast<uint64_t>(n) * ONE) ;
+	}
+}
+
+constexpr Fixed Fixed::fromRaw(int32_t raw) noexcept {
+	Fixed f ;
+	f.raw = raw ;
+	return f ;
+}
+
+constexpr Fixed Fixed::operator-() const noexcept {
+	return fromRaw(static_cast<int32_t>(0u - static_cast<uint32_t>(raw))) ;
+}
+
+constexpr Fixed Fixed::operator+(Fixed other) const noexcept {
+	return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(raw) + static_cast<uint32_t>(other.raw))) ;
+}
+
+constexpr Fixed Fixed::operator-(Fixed other) const noexcept {
+	return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(raw) - static_cast<uint32_t>(other.raw))) ;
+}
+
+constexpr Fixed Fixed::operator*(Fixed other) const Z_UNIT_DIVISION_NOEXCEPT {
+	// Hasil kali 16 bit pecahan, dibulatkan ke terdekat (setengah ke atas)
+	const int64_t product = fixed_shift_floor(static_cast<int64_t>(raw) * other.raw + (ONE >> 1), FRACTION_BITS) ;
+	fixed_overflow_check(product < INT32_MIN || product > INT32_MAX) ;
+	return fromRaw(static_cast<int32_t>(product)) ;
+}
+
+constexpr Fixed Fixed::operator/(Fixed other) const Z_UNIT_DIVISION_NOEXCEPT {
+	// Dibulatkan ke arah nol, sama dengan pembagian int
+	zero_division_check(other.raw == 0) ;
+	const int64_t quotient = static_cast<int64_t>(raw) * ONE / other.raw ;
+	fixed_overflow_check(quotient < INT32_MIN || quotient > INT32_MAX) ;
+	return fromRaw(static_cast<int32_t>(quotient)) ;
+}
+
+constexpr Fixed& Fixed::operator+=(Fixed other) noexcept {
+	*this = *this + other ;
+	return *this ;
+}
+
+constexpr Fixed& Fixed::operator-=(Fixed other) noexcept {
+	*this = *this - other ;
+	return *this ;
+}
+
+constexpr Fixed& Fixed::operator*=(Fixed other) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this * other ;
+	return *this ;
+}
+
+constexpr Fixed& Fixed::operator/=(Fixed other) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this / other ;
+	return *this ;
+}
+
+constexpr bool Fixed::operator==(Fixed other) const noexcept {
+	return raw == other.raw ;
+}
+
+constexpr bool Fixed::operator!=(Fixed other) const noexcept {
+	return raw != other.raw ;
+}
+
+constexpr bool Fixed::operator<(Fixed other) const noexcept {
+	return raw < other.raw ;
+}
+
+constexpr bool Fixed::operator<=(Fixed other) const noexcept {
+	return raw <= other.raw ;
+}
+
+constexpr bool Fixed::operator>(Fixed other) const noexcept {
+	return raw > other.raw ;
+}
+
+constexpr bool Fixed::operator>=(Fixed other) const noexcept {
+	return raw >= other.raw ;
+}
+
+constexpr int Fixed::floor() const noexcept {
+	return static_cast<int>(fixed_shift_floor(raw, FRACTION_BITS)) ;
+}
+
+constexpr int Fixed::ceil() const noexcept {
+	return static_cast<int>(fixed_shift_floor(static_cast<int64_t>(raw) + ONE - 1, FRACTION_BITS)) ;
+}
+
+constexpr int Fixed::round() const noexcept {
+	return static_cast<int>(fixed_shift_floor(static_cast<int64_t>(raw) + (ONE >> 1), FRACTION_BITS)) ;
+}
+
+constexpr Fixed::operator int() const noexcept {
+	return floor() ;
+}
+
+constexpr Fixed::operator float() const noexcept {
+	return static_cast<float>(raw) / ONE ;
+}
+
 template <typename T> struct is_defined_Vec2_variants {
 	static constexpr bool value = false ;
 } ;
@@ -21,6 +259,10 @@ template <> struct is_defined_Vec2_variants<float> {
 	static constexpr bool value = true ;
 } ;
 
+template <> struct is_defined_Vec2_variants<Fixed> {
+	static constexpr bool value = true ;
+} ;
+
 template <typename T> constexpr bool is_defined_Vec2_variants_v = is_defined_Vec2_variants<T>::value ;
 
 template <typename T> struct Vec2 {
@@ -29,310 +271,546 @@ template <typename T> struct Vec2 {
 
 template <> struct Vec2<int> {
 	int x, y ;
-	inline Vec2() noexcept ;
-	template <typename T> Vec2(T n) ;
-	template <typename T> Vec2(T x, T y) ;
-	template <typename T> Vec2(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator=(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator+(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator-(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator*(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator/(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator+=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator-=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator*=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator/=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator=(const T& val) ;
-	template <typename T> Vec2 operator+(const T& val) ;
-	template <typename T> Vec2 operator-(const T& val) ;
-	template <typename T> Vec2 operator*(const T& val) ;
-	template <typename T> Vec2 operator/(const T& val) ;
-	template <typename T> Vec2& operator+=(const T& val) ;
-	template <typename T> Vec2& operator-=(const T& val) ;
-	template <typename T> Vec2& operator*=(const T& val) ;
-	template <typename T> Vec2& operator/=(const T& val) ;
-	inline bool operator==(const Vec2& other) ;
-	inline bool operator!=(const Vec2& other) ;
-	inline operator Vec2<float>() const noexcept ;
+	constexpr Vec2() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2(T n) noexcept ;
+	template <typename T> constexpr Vec2(T x, T y) noexcept ;
+	template <typename T> constexpr Vec2(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2 operator+(const Vec2<T>& other) const noexcept ;
+	template <typename T> constexpr Vec2 operator-(const Vec2<T>& other) const noexcept ;
+	template <typename T> constexpr Vec2 operator*(const Vec2<T>& other) const noexcept ;
+	template <typename T> constexpr Vec2 operator/(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator+=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator-=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator*=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator/=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator+(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator-(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator*(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator+=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator-=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator*=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Vec2& other) const noexcept ;
+	constexpr bool operator!=(const Vec2& other) const noexcept ;
+	constexpr operator Vec2<float>() const noexcept ;
 } ;
 
 template <> struct Vec2<float> {
 	float x, y ;
-	inline Vec2() noexcept ;
-	template <typename T> Vec2(T n) ;
-	template <typename T> Vec2(T x, T y) ;
-	template <typename T> Vec2(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator=(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator+(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator-(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator*(const Vec2<T>& other) ;
-	template <typename T> Vec2 operator/(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator+=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator-=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator*=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator/=(const Vec2<T>& other) ;
-	template <typename T> Vec2& operator=(const T& val) ;
-	template <typename T> Vec2 operator+(const T& val) ;
-	template <typename T> Vec2 operator-(const T& val) ;
-	template <typename T> Vec2 operator*(const T& val) ;
-	template <typename T> Vec2 operator/(const T& val) ;
-	template <typename T> Vec2& operator+=(const T& val) ;
-	template <typename T> Vec2& operator-=(const T& val) ;
-	template <typename T> Vec2& operator*=(const T& val) ;
-	template <typename T> Vec2& operator/=(const T& val) ;
-	inline bool operator==(const Vec2& other) ;
-	inline bool operator!=(const Vec2& other) ;
-	inline operator Vec2<int>() const noexcept ;
+	constexpr Vec2() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2(T n) noexcept ;
+	template <typename T> constexpr Vec2(T x, T y) noexcept ;
+	template <typename T> constexpr Vec2(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2 operator+(const Vec2<T>& other) const noexcept ;
+	template <typename T> constexpr Vec2 operator-(const Vec2<T>& other) const noexcept ;
+	template <typename T> constexpr Vec2 operator*(const Vec2<T>& other) const noexcept ;
+	template <typename T> constexpr Vec2 operator/(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator+=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator-=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator*=(const Vec2<T>& other) noexcept ;
+	template <typename T> constexpr Vec2& operator/=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator+(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator-(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator*(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2 operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator+=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator-=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator*=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2& operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Vec2& other) const noexcept ;
+	constexpr bool operator!=(const Vec2& other) const noexcept ;
+	constexpr operator Vec2<int>() const noexcept ;
 } ;
 
 // Vec2<int> implementation
 
-Vec2<int>::Vec2() noexcept {
-	x = y = 0 ;
+constexpr Vec2<int>::Vec2() noexcept : x(0), y(0) {
 }
 
-template <typename T> Vec2<int>::Vec2(T n) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int>::Vec2(T n) noexcept : x(static_cast<int>(n)), y(static_cast<int>(n)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	x = y = static_cast<int>(n) ;
 }
 
-template <typename T> Vec2<int>::Vec2(T x, T y) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	this->x = static_cast<int>(x) ;
-	this->y = static_cast<int>(y) ;
+template <typename T> constexpr Vec2<int>::Vec2(T x, T y) noexcept : x(static_cast<int>(x)), y(static_cast<int>(y)) {
+	static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, Fixed>, "undefined Vec2 variant!") ;
 }
 
-template <typename T> Vec2<int>::Vec2(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	x = static_cast<int>(other.x) ;
-	y = static_cast<int>(other.y) ;
+template <typename T> constexpr Vec2<int>::Vec2(const Vec2<T>& other) noexcept : x(static_cast<int>(other.x)), y(static_cast<int>(other.y)) {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator=(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<int>& Vec2<int>::operator=(const Vec2<T>& other) noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	x = static_cast<int>(other.x) ;
 	y = static_cast<int>(other.y) ;
 	return *this ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator+(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<int> Vec2<int>::operator+(const Vec2<T>& other) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	return {x + static_cast<int>(other.x), y + static_cast<int>(other.y)} ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator-(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<int> Vec2<int>::operator-(const Vec2<T>& other) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	return {x - static_cast<int>(other.x), y - static_cast<int>(other.y)} ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator*(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<int> Vec2<int>::operator*(const Vec2<T>& other) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	return {x * static_cast<int>(other.x), y * static_cast<int>(other.y)} ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator/(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	if(other.x == 0 || other.y == 0) throw zero_division() ;
+template <typename T> constexpr Vec2<int> Vec2<int>::operator/(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	zero_division_check(static_cast<int>(other.x) == 0 || static_cast<int>(other.y) == 0) ;
 	return {x / static_cast<int>(other.x), y / static_cast<int>(other.y)} ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator+=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<int>& Vec2<int>::operator+=(const Vec2<T>& other) noexcept {
 	*this = *this + other ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator-=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<int>& Vec2<int>::operator-=(const Vec2<T>& other) noexcept {
 	*this = *this - other ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator*=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<int>& Vec2<int>::operator*=(const Vec2<T>& other) noexcept {
 	*this = *this * other ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator/=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<int>& Vec2<int>::operator/=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
 	*this = *this / other ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int>& Vec2<int>::operator=(const T& val) noexcept {
 	*this = Vec2<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator+(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int> Vec2<int>::operator+(const T& val) const noexcept {
 	return *this + Vec2<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator-(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int> Vec2<int>::operator-(const T& val) const noexcept {
 	return *this - Vec2<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator*(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int> Vec2<int>::operator*(const T& val) const noexcept {
 	return *this * Vec2<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Vec2<int> Vec2<int>::operator/(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int> Vec2<int>::operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT {
 	return *this / Vec2<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator+=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int>& Vec2<int>::operator+=(const T& val) noexcept {
 	*this += Vec2<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator-=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int>& Vec2<int>::operator-=(const T& val) noexcept {
 	*this -= Vec2<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator*=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int>& Vec2<int>::operator*=(const T& val) noexcept {
 	*this *= Vec2<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<int>& Vec2<int>::operator/=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<int>& Vec2<int>::operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT {
 	*this /= Vec2<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-bool Vec2<int>::operator==(const Vec2<int>& other) {
+constexpr bool Vec2<int>::operator==(const Vec2<int>& other) const noexcept {
 	return (x == other.x && y == other.y) ;
 }
 
-bool Vec2<int>::operator!=(const Vec2<int>& other) {
+constexpr bool Vec2<int>::operator!=(const Vec2<int>& other) const noexcept {
 	return !(*this == other) ;
 }
 
-Vec2<int>::operator Vec2<float>() const noexcept {
+constexpr Vec2<int>::operator Vec2<float>() const noexcept {
 	return {static_cast<float>(x), static_cast<float>(y)} ;
 }
 
 // Vec2<float> implementation
 
-Vec2<float>::Vec2() noexcept {
-	x = y = 0.0f ;
+constexpr Vec2<float>::Vec2() noexcept : x(0.0f), y(0.0f) {
 }
 
-template <typename T> Vec2<float>::Vec2(T n) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float>::Vec2(T n) noexcept : x(static_cast<float>(n)), y(static_cast<float>(n)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	x = y = static_cast<float>(n) ;
 }
 
-template <typename T> Vec2<float>::Vec2(T x, T y) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	this->x = static_cast<float>(x) ;
-	this->y = static_cast<float>(y) ;
+template <typename T> constexpr Vec2<float>::Vec2(T x, T y) noexcept : x(static_cast<float>(x)), y(static_cast<float>(y)) {
+	static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, Fixed>, "undefined Vec2 variant!") ;
 }
 
-template <typename T> Vec2<float>::Vec2(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	x = static_cast<float>(other.x) ;
-	y = static_cast<float>(other.y) ;
+template <typename T> constexpr Vec2<float>::Vec2(const Vec2<T>& other) noexcept : x(static_cast<float>(other.x)), y(static_cast<float>(other.y)) {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator=(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<float>& Vec2<float>::operator=(const Vec2<T>& other) noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	x = static_cast<float>(other.x) ;
 	y = static_cast<float>(other.y) ;
 	return *this ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator+(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<float> Vec2<float>::operator+(const Vec2<T>& other) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	return {x + static_cast<float>(other.x), y + static_cast<float>(other.y)} ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator-(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<float> Vec2<float>::operator-(const Vec2<T>& other) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	return {x - static_cast<float>(other.x), y - static_cast<float>(other.y)} ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator*(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+template <typename T> constexpr Vec2<float> Vec2<float>::operator*(const Vec2<T>& other) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
 	return {x * static_cast<float>(other.x), y * static_cast<float>(other.y)} ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator/(const Vec2<T>& other) {
-	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
-	if(other.x == 0 || other.y == 0) throw zero_division() ;
+template <typename T> constexpr Vec2<float> Vec2<float>::operator/(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	zero_division_check(other.x == 0 || other.y == 0) ;
 	return {x / static_cast<float>(other.x), y / static_cast<float>(other.y)} ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator+=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<float>& Vec2<float>::operator+=(const Vec2<T>& other) noexcept {
 	*this = *this + other ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator-=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<float>& Vec2<float>::operator-=(const Vec2<T>& other) noexcept {
 	*this = *this - other ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator*=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<float>& Vec2<float>::operator*=(const Vec2<T>& other) noexcept {
 	*this = *this * other ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator/=(const Vec2<T>& other) {
+template <typename T> constexpr Vec2<float>& Vec2<float>::operator/=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
 	*this = *this / other ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float>& Vec2<float>::operator=(const T& val) noexcept {
 	*this = Vec2<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator+(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float> Vec2<float>::operator+(const T& val) const noexcept {
 	return *this + Vec2<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator-(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float> Vec2<float>::operator-(const T& val) const noexcept {
 	return *this - Vec2<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator*(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float> Vec2<float>::operator*(const T& val) const noexcept {
 	return *this * Vec2<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Vec2<float> Vec2<float>::operator/(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float> Vec2<float>::operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT {
 	return *this / Vec2<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator+=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float>& Vec2<float>::operator+=(const T& val) noexcept {
 	*this += Vec2<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator-=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float>& Vec2<float>::operator-=(const T& val) noexcept {
 	*this -= Vec2<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator*=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float>& Vec2<float>::operator*=(const T& val) noexcept {
 	*this *= Vec2<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Vec2<float>& Vec2<float>::operator/=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Vec2<float>& Vec2<float>::operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT {
 	*this /= Vec2<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-bool Vec2<float>::operator==(const Vec2<float>& other) {
+constexpr bool Vec2<float>::operator==(const Vec2<float>& other) const noexcept {
 	return (x == other.x && y == other.y) ;
 }
 
-bool Vec2<float>::operator!=(const Vec2<float>& other) {
+constexpr bool Vec2<float>::operator!=(const Vec2<float>& other) const noexcept {
 	return !(*this == other) ;
 }
 
-Vec2<float>::operator Vec2<int>() const noexcept {
+constexpr Vec2<float>::operator Vec2<int>() const noexcept {
 	return {static_cast<int>(x), static_cast<int>(y)} ;
 }
 
+// Vec2<Fixed>: posisi subpixel; operasi dengan Vec2<int> / Vec2<float> mengonversi operand
+// ke Fixed, arah sebaliknya memakai floor (ke Vec2<int>) atau nilai tepat (ke Vec2<float>)
+template <> struct Vec2<Fixed> {
+	Fixed x, y ;
+	constexpr Vec2() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Vec2(T n) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2(T x, T y) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2 operator+(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2 operator-(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2 operator*(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2 operator/(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator+=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator-=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator*=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Vec2& operator/=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Vec2 operator*(Fixed val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Vec2 operator/(Fixed val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Vec2& operator*=(Fixed val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr Vec2& operator/=(Fixed val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Vec2& other) const noexcept ;
+	constexpr bool operator!=(const Vec2& other) const noexcept ;
+	constexpr Vec2<int> floor() const noexcept ;
+	constexpr Vec2<int> round() const noexcept ;
+	constexpr operator Vec2<int>() const noexcept ;
+	constexpr operator Vec2<float>() const noexcept ;
+} ;
+
+// Vec2<Fixed> implementation
+
+constexpr Vec2<Fixed>::Vec2() noexcept : x(), y() {
+}
+
+template <typename T, z_unit_scalar<T>> constexpr Vec2<Fixed>::Vec2(T n) Z_UNIT_DIVISION_NOEXCEPT : x(n), y(n) {
+}
+
+template <typename T> constexpr Vec2<Fixed>::Vec2(T x, T y) Z_UNIT_DIVISION_NOEXCEPT : x(Fixed(x)), y(Fixed(y)) {
+	static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, Fixed>, "undefined Vec2 variant!") ;
+}
+
+template <typename T> constexpr Vec2<Fixed>::Vec2(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT : x(Fixed(other.x)), y(Fixed(other.y)) {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+}
+
+template <typename T> constexpr Vec2<Fixed>& Vec2<Fixed>::operator=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	x = Fixed(other.x) ;
+	y = Fixed(other.y) ;
+	return *this ;
+}
+
+template <typename T> constexpr Vec2<Fixed> Vec2<Fixed>::operator+(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	return {x + Fixed(other.x), y + Fixed(other.y)} ;
+}
+
+template <typename T> constexpr Vec2<Fixed> Vec2<Fixed>::operator-(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	return {x - Fixed(other.x), y - Fixed(other.y)} ;
+}
+
+template <typename T> constexpr Vec2<Fixed> Vec2<Fixed>::operator*(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	return {x * Fixed(other.x), y * Fixed(other.y)} ;
+}
+
+template <typename T> constexpr Vec2<Fixed> Vec2<Fixed>::operator/(const Vec2<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	return {x / Fixed(other.x), y / Fixed(other.y)} ;
+}
+
+template <typename T> constexpr Vec2<Fixed>& Vec2<Fixed>::operator+=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this + other ;
+	return *this ;
+}
+
+template <typename T> constexpr Vec2<Fixed>& Vec2<Fixed>::operator-=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this - other ;
+	return *this ;
+}
+
+template <typename T> constexpr Vec2<Fixed>& Vec2<Fixed>::operator*=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this * other ;
+	return *this ;
+}
+
+template <typename T> constexpr Vec2<Fixed>& Vec2<Fixed>::operator/=(const Vec2<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this / other ;
+	return *this ;
+}
+
+constexpr Vec2<Fixed> Vec2<Fixed>::operator*(Fixed val) const Z_UNIT_DIVISION_NOEXCEPT {
+	return {x * val, y * val} ;
+}
+
+constexpr Vec2<Fixed> Vec2<Fixed>::operator/(Fixed val) const Z_UNIT_DIVISION_NOEXCEPT {
+	return {x / val, y / val} ;
+}
+
+constexpr Vec2<Fixed>& Vec2<Fixed>::operator*=(Fixed val) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this * val ;
+	return *this ;
+}
+
+constexpr Vec2<Fixed>& Vec2<Fixed>::operator/=(Fixed val) Z_UNIT_DIVISION_NOEXCEPT {
+	*this = *this / val ;
+	return *this ;
+}
+
+constexpr bool Vec2<Fixed>::operator==(const Vec2<Fixed>& other) const noexcept {
+	return (x == other.x && y == other.y) ;
+}
+
+constexpr bool Vec2<Fixed>::operator!=(const Vec2<Fixed>& other) const noexcept {
+	return !(*this == other) ;
+}
+
+constexpr Vec2<int> Vec2<Fixed>::floor() const noexcept {
+	return {x.floor(), y.floor()} ;
+}
+
+constexpr Vec2<int> Vec2<Fixed>::round() const noexcept {
+	return {x.round(), y.round()} ;
+}
+
+constexpr Vec2<Fixed>::operator Vec2<int>() const noexcept {
+	return floor() ;
+}
+
+constexpr Vec2<Fixed>::operator Vec2<float>() const noexcept {
+	return {static_cast<float>(x), static_cast<float>(y)} ;
+}
+
+// ===== Affine =====
+// Transformasi 2D affine (matriks 2x3), urutan koefisien sama dengan SVG matrix(a, b, c, d, tx, ty):
+//   x' = a * x + c * y + tx
+//   y' = b * x + d * y + ty
+// A * B berarti B diterapkan dulu, lalu A.
+struct Affine {
+	float a, b, c, d, tx, ty ;
+	constexpr Affine() noexcept ;
+	constexpr Affine(float a, float b, float c, float d, float tx, float ty) noexcept ;
+	static constexpr Affine translation(float x, float y) noexcept ;
+	template <typename T> static constexpr Affine translation(const Vec2<T>& offset) noexcept ;
+	static constexpr Affine scaling(float sx, float sy) noexcept ;
+	static Affine rotation(float radians) noexcept ;
+	constexpr Affine operator*(const Affine& other) const noexcept ;
+	constexpr Affine& operator*=(const Affine& other) noexcept ;
+	template <typename T> constexpr Vec2<float> operator*(const Vec2<T>& point) const noexcept ;
+	constexpr float determinant() const noexcept ;
+	constexpr Affine inverse() const Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool isIdentity() const noexcept ;
+	constexpr bool isTranslation() const noexcept ;
+	constexpr bool isAxisAligned() const noexcept ;
+	constexpr bool operator==(const Affine& other) const noexcept ;
+	constexpr bool operator!=(const Affine& other) const noexcept ;
+} ;
+
+// Affine implementation
+
+constexpr Affine::Affine() noexcept : a(1.0f), b(0.0f), c(0.0f), d(1.0f), tx(0.0f), ty(0.0f) {
+}
+
+constexpr Affine::Affine(float a, float b, float c, float d, float tx, float ty) noexcept : a(a), b(b), c(c), d(d), tx(tx), ty(ty) {
+}
+
+constexpr Affine Affine::translation(float x, float y) noexcept {
+	return Affine(1.0f, 0.0f, 0.0f, 1.0f, x, y) ;
+}
+
+template <typename T> constexpr Affine Affine::translation(const Vec2<T>& offset) noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	return translation(static_cast<float>(offset.x), static_cast<float>(offset.y)) ;
+}
+
+constexpr Affine Affine::scaling(float sx, float sy) noexcept {
+	return Affine(sx, 0.0f, 0.0f, sy, 0.0f, 0.0f) ;
+}
+
+inline Affine Affine::rotation(float radians) noexcept {
+	const float cs = std::cos(radians) ;
+	const float sn = std::sin(radians) ;
+	return Affine(cs, sn, -sn, cs, 0.0f, 0.0f) ;
+}
+
+constexpr Affine Affine::operator*(const Affine& other) const noexcept {
+	return Affine(
+		a * other.a + c * other.b,
+		b * other.a + d * other.b,
+		a * other.c + c * other.d,
+		b * other.c + d * other.d,
+		a * other.tx + c * other.ty + tx,
+		b * other.tx + d * other.ty + ty
+	) ;
+}
+
+constexpr Affine& Affine::operator*=(const Affine& other) noexcept {
+	*this = *this * other ;
+	return *this ;
+}
+
+template <typename T> constexpr Vec2<float> Affine::operator*(const Vec2<T>& point) const noexcept {
+	static_assert(is_defined_Vec2_variants_v<T>, "undefined Vec2 variant!") ;
+	const float x = static_cast<float>(point.x) ;
+	const float y = static_cast<float>(point.y) ;
+	// Urutan operasi sama dengan kernel z::simd::transform
+	return {a * x + c * y + tx, d * y + b * x + ty} ;
+}
+
+constexpr float Affine::determinant() const noexcept {
+	return a * d - b * c ;
+}
+
+constexpr Affine Affine::inverse() const Z_UNIT_DIVISION_NOEXCEPT {
+	const float det = determinant() ;
+	zero_division_check(det == 0.0f) ;
+	const float inv = 1.0f / det ;
+	return Affine(
+		d * inv,
+		-b * inv,
+		-c * inv,
+		a * inv,
+		(c * ty - d * tx) * inv,
+		(b * tx - a * ty) * inv
+	) ;
+}
+
+constexpr bool Affine::isIdentity() const noexcept {
+	return isTranslation() && tx == 0.0f && ty == 0.0f ;
+}
+
+constexpr bool Affine::isTranslation() const noexcept {
+	return a == 1.0f && d == 1.0f && isAxisAligned() ;
+}
+
+constexpr bool Affine::isAxisAligned() const noexcept {
+	return b == 0.0f && c == 0.0f ;
+}
+
+constexpr bool Affine::operator==(const Affine& other) const noexcept {
+	return (a == other.a && b == other.b && c == other.c && d == other.d && tx == other.tx && ty == other.ty) ;
+}
+
+constexpr bool Affine::operator!=(const Affine& other) const noexcept {
+	return !(*this == other) ;
+}
+
 template <typename T> struct is_defined_Rect_variants {
 	static constexpr bool value = false ;
 } ;
@@ -353,90 +831,108 @@ template <typename T> struct Rect {
 
 template <> struct Rect<int> {
 	int x, y, w, h ;
-	inline Rect() noexcept ;
-	template <typename T> Rect(T n) ;
-	template <typename T> Rect(T x, T y, T w, T h) ;
-	template <typename T> Rect(const Rect<T>& other) ;
-	template <typename T> Rect& operator=(const Rect<T>& other) ;
-	template <typename T> Rect operator+(const Rect<T>& other) ;
-	template <typename T> Rect operator-(const Rect<T>& other) ;
-	template <typename T> Rect operator*(const Rect<T>& other) ;
-	template <typename T> Rect operator/(const Rect<T>& other) ;
-	template <typename T> Rect& operator+=(const Rect<T>& other) ;
-	template <typename T> Rect& operator-=(const Rect<T>& other) ;
-	template <typename T> Rect& operator*=(const Rect<T>& other) ;
-	template <typename T> Rect& operator/=(const Rect<T>& other) ;
-	template <typename T> Rect& operator=(const T& val) ;
-	template <typename T> Rect operator+(const T& val) ;
-	template <typename T> Rect operator-(const T& val) ;
-	template <typename T> Rect operator*(const T& val) ;
-	template <typename T> Rect operator/(const T& val) ;
-	template <typename T> Rect& operator+=(const T& val) ;
-	template <typename T> Rect& operator-=(const T& val) ;
-	template <typename T> Rect& operator*=(const T& val) ;
-	template <typename T> Rect& operator/=(const T& val) ;
-	inline bool operator==(const Rect& other) ;
-	inline bool operator!=(const Rect& other) ;
-	inline operator Rect<float>() const noexcept ;
+	constexpr Rect() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect(T n) noexcept ;
+	template <typename T> constexpr Rect(T x, T y, T w, T h) noexcept ;
+	template <typename T> constexpr Rect(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect operator+(const Rect<T>& other) const noexcept ;
+	template <typename T> constexpr Rect operator-(const Rect<T>& other) const noexcept ;
+	template <typename T> constexpr Rect operator*(const Rect<T>& other) const noexcept ;
+	template <typename T> constexpr Rect operator/(const Rect<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Rect& operator+=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator-=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator*=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator/=(const Rect<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator+(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator-(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator*(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator+=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator-=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator*=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Rect& other) const noexcept ;
+	constexpr bool operator!=(const Rect& other) const noexcept ;
+	constexpr int right() const noexcept ;
+	constexpr int bottom() const noexcept ;
+	constexpr bool empty() const noexcept ;
+	template <typename T> constexpr bool contains(const Vec2<T>& point) const noexcept ;
+	constexpr bool contains(const Rect& other) const noexcept ;
+	constexpr bool overlaps(const Rect& other) const noexcept ;
+	constexpr Rect intersect(const Rect& other) const noexcept ;
+	constexpr Rect unite(const Rect& other) const noexcept ;
+	constexpr operator Rect<float>() const noexcept ;
 } ;
 
 template <> struct Rect<float> {
 	float x, y, w, h ;
-	inline Rect() noexcept ;
-	template <typename T> Rect(T n) ;
-	template <typename T> Rect(T x, T y, T w, T h) ;
-	template <typename T> Rect(const Rect<T>& other) ;
-	template <typename T> Rect& operator=(const Rect<T>& other) ;
-	template <typename T> Rect operator+(const Rect<T>& other) ;
-	template <typename T> Rect operator-(const Rect<T>& other) ;
-	template <typename T> Rect operator*(const Rect<T>& other) ;
-	template <typename T> Rect operator/(const Rect<T>& other) ;
-	template <typename T> Rect& operator+=(const Rect<T>& other) ;
-	template <typename T> Rect& operator-=(const Rect<T>& other) ;
-	template <typename T> Rect& operator*=(const Rect<T>& other) ;
-	template <typename T> Rect& operator/=(const Rect<T>& other) ;
-	template <typename T> Rect& operator=(const T& val) ;
-	template <typename T> Rect operator+(const T& val) ;
-	template <typename T> Rect operator-(const T& val) ;
-	template <typename T> Rect operator*(const T& val) ;
-	template <typename T> Rect operator/(const T& val) ;
-	template <typename T> Rect& operator+=(const T& val) ;
-	template <typename T> Rect& operator-=(const T& val) ;
-	template <typename T> Rect& operator*=(const T& val) ;
-	template <typename T> Rect& operator/=(const T& val) ;
-	inline bool operator==(const Rect& other) ;
-	inline bool operator!=(const Rect& other) ;
-	inline operator Rect<int>() const noexcept ;
+	constexpr Rect() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect(T n) noexcept ;
+	template <typename T> constexpr Rect(T x, T y, T w, T h) noexcept ;
+	template <typename T> constexpr Rect(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect operator+(const Rect<T>& other) const noexcept ;
+	template <typename T> constexpr Rect operator-(const Rect<T>& other) const noexcept ;
+	template <typename T> constexpr Rect operator*(const Rect<T>& other) const noexcept ;
+	template <typename T> constexpr Rect operator/(const Rect<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Rect& operator+=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator-=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator*=(const Rect<T>& other) noexcept ;
+	template <typename T> constexpr Rect& operator/=(const Rect<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator+(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator-(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator*(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator+=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator-=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator*=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Rect& operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Rect& other) const noexcept ;
+	constexpr bool operator!=(const Rect& other) const noexcept ;
+	constexpr float right() const noexcept ;
+	constexpr float bottom() const noexcept ;
+	constexpr bool empty() const noexcept ;
+	template <typename T> constexpr bool contains(const Vec2<T>& point) const noexcept ;
+	constexpr bool contains(const Rect& other) const noexcept ;
+	constexpr bool overlaps(const Rect& other) const noexcept ;
+	constexpr Rect intersect(const Rect& other) const noexcept ;
+	constexpr Rect unite(const Rect& other) const noexcept ;
+	constexpr operator Rect<int>() const noexcept ;
 } ;
 
 // Rect<int> implementation
 
-Rect<int>::Rect() noexcept {
-	x = y = w = h = 0 ;
+constexpr Rect<int>::Rect() noexcept : x(0), y(0), w(0), h(0) {
 }
 
-template <typename T> Rect<int>::Rect(T n) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int>::Rect(T n) noexcept :
+	x(static_cast<int>(n)),
+	y(static_cast<int>(n)),
+	w(static_cast<int>(n)),
+	h(static_cast<int>(n)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	x = y = w = h = static_cast<int>(n) ;
 }
 
-template <typename T> Rect<int>::Rect(T x, T y, T w, T h) {
+template <typename T> constexpr Rect<int>::Rect(T x, T y, T w, T h) noexcept :
+	x(static_cast<int>(x)),
+	y(static_cast<int>(y)),
+	w(static_cast<int>(w)),
+	h(static_cast<int>(h)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	this->x = static_cast<int>(x) ;
-	this->y = static_cast<int>(y) ;
-	this->w = static_cast<int>(w) ;
-	this->h = static_cast<int>(h) ;
 }
 
-template <typename T> Rect<int>::Rect(const Rect<T>& other) {
+template <typename T> constexpr Rect<int>::Rect(const Rect<T>& other) noexcept :
+	x(static_cast<int>(other.x)),
+	y(static_cast<int>(other.y)),
+	w(static_cast<int>(other.w)),
+	h(static_cast<int>(other.h)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	x = static_cast<int>(other.x) ;
-	y = static_cast<int>(other.y) ;
-	w = static_cast<int>(other.w) ;
-	h = static_cast<int>(other.h) ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator=(const Rect<T>& other) {
+template <typename T> constexpr Rect<int>& Rect<int>::operator=(const Rect<T>& other) noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	x = static_cast<int>(other.x) ;
 	y = static_cast<int>(other.y) ;
@@ -445,128 +941,174 @@ template <typename T> Rect<int>& Rect<int>::operator=(const Rect<T>& other) {
 	return *this ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator+(const Rect<T>& other) {
+template <typename T> constexpr Rect<int> Rect<int>::operator+(const Rect<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	return {x + static_cast<int>(other.x), y + static_cast<int>(other.y), w + static_cast<int>(other.w), h + static_cast<int>(other.h)} ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator-(const Rect<T>& other) {
+template <typename T> constexpr Rect<int> Rect<int>::operator-(const Rect<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	return {x - static_cast<int>(other.x), y - static_cast<int>(other.y), w - static_cast<int>(other.w), h - static_cast<int>(other.h)} ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator*(const Rect<T>& other) {
+template <typename T> constexpr Rect<int> Rect<int>::operator*(const Rect<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	return {x * static_cast<int>(other.x), y * static_cast<int>(other.y), w * static_cast<int>(other.w), h * static_cast<int>(other.h)} ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator/(const Rect<T>& other) {
+template <typename T> constexpr Rect<int> Rect<int>::operator/(const Rect<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	if(other.x == 0 || other.y == 0) throw zero_division() ;
+	zero_division_check(static_cast<int>(other.x) == 0 || static_cast<int>(other.y) == 0 || static_cast<int>(other.w) == 0 || static_cast<int>(other.h) == 0) ;
 	return {x / static_cast<int>(other.x), y / static_cast<int>(other.y), w / static_cast<int>(other.w), h / static_cast<int>(other.h)} ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator+=(const Rect<T>& other) {
+template <typename T> constexpr Rect<int>& Rect<int>::operator+=(const Rect<T>& other) noexcept {
 	*this = *this + other ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator-=(const Rect<T>& other) {
+template <typename T> constexpr Rect<int>& Rect<int>::operator-=(const Rect<T>& other) noexcept {
 	*this = *this - other ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator*=(const Rect<T>& other) {
+template <typename T> constexpr Rect<int>& Rect<int>::operator*=(const Rect<T>& other) noexcept {
 	*this = *this * other ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator/=(const Rect<T>& other) {
+template <typename T> constexpr Rect<int>& Rect<int>::operator/=(const Rect<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
 	*this = *this / other ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int>& Rect<int>::operator=(const T& val) noexcept {
 	*this = Rect<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator+(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int> Rect<int>::operator+(const T& val) const noexcept {
 	return *this + Rect<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator-(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int> Rect<int>::operator-(const T& val) const noexcept {
 	return *this - Rect<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator*(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int> Rect<int>::operator*(const T& val) const noexcept {
 	return *this * Rect<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Rect<int> Rect<int>::operator/(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int> Rect<int>::operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT {
 	return *this / Rect<int>(static_cast<int>(val)) ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator+=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int>& Rect<int>::operator+=(const T& val) noexcept {
 	*this += Rect<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator-=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int>& Rect<int>::operator-=(const T& val) noexcept {
 	*this -= Rect<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator*=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int>& Rect<int>::operator*=(const T& val) noexcept {
 	*this *= Rect<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<int>& Rect<int>::operator/=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<int>& Rect<int>::operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT {
 	*this /= Rect<int>(static_cast<int>(val)) ;
 	return *this ;
 }
 
-bool Rect<int>::operator==(const Rect<int>& other) {
+constexpr bool Rect<int>::operator==(const Rect<int>& other) const noexcept {
 	return (x == other.x && y == other.y && w == other.w && h == other.h) ;
 }
 
-bool Rect<int>::operator!=(const Rect<int>& other) {
+constexpr bool Rect<int>::operator!=(const Rect<int>& other) const noexcept {
 	return !(*this == other) ;
 }
 
-Rect<int>::operator Rect<float>() const noexcept {
+constexpr Rect<int>::operator Rect<float>() const noexcept {
 	return {static_cast<float>(x), static_cast<float>(y), static_cast<float>(w), static_cast<float>(h)} ;
 }
 
+// Rect<int> geometry: area setengah terbuka [x, x + w) x [y, y + h), w/h <= 0 berarti kosong
+
+constexpr int Rect<int>::right() const noexcept {
+	return x + w ;
+}
+
+constexpr int Rect<int>::bottom() const noexcept {
+	return y + h ;
+}
+
+constexpr bool Rect<int>::empty() const noexcept {
+	return w <= 0 || h <= 0 ;
+}
+
+template <typename T> constexpr bool Rect<int>::contains(const Vec2<T>& point) const noexcept {
+	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+	return point.x >= x && point.x < x + w && point.y >= y && point.y < y + h ;
+}
+
+constexpr bool Rect<int>::contains(const Rect<int>& other) const noexcept {
+	return !other.empty() && other.x >= x && other.y >= y && other.right() <= right() && other.bottom() <= bottom() ;
+}
+
+constexpr bool Rect<int>::overlaps(const Rect<int>& other) const noexcept {
+	return !empty() && !other.empty() && other.x < right() && other.right() > x && other.y < bottom() && other.bottom() > y ;
+}
+
+// Irisan dua rect, Rect kosong (0, 0, 0, 0) kalau tidak beririsan
+constexpr Rect<int> Rect<int>::intersect(const Rect<int>& other) const noexcept {
+	if(!overlaps(other)) return Rect<int>() ;
+	int left = std::max(x, other.x) ;
+	int top = std::max(y, other.y) ;
+	return Rect<int>(left, top, std::min(right(), other.right()) - left, std::min(bottom(), other.bottom()) - top) ;
+}
+
+// Bounding box gabungan, rect kosong diabaikan
+constexpr Rect<int> Rect<int>::unite(const Rect<int>& other) const noexcept {
+	if(empty()) return other ;
+	if(other.empty()) return *this ;
+	int left = std::min(x, other.x) ;
+	int top = std::min(y, other.y) ;
+	return Rect<int>(left, top, std::max(right(), other.right()) - left, std::max(bottom(), other.bottom()) - top) ;
+}
+
 // Rect<float> implementation
 
-Rect<float>::Rect() noexcept {
-	x = y = w = h = 0 ;
+constexpr Rect<float>::Rect() noexcept : x(0), y(0), w(0), h(0) {
 }
 
-template <typename T> Rect<float>::Rect(T n) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float>::Rect(T n) noexcept :
+	x(static_cast<float>(n)),
+	y(static_cast<float>(n)),
+	w(static_cast<float>(n)),
+	h(static_cast<float>(n)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	x = y = w = h = static_cast<float>(n) ;
 }
 
-template <typename T> Rect<float>::Rect(T x, T y, T w, T h) {
+template <typename T> constexpr Rect<float>::Rect(T x, T y, T w, T h) noexcept :
+	x(static_cast<float>(x)),
+	y(static_cast<float>(y)),
+	w(static_cast<float>(w)),
+	h(static_cast<float>(h)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	this->x = static_cast<float>(x) ;
-	this->y = static_cast<float>(y) ;
-	this->w = static_cast<float>(w) ;
-	this->h = static_cast<float>(h) ;
 }
 
-template <typename T> Rect<float>::Rect(const Rect<T>& other) {
+template <typename T> constexpr Rect<float>::Rect(const Rect<T>& other) noexcept :
+	x(static_cast<float>(other.x)),
+	y(static_cast<float>(other.y)),
+	w(static_cast<float>(other.w)),
+	h(static_cast<float>(other.h)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	x = static_cast<float>(other.x) ;
-	y = static_cast<float>(other.y) ;
-	w = static_cast<float>(other.w) ;
-	h = static_cast<float>(other.h) ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator=(const Rect<T>& other) {
+template <typename T> constexpr Rect<float>& Rect<float>::operator=(const Rect<T>& other) noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	x = static_cast<float>(other.x) ;
 	y = static_cast<float>(other.y) ;
@@ -575,100 +1117,144 @@ template <typename T> Rect<float>& Rect<float>::operator=(const Rect<T>& other)
 	return *this ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator+(const Rect<T>& other) {
+template <typename T> constexpr Rect<float> Rect<float>::operator+(const Rect<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	return {x + static_cast<float>(other.x), y + static_cast<float>(other.y), w + static_cast<float>(other.w), h + static_cast<float>(other.h)} ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator-(const Rect<T>& other) {
+template <typename T> constexpr Rect<float> Rect<float>::operator-(const Rect<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	return {x - static_cast<float>(other.x), y - static_cast<float>(other.y), w - static_cast<float>(other.w), h - static_cast<float>(other.h)} ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator*(const Rect<T>& other) {
+template <typename T> constexpr Rect<float> Rect<float>::operator*(const Rect<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
 	return {x * static_cast<float>(other.x), y * static_cast<float>(other.y), w * static_cast<float>(other.w), h * static_cast<float>(other.h)} ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator/(const Rect<T>& other) {
+template <typename T> constexpr Rect<float> Rect<float>::operator/(const Rect<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
 	static_assert(std::is_arithmetic_v<T>, "undefined Rect variant!") ;
-	if(other.x == 0 || other.y == 0) throw zero_division() ;
+	zero_division_check(other.x == 0 || other.y == 0 || other.w == 0 || other.h == 0) ;
 	return {x / static_cast<float>(other.x), y / static_cast<float>(other.y), w / static_cast<float>(other.w), h / static_cast<float>(other.h)} ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator+=(const Rect<T>& other) {
+template <typename T> constexpr Rect<float>& Rect<float>::operator+=(const Rect<T>& other) noexcept {
 	*this = *this + other ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator-=(const Rect<T>& other) {
+template <typename T> constexpr Rect<float>& Rect<float>::operator-=(const Rect<T>& other) noexcept {
 	*this = *this - other ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator*=(const Rect<T>& other) {
+template <typename T> constexpr Rect<float>& Rect<float>::operator*=(const Rect<T>& other) noexcept {
 	*this = *this * other ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator/=(const Rect<T>& other) {
+template <typename T> constexpr Rect<float>& Rect<float>::operator/=(const Rect<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
 	*this = *this / other ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float>& Rect<float>::operator=(const T& val) noexcept {
 	*this = Rect<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator+(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float> Rect<float>::operator+(const T& val) const noexcept {
 	return *this + Rect<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator-(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float> Rect<float>::operator-(const T& val) const noexcept {
 	return *this - Rect<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator*(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float> Rect<float>::operator*(const T& val) const noexcept {
 	return *this * Rect<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Rect<float> Rect<float>::operator/(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float> Rect<float>::operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT {
 	return *this / Rect<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator+=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float>& Rect<float>::operator+=(const T& val) noexcept {
 	*this += Rect<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator-=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float>& Rect<float>::operator-=(const T& val) noexcept {
 	*this -= Rect<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator*=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float>& Rect<float>::operator*=(const T& val) noexcept {
 	*this *= Rect<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Rect<float>& Rect<float>::operator/=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Rect<float>& Rect<float>::operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT {
 	*this /= Rect<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-bool Rect<float>::operator==(const Rect<float>& other) {
+constexpr bool Rect<float>::operator==(const Rect<float>& other) const noexcept {
 	return (x == other.x && y == other.y && w == other.w && h == other.h) ;
 }
 
-bool Rect<float>::operator!=(const Rect<float>& other) {
+constexpr bool Rect<float>::operator!=(const Rect<float>& other) const noexcept {
 	return !(*this == other) ;
 }
 
-Rect<float>::operator Rect<int>() const noexcept {
+constexpr Rect<float>::operator Rect<int>() const noexcept {
 	return {static_cast<int>(x), static_cast<int>(y), static_cast<int>(w), static_cast<int>(h)} ;
 }
 
+// Rect<float> geometry (sama dengan Rect<int>)
+
+constexpr float Rect<float>::right() const noexcept {
+	return x + w ;
+}
+
+constexpr float Rect<float>::bottom() const noexcept {
+	return y + h ;
+}
+
+constexpr bool Rect<float>::empty() const noexcept {
+	return w <= 0.0f || h <= 0.0f ;
+}
+
+template <typename T> constexpr bool Rect<float>::contains(const Vec2<T>& point) const noexcept {
+	static_assert(std::is_arithmetic_v<T>, "undefined Vec2 variant!") ;
+	return point.x >= x && point.x < x + w && point.y >= y && point.y < y + h ;
+}
+
+constexpr bool Rect<float>::contains(const Rect<float>& other) const noexcept {
+	return !other.empty() && other.x >= x && other.y >= y && other.right() <= right() && other.bottom() <= bottom() ;
+}
+
+constexpr bool Rect<float>::overlaps(const Rect<float>& other) const noexcept {
+	return !empty() && !other.empty() && other.x < right() && other.right() > x && other.y < bottom() && other.bottom() > y ;
+}
+
+// Irisan dua rect, Rect kosong (0, 0, 0, 0) kalau tidak beririsan
+constexpr Rect<float> Rect<float>::intersect(const Rect<float>& other) const noexcept {
+	if(!overlaps(other)) return Rect<float>() ;
+	float left = std::max(x, other.x) ;
+	float top = std::max(y, other.y) ;
+	return Rect<float>(left, top, std::min(right(), other.right()) - left, std::min(bottom(), other.bottom()) - top) ;
+}
+
+// Bounding box gabungan, rect kosong diabaikan
+constexpr Rect<float> Rect<float>::unite(const Rect<float>& other) const noexcept {
+	if(empty()) return other ;
+	if(other.empty()) return *this ;
+	float left = std::min(x, other.x) ;
+	float top = std::min(y, other.y) ;
+	return Rect<float>(left, top, std::max(right(), other.right()) - left, std::max(bottom(), other.bottom()) - top) ;
+}
+
 template <typename T> struct is_defined_Color_variants {
 	static constexpr bool value = false ;
 } ;
@@ -689,99 +1275,95 @@ template <typename T> struct Color {
 
 template <> struct Color<unsigned char> {
 	unsigned char r, g, b, a ;
-	inline Color() noexcept ;
-	template <typename T> Color(T n) ;
-	template <typename T> Color(T r, T g, T b, T a) ;
-	template <typename T> Color(const Color<T>& other) ;
-	template <typename T> Color& operator=(const Color<T>& other) ;
-	template <typename T> Color operator+(const Color<T>& other) ;
-	template <typename T> Color operator-(const Color<T>& other) ;
-	template <typename T> Color operator*(const Color<T>& other) ;
-	template <typename T> Color operator/(const Color<T>& other) ;
-	template <typename T> Color& operator+=(const Color<T>& other) ;
-	template <typename T> Color& operator-=(const Color<T>& other) ;
-	template <typename T> Color& operator*=(const Color<T>& other) ;
-	template <typename T> Color& operator/=(const Color<T>& other) ;
-	template <typename T> Color& operator=(const T& val) ;
-	template <typename T> Color operator+(const T& val) ;
-	template <typename T> Color operator-(const T& val) ;
-	template <typename T> Color operator*(const T& val) ;
-	template <typename T> Color operator/(const T& val) ;
-	template <typename T> Color& operator+=(const T& val) ;
-	template <typename T> Color& operator-=(const T& val) ;
-	template <typename T> Color& operator*=(const T& val) ;
-	template <typename T> Color& operator/=(const T& val) ;
-	inline bool operator==(const Color& other) ;
-	inline bool operator!=(const Color& other) ;
-	inline operator Color<float>() const noexcept ;
+	constexpr Color() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color(T n) noexcept ;
+	template <typename T> constexpr Color(T r, T g, T b, T a) noexcept ;
+	template <typename T> constexpr Color(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color operator+(const Color<T>& other) const noexcept ;
+	template <typename T> constexpr Color operator-(const Color<T>& other) const noexcept ;
+	template <typename T> constexpr Color operator*(const Color<T>& other) const noexcept ;
+	template <typename T> constexpr Color operator/(const Color<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Color& operator+=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator-=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator*=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator/=(const Color<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator+(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator-(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator*(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator+=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator-=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator*=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Color& other) const noexcept ;
+	constexpr bool operator!=(const Color& other) const noexcept ;
+	constexpr operator Color<float>() const noexcept ;
 } ;
 
 template <> struct Color<float> {
 	float r, g, b, a ;
-	inline Color() noexcept ;
-	template <typename T> Color(T n) ;
-	template <typename T> Color(T r, T g, T b, T a) ;
-	template <typename T> Color(const Color<T>& other) ;
-	template <typename T> Color& operator=(const Color<T>& other) ;
-	template <typename T> Color operator+(const Color<T>& other) ;
-	template <typename T> Color operator-(const Color<T>& other) ;
-	template <typename T> Color operator*(const Color<T>& other) ;
-	template <typename T> Color operator/(const Color<T>& other) ;
-	template <typename T> Color& operator+=(const Color<T>& other) ;
-	template <typename T> Color& operator-=(const Color<T>& other) ;
-	template <typename T> Color& operator*=(const Color<T>& other) ;
-	template <typename T> Color& operator/=(const Color<T>& other) ;
-	template <typename T> Color& operator=(const T& val) ;
-	template <typename T> Color operator+(const T& val) ;
-	template <typename T> Color operator-(const T& val) ;
-	template <typename T> Color operator*(const T& val) ;
-	template <typename T> Color operator/(const T& val) ;
-	template <typename T> Color& operator+=(const T& val) ;
-	template <typename T> Color& operator-=(const T& val) ;
-	template <typename T> Color& operator*=(const T& val) ;
-	template <typename T> Color& operator/=(const T& val) ;
-	inline bool operator==(const Color& other) ;
-	inline bool operator!=(const Color& other) ;
-	inline operator Color<unsigned char>() const noexcept ;
+	constexpr Color() noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color(T n) noexcept ;
+	template <typename T> constexpr Color(T r, T g, T b, T a) noexcept ;
+	template <typename T> constexpr Color(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color operator+(const Color<T>& other) const noexcept ;
+	template <typename T> constexpr Color operator-(const Color<T>& other) const noexcept ;
+	template <typename T> constexpr Color operator*(const Color<T>& other) const noexcept ;
+	template <typename T> constexpr Color operator/(const Color<T>& other) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T> constexpr Color& operator+=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator-=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator*=(const Color<T>& other) noexcept ;
+	template <typename T> constexpr Color& operator/=(const Color<T>& other) Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator+(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator-(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator*(const T& val) const noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator+=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator-=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator*=(const T& val) noexcept ;
+	template <typename T, z_unit_scalar<T> = 0> constexpr Color& operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT ;
+	constexpr bool operator==(const Color& other) const noexcept ;
+	constexpr bool operator!=(const Color& other) const noexcept ;
+	constexpr operator Color<unsigned char>() const noexcept ;
 } ;
 
 // Color<unsigned char> implementation
 
-Color<unsigned char>::Color() noexcept {
-	r = g = b = a = 0 ;
+constexpr Color<unsigned char>::Color() noexcept : r(0), g(0), b(0), a(0) {
 }
 
-template <typename T> Color<unsigned char>::Color(T n) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char>::Color(T n) noexcept :
+	r(static_cast<unsigned char>(std::clamp<T>(n, 0, 255))),
+	g(static_cast<unsigned char>(std::clamp<T>(n, 0, 255))),
+	b(static_cast<unsigned char>(std::clamp<T>(n, 0, 255))),
+	a(static_cast<unsigned char>(std::clamp<T>(n, 0, 255))) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	r = g = b = a = static_cast<unsigned char>(std::clamp(n, 0, 255)) ;
 }
 
-template <typename T> Color<unsigned char>::Color(T r, T g, T b, T a) {
+template <typename T> constexpr Color<unsigned char>::Color(T r, T g, T b, T a) noexcept :
+	r(static_cast<unsigned char>(std::clamp<T>(r, 0, 255))),
+	g(static_cast<unsigned char>(std::clamp<T>(g, 0, 255))),
+	b(static_cast<unsigned char>(std::clamp<T>(b, 0, 255))),
+	a(static_cast<unsigned char>(std::clamp<T>(a, 0, 255))) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	this->r = static_cast<unsigned char>(std::clamp<T>(r, 0, 255)) ;
-	this->g = static_cast<unsigned char>(std::clamp<T>(g, 0, 255)) ;
-	this->b = static_cast<unsigned char>(std::clamp<T>(b, 0, 255)) ;
-	this->a = static_cast<unsigned char>(std::clamp<T>(a, 0, 255)) ;
 }
 
-template <typename T> Color<unsigned char>::Color(const Color<T>& other) {
+// Variant lain (Color<float>) dikonversi dengan skala yang sama seperti operator konversinya
+template <typename T> constexpr Color<unsigned char>::Color(const Color<T>& other) noexcept : Color(other.operator Color<unsigned char>()) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	r = static_cast<unsigned char>(std::clamp(other.r, 0, 255)) ;
-	g = static_cast<unsigned char>(std::clamp(other.g, 0, 255)) ;
-	b = static_cast<unsigned char>(std::clamp(other.b, 0, 255)) ;
-	a = static_cast<unsigned char>(std::clamp(other.a, 0, 255)) ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator=(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char>& Color<unsigned char>::operator=(const Color<T>& other) noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	r = static_cast<unsigned char>(std::clamp(other.r, 0, 255)) ;
-	g = static_cast<unsigned char>(std::clamp(other.g, 0, 255)) ;
-	b = static_cast<unsigned char>(std::clamp(other.b, 0, 255)) ;
-	a = static_cast<unsigned char>(std::clamp(other.a, 0, 255)) ;
+	*this = other.operator Color<unsigned char>() ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator+(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char> Color<unsigned char>::operator+(const Color<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
 	return {
 		std::clamp(r + static_cast<unsigned char>(other.r), 0, 255), 
@@ -791,7 +1373,7 @@ template <typename T> Color<unsigned char> Color<unsigned char>::operator+(const
 	} ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator-(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char> Color<unsigned char>::operator-(const Color<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
 	return {
 		std::clamp(r - static_cast<unsigned char>(other.r), 0, 255), 
@@ -801,7 +1383,7 @@ template <typename T> Color<unsigned char> Color<unsigned char>::operator-(const
 	} ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator*(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char> Color<unsigned char>::operator*(const Color<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
 	return {
 		std::clamp(r * static_cast<unsigned char>(other.r), 0, 255), 
@@ -811,79 +1393,79 @@ template <typename T> Color<unsigned char> Color<unsigned char>::operator*(const
 	} ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator/(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char> Color<unsigned char>::operator/(const Color<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	if(other.r == 0 || other.g == 0 || other.b == 0 || other.a == 0) throw zero_division() ;
-		return {
-			std::clamp(r / static_cast<unsigned char>(other.r), 0, 255), 
-			std::clamp(g / static_cast<unsigned char>(other.g), 0, 255), 
-			std::clamp(b / static_cast<unsigned char>(other.b), 0, 255), 
-			std::clamp(a / static_cast<unsigned char>(other.a), 0, 255)
-		} ;
+	zero_division_check(static_cast<unsigned char>(other.r) == 0 || static_cast<unsigned char>(other.g) == 0 || static_cast<unsigned char>(other.b) == 0 || static_cast<unsigned char>(other.a) == 0) ;
+	return {
+		std::clamp(r / static_cast<unsigned char>(other.r), 0, 255), 
+		std::clamp(g / static_cast<unsigned char>(other.g), 0, 255), 
+		std::clamp(b / static_cast<unsigned char>(other.b), 0, 255), 
+		std::clamp(a / static_cast<unsigned char>(other.a), 0, 255)
+	} ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator+=(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char>& Color<unsigned char>::operator+=(const Color<T>& other) noexcept {
 	*this = *this + other ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator-=(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char>& Color<unsigned char>::operator-=(const Color<T>& other) noexcept {
 	*this = *this - other ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator*=(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char>& Color<unsigned char>::operator*=(const Color<T>& other) noexcept {
 	*this = *this * other ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator/=(const Color<T>& other) {
+template <typename T> constexpr Color<unsigned char>& Color<unsigned char>::operator/=(const Color<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
 	*this = *this / other ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char>& Color<unsigned char>::operator=(const T& val) noexcept {
 	*this = Color<unsigned char>(static_cast<unsigned char>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator+(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char> Color<unsigned char>::operator+(const T& val) const noexcept {
 	return *this + Color<unsigned char>(static_cast<unsigned char>(val)) ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator-(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char> Color<unsigned char>::operator-(const T& val) const noexcept {
 	return *this - Color<unsigned char>(static_cast<unsigned char>(val)) ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator*(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char> Color<unsigned char>::operator*(const T& val) const noexcept {
 	return *this * Color<unsigned char>(static_cast<unsigned char>(val)) ;
 }
 
-template <typename T> Color<unsigned char> Color<unsigned char>::operator/(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char> Color<unsigned char>::operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT {
 	return *this / Color<unsigned char>(static_cast<unsigned char>(val)) ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator+=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char>& Color<unsigned char>::operator+=(const T& val) noexcept {
 	*this += Color<unsigned char>(static_cast<unsigned char>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator-=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char>& Color<unsigned char>::operator-=(const T& val) noexcept {
 	*this -= Color<unsigned char>(static_cast<unsigned char>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator*=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char>& Color<unsigned char>::operator*=(const T& val) noexcept {
 	*this *= Color<unsigned char>(static_cast<unsigned char>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<unsigned char>& Color<unsigned char>::operator/=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<unsigned char>& Color<unsigned char>::operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT {
 	*this /= Color<unsigned char>(static_cast<unsigned char>(val)) ;
 	return *this ;
 }
 
-bool Color<unsigned char>::operator==(const Color<unsigned char>& other) {
+constexpr bool Color<unsigned char>::operator==(const Color<unsigned char>& other) const noexcept {
 	return (
 		r == other.r && 
 		g == other.g && 
@@ -892,11 +1474,11 @@ bool Color<unsigned char>::operator==(const Color<unsigned char>& other) {
 	) ;
 }
 
-bool Color<unsigned char>::operator!=(const Color<unsigned char>& other) {
+constexpr bool Color<unsigned char>::operator!=(const Color<unsigned char>& other) const noexcept {
 	return !(*this == other) ;
 }
 
-Color<unsigned char>::operator Color<float>() const noexcept {
+constexpr Color<unsigned char>::operator Color<float>() const noexcept {
 	return {
 		std::clamp(static_cast<float>(r) / 255.0f, 0.0f, 1.0f), 
 		std::clamp(static_cast<float>(g) / 255.0f, 0.0f, 1.0f), 
@@ -907,41 +1489,37 @@ Color<unsigned char>::operator Color<float>() const noexcept {
 
 // Color<float> implementation
 
-Color<float>::Color() noexcept {
-	r = g = b = a = 0 ;
+constexpr Color<float>::Color() noexcept : r(0), g(0), b(0), a(0) {
 }
 
-template <typename T> Color<float>::Color(T n) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float>::Color(T n) noexcept :
+	r(std::clamp(static_cast<float>(n), 0.0f, 1.0f)),
+	g(std::clamp(static_cast<float>(n), 0.0f, 1.0f)),
+	b(std::clamp(static_cast<float>(n), 0.0f, 1.0f)),
+	a(std::clamp(static_cast<float>(n), 0.0f, 1.0f)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	r = g = b = a = static_cast<float>(std::clamp(n, 0.0f, 1.0f)) ;
 }
 
-template <typename T> Color<float>::Color(T r, T g, T b, T a) {
+template <typename T> constexpr Color<float>::Color(T r, T g, T b, T a) noexcept :
+	r(std::clamp(static_cast<float>(r), 0.0f, 1.0f)),
+	g(std::clamp(static_cast<float>(g), 0.0f, 1.0f)),
+	b(std::clamp(static_cast<float>(b), 0.0f, 1.0f)),
+	a(std::clamp(static_cast<float>(a), 0.0f, 1.0f)) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	this->r = static_cast<float>(std::clamp(r, 0.0f, 1.0f)) ;
-	this->g = static_cast<float>(std::clamp(g, 0.0f, 1.0f)) ;
-	this->b = static_cast<float>(std::clamp(b, 0.0f, 1.0f)) ;
-	this->a = static_cast<float>(std::clamp(a, 0.0f, 1.0f)) ;
 }
 
-template <typename T> Color<float>::Color(const Color<T>& other) {
+// Variant lain (Color<unsigned char>) dikonversi dengan skala yang sama seperti operator konversinya
+template <typename T> constexpr Color<float>::Color(const Color<T>& other) noexcept : Color(other.operator Color<float>()) {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	r = static_cast<float>(std::clamp(other.r, 0.0f, 1.0f)) ;
-	g = static_cast<float>(std::clamp(other.g, 0.0f, 1.0f)) ;
-	b = static_cast<float>(std::clamp(other.b, 0.0f, 1.0f)) ;
-	a = static_cast<float>(std::clamp(other.a, 0.0f, 1.0f)) ;
 }
 
-template <typename T> Color<float>& Color<float>::operator=(const Color<T>& other) {
+template <typename T> constexpr Color<float>& Color<float>::operator=(const Color<T>& other) noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	r = static_cast<float>(std::clamp(other.r, 0.0f, 1.0f)) ;
-	g = static_cast<float>(std::clamp(other.g, 0.0f, 1.0f)) ;
-	b = static_cast<float>(std::clamp(other.b, 0.0f, 1.0f)) ;
-	a = static_cast<float>(std::clamp(other.a, 0.0f, 1.0f)) ;
+	*this = other.operator Color<float>() ;
 	return *this ;
 }
 
-template <typename T> Color<float> Color<float>::operator+(const Color<T>& other) {
+template <typename T> constexpr Color<float> Color<float>::operator+(const Color<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
 	return {
 		std::clamp(r + static_cast<float>(other.r), 0.0f, 1.0f), 
@@ -951,7 +1529,7 @@ template <typename T> Color<float> Color<float>::operator+(const Color<T>& other
 	} ;
 }
 
-template <typename T> Color<float> Color<float>::operator-(const Color<T>& other) {
+template <typename T> constexpr Color<float> Color<float>::operator-(const Color<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
 	return {
 		std::clamp(r - static_cast<float>(other.r), 0.0f, 1.0f), 
@@ -961,7 +1539,7 @@ template <typename T> Color<float> Color<float>::operator-(const Color<T>& other
 	} ;
 }
 
-template <typename T> Color<float> Color<float>::operator*(const Color<T>& other) {
+template <typename T> constexpr Color<float> Color<float>::operator*(const Color<T>& other) const noexcept {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
 	return {
 		std::clamp(r * static_cast<float>(other.r), 0.0f, 1.0f), 
@@ -971,79 +1549,79 @@ template <typename T> Color<float> Color<float>::operator*(const Color<T>& other
 	} ;
 }
 
-template <typename T> Color<float> Color<float>::operator/(const Color<T>& other) {
+template <typename T> constexpr Color<float> Color<float>::operator/(const Color<T>& other) const Z_UNIT_DIVISION_NOEXCEPT {
 	static_assert(std::is_arithmetic_v<T>, "undefined Color variant!") ;
-	if(other.r == 0.0f || other.g == 0.0f || other.b == 0.0f || other.a == 0.0f) throw zero_division() ;
-		return {
-			std::clamp(r / static_cast<float>(other.r), 0.0f, 1.0f), 
-			std::clamp(g / static_cast<float>(other.g), 0.0f, 1.0f), 
-			std::clamp(b / static_cast<float>(other.b), 0.0f, 1.0f), 
-			std::clamp(a / static_cast<float>(other.a), 0.0f, 1.0f)
-		} ;
+	zero_division_check(other.r == 0 || other.g == 0 || other.b == 0 || other.a == 0) ;
+	return {
+		std::clamp(r / static_cast<float>(other.r), 0.0f, 1.0f), 
+		std::clamp(g / static_cast<float>(other.g), 0.0f, 1.0f), 
+		std::clamp(b / static_cast<float>(other.b), 0.0f, 1.0f), 
+		std::clamp(a / static_cast<float>(other.a), 0.0f, 1.0f)
+	} ;
 }
 
-template <typename T> Color<float>& Color<float>::operator+=(const Color<T>& other) {
+template <typename T> constexpr Color<float>& Color<float>::operator+=(const Color<T>& other) noexcept {
 	*this = *this + other ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator-=(const Color<T>& other) {
+template <typename T> constexpr Color<float>& Color<float>::operator-=(const Color<T>& other) noexcept {
 	*this = *this - other ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator*=(const Color<T>& other) {
+template <typename T> constexpr Color<float>& Color<float>::operator*=(const Color<T>& other) noexcept {
 	*this = *this * other ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator/=(const Color<T>& other) {
+template <typename T> constexpr Color<float>& Color<float>::operator/=(const Color<T>& other) Z_UNIT_DIVISION_NOEXCEPT {
 	*this = *this / other ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float>& Color<float>::operator=(const T& val) noexcept {
 	*this = Color<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<float> Color<float>::operator+(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float> Color<float>::operator+(const T& val) const noexcept {
 	return *this + Color<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Color<float> Color<float>::operator-(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float> Color<float>::operator-(const T& val) const noexcept {
 	return *this - Color<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Color<float> Color<float>::operator*(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float> Color<float>::operator*(const T& val) const noexcept {
 	return *this * Color<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Color<float> Color<float>::operator/(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float> Color<float>::operator/(const T& val) const Z_UNIT_DIVISION_NOEXCEPT {
 	return *this / Color<float>(static_cast<float>(val)) ;
 }
 
-template <typename T> Color<float>& Color<float>::operator+=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float>& Color<float>::operator+=(const T& val) noexcept {
 	*this += Color<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator-=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float>& Color<float>::operator-=(const T& val) noexcept {
 	*this -= Color<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator*=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float>& Color<float>::operator*=(const T& val) noexcept {
 	*this *= Color<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-template <typename T> Color<float>& Color<float>::operator/=(const T& val) {
+template <typename T, z_unit_scalar<T>> constexpr Color<float>& Color<float>::operator/=(const T& val) Z_UNIT_DIVISION_NOEXCEPT {
 	*this /= Color<float>(static_cast<float>(val)) ;
 	return *this ;
 }
 
-bool Color<float>::operator==(const Color<float>& other) {
+constexpr bool Color<float>::operator==(const Color<float>& other) const noexcept {
 	return (
 		r == other.r && 
 		g == other.g && 
@@ -1052,11 +1630,11 @@ bool Color<float>::operator==(const Color<float>& other) {
 	) ;
 }
 
-bool Color<float>::operator!=(const Color<float>& other) {
+constexpr bool Color<float>::operator!=(const Color<float>& other) const noexcept {
 	return !(*this == other) ;
 }
 
-Color<float>::operator Color<unsigned char>() const noexcept {
+constexpr Color<float>::operator Color<unsigned char>() const noexcept {
 	return {
 		static_cast<unsigned char>(std::clamp(r * 255.0f, 0.0f, 255.0f)), 
 		static_cast<unsigned char>(std::clamp(g * 255.0f, 0.0f, 255.0f)), 
@@ -1,50 +1,79 @@
 #pragma once
-#include <windows.h>
+#include "z_platform.h"
 #include <string>
 #include <stdexcept>
 #include <functional>
-#include <queue>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include "z_event.h"
 #include "z_event_util.h"
 #include "z_unit.h"
 
+#if Z_PLATFORM_WIN32
+    #include "z_window_win32.h"
+#else
+    #include "z_window_headless.h"
+#endif
+
 namespace z {
 
+namespace platform {
+#if Z_PLATFORM_WIN32
+    using NativeWindow = Win32Window;
+#else
+    using NativeWindow = HeadlessWindow;
+#endif
+}
+
+// HWND di Win32, platform::HeadlessWindow* di backend headless
+using NativeHandle = platform::NativeWindow::NativeHandle;
+
+enum class RunMode {
+    Continuous,     // Loop jalan terus (default)
+    EventDriven     // Tidur sampai ada input, deadline timer, atau invalidate()
+};
+
+// Statistik mode idle - untuk membuktikan window diam benar-benar diam
+struct IdleStats {
+    unsigned long long wakeups = 0;     // berapa kali bangun dari tidur
+    unsigned long long frames = 0;      // berapa frame yang diminta digambar
+    double wallSeconds = 0.0;           // waktu sejak stats di-reset
+    double cpuSeconds = 0.0;            // CPU time proses (user + kernel) sejak reset
+
+    double wakeupsPerSecond() const {
+        return wallSeconds > 0.0 ? static_cast<double>(wakeups) / wallSeconds : 0.0;
+    }
+
+    // Fraksi satu core yang terpakai (0.0 - 1.0)
+    double cpuUsage() const {
+        return wallSeconds > 0.0 ? cpuSeconds / wallSeconds : 0.0;
+    }
+};
+
 class Window {
 public:
     // Constructor - simple and straightforward
-    Window(const char* title, int width, int height) 
+    Window(const char* title, int width, int height)
         : m_size(width, height), m_title(title) {
-        m_hInstance = GetModuleHandle(nullptr);
-        registerWindowClass();
-        createWindow();
-        
-        // Set this pointer untuk callback
-        SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+        create();
     }
 
     // Constructor with Vec2 size
-    Window(const char* title, Vec2<int> size) 
+    Window(const char* title, Vec2<int> size)
         : m_size(size), m_title(title) {
-        m_hInstance = GetModuleHandle(nullptr);
-        registerWindowClass();
-        createWindow();
-        
-        SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+        create();
     }
 
     // Constructor with Rect (position + size)
     Window(const char* title, Rect<int> bounds) : m_size(bounds.w, bounds.h), m_position(bounds.x, bounds.y), m_title(title) {
-        m_hInstance = GetModuleHandle(nullptr);
-        registerWindowClass();
-        createWindow();
-        
-        SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+        create();
     }
 
     // Destructor
     ~Window() {
-        destroy();
+        m_native.destroy();
     }
 
     // Delete copy constructor and assignment (modern C++ best practice)
@@ -52,62 +81,75 @@ public:
     Window& operator=(const Window&) = delete;
 
     // Move constructor and assignment
-    Window(Window&& other) noexcept 
-        : m_hwnd(other.m_hwnd), m_hInstance(other.m_hInstance), 
+    Window(Window&& other) noexcept
+        : m_native(std::move(other.m_native)),
           m_size(other.m_size), m_position(other.m_position),
-          m_title(std::move(other.m_title)) {
-        other.m_hwnd = nullptr;
-        other.m_hInstance = nullptr;
-        if (m_hwnd) {
-            SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
-        }
+          m_title(std::move(other.m_title)), m_shouldClose(other.m_shouldClose),
+          m_eventQueue(std::move(other.m_eventQueue)), m_eventHead(other.m_eventHead), m_runMode(other.m_runMode),
+          m_animating(other.m_animating), m_dirty(other.m_dirty.load()),
+          m_hasDeadline(other.m_hasDeadline), m_deadline(other.m_deadline),
+          m_ownerThread(other.m_ownerThread), m_idle(other.m_idle),
+          m_idleStart(other.m_idleStart), m_idleCpuStart(other.m_idleCpuStart),
+          m_inputTicks(other.m_inputTicks), m_clientSize(other.m_clientSize) {
+        bindSink();
     }
 
     Window& operator=(Window&& other) noexcept {
         if (this != &other) {
-            destroy();
-            m_hwnd = other.m_hwnd;
-            m_hInstance = other.m_hInstance;
+            m_native.destroy();
+            m_native = std::move(other.m_native);
             m_size = other.m_size;
             m_position = other.m_position;
             m_title = std::move(other.m_title);
-            
-            other.m_hwnd = nullptr;
-            other.m_hInstance = nullptr;
-            
-            if (m_hwnd) 
-                SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+            m_shouldClose = other.m_shouldClose;
+            m_eventQueue = std::move(other.m_eventQueue);
+            m_eventHead = other.m_eventHead;
+            m_runMode = other.m_runMode;
+            m_animating = other.m_animating;
+            m_dirty = other.m_dirty.load();
+            m_hasDeadline = other.m_hasDeadline;
+            m_deadline = other.m_deadline;
+            m_ownerThread = other.m_ownerThread;
+            m_idle = other.m_idle;
+            m_idleStart = other.m_idleStart;
+            m_idleCpuStart = other.m_idleCpuStart;
+            m_inputTicks = other.m_inputTicks;
+            m_clientSize = other.m_clientSize;
+
+            bindSink();
         }
         return *this;
     }
 
     // Show window - SDL3 style
     void show() {
-        ShowWindow(m_hwnd, SW_SHOW);
-        UpdateWindow(m_hwnd);
+        m_native.show();
     }
 
     void hide() {
-        ShowWindow(m_hwnd, SW_HIDE);
+        m_native.hide();
     }
 
     void minimize() {
-        ShowWindow(m_hwnd, SW_MINIMIZE);
+        m_native.minimize();
     }
 
     void maximize() {
-        ShowWindow(m_hwnd, SW_MAXIMIZE);
+        m_native.maximize();
     }
 
     void restore() {
-        ShowWindow(m_hwnd, SW_RESTORE);
+        m_native.restore();
     }
 
-    // Get window handle
-    HWND handle() const {
-        return m_hwnd;
+    // Get window handle (HWND di Win32, HeadlessWindow* di headless)
+    NativeHandle handle() const {
+        return m_native.handle();
     }
 
+    // Akses backend, misalnya frontBuffer() di headless
+    platform::NativeWindow& native() { return m_native; }
+
     // Get window properties - legacy methods
     int width() const { return m_size.x; }
     int height() const { return m_size.y; }
@@ -115,13 +157,16 @@ public:
 
     // Get window properties - z_unit methods
     Vec2<int> size() const { return m_size; }
-    Vec2<int> position() const { return m_position; }
-    Rect<int> bounds() const { return Rect<int>(m_position.x, m_position.y, m_size.x, m_size.y); }
+    Vec2<int> position() const { return m_native.position(); }
+    Rect<int> bounds() const {
+        Vec2<int> pos = position();
+        return Rect<int>(pos.x, pos.y, m_size.x, m_size.y);
+    }
 
     // Set window properties - legacy methods
     void setTitle(const char* title) {
         m_title = title;
-        SetWindowText(m_hwnd, title);
+        m_native.setTitle(title);
     }
 
     void setSize(int width, int height) {
@@ -132,45 +177,142 @@ public:
         setPosition(Vec2<int>(x, y));
     }
 
-    // Set window properties - z_unit methods
+    // Set window properties - z_unit methods.
+    // Ukuran = area client di semua backend (Win32 menambahkan border/title bar sendiri).
     void setSize(Vec2<int> newSize) {
         m_size = newSize;
-        SetWindowPos(m_hwnd, nullptr, 0, 0, m_size.x, m_size.y, 
-                    SWP_NOMOVE | SWP_NOZORDER);
+        m_native.setSize(newSize);
     }
 
     void setPosition(Vec2<int> newPosition) {
         m_position = newPosition;
-        SetWindowPos(m_hwnd, nullptr, m_position.x, m_position.y, 0, 0, 
-                    SWP_NOSIZE | SWP_NOZORDER);
+        m_native.setPosition(newPosition);
     }
 
     void setBounds(Rect<int> newBounds) {
         m_size = Vec2<int>(newBounds.w, newBounds.h);
         m_position = Vec2<int>(newBounds.x, newBounds.y);
-        SetWindowPos(m_hwnd, nullptr, m_position.x, m_position.y, 
-                    m_size.x, m_size.y, SWP_NOZORDER);
+        m_native.setBounds(newBounds);
     }
 
     // Event handling - SDL3 style
     bool pollEvent(Event& event) {
-        if (!m_eventQueue.empty()) {
-            event = m_eventQueue.front();
-            m_eventQueue.pop();
+        if (m_eventHead < m_eventQueue.size()) {
+            event = m_eventQueue[m_eventHead++];
+            // Antrian habis: mulai dari awal lagi, kapasitas vector tetap dipakai
+            if (m_eventHead == m_eventQueue.size()) {
+                m_eventQueue.clear();
+                m_eventHead = 0;
+            }
             return true;
         }
         return false;
     }
 
-    // Process Windows messages
+    // Masukkan event sintetis ke antrian (aman dari thread mana pun).
+    // Event diproses pada processMessages()/waitFrame() berikutnya.
+    void postEvent(const Event& event) {
+        m_native.post(event);
+    }
+
+    // Process pending messages (Win32) / synthetic events (headless)
     void processMessages() {
-        MSG msg;
-        while (PeekMessage(&msg, m_hwnd, 0, 0, PM_REMOVE)) {
-            TranslateMessage(&msg);
-            DispatchMessage(&msg);
+        m_native.pump();
+    }
+
+    // ===== RUN MODE / IDLE =====
+
+    // Continuous: waitFrame() sama dengan processMessages() dan selalu minta frame.
+    // EventDriven: waitFrame() tidur sampai ada input, deadline, atau invalidate().
+    void setRunMode(RunMode mode) {
+        m_runMode = mode;
+        m_dirty = true;     // gambar sekali setelah ganti mode
+        resetIdleStats();
+    }
+
+    RunMode runMode() const { return m_runMode; }
+
+    // Minta redraw. Aman dipanggil dari thread lain (akan membangunkan waitFrame)
+    void invalidate() {
+        m_dirty = true;
+        if (std::this_thread::get_id() != m_ownerThread)
+            m_native.wake();
+    }
+
+    // Selama animasi aktif, EventDriven berperilaku seperti Continuous
+    void setAnimating(bool animating) { m_animating = animating; }
+    bool isAnimating() const { return m_animating; }
+
+    // Jadwalkan wakeup (dan redraw) setelah delay; deadline terdekat yang dipakai
+    void scheduleWakeup(float delaySeconds) {
+        auto when = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<float>(delaySeconds < 0.0f ? 0.0f : delaySeconds));
+        if (!m_hasDeadline || when < m_deadline) {
+            m_deadline = when;
+            m_hasDeadline = true;
+        }
+    }
+
+    // Proses message lalu tunggu frame berikutnya sesuai run mode.
+    // Return true kalau frame perlu digambar, false kalau window akan ditutup.
+    bool waitFrame() {
+        processMessages();
+
+        if (m_runMode == RunMode::Continuous || m_animating) {
+            m_dirty = false;
+            ++m_idle.frames;
+            return !m_shouldClose;
+        }
+
+        for (;;) {
+            if (m_shouldClose) return false;
+
+            if (m_hasDeadline && Clock::now() >= m_deadline) {
+                m_hasDeadline = false;
+                m_dirty = true;
+            }
+
+            if (m_dirty.exchange(false) || m_animating) {
+                ++m_idle.frames;
+                return true;
+            }
+
+            int timeoutMs = -1;
+            if (m_hasDeadline) {
+                // Dibulatkan ke atas supaya tidak bangun sebelum deadline lalu tidur 0 ms berulang
+                auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(m_deadline - Clock::now()).count();
+                timeoutMs = remaining > 0 ? static_cast<int>((remaining + 999) / 1000) : 0;
+            }
+
+            // Bangun kalau ada message/event baru, wake(), atau timeout deadline
+            m_native.wait(timeoutMs);
+            ++m_idle.wakeups;
+            processMessages();
         }
     }
 
+    // Statistik sejak resetIdleStats() / setRunMode()
+    IdleStats idleStats() const {
+        IdleStats stats = m_idle;
+        stats.wallSeconds = std::chrono::duration<double>(Clock::now() - m_idleStart).count();
+        stats.cpuSeconds = platform::processCpuSeconds() - m_idleCpuStart;
+        return stats;
+    }
+
+    void resetIdleStats() {
+        m_idle = IdleStats();
+        m_idleStart = Clock::now();
+        m_idleCpuStart = platform::processCpuSeconds();
+    }
+
+    // Waktu (platform::ticks) input pertama yang belum tercermin di frame, 0 kalau tidak ada.
+    // Panggil saat merekam frame; nilainya dipakai RenderThread untuk latency input-to-present.
+    int64_t takeInputTicks() {
+        int64_t ticks = m_inputTicks;
+        m_inputTicks = 0;
+        return ticks;
+    }
+
     // Check if window should close
     bool shouldClose() const {
         return m_shouldClose;
@@ -183,212 +325,115 @@ public:
 
     // Check if window is valid
     bool isValid() const {
-        return m_hwnd != nullptr && IsWindow(m_hwnd);
+        return m_native.isValid();
     }
 
     // Get client area size - legacy method
     void getClientSize(int& width, int& height) const {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        width = rect.right - rect.left;
-        height = rect.bottom - rect.top;
+        Vec2<int> client = m_native.clientSize();
+        width = client.x;
+        height = client.y;
     }
 
     // Get client area size - z_unit method
     Vec2<int> getClientSize() const {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        return Vec2<int>(rect.right - rect.left, rect.bottom - rect.top);
+        return m_native.clientSize();
     }
 
     // Get client area bounds
     Rect<int> getClientBounds() const {
-        RECT rect;
-        GetClientRect(m_hwnd, &rect);
-        return Rect<int>(0, 0, static_cast<int>(rect.right - rect.left), static_cast<int>(rect.bottom - rect.top));
+        Vec2<int> client = m_native.clientSize();
+        return Rect<int>(0, 0, client.x, client.y);
     }
 
     // Center window on screen
     void centerOnScreen() {
-        int screenWidth = GetSystemMetrics(SM_CXSCREEN);
-        int screenHeight = GetSystemMetrics(SM_CYSCREEN);
-        
-        RECT rect;
-        GetWindowRect(m_hwnd, &rect);
-        int windowWidth = rect.right - rect.left;
-        int windowHeight = rect.bottom - rect.top;
-        
+        Vec2<int> screen = platform::NativeWindow::screenSize();
+        Vec2<int> frame = m_native.frameSize();
+
         Vec2<int> centerPos(
-            (screenWidth - windowWidth) / 2,
-            (screenHeight - windowHeight) / 2
+            (screen.x - frame.x) / 2,
+            (screen.y - frame.y) / 2
         );
-        
+
         setPosition(centerPos);
     }
 
-    // Check if point is inside client area
+    // Check if point is inside client area.
+    // Memakai ukuran client yang di-cache dari event Resize, tanpa GetClientRect per panggilan.
     bool containsPoint(Vec2<int> point) const {
-        Rect<int> clientBounds = getClientBounds();
-        return point.x >= clientBounds.x && point.x < clientBounds.x + clientBounds.w && point.y >= clientBounds.y && point.y < clientBounds.y + clientBounds.h;
+        return Rect<int>(0, 0, m_clientSize.x, m_clientSize.y).contains(point);
     }
 
     // Convert screen coordinates to client coordinates
     Vec2<int> screenToClient(Vec2<int> screenPos) const {
-        POINT pt = {screenPos.x, screenPos.y};
-        ScreenToClient(m_hwnd, &pt);
-        return Vec2<int>(pt.x, pt.y);
+        return m_native.screenToClient(screenPos);
     }
 
     // Convert client coordinates to screen coordinates
     Vec2<int> clientToScreen(Vec2<int> clientPos) const {
-        POINT pt = {clientPos.x, clientPos.y};
-        ClientToScreen(m_hwnd, &pt);
-        return Vec2<int>(pt.x, pt.y);
+        return m_native.clientToScreen(clientPos);
     }
 
 private:
-    HWND m_hwnd = nullptr;
-    HINSTANCE m_hInstance = nullptr;
+    platform::NativeWindow m_native;
     Vec2<int> m_size;
     Vec2<int> m_position;
     std::string m_title;
     bool m_shouldClose = false;
-    std::queue<Event> m_eventQueue;
-
-    static constexpr const char* CLASS_NAME = "z_Window";
-
-    // Static window procedure
-    static LRESULT CALLBACK StaticWndProc(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
-        Window* window = nullptr;
-
-        if (msg == WM_NCCREATE) {
-            CREATESTRUCT* cs = reinterpret_cast<CREATESTRUCT*>(lp);
-            window = reinterpret_cast<Window*>(cs->lpCreateParams);
-            SetWindowLongPtr(hwnd, GWLP_USERDATA, (LONG_PTR)window);
-        } else {
-            window = reinterpret_cast<Window*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
-        }
-
-        if (window) {
-            return window->handleMessage(hwnd, msg, wp, lp);
-        }
-
-        return DefWindowProc(hwnd, msg, wp, lp);
-    }
-
-    // Instance window procedure
-    LRESULT handleMessage(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
-        // Convert Windows message to our Event and add to queue
-        Event event = translateWinEvent(hwnd, msg, wp, lp);
-        if (event.type != EventType::None) {
-            m_eventQueue.push(event);
-        }
-
-        // Handle special cases
-        switch (msg) {
-            case WM_CLOSE:
+    std::vector<Event> m_eventQueue;    // FIFO; vector + head supaya tidak alokasi tiap frame
+    size_t m_eventHead = 0;
+
+    using Clock = std::chrono::steady_clock;
+    RunMode m_runMode = RunMode::Continuous;
+    bool m_animating = false;
+    std::atomic<bool> m_dirty{true};
+    bool m_hasDeadline = false;
+    Clock::time_point m_deadline;
+    std::thread::id m_ownerThread = std::this_thread::get_id();
+    IdleStats m_idle;
+    Clock::time_point m_idleStart;
+    double m_idleCpuStart = 0.0;
+    int64_t m_inputTicks = 0;
+    Vec2<int> m_clientSize;     // cache untuk containsPoint, diperbarui oleh event Resize
+
+    void create() {
+        m_native.create(m_title.c_str(), m_position, m_size, [this](const Event& ev) { onNativeEvent(ev); });
+        m_clientSize = m_native.clientSize();
+        resetIdleStats();
+    }
+
+    void bindSink() {
+        m_native.setSink([this](const Event& ev) { onNativeEvent(ev); });
+    }
+
+    // Semua event dari backend masuk lewat sini.
+    // EventType::None hanya berarti "area ter-expose, gambar ulang".
+    void onNativeEvent(const Event& event) {
+        m_dirty = true;
+
+        switch (event.type) {
+            case EventType::None:
+                return;
+
+            case EventType::Quit:
                 m_shouldClose = true;
-                return 0;
-
-            case WM_DESTROY:
-                PostQuitMessage(0);
-                return 0;
-
-            case WM_SIZE:
-                m_size = Vec2<int>(LOWORD(lp), HIWORD(lp));
                 break;
 
-            case WM_MOVE:
-                m_position = Vec2<int>(LOWORD(lp), HIWORD(lp));
+            case EventType::Resize:
+                m_size = event.getResizeSize();
+                m_clientSize = m_size;
                 break;
 
-            case WM_PAINT: {
-                PAINTSTRUCT ps;
-                HDC hdc = BeginPaint(hwnd, &ps);
-                // Default: paint black background
-                RECT rect;
-                GetClientRect(hwnd, &rect);
-                FillRect(hdc, &rect, (HBRUSH)GetStockObject(BLACK_BRUSH));
-                EndPaint(hwnd, &ps);
-                return 0;
-            }
-        }
-
-        return DefWindowProc(hwnd, msg, wp, lp);
-    }
-
-    void registerWindowClass() {
-        WNDCLASSEX wc = {};
-        wc.cbSize = sizeof(WNDCLASSEX);
-        wc.style = CS_HREDRAW | CS_VREDRAW;
-        wc.lpfnWndProc = StaticWndProc;
-        wc.cbClsExtra = 0;
-        wc.cbWndExtra = 0;
-        wc.hInstance = m_hInstance;
-        wc.hIcon = LoadIcon(nullptr, IDI_APPLICATION);
-        wc.hCursor = LoadCursor(nullptr, IDC_ARROW);
-        wc.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
-        wc.lpszMenuName = nullptr;
-        wc.lpszClassName = CLASS_NAME;
-        wc.hIconSm = LoadIcon(nullptr, IDI_APPLICATION);
-
-        if (!RegisterClassEx(&wc)) {
-            DWORD error = GetLastError();
-            if (error != ERROR_CLASS_ALREADY_EXISTS) {
-                throw std::runtime_error("Failed to register window class. Error: " + std::to_string(error));
-            }
-        }
-    }
-
-    void createWindow() {
-        // Calculate window size to get desired client area
-        RECT rect = { 0, 0, m_size.x, m_size.y };
-        AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, FALSE);
-        
-        int windowWidth = rect.right - rect.left;
-        int windowHeight = rect.bottom - rect.top;
-
-        // Use position if set, otherwise use default
-        int x = (m_position.x != 0) ? m_position.x : CW_USEDEFAULT;
-        int y = (m_position.y != 0) ? m_position.y : CW_USEDEFAULT;
-
-        m_hwnd = CreateWindowEx(
-            0,                          // Extended style
-            CLASS_NAME,                 // Class name
-            m_title.c_str(),           // Window title
-            WS_OVERLAPPEDWINDOW,       // Window style
-            x,                         // X position
-            y,                         // Y position
-            windowWidth,               // Width
-            windowHeight,              // Height
-            nullptr,                   // Parent window
-            nullptr,                   // Menu
-            m_hInstance,               // Instance handle
-            this                       // Additional data
-        );
-
-        if (!m_hwnd) {
-            DWORD error = GetLastError();
-            throw std::runtime_error("Failed to create window. Error: " + std::to_string(error));
+            default:
+                break;
         }
 
-        // Update actual position after creation
-        if (x == CW_USEDEFAULT || y == CW_USEDEFAULT) {
-            RECT winRect;
-            GetWindowRect(m_hwnd, &winRect);
-            m_position = Vec2<int>(winRect.left, winRect.top);
-        }
-    }
+        if ((event.isMouseEvent() || event.isKeyEvent()) && m_inputTicks == 0)
+            m_inputTicks = platform::ticks();
 
-    void destroy() {
-        if (m_hwnd) {
-            DestroyWindow(m_hwnd);
-            m_hwnd = nullptr;
-        }
-        if (m_hInstance) {
-            UnregisterClass(CLASS_NAME, m_hInstance);
-        }
+        m_eventQueue.push_back(event);
     }
 };
 
-} // namespace z
\ No newline at end of file
+} // namespace z
@@ -0,0 +1,254 @@
+#pragma once
+#include "z_platform.h"
+
+#if Z_PLATFORM_HEADLESS
+
+#include <string>
+#include <functional>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include "z_event.h"
+#include "z_event_util.h"
+#include "z_surface.h"
+#include "z_unit.h"
+
+namespace z {
+namespace platform {
+
+// Backend headless: tidak ada layar. Client area adalah surface di memori,
+// event datang dari post() (sumber event sintetis), dan Canvas::present()
+// menyalin frame ke frontBuffer().
+class HeadlessWindow {
+public:
+    using NativeHandle = HeadlessWindow*;
+    using EventSink = std::function<void(const Event&)>;
+    using PresentHook = std::function<void()>;
+
+    // Ukuran "layar" virtual untuk centerOnScreen()
+    static constexpr int SCREEN_WIDTH = 1920;
+    static constexpr int SCREEN_HEIGHT = 1080;
+
+    HeadlessWindow() = default;
+
+    HeadlessWindow(const HeadlessWindow&) = delete;
+    HeadlessWindow& operator=(const HeadlessWindow&) = delete;
+
+    // Dipakai oleh move z::Window; Canvas yang memegang handle lama harus dibuat ulang
+    HeadlessWindow(HeadlessWindow&& other) noexcept {
+        moveFrom(other);
+    }
+
+    HeadlessWindow& operator=(HeadlessWindow&& other) noexcept {
+        if (this != &other)
+            moveFrom(other);
+        return *this;
+    }
+
+    void create(const char* title, Vec2<int> position, Vec2<int> clientSize, EventSink sink) {
+        m_sink = std::move(sink);
+        m_title = title;
+        m_position = position;
+        m_created = true;
+        applySize(clientSize);
+    }
+
+    void setSink(EventSink sink) {
+        m_sink = std::move(sink);
+    }
+
+    void destroy() {
+        if (m_created) {
+            m_created = false;
+            Event quit;
+            quit.type = EventType::Quit;
+            dispatch(quit);
+        }
+    }
+
+    NativeHandle handle() const { return const_cast<HeadlessWindow*>(this); }
+
+    bool isValid() const { return m_created; }
+
+    void show()     { m_visible = true; }
+    void hide()     { m_visible = false; }
+    void minimize() { m_visible = true; }
+    void maximize() { m_visible = true; applySize(Vec2<int>(SCREEN_WIDTH, SCREEN_HEIGHT)); }
+    void restore()  { m_visible = true; }
+
+    bool isVisible() const { return m_visible; }
+
+    void setTitle(const char* title) { m_title = title; }
+    const std::string& title() const { return m_title; }
+
+    // Tidak ada border: size = ukuran client, sama artinya dengan setSize Win32
+    void setSize(Vec2<int> size) { applySize(size); }
+    void setPosition(Vec2<int> position) { m_position = position; }
+
+    void setBounds(Rect<int> bounds) {
+        m_position = Vec2<int>(bounds.x, bounds.y);
+        applySize(Vec2<int>(bounds.w, bounds.h));
+    }
+
+    Vec2<int> position() const { return m_position; }
+    // clientSize/present/frontBuffer aman dipanggil dari render thread
+    Vec2<int> clientSize() const {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        return m_clientSize;
+    }
+
+    Vec2<int> frameSize() const { return clientSize(); }
+
+    static Vec2<int> screenSize() {
+        return Vec2<int>(SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    Vec2<int> screenToClient(Vec2<int> screenPos) const {
+        return Vec2<int>(screenPos.x - m_position.x, screenPos.y - m_position.y);
+    }
+
+    Vec2<int> clientToScreen(Vec2<int> clientPos) const {
+        return Vec2<int>(clientPos.x + m_position.x, clientPos.y + m_position.y);
+    }
+
+    // Kirim event sintetis yang tertunda ke sink
+    void pump() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_dispatching.swap(m_pending);
+        }
+        for (const Event& ev : m_dispatching) {
+            // Resize sintetis benar-benar mengubah ukuran client area
+            if (ev.type == EventType::Resize) {
+                std::lock_guard<std::mutex> lock(m_frameMutex);
+                m_clientSize = ev.getResizeSize();
+            }
+            dispatch(ev);
+        }
+        m_dispatching.clear();
+    }
+
+    // Tidur sampai ada event sintetis, wake(), atau timeout (ms, -1 = selamanya)
+    void wait(int timeoutMs) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto ready = [this] { return !m_pending.empty() || m_woken; };
+        if (timeoutMs < 0)
+            m_cv.wait(lock, ready);
+        else
+            m_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), ready);
+        m_woken = false;
+    }
+
+    // Aman dipanggil dari thread mana pun
+    void wake() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_woken = true;
+        }
+        m_cv.notify_one();
+    }
+
+    // Sumber event sintetis (aman dari thread mana pun)
+    void post(const Event& event) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.push_back(event);
+        }
+        m_cv.notify_one();
+    }
+
+    // ===== PRESENT =====
+
+    // Dipanggil Canvas::present(); frame disalin ke memori window
+    void present(const Surface& frame) {
+        PresentHook hook;
+        {
+            std::lock_guard<std::mutex> lock(m_frameMutex);
+            hook = m_presentHook;
+        }
+        if (hook) hook();
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        int width = std::min(frame.width, m_clientSize.x);
+        int height = std::min(frame.height, m_clientSize.y);
+        m_front.resize(static_cast<size_t>(m_clientSize.x) * m_clientSize.y);
+        for (int y = 0; y < height; y++)
+            std::copy(frame.row(y), frame.row(y) + width, m_front.data() + static_cast<size_t>(y) * m_clientSize.x);
+        m_frontSize = m_clientSize;
+        m_presentCount++;
+    }
+
+    // Frame terakhir yang di-present (kosong sebelum present pertama).
+    // Kalau present dari render thread, baca setelah RenderThread::flush().
+    Surface frontBuffer() {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        return Surface(m_front.data(), m_frontSize.x, m_frontSize.y, m_frontSize.x);
+    }
+
+    unsigned long long presentCount() const {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        return m_presentCount;
+    }
+
+    // Dipanggil di awal setiap present(), di thread yang mem-present, tanpa lock.
+    // Untuk test: hook yang menunggu latch menahan render thread di tengah frame.
+    void setPresentHook(PresentHook hook) {
+        std::lock_guard<std::mutex> lock(m_frameMutex);
+        m_presentHook = std::move(hook);
+    }
+
+private:
+    EventSink m_sink;
+    std::string m_title;
+    Vec2<int> m_position;
+    Vec2<int> m_clientSize;
+    bool m_created = false;
+    bool m_visible = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<Event> m_pending;
+    std::vector<Event> m_dispatching;   // buffer pump(), ditukar dengan m_pending supaya kapasitas dipakai ulang
+    bool m_woken = false;
+
+    mutable std::mutex m_frameMutex;    // client size + front buffer
+    std::vector<Pixel> m_front;
+    Vec2<int> m_frontSize;
+    unsigned long long m_presentCount = 0;
+    PresentHook m_presentHook;
+
+    void dispatch(const Event& event) {
+        if (m_sink)
+            m_sink(event);
+    }
+
+    // Sama seperti WM_SIZE: ubah ukuran lalu kirim event Resize
+    void applySize(Vec2<int> size) {
+        Vec2<int> clamped(std::max(size.x, 0), std::max(size.y, 0));
+        {
+            std::lock_guard<std::mutex> lock(m_frameMutex);
+            m_clientSize = clamped;
+        }
+        dispatch(createResizeEvent(clamped));
+    }
+
+    void moveFrom(HeadlessWindow& other) {
+        m_sink = std::move(other.m_sink);
+        m_title = std::move(other.m_title);
+        m_position = other.m_position;
+        m_clientSize = other.m_clientSize;
+        m_created = other.m_created;
+        m_visible = other.m_visible;
+        m_pending = std::move(other.m_pending);
+        m_front = std::move(other.m_front);
+        m_frontSize = other.m_frontSize;
+        m_presentCount = other.m_presentCount;
+        m_presentHook = std::move(other.m_presentHook);
+        other.m_created = false;
+    }
+};
+
+} // namespace platform
+} // namespace z
+
+#endif // Z_PLATFORM_HEADLESS
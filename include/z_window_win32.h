@@ -0,0 +1,347 @@
+#pragma once
+#include "z_platform.h"
+
+#if Z_PLATFORM_WIN32
+
+#include <string>
+#include <stdexcept>
+#include <functional>
+#include <vector>
+#include <mutex>
+#include "z_event.h"
+#include "z_event_util.h"
+#include "z_unit.h"
+
+namespace z {
+namespace platform {
+
+// Backend Win32: HWND + window procedure. Semua message diterjemahkan
+// ke Event lalu dikirim ke sink (z::Window).
+class Win32Window {
+public:
+    using NativeHandle = HWND;
+    using EventSink = std::function<void(const Event&)>;
+
+    Win32Window() = default;
+
+    ~Win32Window() {
+        destroy();
+    }
+
+    Win32Window(const Win32Window&) = delete;
+    Win32Window& operator=(const Win32Window&) = delete;
+
+    Win32Window(Win32Window&& other) noexcept
+        : m_hwnd(other.m_hwnd), m_hInstance(other.m_hInstance),
+          m_position(other.m_position), m_sink(std::move(other.m_sink)),
+          m_pending(std::move(other.m_pending)) {
+        other.m_hwnd = nullptr;
+        other.m_hInstance = nullptr;
+        if (m_hwnd)
+            SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+    }
+
+    Win32Window& operator=(Win32Window&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            m_hwnd = other.m_hwnd;
+            m_hInstance = other.m_hInstance;
+            m_position = other.m_position;
+            m_sink = std::move(other.m_sink);
+            m_pending = std::move(other.m_pending);
+
+            other.m_hwnd = nullptr;
+            other.m_hInstance = nullptr;
+
+            if (m_hwnd)
+                SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+        }
+        return *this;
+    }
+
+    // Position (0, 0) berarti pakai posisi default dari sistem
+    void create(const char* title, Vec2<int> position, Vec2<int> clientSize, EventSink sink) {
+        m_sink = std::move(sink);
+        m_position = position;
+        m_hInstance = GetModuleHandle(nullptr);
+        registerWindowClass();
+        createWindow(title, clientSize);
+
+        // Set this pointer untuk callback
+        SetWindowLongPtr(m_hwnd, GWLP_USERDATA, (LONG_PTR)this);
+    }
+
+    void setSink(EventSink sink) {
+        m_sink = std::move(sink);
+    }
+
+    void destroy() {
+        if (m_hwnd) {
+            DestroyWindow(m_hwnd);
+            m_hwnd = nullptr;
+        }
+        if (m_hInstance) {
+            UnregisterClass(CLASS_NAME, m_hInstance);
+            m_hInstance = nullptr;
+        }
+    }
+
+    NativeHandle handle() const { return m_hwnd; }
+
+    bool isValid() const {
+        return m_hwnd != nullptr && IsWindow(m_hwnd);
+    }
+
+    void show()     { ShowWindow(m_hwnd, SW_SHOW); UpdateWindow(m_hwnd); }
+    void hide()     { ShowWindow(m_hwnd, SW_HIDE); }
+    void minimize() { ShowWindow(m_hwnd, SW_MINIMIZE); }
+    void maximize() { ShowWindow(m_hwnd, SW_MAXIMIZE); }
+    void restore()  { ShowWindow(m_hwnd, SW_RESTORE); }
+
+    void setTitle(const char* title) {
+        SetWindowText(m_hwnd, title);
+    }
+
+    // size = ukuran client (sama dengan backend headless), dikonversi ke ukuran frame
+    void setSize(Vec2<int> size) {
+        Vec2<int> frame = frameFor(size);
+        SetWindowPos(m_hwnd, nullptr, 0, 0, frame.x, frame.y, SWP_NOMOVE | SWP_NOZORDER);
+    }
+
+    void setPosition(Vec2<int> position) {
+        m_position = position;
+        SetWindowPos(m_hwnd, nullptr, position.x, position.y, 0, 0, SWP_NOSIZE | SWP_NOZORDER);
+    }
+
+    // Posisi = pojok frame, ukuran = client (seperti setSize)
+    void setBounds(Rect<int> bounds) {
+        m_position = Vec2<int>(bounds.x, bounds.y);
+        Vec2<int> frame = frameFor(Vec2<int>(bounds.w, bounds.h));
+        SetWindowPos(m_hwnd, nullptr, bounds.x, bounds.y, frame.x, frame.y, SWP_NOZORDER);
+    }
+
+    Vec2<int> position() const { return m_position; }
+
+    Vec2<int> clientSize() const {
+        RECT rect;
+        GetClientRect(m_hwnd, &rect);
+        return Vec2<int>(rect.right - rect.left, rect.bottom - rect.top);
+    }
+
+    // Ukuran luar window (termasuk border dan title bar)
+    Vec2<int> frameSize() const {
+        RECT rect;
+        GetWindowRect(m_hwnd, &rect);
+        return Vec2<int>(rect.right - rect.left, rect.bottom - rect.top);
+    }
+
+    static Vec2<int> screenSize() {
+        return Vec2<int>(GetSystemMetrics(SM_CXSCREEN), GetSystemMetrics(SM_CYSCREEN));
+    }
+
+    Vec2<int> screenToClient(Vec2<int> screenPos) const {
+        POINT pt = {screenPos.x, screenPos.y};
+        ScreenToClient(m_hwnd, &pt);
+        return Vec2<int>(pt.x, pt.y);
+    }
+
+    Vec2<int> clientToScreen(Vec2<int> clientPos) const {
+        POINT pt = {clientPos.x, clientPos.y};
+        ClientToScreen(m_hwnd, &pt);
+        return Vec2<int>(pt.x, pt.y);
+    }
+
+    // Proses semua message yang tertunda, lalu event sintetis
+    void pump() {
+        MSG msg;
+        while (PeekMessage(&msg, m_hwnd, 0, 0, PM_REMOVE)) {
+            TranslateMessage(&msg);
+            DispatchMessage(&msg);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            m_dispatching.swap(m_pending);
+        }
+        for (const Event& ev : m_dispatching)
+            dispatch(ev);
+        m_dispatching.clear();
+    }
+
+    // Tidur sampai ada message baru, event sintetis, wake(), atau timeout (ms, -1 = selamanya)
+    void wait(int timeoutMs) {
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            if (!m_pending.empty()) return;
+        }
+        // MWMO_INPUTAVAILABLE: bangun juga untuk input yang sudah ada di antrian tapi sudah
+        // "dilihat" (mis. oleh PeekMessage di modal loop), bukan hanya input yang baru masuk
+        MsgWaitForMultipleObjectsEx(0, nullptr, timeoutMs < 0 ? INFINITE : static_cast<DWORD>(timeoutMs), QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+    }
+
+    // Aman dipanggil dari thread mana pun
+    void wake() {
+        if (m_hwnd)
+            PostMessage(m_hwnd, WM_NULL, 0, 0);
+    }
+
+    // Masukkan event sintetis (aman dari thread mana pun)
+    void post(const Event& event) {
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            m_pending.push_back(event);
+        }
+        wake();
+    }
+
+private:
+    HWND m_hwnd = nullptr;
+    HINSTANCE m_hInstance = nullptr;
+    Vec2<int> m_position;
+    EventSink m_sink;
+    std::mutex m_pendingMutex;
+    std::vector<Event> m_pending;
+    std::vector<Event> m_dispatching;   // buffer pump(), ditukar dengan m_pending supaya kapasitas dipakai ulang
+
+    static constexpr const char* CLASS_NAME = "z_Window";
+
+    void dispatch(const Event& event) {
+        if (m_sink)
+            m_sink(event);
+    }
+
+    // Static window procedure
+    static LRESULT CALLBACK StaticWndProc(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
+        Win32Window* window = nullptr;
+
+        if (msg == WM_NCCREATE) {
+            CREATESTRUCT* cs = reinterpret_cast<CREATESTRUCT*>(lp);
+            window = reinterpret_cast<Win32Window*>(cs->lpCreateParams);
+            SetWindowLongPtr(hwnd, GWLP_USERDATA, (LONG_PTR)window);
+        } else {
+            window = reinterpret_cast<Win32Window*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+        }
+
+        if (window) {
+            return window->handleMessage(hwnd, msg, wp, lp);
+        }
+
+        return DefWindowProc(hwnd, msg, wp, lp);
+    }
+
+    // Instance window procedure
+    LRESULT handleMessage(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
+        // Convert Windows message to our Event and send it to the sink
+        Event event = translateWinEvent(hwnd, msg, wp, lp);
+        if (event.type != EventType::None) {
+            dispatch(event);
+        }
+
+        // Handle special cases
+        switch (msg) {
+            case WM_CLOSE:
+                return 0;
+
+            case WM_DESTROY:
+                PostQuitMessage(0);
+                return 0;
+
+            case WM_MOVE:
+                m_position = Vec2<int>(LOWORD(lp), HIWORD(lp));
+                break;
+
+            case WM_PAINT: {
+                // Area ter-expose: beri tahu sink supaya frame berikutnya digambar
+                Event expose;
+                dispatch(expose);
+
+                PAINTSTRUCT ps;
+                HDC hdc = BeginPaint(hwnd, &ps);
+                // Default: paint black background
+                RECT rect;
+                GetClientRect(hwnd, &rect);
+                FillRect(hdc, &rect, (HBRUSH)GetStockObject(BLACK_BRUSH));
+                EndPaint(hwnd, &ps);
+                return 0;
+            }
+        }
+
+        return DefWindowProc(hwnd, msg, wp, lp);
+    }
+
+    void registerWindowClass() {
+        WNDCLASSEX wc = {};
+        wc.cbSize = sizeof(WNDCLASSEX);
+        wc.style = CS_HREDRAW | CS_VREDRAW;
+        wc.lpfnWndProc = StaticWndProc;
+        wc.cbClsExtra = 0;
+        wc.cbWndExtra = 0;
+        wc.hInstance = m_hInstance;
+        wc.hIcon = LoadIcon(nullptr, IDI_APPLICATION);
+        wc.hCursor = LoadCursor(nullptr, IDC_ARROW);
+        wc.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
+        wc.lpszMenuName = nullptr;
+        wc.lpszClassName = CLASS_NAME;
+        wc.hIconSm = LoadIcon(nullptr, IDI_APPLICATION);
+
+        if (!RegisterClassEx(&wc)) {
+            DWORD error = GetLastError();
+            if (error != ERROR_CLASS_ALREADY_EXISTS) {
+                throw std::runtime_error("Failed to register window class. Error: " + std::to_string(error));
+            }
+        }
+    }
+
+    // Ukuran frame untuk ukuran client tertentu dengan style window sekarang
+    Vec2<int> frameFor(Vec2<int> client) const {
+        RECT rect = { 0, 0, client.x, client.y };
+        AdjustWindowRectEx(&rect, static_cast<DWORD>(GetWindowLongPtr(m_hwnd, GWL_STYLE)), GetMenu(m_hwnd) != nullptr,
+                           static_cast<DWORD>(GetWindowLongPtr(m_hwnd, GWL_EXSTYLE)));
+        return Vec2<int>(rect.right - rect.left, rect.bottom - rect.top);
+    }
+
+    void createWindow(const char* title, Vec2<int> clientSize) {
+        // Calculate window size to get desired client area
+        RECT rect = { 0, 0, clientSize.x, clientSize.y };
+        AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, FALSE);
+
+        int windowWidth = rect.right - rect.left;
+        int windowHeight = rect.bottom - rect.top;
+
+        // Use position if set, otherwise use default
+        int x = (m_position.x != 0) ? m_position.x : CW_USEDEFAULT;
+        int y = (m_position.y != 0) ? m_position.y : CW_USEDEFAULT;
+
+        m_hwnd = CreateWindowEx(
+            0,                          // Extended style
+            CLASS_NAME,                 // Class name
+            title,                      // Window title
+            WS_OVERLAPPEDWINDOW,       // Window style
+            x,                         // X position
+            y,                         // Y position
+            windowWidth,               // Width
+            windowHeight,              // Height
+            nullptr,                   // Parent window
+            nullptr,                   // Menu
+            m_hInstance,               // Instance handle
+            this                       // Additional data
+        );
+
+        if (!m_hwnd) {
+            DWORD error = GetLastError();
+            throw std::runtime_error("Failed to create window. Error: " + std::to_string(error));
+        }
+
+        // Update actual position after creation
+        if (x == CW_USEDEFAULT || y == CW_USEDEFAULT) {
+            RECT winRect;
+            GetWindowRect(m_hwnd, &winRect);
+            m_position = Vec2<int>(winRect.left, winRect.top);
+        }
+    }
+};
+
+} // namespace platform
+} // namespace z
+
+#endif // Z_PLATFORM_WIN32
@@ -0,0 +1,160 @@
+// Build sekali per mode pembagian untuk membandingkan:
+//   g++ -std=c++17 -O2 test/10_unit_test.cpp                                              (throw, default)
+//   g++ -std=c++17 -O2 -DZ_UNIT_DIVISION=Z_UNIT_DIVISION_ASSERT test/10_unit_test.cpp     (assert)
+//   g++ -std=c++17 -O2 -DZ_UNIT_DIVISION=Z_UNIT_DIVISION_ASSERT -DNDEBUG test/10_unit_test.cpp
+//   g++ -std=c++17 -O2 -DZ_UNIT_DIVISION=Z_UNIT_DIVISION_UNCHECKED test/10_unit_test.cpp  (unchecked)
+#include <cstdio>
+#include <vector>
+#include "../include/z_unit.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+// ===== Compile time =====
+
+constexpr Vec2<int> vi = Vec2<int>(10, 20) + Vec2<int>(2, 4) * 3;
+static_assert(vi.x == 16 && vi.y == 32, "Vec2<int> constexpr + *");
+static_assert(Vec2<int>(9, 12) / Vec2<int>(3, 4) == Vec2<int>(3, 3), "Vec2<int> constexpr /");
+static_assert(Vec2<float>(1.0f, 3.0f) / 2.0f == Vec2<float>(0.5f, 1.5f), "Vec2<float> constexpr /");
+static_assert(Vec2<int>(Vec2<float>(2.9f, -2.9f)) == Vec2<int>(2, -2), "Vec2 float -> int truncate");
+
+constexpr Vec2<int> compound() {
+    Vec2<int> v(100, 50);
+    v += Vec2<int>(1, 1);
+    v *= 2;
+    v /= Vec2<int>(2, 3);
+    v -= 1;
+    return v;
+}
+static_assert(compound() == Vec2<int>(100, 33), "Vec2 compound assignment constexpr");
+
+static_assert(Rect<int>(0, 0, 100, 50) / 2 == Rect<int>(0, 0, 50, 25), "Rect<int> constexpr /");
+static_assert((Rect<float>(1.0f, 2.0f, 3.0f, 4.0f) + Rect<int>(1)) == Rect<float>(2.0f, 3.0f, 4.0f, 5.0f), "Rect mixed +");
+static_assert(Rect<int>(Rect<float>(1.5f, 2.5f, 3.5f, 4.5f)) != Rect<int>(0), "Rect float -> int");
+
+static_assert((Color<unsigned char>(200, 100, 50, 255) + Color<unsigned char>(100, 100, 100, 100)) == Color<unsigned char>(255, 200, 150, 255), "Color saturating +");
+static_assert((Color<unsigned char>(10, 100, 50, 0) - Color<unsigned char>(20, 20, 20, 20)) == Color<unsigned char>(0, 80, 30, 0), "Color saturating -");
+static_assert(Color<unsigned char>(200, 100, 50, 255) / Color<unsigned char>(2, 2, 2, 5) == Color<unsigned char>(100, 50, 25, 51), "Color constexpr /");
+static_assert(Color<unsigned char>(Color<float>(1.0f, 0.0f, 2.0f, 0.5f)) == Color<unsigned char>(255, 0, 255, 127), "Color float -> uchar");
+static_assert(Color<float>(Color<unsigned char>(255, 0, 0, 255)).r == 1.0f, "Color uchar -> float");
+
+// noexcept: semua operator kecuali pembagian di mode throw
+static_assert(noexcept(Vec2<float>(1.0f) + Vec2<float>(2.0f)), "Vec2 + noexcept");
+static_assert(noexcept(Rect<int>(1) * 2), "Rect * noexcept");
+static_assert(noexcept(Color<unsigned char>(1) - Color<unsigned char>(2)), "Color - noexcept");
+static_assert(noexcept(Vec2<int>(1) == Vec2<int>(2)), "== noexcept");
+static_assert(noexcept(Vec2<float>(1.0f) / 2.0f) == (Z_UNIT_DIVISION != Z_UNIT_DIVISION_THROW), "operator/ noexcept mengikuti mode");
+static_assert(std::is_base_of_v<std::exception, zero_division>, "zero_division turunan std::exception");
+static_assert(std::is_trivially_copyable_v<Vec2<float>> && std::is_trivially_copyable_v<Rect<int>> && std::is_trivially_copyable_v<Color<unsigned char>>, "unit trivially copyable");
+
+// ===== Runtime =====
+
+static const char* modeName() {
+#if Z_UNIT_DIVISION == Z_UNIT_DIVISION_THROW
+    return "throw";
+#elif Z_UNIT_DIVISION == Z_UNIT_DIVISION_ASSERT
+    #ifdef NDEBUG
+    return "assert (NDEBUG)";
+    #else
+    return "assert";
+    #endif
+#else
+    return "unchecked";
+#endif
+}
+
+struct RawVec2 {
+    float x, y;
+};
+
+int main() {
+    printf("z_unit, mode pembagian: %s\n", modeName());
+
+    // Operator const: bisa dipakai langsung pada objek const
+    const Vec2<float> a(3.0f, 4.0f);
+    const Vec2<float> b = a * 2.0f - Vec2<float>(1.0f);
+    check(b == Vec2<float>(5.0f, 7.0f), "operator pada objek const");
+
+#if Z_UNIT_DIVISION == Z_UNIT_DIVISION_THROW
+    bool caught = false;
+    try {
+        Vec2<int> v(4, 4);
+        v = v / Vec2<float>(0.5f, 1.0f);    // 0.5 -> 0 setelah konversi ke int
+    } catch (const std::exception& e) {
+        caught = dynamic_cast<const zero_division*>(&e) != nullptr;
+    }
+    check(caught, "pembagi nol (setelah konversi) throw zero_division sebagai std::exception");
+
+    caught = false;
+    try {
+        Rect<int> r(10);
+        r = r / Rect<int>(1, 1, 1, 0);        // komponen h juga dicek
+    } catch (const zero_division&) {
+        caught = true;
+    }
+    check(caught, "Rect memeriksa w dan h");
+#endif
+
+    // ===== Benchmark: loop yang didominasi pembagian =====
+    const size_t count = 1 << 16;
+    const int repeat = 200;
+    std::vector<Vec2<float>> pos(count), out(count);
+    std::vector<Vec2<float>> div(count);
+    std::vector<Vec2<int>> ipos(count), iout(count), idiv(count);
+    std::vector<RawVec2> rawPos(count), rawDiv(count), rawOut(count);
+    for (size_t i = 0; i < count; i++) {
+        float f = static_cast<float>(i);
+        pos[i] = Vec2<float>(f * 0.5f + 1.0f, f * 0.25f - 3.0f);
+        div[i] = Vec2<float>(1.0f + (i % 7), 2.0f + (i % 5));
+        ipos[i] = Vec2<int>(static_cast<int>(i) * 3 + 7, 100000 - static_cast<int>(i));
+        idiv[i] = Vec2<int>(1 + static_cast<int>(i % 13), 1 + static_cast<int>(i % 11));
+        rawPos[i] = RawVec2{pos[i].x, pos[i].y};
+        rawDiv[i] = RawVec2{div[i].x, div[i].y};
+    }
+
+    z::Timer timer(z::TimerMode::Precise);
+    auto nsPer = [&](double seconds) { return seconds * 1e9 / (static_cast<double>(count) * repeat); };
+
+    // Baseline: struct polos tanpa pengecekan apa pun
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            rawOut[i] = RawVec2{rawPos[i].x / rawDiv[i].x, rawPos[i].y / rawDiv[i].y};
+    timer.tick();
+    double rawNs = nsPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            out[i] = pos[i] / div[i];
+    timer.tick();
+    double floatNs = nsPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            out[i] = pos[i] / 3.0f;
+    timer.tick();
+    double scalarNs = nsPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            iout[i] = ipos[i] / idiv[i];
+    timer.tick();
+    double intNs = nsPer(timer.deltaTime());
+
+    bool same = true;
+    for (size_t i = 0; i < count; i++) {
+        Vec2<float> expected = pos[i] / 3.0f;
+        if (out[i] != expected || iout[i] != Vec2<int>(ipos[i].x / idiv[i].x, ipos[i].y / idiv[i].y) || rawOut[i].x != pos[i].x / div[i].x)
+            same = false;
+    }
+    check(same, "hasil benchmark benar");
+
+    printf("  struct polos   Vec2<float> / Vec2<float> : %6.3f ns/op\n", rawNs);
+    printf("  %-14s Vec2<float> / Vec2<float> : %6.3f ns/op\n", modeName(), floatNs);
+    printf("  %-14s Vec2<float> / float       : %6.3f ns/op\n", modeName(), scalarNs);
+    printf("  %-14s Vec2<int>   / Vec2<int>   : %6.3f ns/op\n", modeName(), intNs);
+
+    return finishChecks();
+}
@@ -0,0 +1,168 @@
+#include <cstdio>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_color.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::PackedColor;
+
+// Compile time: operasi SWAR bisa dievaluasi constexpr
+static_assert((PackedColor(200, 100, 50, 255) + PackedColor(100, 100, 100, 10)) == PackedColor(255, 200, 150, 255), "add saturating");
+static_assert((PackedColor(10, 100, 50, 0) - PackedColor(20, 20, 20, 20)) == PackedColor(0, 80, 30, 0), "sub saturating");
+static_assert((PackedColor(255, 128, 0, 255) * PackedColor(255, 255, 255, 128)) == PackedColor(255, 128, 0, 128), "multiply");
+static_assert(PackedColor(0, 0, 0, 0).lerp256(PackedColor(255, 255, 255, 255), 256) == PackedColor(255, 255, 255, 255), "lerp t=1 tepat");
+static_assert(PackedColor(12, 34, 56, 78).colorRef() == RGB(12, 34, 56), "colorRef");
+static_assert(PackedColor::fromColorRef(RGB(12, 34, 56)) == PackedColor(12, 34, 56), "fromColorRef");
+
+static uint8_t rnd8() {
+    return static_cast<uint8_t>(rnd() >> 24);
+}
+
+// Referensi per channel, ditulis terpisah dari implementasi
+static int sat(int v) { return v < 0 ? 0 : v > 255 ? 255 : v; }
+static int mul255(int a, int b) { return (a * b + 127) / 255; }
+
+static PackedColor channelwise(PackedColor a, PackedColor b, int op, unsigned t = 0) {
+    int ca[4] = { a.r(), a.g(), a.b(), a.a() };
+    int cb[4] = { b.r(), b.g(), b.b(), b.a() };
+    int c[4];
+    for (int k = 0; k < 4; k++) {
+        if (op == 0) c[k] = sat(ca[k] + cb[k]);
+        else if (op == 1) c[k] = sat(ca[k] - cb[k]);
+        else if (op == 2) c[k] = mul255(ca[k], cb[k]);
+        else c[k] = (ca[k] * static_cast<int>(256 - t) + cb[k] * static_cast<int>(t)) >> 8;
+    }
+    return PackedColor(static_cast<uint8_t>(c[0]), static_cast<uint8_t>(c[1]), static_cast<uint8_t>(c[2]), static_cast<uint8_t>(c[3]));
+}
+
+int main() {
+    seedRandom(2024);
+    // ===== Kebenaran =====
+    printf("PackedColor\n");
+    {
+        // Multiply harus tepat untuk semua pasangan 0..255
+        bool mulExact = true;
+        for (int a = 0; a < 256 && mulExact; a++)
+            for (int b = 0; b < 256; b++) {
+                PackedColor p = PackedColor::fromPixel(0x01010101u * a) * PackedColor::fromPixel(0x01010101u * b);
+                if (p.r() != mul255(a, b)) { mulExact = false; break; }
+            }
+        check(mulExact, "multiply = round(a * b / 255) untuk semua 256 x 256");
+
+        const size_t n = 4099;      // bukan kelipatan 4: ekor skalar ikut teruji
+        std::vector<PackedColor> a(n), b(n), out(n);
+        for (size_t i = 0; i < n; i++) {
+            a[i] = PackedColor(rnd8(), rnd8(), rnd8(), rnd8());
+            b[i] = PackedColor(rnd8(), rnd8(), rnd8(), rnd8());
+        }
+
+        const char* names[4] = { "add", "sub", "multiply", "lerp" };
+        for (int op = 0; op < 4; op++) {
+            bool swarOk = true, arrayOk = true;
+            const float t = 0.3f;
+            unsigned w = PackedColor::lerpWeight(t);
+            if (op == 0) z::addColors(a.data(), b.data(), out.data(), n);
+            else if (op == 1) z::subColors(a.data(), b.data(), out.data(), n);
+            else if (op == 2) z::multiplyColors(a.data(), b.data(), out.data(), n);
+            else z::lerpColors(a.data(), b.data(), t, out.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                PackedColor ref = channelwise(a[i], b[i], op, w);
+                PackedColor swar = op == 0 ? a[i] + b[i] : op == 1 ? a[i] - b[i] : op == 2 ? a[i] * b[i] : a[i].lerp(b[i], t);
+                if (swar != ref) swarOk = false;
+                if (out[i] != ref) arrayOk = false;
+            }
+            char label[64];
+            snprintf(label, sizeof(label), "%s: SWAR dan array = referensi per channel", names[op]);
+            check(swarOk && arrayOk, label);
+        }
+
+        // Color<unsigned char> <-> PackedColor
+        std::vector<Color<unsigned char>> colors(n), back(n);
+        for (size_t i = 0; i < n; i++)
+            colors[i] = Color<unsigned char>(rnd8(), rnd8(), rnd8(), rnd8());
+        z::packColors(colors.data(), out.data(), n);
+        bool packOk = true;
+        for (size_t i = 0; i < n; i++) {
+            const Color<unsigned char>& c = colors[i];
+            if (out[i] != PackedColor(c) || out[i].r() != c.r || out[i].a() != c.a) packOk = false;
+        }
+        z::unpackColors(out.data(), back.data(), n);
+        for (size_t i = 0; i < n; i++)
+            if (back[i] != colors[i]) packOk = false;
+        Color<unsigned char> converted = out[5];
+        Color<unsigned char> direct(out[5]);
+        check(packOk && converted == colors[5] && direct == colors[5], "pack/unpack dan konversi implisit bolak-balik");
+    }
+
+    // Canvas: overload PackedColor menghasilkan pixel yang sama dengan Color<unsigned char>
+    {
+        z::Window window("Color Test", 64, 64);
+        z::Canvas canvas(window.handle());
+        Color<unsigned char> c(30, 140, 250, 255);
+        canvas.clear(PackedColor(c));
+        canvas.drawPixel(Vec2<int>(3, 3), c);
+        canvas.drawPixel(Vec2<int>(4, 3), PackedColor(c));
+        z::Surface s = canvas.surface();
+        check(s.at(0, 0) == PackedColor(c).pixel() && s.at(3, 3) == s.at(4, 3), "Canvas menerima PackedColor langsung");
+    }
+
+    // ===== Benchmark: lerp 1M warna =====
+    const size_t count = 1 << 20;
+    const int repeat = 20;
+    const float t = 0.35f;
+    std::vector<Color<unsigned char>> ca(count), cb(count), cout(count);
+    std::vector<PackedColor> pa(count), pb(count), pout(count);
+    for (size_t i = 0; i < count; i++) {
+        ca[i] = Color<unsigned char>(rnd8(), rnd8(), rnd8(), rnd8());
+        cb[i] = Color<unsigned char>(rnd8(), rnd8(), rnd8(), rnd8());
+    }
+    z::packColors(ca.data(), pa.data(), count);
+    z::packColors(cb.data(), pb.data(), count);
+
+    z::Timer timer(z::TimerMode::Precise);
+    auto msPer = [&](double seconds) { return seconds * 1000.0 / repeat; };
+
+    // Operator Color yang ada: lewat Color<float> (a * (1 - t) + b * t), clamp per channel
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            cout[i] = Color<unsigned char>(Color<float>(ca[i]) * (1.0f - t) + Color<float>(cb[i]) * t);
+    timer.tick();
+    double floatMs = msPer(timer.deltaTime());
+
+    // Color<unsigned char> per channel dengan integer (tanpa operator)
+    const int w = static_cast<int>(PackedColor::lerpWeight(t));
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++) {
+            const Color<unsigned char>& a = ca[i];
+            const Color<unsigned char>& b = cb[i];
+            cout[i] = Color<unsigned char>((a.r * (256 - w) + b.r * w) >> 8, (a.g * (256 - w) + b.g * w) >> 8,
+                                           (a.b * (256 - w) + b.b * w) >> 8, (a.a * (256 - w) + b.a * w) >> 8);
+        }
+    timer.tick();
+    double channelMs = msPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            pout[i] = pa[i].lerp(pb[i], t);
+    timer.tick();
+    double swarMs = msPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        z::lerpColors(pa.data(), pb.data(), t, pout.data(), count);
+    timer.tick();
+    double sseMs = msPer(timer.deltaTime());
+
+    printf("Benchmark lerp %zu warna (ms per pass)\n", count);
+    printf("  Color<float> operator       %7.3f ms\n", floatMs);
+    printf("  Color<uchar> per channel    %7.3f ms (%5.2fx)\n", channelMs, floatMs / channelMs);
+    printf("  PackedColor::lerp (SWAR)    %7.3f ms (%5.2fx)\n", swarMs, floatMs / swarMs);
+    printf("  lerpColors (SSE2)           %7.3f ms (%5.2fx)\n", sseMs, floatMs / sseMs);
+
+    return finishChecks();
+}
@@ -0,0 +1,282 @@
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "../include/z_color.h"
+#include "../include/z_timer.h"
+#include "../include/z_simd.h"
+#include "test_util.h"
+
+using z::PackedColor;
+
+// Referensi double presisi, terpisah dari implementasi
+static double refToLinear(double s) {
+    return s <= 0.04045 ? s / 12.92 : std::pow((s + 0.055) / 1.055, 2.4);
+}
+
+static int refToSrgb8(double l) {
+    l = l < 0.0 ? 0.0 : l > 1.0 ? 1.0 : l;
+    double s = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+    return static_cast<int>(std::floor(s * 255.0 + 0.5));
+}
+
+int main() {
+    seedRandom(77);
+    printf("sRGB / premultiply / swizzle\n");
+
+    // ===== sRGB -> linear: semua 256 nilai =====
+    {
+        std::vector<Color<unsigned char>> codes(256);
+        for (int i = 0; i < 256; i++)
+            codes[i] = Color<unsigned char>(i, 255 - i, i / 2, i);
+        std::vector<Color<float>> linear(256);
+        z::srgbToLinear(codes.data(), linear.data(), 256);
+        double maxErr = 0.0;
+        for (int i = 0; i < 256; i++) {
+            maxErr = std::max(maxErr, std::fabs(linear[i].r - refToLinear(i / 255.0)));
+            maxErr = std::max(maxErr, std::fabs(linear[i].g - refToLinear((255 - i) / 255.0)));
+            maxErr = std::max(maxErr, std::fabs(linear[i].a - i / 255.0));
+        }
+        printf("  sRGB -> linear max error %.2e\n", maxErr);
+        check(maxErr < 1e-6, "sRGB -> linear sesuai rumus");
+
+        // Round trip 8-bit harus identik untuk semua kode
+        std::vector<Color<unsigned char>> back(256);
+        z::linearToSrgb(linear.data(), back.data(), 256);
+        bool roundTrip = true;
+        for (int i = 0; i < 256; i++)
+            if (back[i] != codes[i]) roundTrip = false;
+        check(roundTrip, "sRGB -> linear -> sRGB identik untuk 256 kode");
+    }
+
+    // ===== linear -> sRGB: sapuan padat + nilai acak =====
+    {
+        const size_t n = 1 << 20;
+        std::vector<Color<float>> linear(n);
+        for (size_t i = 0; i < n; i++) {
+            float sweep = static_cast<float>(i) / static_cast<float>(n - 1);
+            linear[i] = Color<float>(sweep, rndUnit(), sweep * sweep * sweep, rndUnit());
+        }
+        // Di luar 0..1 dan NaN harus di-clamp (Color<float> sendiri clamp, jadi tulis langsung)
+        linear[1].r = -3.0f;
+        linear[2].g = 7.5f;
+        linear[3].b = std::nanf("");
+
+        std::vector<PackedColor> packed(n);
+        std::vector<Color<unsigned char>> bytes(n);
+        z::linearToSrgb(linear.data(), packed.data(), n);
+        z::linearToSrgb(linear.data(), bytes.data(), n);
+
+        size_t exact = 0, total = 0;
+        int worst = 0;
+        bool orderOk = true;
+        for (size_t i = 0; i < n; i++) {
+            const Color<float>& c = linear[i];
+            float ch[3] = { c.r, c.g, c.b };
+            int got[3] = { packed[i].r(), packed[i].g(), packed[i].b() };
+            for (int k = 0; k < 3; k++) {
+                int ref = std::isnan(ch[k]) ? 0 : refToSrgb8(ch[k]);
+                int d = std::abs(got[k] - ref);
+                worst = std::max(worst, d);
+                exact += d == 0;
+                total++;
+            }
+            if (packed[i].a() != static_cast<int>(c.a * 255.0f + 0.5f)) orderOk = false;
+            if (PackedColor(bytes[i]) != packed[i]) orderOk = false;
+        }
+        printf("  linear -> sRGB: %.4f%% tepat, selisih maksimum %d kode\n", 100.0 * exact / total, worst);
+        check(worst == 0, "linear -> sRGB dibulatkan tepat seperti rumus");
+        check(orderOk, "alpha linear, keluaran PackedColor dan Color<unsigned char> sama");
+    }
+
+    // ===== Setiap level SIMD = skalar, bit per bit =====
+    const z::simd::Level best = z::simd::detectLevel();
+    {
+        const size_t n = 4099;      // bukan kelipatan 4: tail skalar ikut teruji
+        std::vector<Color<float>> linear(n);
+        std::vector<PackedColor> codes(n);
+        for (size_t i = 0; i < n; i++) {
+            linear[i] = Color<float>(rndUnit() * 1.2f - 0.1f, rndUnit(), rndUnit() * rndUnit(), rndUnit() * 1.2f - 0.1f);
+            codes[i] = PackedColor::fromPixel(rnd());
+        }
+        linear[5].r = std::nanf("");
+        linear[6].a = std::nanf("");
+        auto run = [&](z::simd::Level level, std::vector<PackedColor>& packed, std::vector<Color<unsigned char>>& bytes,
+                       std::vector<Color<float>>& fromPacked, std::vector<Color<float>>& fromBytes) {
+            z::simd::setLevel(level);
+            packed.resize(n); bytes.resize(n); fromPacked.resize(n); fromBytes.resize(n);
+            z::linearToSrgb(linear.data(), packed.data(), n);
+            z::linearToSrgb(linear.data(), bytes.data(), n);
+            z::srgbToLinear(codes.data(), fromPacked.data(), n);
+            z::srgbToLinear(reinterpret_cast<const Color<unsigned char>*>(codes.data()), fromBytes.data(), n);
+        };
+        std::vector<PackedColor> refPacked, packed;
+        std::vector<Color<unsigned char>> refBytes, bytes;
+        std::vector<Color<float>> refA, refB, a, b;
+        run(z::simd::Level::Scalar, refPacked, refBytes, refA, refB);
+        bool same = true;
+        for (z::simd::Level level : {z::simd::Level::SSE2, z::simd::Level::AVX2}) {
+            if (static_cast<int>(level) > static_cast<int>(best)) continue;
+            run(level, packed, bytes, a, b);
+            same = same && packed == refPacked && bytes == refBytes
+                && std::memcmp(a.data(), refA.data(), n * sizeof(Color<float>)) == 0
+                && std::memcmp(b.data(), refB.data(), n * sizeof(Color<float>)) == 0;
+        }
+        z::simd::setLevel(best);
+        check(same, "linearToSrgb / srgbToLinear: SSE2 dan AVX2 = skalar, bit per bit");
+    }
+
+    // ===== Premultiply / unpremultiply =====
+    {
+        const size_t n = 65536 + 3;
+        std::vector<PackedColor> colors(n), pre(n), un(n);
+        for (size_t i = 0; i < n; i++)
+            colors[i] = PackedColor::fromPixel(static_cast<uint32_t>(i * 2654435761u));
+        colors[0] = PackedColor(200, 100, 50, 0);
+        z::premultiply(colors.data(), pre.data(), n);
+        bool preOk = true;
+        for (size_t i = 0; i < n; i++) {
+            int a = colors[i].a();
+            int ch[3] = { colors[i].r(), colors[i].g(), colors[i].b() };
+            int got[3] = { pre[i].r(), pre[i].g(), pre[i].b() };
+            for (int k = 0; k < 3; k++)
+                if (got[k] != (ch[k] * a + 127) / 255) preOk = false;
+            if (pre[i].a() != a) preOk = false;
+        }
+        check(preOk, "premultiply 8-bit = round(c * a / 255)");
+
+        z::unpremultiply(pre.data(), un.data(), n);
+        int worst = 0;
+        for (size_t i = 0; i < n; i++) {
+            int a = pre[i].a();
+            int ch[3] = { pre[i].r(), pre[i].g(), pre[i].b() };
+            int got[3] = { un[i].r(), un[i].g(), un[i].b() };
+            for (int k = 0; k < 3; k++) {
+                int ref = a == 0 ? 0 : std::min(255, (ch[k] * 255 + a / 2) / a);
+                worst = std::max(worst, std::abs(got[k] - ref));
+            }
+        }
+        printf("  unpremultiply selisih maksimum %d kode\n", worst);
+        // Jalur SSE2 = rumus reciprocal 16.16 skalar persis
+        bool sameRecip = true;
+        for (size_t i = 0; i < n; i++) {
+            uint32_t a = static_cast<uint32_t>(pre[i].a()), k = a ? (255u * 65536u + a / 2) / a : 0;
+            uint32_t ch[3] = { static_cast<uint32_t>(pre[i].r()), static_cast<uint32_t>(pre[i].g()), static_cast<uint32_t>(pre[i].b()) };
+            PackedColor expected(static_cast<int>(std::min((ch[0] * k + 32768) >> 16, 255u)), static_cast<int>(std::min((ch[1] * k + 32768) >> 16, 255u)),
+                                 static_cast<int>(std::min((ch[2] * k + 32768) >> 16, 255u)), static_cast<int>(a));
+            sameRecip = sameRecip && un[i] == expected;
+        }
+        check(sameRecip, "unpremultiply = reciprocal 16.16 skalar persis");
+        check(worst <= 1 && un[0] == PackedColor(0, 0, 0, 0), "unpremultiply dalam 1 kode, alpha 0 -> transparan");
+
+        std::vector<Color<float>> f(5), fp(5), fu(5);
+        for (int i = 0; i < 5; i++)
+            f[i] = Color<float>(0.8f, 0.4f, 0.2f, i * 0.25f);
+        z::premultiply(f.data(), fp.data(), 5);
+        z::unpremultiply(fp.data(), fu.data(), 5);
+        bool floatOk = std::fabs(fp[2].r - 0.4f) < 1e-6f && fp[2].a == 0.5f && std::fabs(fu[3].g - 0.4f) < 1e-6f && fu[0].r == 0.0f;
+        check(floatOk, "premultiply / unpremultiply Color<float>");
+    }
+
+    // ===== Swizzle =====
+    {
+        uint32_t px[7] = { 0x11223344u, 0xAABBCCDDu, 0, 0xFFFFFFFFu, 0x01020304u, 0x80FF0080u, 0x12345678u };
+        uint32_t out[7];
+        z::swizzleRedBlue(px, out, 7);
+        bool ok = out[0] == 0x11443322u && out[1] == 0xAADDCCBBu && out[6] == 0x12785634u;
+        z::swizzleRedBlue(out, out, 7);
+        for (int i = 0; i < 7; i++)
+            if (out[i] != px[i]) ok = false;
+        check(ok, "swizzle BGRA <-> RGBA (dan in-place)");
+    }
+
+    // ===== Benchmark =====
+    const size_t count = 1 << 20;
+    const int repeat = 10;
+    std::vector<Color<float>> linear(count), linearOut(count);
+    std::vector<Color<unsigned char>> bytes(count);
+    std::vector<PackedColor> packed(count);
+    for (size_t i = 0; i < count; i++)
+        linear[i] = Color<float>(rndUnit(), rndUnit(), rndUnit(), rndUnit());
+
+    z::Timer timer(z::TimerMode::Precise);
+    auto msPer = [&](double seconds) { return seconds * 1000.0 / repeat; };
+
+    // Operator konversi yang ada (tanpa gamma)
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            bytes[i] = linear[i];
+    timer.tick();
+    double operatorMs = msPer(timer.deltaTime());
+
+    // Rumus pow per channel
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++) {
+            const Color<float>& c = linear[i];
+            bytes[i] = Color<unsigned char>(static_cast<int>(z::linearToSrgb(c.r) * 255.0f + 0.5f), static_cast<int>(z::linearToSrgb(c.g) * 255.0f + 0.5f),
+                                            static_cast<int>(z::linearToSrgb(c.b) * 255.0f + 0.5f), static_cast<int>(c.a * 255.0f + 0.5f));
+        }
+    timer.tick();
+    double powMs = msPer(timer.deltaTime());
+
+    // Konversi LUT per level SIMD
+    const z::simd::Level levels[3] = {z::simd::Level::Scalar, z::simd::Level::SSE2, z::simd::Level::AVX2};
+    double lutMs[3] = {}, toLinearMs[3] = {};
+    for (int l = 0; l < 3; l++) {
+        if (static_cast<int>(levels[l]) > static_cast<int>(best)) continue;
+        z::simd::setLevel(levels[l]);
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            z::linearToSrgb(linear.data(), packed.data(), count);
+        timer.tick();
+        lutMs[l] = msPer(timer.deltaTime());
+
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            z::srgbToLinear(packed.data(), linearOut.data(), count);
+        timer.tick();
+        toLinearMs[l] = msPer(timer.deltaTime());
+    }
+    z::simd::setLevel(best);
+
+    // Setengah transparan supaya unpremultiply tidak selalu alpha 255
+    for (size_t i = 0; i < count; i++)
+        packed[i] = PackedColor::fromPixel((packed[i].value & 0x00FFFFFFu) | (rnd() & 0xFF000000u));
+    std::vector<PackedColor> unpremultiplied(count);
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        z::unpremultiply(packed.data(), unpremultiplied.data(), count);
+    timer.tick();
+    double unpremulMs = msPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        z::premultiply(packed.data(), packed.data(), count);
+    timer.tick();
+    double premulMs = msPer(timer.deltaTime());
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        z::swizzleRedBlue(reinterpret_cast<uint32_t*>(packed.data()), reinterpret_cast<uint32_t*>(packed.data()), count);
+    timer.tick();
+    double swizzleMs = msPer(timer.deltaTime());
+
+    printf("Benchmark %zu warna (ms per pass)\n", count);
+    printf("  operator Color<uchar>() tanpa gamma  %7.3f ms\n", operatorMs);
+    printf("  linear -> sRGB rumus pow             %7.3f ms\n", powMs);
+    for (int l = 0; l < 3; l++) {
+        if (static_cast<int>(levels[l]) > static_cast<int>(best)) continue;
+        printf("  linear -> sRGB LUT %-6s           %7.3f ms (%5.2fx vs pow)\n", z::simd::levelName(levels[l]), lutMs[l], powMs / lutMs[l]);
+    }
+    for (int l = 0; l < 3; l++) {
+        if (static_cast<int>(levels[l]) > static_cast<int>(best)) continue;
+        printf("  sRGB -> linear LUT %-6s           %7.3f ms (%5.2fx vs skalar)\n", z::simd::levelName(levels[l]), toLinearMs[l], toLinearMs[0] / toLinearMs[l]);
+    }
+    printf("  premultiply 8-bit                    %7.3f ms\n", premulMs);
+    printf("  unpremultiply 8-bit                  %7.3f ms\n", unpremulMs);
+    printf("  swizzle BGRA <-> RGBA                %7.3f ms\n", swizzleMs);
+
+    return finishChecks();
+}
@@ -0,0 +1,109 @@
+#include <cstdio>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_cull.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+// ===== Compile time =====
+constexpr Rect<int> A(0, 0, 100, 50);
+constexpr Rect<int> B(80, 40, 40, 40);
+static_assert(A.right() == 100 && A.bottom() == 50, "right/bottom");
+static_assert(A.overlaps(B) && B.overlaps(A), "overlap simetris");
+static_assert(A.intersect(B) == Rect<int>(80, 40, 20, 10), "intersect");
+static_assert(A.unite(B) == Rect<int>(0, 0, 120, 80), "unite");
+static_assert(!A.overlaps(Rect<int>(100, 0, 10, 10)), "tepi kanan eksklusif");
+static_assert(A.intersect(Rect<int>(200, 200, 5, 5)).empty(), "tanpa irisan -> kosong");
+static_assert(A.contains(Vec2<int>(0, 0)) && !A.contains(Vec2<int>(100, 10)), "contains titik setengah terbuka");
+static_assert(A.contains(Rect<int>(10, 10, 90, 40)) && !A.contains(B), "contains rect");
+static_assert(!A.overlaps(Rect<int>(10, 10, 0, 5)) && A.unite(Rect<int>()) == A, "rect kosong diabaikan");
+static_assert(Rect<float>(0.0f, 0.0f, 1.0f, 1.0f).contains(Vec2<float>(0.5f, 0.999f)), "Rect<float> contains");
+static_assert(Rect<float>(0.0f, 0.0f, 2.0f, 2.0f).intersect(Rect<float>(1.0f, 1.0f, 2.0f, 2.0f)) == Rect<float>(1.0f, 1.0f, 1.0f, 1.0f), "Rect<float> intersect");
+
+int main() {
+    seedRandom(4242);
+    printf("Rect\n");
+
+    // containsPoint memakai cache yang ikut berubah saat resize
+    {
+        z::Window window("Rect Test", 320, 200);
+        bool before = window.containsPoint(Vec2<int>(319, 199)) && !window.containsPoint(Vec2<int>(320, 10));
+        window.setSize(Vec2<int>(640, 400));
+        window.processMessages();
+        bool after = window.containsPoint(Vec2<int>(639, 399)) && !window.containsPoint(Vec2<int>(-1, 0));
+        check(before && after, "Window::containsPoint mengikuti event Resize");
+        // setSize = ukuran client di semua backend (Win32 menambah frame sendiri)
+        check(window.getClientSize() == Vec2<int>(640, 400), "Window::setSize mengatur ukuran client");
+    }
+
+    // ===== Culling: hasil SoA = Rect::overlaps per rect =====
+    const size_t count = 1000000;
+    const int worldW = 16000, worldH = 9000;
+    std::vector<Rect<int>> aos;
+    aos.reserve(count);
+    z::RectArray soa(count);
+    for (size_t i = 0; i < count; i++) {
+        Rect<int> r(rnd(worldW), rnd(worldH), 4 + rnd(300), 4 + rnd(120));
+        if (i % 997 == 0) r.w = 0;      // beberapa rect kosong
+        aos.push_back(r);
+        soa.add(r);
+    }
+
+    std::vector<uint32_t> visible(count);
+    std::vector<uint32_t> expected;
+    expected.reserve(count);
+
+    struct Scenario {
+        const char* name;
+        Rect<int> clip;
+    };
+    Scenario scenarios[] = {
+        { "viewport 1920x1080 (~3%)", Rect<int>(4000, 3000, 1920, 1080) },
+        { "setengah world (~50%)", Rect<int>(0, 0, worldW / 2, worldH) },
+        { "semua", Rect<int>(-1000, -1000, worldW + 2000, worldH + 2000) },
+    };
+
+    bool allSame = true;
+    z::Timer timer(z::TimerMode::Precise);
+    const int repeat = 10;
+    printf("Benchmark %zu rect (ms per pass)\n", count);
+    for (const Scenario& sc : scenarios) {
+        // Baseline: loop AoS dengan Rect::overlaps
+        size_t n = 0;
+        timer.tick();
+        for (int r = 0; r < repeat; r++) {
+            expected.clear();
+            for (size_t i = 0; i < count; i++)
+                if (aos[i].overlaps(sc.clip))
+                    expected.push_back(static_cast<uint32_t>(i));
+        }
+        timer.tick();
+        double aosMs = timer.deltaTime() * 1000.0 / repeat;
+
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            n = z::cullRects(soa, sc.clip, visible.data());
+        timer.tick();
+        double soaMs = timer.deltaTime() * 1000.0 / repeat;
+
+        bool same = n == expected.size();
+        for (size_t i = 0; same && i < n; i++)
+            same = visible[i] == expected[i];
+        allSame = allSame && same;
+        printf("  %-26s %7zu terlihat | AoS overlaps %7.3f ms | SoA SSE2 %7.3f ms (%5.2fx)%s\n",
+               sc.name, n, aosMs, soaMs, aosMs / soaMs, same ? "" : "  MISMATCH");
+    }
+    check(allSame, "cullRects = Rect::overlaps, index urut");
+
+    // Jumlah yang bukan kelipatan 4 dan clip kosong
+    z::RectArray small;
+    for (int i = 0; i < 7; i++)
+        small.add(Rect<int>(i * 10, 0, 10, 10));
+    std::vector<uint32_t> idx;
+    z::cullRects(small, Rect<int>(25, 5, 20, 1), idx);
+    bool tailOk = idx.size() == 3 && idx[0] == 2 && idx[2] == 4;
+    tailOk = tailOk && z::cullRects(small, Rect<int>(0, 0, 0, 10), idx) == 0;
+    check(tailOk && small.get(3) == Rect<int>(30, 0, 10, 10), "ekor skalar, clip kosong, get()");
+
+    return finishChecks();
+}
@@ -0,0 +1,188 @@
+// Fixed point 24.8 dan rasterizer integer.
+// Hash gambar dibandingkan dengan konstanta, jadi build dengan compiler / flag lain
+// harus menghasilkan pixel yang sama persis, mis.:
+//   g++ -std=c++17 -O0 test/14_fixed_test.cpp
+//   g++ -std=c++17 -O3 -march=native -ffast-math test/14_fixed_test.cpp
+//   clang++ -std=c++17 -O2 test/14_fixed_test.cpp
+//   cl /std:c++17 /O2 /fp:fast test\14_fixed_test.cpp
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include "../include/z_raster.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+// ===== Compile time =====
+static_assert(Fixed(1.5f).raw == 384 && Fixed(-0.25f).raw == -64, "konversi float");
+static_assert(Fixed(1.0f / 512).raw == 1 && Fixed(-1.0f / 512).raw == -1, "setengah menjauhi nol");
+static_assert(Fixed(2.5f) * Fixed(-1.5f) == Fixed(-3.75f), "multiply");
+static_assert(Fixed(7) / Fixed(2) == Fixed(3.5f), "divide");
+static_assert(Fixed(-0.5f).floor() == -1 && Fixed(-0.5f).ceil() == 0 && Fixed(2.5f).round() == 3, "floor / ceil / round");
+static_assert(static_cast<int>(Fixed(-1.25f)) == -2 && static_cast<float>(Fixed(-1.25f)) == -1.25f, "konversi keluar");
+static_assert(Vec2<int>(Vec2<Fixed>(-0.5f, 1.75f)) == Vec2<int>(-1, 1), "Vec2<Fixed> -> Vec2<int> floor");
+static_assert(Vec2<int>(3, 4) + Vec2<Fixed>(1.5f, -0.25f) == Vec2<int>(4, 3), "Vec2<int> + Vec2<Fixed>");
+static_assert(Vec2<Fixed>(1.5f, -0.25f) + Vec2<int>(1, 1) == Vec2<Fixed>(2.5f, 0.75f), "Vec2<Fixed> + Vec2<int>");
+static_assert(Vec2<float>(1.0f, 1.0f) + Vec2<Fixed>(1.5f, -0.25f) == Vec2<float>(2.5f, 0.75f), "Vec2<float> + Vec2<Fixed>");
+static_assert(Vec2<Fixed>(1.5f, -0.25f) * 2 == Vec2<Fixed>(3.0f, -0.5f), "Vec2<Fixed> * skalar");
+static_assert(std::is_trivially_copyable_v<Fixed> && sizeof(Vec2<Fixed>) == 8, "layout");
+
+// Hash yang diharapkan untuk scene di bawah, sama untuk semua build
+static constexpr uint32_t EXPECTED_HASH = 0xECAFD82Du;
+
+static float rndf(float range) {
+    return rndUnit() * range;
+}
+
+static uint32_t fnv1a(const std::vector<Pixel>& pixels) {
+    uint32_t h = 2166136261u;
+    for (Pixel p : pixels)
+        for (int k = 0; k < 4; k++) {
+            h ^= (p >> (k * 8)) & 0xFF;
+            h *= 16777619u;
+        }
+    return h;
+}
+
+// Referensi brute force: winding per pixel dari tes sisi integer, tanpa DDA
+static bool covered(const Vec2<Fixed>* pts, int count, int px, int py, z::FillRule rule) {
+    const int64_t cx = static_cast<int64_t>(px) * Fixed::ONE + Fixed::ONE / 2;
+    const int64_t cy = static_cast<int64_t>(py) * Fixed::ONE + Fixed::ONE / 2;
+    int winding = 0;
+    for (int i = 0; i < count; i++) {
+        Vec2<Fixed> a = pts[i], b = pts[(i + 1) % count];
+        int w = 1;
+        if (a.y == b.y) continue;
+        if (a.y > b.y) { std::swap(a, b); w = -1; }
+        if (cy < a.y.raw || cy >= b.y.raw) continue;
+        // crossing x <= cx  <=>  (x0 - cx) * dy + (cy - y0) * dx <= 0
+        int64_t dy = b.y.raw - a.y.raw, dx = static_cast<int64_t>(b.x.raw) - a.x.raw;
+        if ((a.x.raw - cx) * dy + (cy - a.y.raw) * dx <= 0)
+            winding += w;
+    }
+    return rule == z::FillRule::EvenOdd ? (winding & 1) != 0 : winding != 0;
+}
+
+struct Shape {
+    std::vector<Vec2<Fixed>> fixedPoints;
+    std::vector<Vec2<float>> floatPoints;
+    z::FillRule rule;
+    Pixel color;
+};
+
+int main() {
+    seedRandom(1337);
+    printf("Fixed\n");
+
+    // Konversi float tepat: sama dengan round(f * 256) setengah menjauhi nol
+    {
+        bool exact = true;
+        for (int i = 0; i < 200000 && exact; i++) {
+            float f = rndf(2000.0f) - 1000.0f;
+            if (i % 3 == 0) f = std::floor(f * 512.0f) / 512.0f;     // tepat di tengah dua nilai
+            exact = Fixed(f).raw == std::llround(static_cast<double>(f) * 256.0) && Fixed(static_cast<double>(f)) == Fixed(f);
+        }
+        check(exact, "Fixed(float) = llround(f * 256)");
+    }
+
+    // Overflow dicek
+#if Z_UNIT_DIVISION == Z_UNIT_DIVISION_THROW
+    {
+        int thrown = 0, expected = 5;
+        try { (void)(Fixed(100000) * Fixed(100000)); } catch (const fixed_overflow&) { thrown++; }
+        try { (void)(Fixed(8000000) / Fixed(0.5f)); } catch (const fixed_overflow&) { thrown++; }
+        try { (void)Fixed(1e9f); } catch (const fixed_overflow&) { thrown++; }
+#ifndef __FAST_MATH__
+        try { (void)Fixed(std::nanf("")); } catch (const fixed_overflow&) { thrown++; }
+#else
+        expected--;         // -ffast-math menganggap tidak ada NaN
+#endif
+        try { (void)Fixed(Fixed::INT_MAX_VALUE + 1); } catch (const fixed_overflow&) { thrown++; }
+        bool inRange = Fixed(Fixed::INT_MIN_VALUE).raw == INT32_MIN && (Fixed(-2896) * Fixed(2896)).raw == -2896 * 2896 * 256;
+        check(thrown == expected && inRange, "overflow multiply / divide / konversi -> fixed_overflow");
+    }
+#endif
+
+    // ===== Rasterizer =====
+    const int width = 256, height = 192;
+    std::vector<Shape> shapes;
+    for (int s = 0; s < 40; s++) {
+        Shape shape;
+        int count = 3 + s % 6;
+        // Scene dibangun dari integer supaya hanya rasterizer yang diuji antar build
+        int cx = rnd((width + 40) * Fixed::ONE) - 20 * Fixed::ONE, cy = rnd((height + 40) * Fixed::ONE) - 20 * Fixed::ONE;
+        for (int i = 0; i < count; i++) {
+            Vec2<Fixed> p(Fixed::fromRaw(cx + rnd(120 * Fixed::ONE) - 60 * Fixed::ONE), Fixed::fromRaw(cy + rnd(90 * Fixed::ONE) - 45 * Fixed::ONE));
+            if (i % 4 == 1) p = Vec2<Fixed>(p.floor()) + Vec2<Fixed>(0.5f);     // tepat di tengah pixel
+            shape.fixedPoints.push_back(p);
+            shape.floatPoints.push_back(Vec2<float>(p));
+        }
+        shape.rule = s % 2 ? z::FillRule::NonZero : z::FillRule::EvenOdd;
+        shape.color = z::makePixel(static_cast<uint8_t>(s * 37), static_cast<uint8_t>(s * 91), static_cast<uint8_t>(s * 13));
+        shapes.push_back(shape);
+    }
+
+    std::vector<Pixel> fixedImage(width * height, 0), floatImage(width * height, 0), refImage(width * height, 0);
+    z::Raster fixedRaster(z::Surface(fixedImage.data(), width, height, width));
+    z::Raster floatRaster(z::Surface(floatImage.data(), width, height, width));
+    for (const Shape& shape : shapes) {
+        fixedRaster.polygon(shape.fixedPoints.data(), static_cast<int>(shape.fixedPoints.size()), shape.color, 0, true, false, 1, shape.rule);
+        floatRaster.polygon(shape.floatPoints.data(), static_cast<int>(shape.floatPoints.size()), shape.color, 0, true, false, 1, shape.rule);
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                if (covered(shape.fixedPoints.data(), static_cast<int>(shape.fixedPoints.size()), x, y, shape.rule))
+                    refImage[y * width + x] = shape.color;
+    }
+
+    size_t refDiff = 0, floatDiff = 0;
+    for (size_t i = 0; i < fixedImage.size(); i++) {
+        refDiff += fixedImage[i] != refImage[i];
+        floatDiff += fixedImage[i] != floatImage[i];
+    }
+    check(refDiff == 0, "scanline fixed = tes sisi brute force per pixel");
+    printf("  (path float berbeda %zu pixel dari fixed)\n", floatDiff);
+
+    // Clip: hasil di dalam clip sama dengan gambar penuh
+    {
+        std::vector<Pixel> clipped(width * height, 0);
+        z::Raster raster(z::Surface(clipped.data(), width, height, width));
+        raster.setClip(Rect<int>(37, 21, 150, 100));
+        for (const Shape& shape : shapes)
+            raster.polygon(shape.fixedPoints.data(), static_cast<int>(shape.fixedPoints.size()), shape.color, 0, true, false, 1, shape.rule);
+        bool same = true;
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++) {
+                bool inside = raster.clip().contains(Vec2<int>(x, y));
+                if (clipped[y * width + x] != (inside ? fixedImage[y * width + x] : 0)) same = false;
+            }
+        check(same, "clip tidak mengubah pixel di dalamnya");
+    }
+
+    uint32_t hash = fnv1a(fixedImage);
+    printf("  hash gambar 0x%08X\n", hash);
+    check(hash == EXPECTED_HASH, "hash sama dengan build referensi (bit-exact)");
+
+    // ===== Benchmark: isi semua shape =====
+    const int repeat = 200;
+    z::Timer timer(z::TimerMode::Precise);
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (const Shape& shape : shapes)
+            floatRaster.polygon(shape.floatPoints.data(), static_cast<int>(shape.floatPoints.size()), shape.color, 0, true, false, 1, shape.rule);
+    timer.tick();
+    double floatMs = timer.deltaTime() * 1000.0 / repeat;
+
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (const Shape& shape : shapes)
+            fixedRaster.polygon(shape.fixedPoints.data(), static_cast<int>(shape.fixedPoints.size()), shape.color, 0, true, false, 1, shape.rule);
+    timer.tick();
+    double fixedMs = timer.deltaTime() * 1000.0 / repeat;
+
+    printf("Benchmark %zu polygon %dx%d (ms per frame)\n", shapes.size(), width, height);
+    printf("  float  %7.3f ms\n", floatMs);
+    printf("  fixed  %7.3f ms (%5.2fx)\n", fixedMs, floatMs / fixedMs);
+
+    return finishChecks();
+}
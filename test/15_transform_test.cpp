@@ -0,0 +1,213 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_drawlist.h"
+#include "../include/z_simd.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::simd::Level;
+
+// ===== Compile time =====
+constexpr Affine T = Affine::translation(10.0f, 20.0f);
+constexpr Affine S = Affine::scaling(2.0f, 4.0f);
+static_assert(Affine().isIdentity() && T.isTranslation() && !S.isTranslation() && S.isAxisAligned(), "klasifikasi");
+static_assert((T * S) * Vec2<float>(1.0f, 1.0f) == Vec2<float>(12.0f, 24.0f), "T * S: scale dulu");
+static_assert((S * T) * Vec2<float>(1.0f, 1.0f) == Vec2<float>(22.0f, 84.0f), "S * T: translate dulu");
+static_assert((T * S).inverse() * Vec2<float>(12.0f, 24.0f) == Vec2<float>(1.0f, 1.0f), "inverse");
+static_assert((S * S.inverse()).isIdentity() && (T * S).determinant() == 8.0f, "determinant");
+static_assert(Affine::translation(Vec2<int>(3, 4)) * Vec2<int>(1, 1) == Vec2<float>(4.0f, 5.0f), "translation dari Vec2");
+
+static float rndf(float range) {
+    return (rndUnit() - 0.5f) * range;
+}
+
+static bool sameSurface(const z::Surface& a, const z::Surface& b) {
+    for (int y = 0; y < a.height; y++)
+        for (int x = 0; x < a.width; x++)
+            if (a.at(x, y) != b.at(x, y)) return false;
+    return true;
+}
+
+int main() {
+    seedRandom(99);
+    printf("Affine / transform (SIMD terbaik: %s)\n", z::simd::levelName(z::simd::detectLevel()));
+
+    // ===== Batch transform = Affine * Vec2 di semua level =====
+    {
+        const size_t n = 1003;
+        std::vector<Vec2<float>> in(n), out(n);
+        std::vector<Vec2<int>> inInt(n), outInt(n);
+        for (size_t i = 0; i < n; i++) {
+            in[i] = Vec2<float>(rndf(2000.0f), rndf(2000.0f));
+            inInt[i] = Vec2<int>(in[i]);
+        }
+        Affine general = Affine::translation(320.5f, -40.25f) * Affine::rotation(0.7f) * Affine::scaling(1.5f, -0.75f);
+        Affine shift = Affine::translation(17.0f, -3.0f);
+
+        Level levels[3] = { Level::Scalar, Level::SSE2, Level::AVX2 };
+        for (Level requested : levels) {
+            Level used = z::simd::setLevel(requested);
+            if (used != requested) continue;
+            // AVX2 memakai FMA: boleh beda 1 ulp, pembulatan ke int boleh beda 1 di titik .5
+            const bool exact = used != Level::AVX2;
+            auto near = [&](Vec2<float> got, Vec2<float> p) {
+                Vec2<float> ref = general * p;
+                if (exact) return got == ref;
+                // Error relatif terhadap suku-sukunya, bukan hasil (bisa saling menghapus)
+                float tol = 1e-6f * (1.0f + std::fabs(p.x) + std::fabs(p.y) + std::fabs(general.tx) + std::fabs(general.ty));
+                return std::fabs(got.x - ref.x) <= tol && std::fabs(got.y - ref.y) <= tol;
+            };
+            bool ok = true;
+            z::simd::transform(general, in.data(), out.data(), n);
+            for (size_t i = 0; i < n; i++)
+                if (!near(out[i], in[i])) ok = false;
+            z::simd::transform(shift, in.data(), out.data(), n);
+            for (size_t i = 0; i < n; i++)
+                if (out[i] != shift * in[i]) ok = false;
+            z::simd::transform(shift, inInt.data(), outInt.data(), n);
+            for (size_t i = 0; i < n; i++)
+                if (outInt[i] != inInt[i] + Vec2<int>(17, -3)) ok = false;
+            z::simd::transform(general, inInt.data(), outInt.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                Vec2<float> p = general * inInt[i];
+                Vec2<int> ref(static_cast<int>(std::nearbyint(p.x)), static_cast<int>(std::nearbyint(p.y)));
+                if (exact ? outInt[i] != ref : std::abs(outInt[i].x - ref.x) > 1 || std::abs(outInt[i].y - ref.y) > 1) ok = false;
+            }
+            std::vector<Vec2<float>> inPlace(in);
+            z::simd::transform(general, inPlace.data(), inPlace.data(), n);
+            z::simd::transform(general, in.data(), out.data(), n);
+            for (size_t i = 0; i < n; i++)
+                if (inPlace[i] != out[i]) ok = false;
+            char label[96];
+            snprintf(label, sizeof(label), "%s: general, translasi, int, in-place = Affine * Vec2", z::simd::levelName(used));
+            check(ok, label);
+        }
+        z::simd::setLevel(Level::AVX2);
+    }
+
+    // ===== Canvas =====
+    z::Window window("Transform Test", 200, 150);
+    z::Canvas a(window.handle());
+    z::Canvas b(window.handle());
+
+    // Translasi sama dengan menggambar di posisi yang digeser
+    {
+        a.clear();
+        a.pushTransform();
+        a.translate(30.0f, 20.0f);
+        a.fillRect(Rect<int>(5, 5, 40, 30), RGB(200, 10, 10));
+        a.drawLine(Vec2<int>(0, 0), Vec2<int>(50, 40), RGB(10, 200, 10), 3);
+        a.fillCircle(Vec2<int>(60, 60), 15, RGB(10, 10, 200));
+        Vec2<int> poly[4] = { Vec2<int>(0, 0), Vec2<int>(20, 5), Vec2<int>(15, 30), Vec2<int>(-5, 20) };
+        a.fillPolygon(poly, 4, RGB(255, 255, 0));
+        a.drawPixel(Vec2<int>(100, 100), RGB(255, 255, 255));
+        a.popTransform();
+        a.fillRect(Rect<int>(0, 0, 4, 4), RGB(1, 2, 3));     // setelah pop: tanpa transform
+
+        b.clear();
+        b.fillRect(Rect<int>(35, 25, 40, 30), RGB(200, 10, 10));
+        b.drawLine(Vec2<int>(30, 20), Vec2<int>(80, 60), RGB(10, 200, 10), 3);
+        b.fillCircle(Vec2<int>(90, 80), 15, RGB(10, 10, 200));
+        Vec2<int> moved[4] = { Vec2<int>(30, 20), Vec2<int>(50, 25), Vec2<int>(45, 50), Vec2<int>(25, 40) };
+        b.fillPolygon(moved, 4, RGB(255, 255, 0));
+        b.drawPixel(Vec2<int>(130, 120), RGB(255, 255, 255));
+        b.fillRect(Rect<int>(0, 0, 4, 4), RGB(1, 2, 3));
+        check(sameSurface(a.surface(), b.surface()) && a.getTransform().isIdentity(), "translate + push/pop = koordinat digeser");
+    }
+
+    // Scale 2x: rect tetap rect, ukuran dikali dua
+    {
+        a.clear();
+        a.pushTransform(Affine::scaling(2.0f, 2.0f));
+        a.fillRect(Rect<int>(10, 10, 20, 15), RGB(255, 0, 0));
+        a.popTransform();
+        b.clear();
+        b.fillRect(Rect<int>(20, 20, 40, 30), RGB(255, 0, 0));
+        check(sameSurface(a.surface(), b.surface()), "scale: fillRect dipetakan ke rect device");
+    }
+
+    // Rotasi 90 derajat di sekitar (100, 75): rect menjadi rect yang diputar
+    {
+        a.clear();
+        a.translate(100.0f, 75.0f);
+        a.rotate(3.14159265f / 2.0f);
+        a.fillRect(Rect<int>(0, 0, 40, 20), RGB(0, 255, 0));
+        a.resetTransform();
+        b.clear();
+        b.fillRect(Rect<int>(80, 75, 20, 40), RGB(0, 255, 0));
+        check(sameSurface(a.surface(), b.surface()), "rotate 90: rect menjadi polygon dengan pixel yang sama");
+    }
+
+    // drawTriangles / drawPixels ikut transform, DrawList juga
+    {
+        a.clear();
+        a.translate(10.0f, 10.0f);
+        Vec2<float> tris[7] = { Vec2<float>(0, 0), Vec2<float>(40, 0), Vec2<float>(0, 40),
+                                Vec2<float>(50, 50), Vec2<float>(90, 50), Vec2<float>(50, 90), Vec2<float>(1, 1) };
+        a.drawTriangles(tris, 7, z::PackedColor(255, 0, 255));
+        Vec2<int> pts[3] = { Vec2<int>(100, 5), Vec2<int>(101, 6), Vec2<int>(102, 7) };
+        a.drawPixels(pts, 3, RGB(255, 255, 255));
+        z::DrawList list;
+        list.fillRect(120, 100, 10, 10, RGB(9, 9, 9));
+        a.draw(list);
+        a.resetTransform();
+
+        b.clear();
+        Vec2<float> moved[6] = { Vec2<float>(10, 10), Vec2<float>(50, 10), Vec2<float>(10, 50),
+                                 Vec2<float>(60, 60), Vec2<float>(100, 60), Vec2<float>(60, 100) };
+        b.drawTriangles(moved, 6, RGB(255, 0, 255));
+        for (int i = 0; i < 3; i++)
+            b.drawPixel(110 + i, 15 + i, RGB(255, 255, 255));
+        b.fillRect(130, 110, 10, 10, RGB(9, 9, 9));
+        check(sameSurface(a.surface(), b.surface()), "drawTriangles, drawPixels dan draw(DrawList) ikut transform");
+
+        a.translate(50.0f, 0.0f);
+        a.scale(2.0f);
+        Vec2<float> back = a.fromDevice(a.toDevice(Vec2<float>(3.0f, 4.0f)));
+        check(a.toDevice(Vec2<float>(3.0f, 4.0f)) == Vec2<float>(56.0f, 8.0f) && back == Vec2<float>(3.0f, 4.0f), "toDevice / fromDevice");
+        a.popTransform();   // tanpa push: diabaikan
+        a.resetTransform();
+    }
+
+    // ===== Benchmark: transform 10M titik =====
+    const size_t count = 10000000;
+    std::vector<Vec2<float>> points(count), result(count);
+    for (size_t i = 0; i < count; i++)
+        points[i] = Vec2<float>(rndf(4000.0f), rndf(4000.0f));
+    Affine view = Affine::translation(640.0f, 360.0f) * Affine::rotation(0.3f) * Affine::scaling(1.25f, -1.25f);
+    Affine pan = Affine::translation(-12.5f, 48.0f);
+
+    z::Timer timer(z::TimerMode::Precise);
+    const int repeat = 3;
+    timer.tick();
+    for (int r = 0; r < repeat; r++)
+        for (size_t i = 0; i < count; i++)
+            result[i] = view * points[i];
+    timer.tick();
+    double loopMs = timer.deltaTime() * 1000.0 / repeat;
+
+    printf("Benchmark %zu titik (ms per pass)\n", count);
+    printf("  loop Affine * Vec2        %8.3f ms\n", loopMs);
+    Level levels[3] = { Level::Scalar, Level::SSE2, Level::AVX2 };
+    for (Level requested : levels) {
+        Level used = z::simd::setLevel(requested);
+        if (used != requested) continue;
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            z::simd::transform(view, points.data(), result.data(), count);
+        timer.tick();
+        double generalMs = timer.deltaTime() * 1000.0 / repeat;
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            z::simd::transform(pan, points.data(), result.data(), count);
+        timer.tick();
+        double panMs = timer.deltaTime() * 1000.0 / repeat;
+        printf("  simd::transform %-6s    %8.3f ms (%5.2fx) | translasi saja %8.3f ms\n", z::simd::levelName(used), generalMs, loopMs / generalMs, panMs);
+    }
+    z::simd::setLevel(Level::AVX2);
+
+    return finishChecks();
+}
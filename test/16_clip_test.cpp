@@ -0,0 +1,220 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_drawlist.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+// Bresenham penuh seperti Raster::line sebelum ada clip per langkah, pixel di luar clip dibuang
+static void referenceLine(std::vector<Pixel>& image, int width, Rect<int> clip, int x0, int y0, int x1, int y1, Pixel color) {
+    int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    while (x0 != x1 || y0 != y1) {
+        if (clip.contains(Vec2<int>(x0, y0)))
+            image[y0 * width + x0] = color;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+// Pixel di dalam clip sama, di luar clip tidak tersentuh (masih warna clear)
+static bool sameInside(const z::Surface& a, const z::Surface& b, Rect<int> clip, Pixel background) {
+    for (int y = 0; y < a.height; y++)
+        for (int x = 0; x < a.width; x++) {
+            bool inside = clip.contains(Vec2<int>(x, y));
+            if (inside ? a.at(x, y) != b.at(x, y) : a.at(x, y) != background) return false;
+        }
+    return true;
+}
+
+int main() {
+    seedRandom(2024);
+    printf("Clip\n");
+
+    // ===== Liang-Barsky =====
+    {
+        float t0, t1;
+        Rect<float> box(0.0f, 0.0f, 10.0f, 10.0f);
+        bool ok = z::clipSegment(Vec2<float>(-10.0f, 5.0f), Vec2<float>(20.0f, 5.0f), box, t0, t1) && std::fabs(t0 - 1.0f / 3.0f) < 1e-6f && std::fabs(t1 - 2.0f / 3.0f) < 1e-6f;
+        ok = ok && !z::clipSegment(Vec2<float>(-5.0f, 4.0f), Vec2<float>(4.0f, -5.0f), box, t0, t1);     // lewat di samping sudut
+        ok = ok && !z::clipSegment(Vec2<float>(11.0f, 0.0f), Vec2<float>(11.0f, 10.0f), box, t0, t1);    // vertikal di luar
+        ok = ok && z::clipSegment(Vec2<float>(2.0f, 3.0f), Vec2<float>(4.0f, 5.0f), box, t0, t1) && t0 == 0.0f && t1 == 1.0f;
+        check(ok, "clipSegment: potong, lewat di samping, vertikal, seluruhnya di dalam");
+    }
+
+    // ===== Bresenham dengan lompatan ke clip = loop penuh =====
+    {
+        const int width = 320, height = 240;
+        std::vector<Pixel> fast(width * height, 0), ref(width * height, 0);
+        z::Raster raster(z::Surface(fast.data(), width, height, width));
+        bool same = true;
+        for (int i = 0; i < 20000 && same; i++) {
+            Rect<int> clip(rnd(width), rnd(height), 1 + rnd(width), 1 + rnd(height));
+            clip = clip.intersect(Rect<int>(0, 0, width, height));
+            raster.setClip(clip);
+            // Sebagian besar garis jauh di luar layar, sebagian pendek
+            int range = i % 3 == 0 ? 400 : 60000;
+            int x0 = rnd(range) - range / 2 + width / 2, y0 = rnd(range) - range / 2 + height / 2;
+            int x1 = rnd(range) - range / 2 + width / 2, y1 = rnd(range) - range / 2 + height / 2;
+            if (i % 7 == 0) y1 = y0;
+            if (i % 11 == 0) x1 = x0;
+            Pixel color = static_cast<Pixel>(i + 1);
+            raster.line(x0, y0, x1, y1, color, 1);
+            referenceLine(ref, width, raster.clip(), x0, y0, x1, y1, color);
+            same = fast == ref;
+        }
+        check(same, "Raster::line melompat ke clip, pixel identik dengan Bresenham penuh");
+    }
+
+    // ===== Canvas: pushClip / popClip =====
+    z::Window window("Clip Test", 200, 150);
+    z::Canvas a(window.handle());
+    z::Canvas b(window.handle());
+    const Pixel black = z::makePixel(0, 0, 0);
+
+    {
+        a.clear();
+        a.pushClip(Rect<int>(20, 10, 100, 80));
+        a.pushClip(Rect<int>(60, 40, 200, 200));        // iris: (60, 40) - (120, 90)
+        bool nested = a.getClip() == Rect<int>(60, 40, 60, 50);
+        a.fillRect(Rect<int>(0, 0, 200, 150), RGB(255, 0, 0));
+        a.popClip();
+        bool popped = a.getClip() == Rect<int>(20, 10, 100, 80);
+        a.popClip();
+        a.popClip();        // tanpa push: diabaikan
+        bool full = a.getClip() == Rect<int>(0, 0, 200, 150);
+
+        b.clear();
+        b.fillRect(Rect<int>(60, 40, 60, 50), RGB(255, 0, 0));
+        check(nested && popped && full && sameInside(a.surface(), b.surface(), Rect<int>(0, 0, 200, 150), black), "pushClip mengiris, popClip mengembalikan");
+    }
+
+    // Semua primitive yang terpotong sama dengan versi tanpa clip di dalam area clip
+    {
+        Rect<int> clip(35, 25, 90, 70);
+        auto scene = [](z::Canvas& canvas) {
+            canvas.fillRect(Rect<int>(10, 10, 80, 50), RGB(200, 10, 10), RGB(255, 255, 255), 3);
+            canvas.drawLine(Vec2<int>(-500, -300), Vec2<int>(700, 400), RGB(10, 200, 10));
+            canvas.drawLine(Vec2<int>(0, 140), Vec2<int>(190, 0), RGB(10, 200, 200), 5);
+            canvas.fillCircle(Vec2<int>(110, 80), 30, RGB(10, 10, 200), RGB(255, 255, 0), 2);
+            Vec2<int> poly[5] = { Vec2<int>(40, 100), Vec2<int>(150, 20), Vec2<int>(190, 130), Vec2<int>(90, 60), Vec2<int>(20, 140) };
+            canvas.drawPolygon(poly, 5, RGB(255, 0, 255), 1);
+            Vec2<float> tris[6] = { Vec2<float>(30, 30), Vec2<float>(130, 40), Vec2<float>(60, 120),
+                                    Vec2<float>(300, 300), Vec2<float>(310, 300), Vec2<float>(300, 310) };
+            canvas.drawTriangles(tris, 6, RGB(128, 128, 128));
+            for (int i = 0; i < 200; i += 3)
+                canvas.drawPixel(i, i / 2, RGB(255, 255, 255));
+        };
+        a.clear();
+        a.pushClip(clip);
+        scene(a);
+        a.popClip();
+        b.clear();
+        scene(b);
+        check(sameInside(a.surface(), b.surface(), clip, black), "line, rect, ellipse, polygon, segitiga, pixel terpotong tepat di clip");
+
+        // clear() juga mengikuti clip
+        a.clear(RGB(0, 0, 0));
+        a.pushClip(clip);
+        a.clear(RGB(9, 9, 9));
+        a.popClip();
+        b.clear(RGB(0, 0, 0));
+        b.fillRect(clip, RGB(9, 9, 9));
+        check(sameInside(a.surface(), b.surface(), Rect<int>(0, 0, 200, 150), black), "clear() hanya mengisi clip");
+    }
+
+    // ===== Penolakan dan statistik per frame =====
+    {
+        a.present();
+        a.clear();
+        a.pushClip(Rect<int>(50, 50, 50, 50));
+        a.fillRect(Rect<int>(0, 0, 20, 20), RGB(255, 0, 0));              // ditolak
+        a.fillRect(Rect<int>(60, 60, 10, 10), RGB(255, 0, 0));            // terlihat
+        a.drawLine(Vec2<int>(0, 90), Vec2<int>(90, 0), RGB(0, 255, 0));   // box kena, garis lewat di samping
+        a.fillCircle(Vec2<int>(-100, 75), 20, RGB(0, 0, 255));            // ditolak
+        a.drawPixel(75, 75, RGB(1, 1, 1));                                // terlihat
+        a.drawPixel(10, 75, RGB(1, 1, 1));                                // ditolak
+        Vec2<int> far[3] = { Vec2<int>(500, 500), Vec2<int>(600, 500), Vec2<int>(550, 600) };
+        a.fillPolygon(far, 3, RGB(1, 2, 3));                              // ditolak
+        z::DrawList list;
+        list.fillRect(70, 70, 5, 5, RGB(4, 5, 6));                        // terlihat
+        list.drawLine(0, 0, 40, 0, RGB(4, 5, 6));                          // ditolak
+        a.draw(list);
+        a.popClip();
+        z::CanvasStats frame = a.frameStats();
+        bool counted = frame.primitives == 9 && frame.rejected == 6;
+        a.present();
+        bool rolled = a.lastFrameStats().rejected == 6 && a.frameStats().primitives == 0;
+        check(counted && rolled, "primitive di luar clip ditolak dan dihitung per frame");
+    }
+
+    // Clip lewat transform: rect di koordinat canvas
+    {
+        a.clear();
+        a.pushTransform();
+        a.translate(30.0f, 20.0f);
+        a.scale(2.0f);
+        a.pushClip(Rect<int>(0, 0, 10, 10));
+        bool mapped = a.getClip() == Rect<int>(30, 20, 20, 20);
+        a.popClip();
+        a.popTransform();
+        check(mapped, "pushClip memakai transform sekarang");
+    }
+
+    // ===== Benchmark =====
+    const int repeat = 20;
+    z::Timer timer(z::TimerMode::Precise);
+    printf("Benchmark (ms per pass)\n");
+
+    // 2000 garis panjang yang hanya sedikit melewati layar
+    {
+        const int count = 2000;
+        std::vector<Vec2<int>> ends(count * 2);
+        for (int i = 0; i < count; i++) {
+            ends[i * 2] = Vec2<int>(-20000 + rnd(1000), rnd(150));
+            ends[i * 2 + 1] = Vec2<int>(20000 + rnd(1000), rnd(150));
+        }
+        std::vector<Pixel> ref(200 * 150, 0);
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            for (int i = 0; i < count; i++)
+                referenceLine(ref, 200, Rect<int>(0, 0, 200, 150), ends[i * 2].x, ends[i * 2].y, ends[i * 2 + 1].x, ends[i * 2 + 1].y, 1);
+        timer.tick();
+        double fullMs = timer.deltaTime() * 1000.0 / repeat;
+
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            for (int i = 0; i < count; i++)
+                a.drawLine(ends[i * 2], ends[i * 2 + 1], RGB(255, 255, 255));
+        timer.tick();
+        double clippedMs = timer.deltaTime() * 1000.0 / repeat;
+        printf("  %d garis 40000 px: Bresenham penuh %8.3f ms | dipotong ke clip %8.3f ms (%6.1fx)\n", count, fullMs, clippedMs, fullMs / clippedMs);
+    }
+
+    // 100k primitive di luar clip: ditolak sebelum backend
+    {
+        const int count = 100000;
+        a.present();
+        a.pushClip(Rect<int>(0, 0, 50, 50));
+        timer.tick();
+        for (int i = 0; i < count; i++)
+            a.fillCircle(Vec2<int>(100 + i % 90, 100 + i % 40), 8, RGB(255, 0, 0));
+        timer.tick();
+        double rejectMs = timer.deltaTime() * 1000.0;
+        a.popClip();
+        timer.tick();
+        for (int i = 0; i < count; i++)
+            a.fillCircle(Vec2<int>(100 + i % 90, 100 + i % 40), 8, RGB(255, 0, 0));
+        timer.tick();
+        double drawMs = timer.deltaTime() * 1000.0;
+        printf("  %d fillCircle: ditolak clip %8.3f ms | digambar %8.3f ms (rejected %zu)\n", count, rejectMs, drawMs, a.frameStats().rejected);
+    }
+
+    return finishChecks();
+}
@@ -0,0 +1,172 @@
+#include <cstdio>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_surface_pool.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+static z::Event plainEvent(z::EventType type) {
+    z::Event event;
+    event.type = type;
+    return event;
+}
+
+int main() {
+    printf("SurfacePool\n");
+
+    // ===== Kebijakan: drag memperbesar window 5 px per langkah =====
+    {
+        z::SurfacePool pool;
+        int allocs = 0;
+        allocs += pool.resize(Vec2<int>(800, 600), 0.0);
+        for (int i = 1; i <= 120; i++)
+            allocs += pool.resize(Vec2<int>(800 + i * 5, 600 + i * 3), 0.01 * i);
+        bool fewer = allocs == static_cast<int>(pool.stats().reallocations) && allocs <= 4 && pool.capacity().x >= 1400 && pool.capacity().x % 128 == 0;
+        printf("  drag tanpa interactive: %d alokasi untuk 121 resize, kapasitas %dx%d\n", allocs, pool.capacity().x, pool.capacity().y);
+        check(fewer, "tumbuh per size class dengan headroom, sisanya dipakai ulang");
+
+        // Interactive: tidak ada alokasi selama drag, satu alokasi saat selesai
+        z::SurfacePool drag;
+        drag.resize(Vec2<int>(800, 600), 0.0);
+        drag.beginInteractive();
+        int during = 0;
+        for (int i = 1; i <= 120; i++)
+            during += drag.resize(Vec2<int>(800 + i * 10, 600 + i * 6), 0.01 * i);
+        bool clipped = drag.size().x <= drag.capacity().x && drag.size() != drag.requested();
+        bool ended = drag.endInteractive(2.0) && drag.size() == Vec2<int>(2000, 1320) && drag.stats().reallocations == 2;
+        check(during == 0 && clipped && ended && drag.stats().deferred > 0, "interactive resize: alokasi ditunda sampai selesai");
+
+        // Shrink hanya setelah tetap kecil selama shrinkDelay
+        z::SurfacePool shrink;
+        shrink.resize(Vec2<int>(1600, 1200), 0.0);
+        shrink.resize(Vec2<int>(400, 300), 10.0);
+        bool early = !shrink.update(11.0);
+        shrink.resize(Vec2<int>(1500, 1100), 11.5);         // membesar lagi: timer batal
+        shrink.resize(Vec2<int>(400, 300), 12.0);
+        bool restarted = !shrink.update(13.9);
+        bool late = shrink.update(14.1) && shrink.capacity().x < 1600 && shrink.stats().shrinks == 1;
+        bool noRepeat = !shrink.update(20.0);
+        check(early && restarted && late && noRepeat, "shrink setelah shrinkDelay, batal kalau membesar lagi");
+    }
+
+    // ===== Canvas =====
+    z::Window window("Pool Test", 320, 200);
+    z::Canvas canvas(window.handle());
+    {
+        canvas.clear();
+        canvas.fillRect(Rect<int>(10, 10, 20, 20), RGB(255, 0, 0));
+        z::Pixel red = canvas.surface().at(15, 15);
+
+        window.setSize(Vec2<int>(330, 210));
+        canvas.resize();
+        z::Surface s = canvas.surface();
+        bool reused = s.width == 330 && s.height == 210 && s.stride >= 330 && canvas.surfaceStats().reallocations == 1;
+        bool kept = s.at(15, 15) == red;
+
+        window.setSize(Vec2<int>(900, 700));
+        canvas.resize();
+        s = canvas.surface();
+        bool grown = s.width == 900 && s.stride >= 900 && canvas.surfaceStats().reallocations == 2 && s.at(15, 15) == red;
+        canvas.fillRect(Rect<int>(0, 0, 900, 700), RGB(0, 0, 255));
+        bool drawn = s.at(899, 699) == z::makePixel(0, 0, 255);
+        check(reused && kept && grown && drawn, "resize muat: storage dipakai ulang, isi frame dipertahankan");
+    }
+
+    // Interactive lewat event ResizeBegin / ResizeEnd
+    {
+        z::Event ev;
+        while (window.pollEvent(ev)) {}     // Resize dari setSize() di atas sudah ditangani
+        window.postEvent(plainEvent(z::EventType::ResizeBegin));
+        window.postEvent(z::createResizeEvent(Vec2<int>(1500, 1000)));
+        window.postEvent(z::createResizeEvent(Vec2<int>(1600, 1100)));
+        window.postEvent(plainEvent(z::EventType::ResizeEnd));
+        window.processMessages();
+        size_t before = canvas.surfaceStats().reallocations;
+        bool clippedDuring = false;
+        while (window.pollEvent(ev)) {
+            switch (ev.type) {
+                case z::EventType::ResizeBegin:
+                    canvas.beginInteractiveResize();
+                    break;
+                case z::EventType::Resize:
+                    canvas.resize();
+                    clippedDuring = canvas.surfaceStats().reallocations == before && canvas.surface().width < 1600;
+                    break;
+                case z::EventType::ResizeEnd:
+                    canvas.endInteractiveResize();
+                    break;
+                default:
+                    break;
+            }
+        }
+        bool after = canvas.surface().width == 1600 && canvas.surface().height == 1100 && canvas.surfaceStats().reallocations == before + 1;
+        canvas.fillRect(Rect<int>(0, 0, 1600, 1100), RGB(1, 2, 3));
+        check(clippedDuring && after && canvas.getClip() == Rect<int>(0, 0, 1600, 1100), "ResizeBegin / ResizeEnd menunda alokasi");
+    }
+
+    // Shrink lewat present() setelah delay
+    {
+        z::SurfacePoolConfig config;
+        config.shrinkDelay = 0.0;
+        canvas.setSurfacePoolConfig(config);
+        window.setSize(Vec2<int>(200, 100));
+        canvas.resize();
+        size_t peak = canvas.surfaceStats().peakBytes;
+        canvas.present();
+        z::SurfacePoolStats stats = canvas.surfaceStats();
+        bool shrunk = stats.shrinks == 1 && stats.bytes < peak && canvas.surface().stride < 1600 && canvas.surface().width == 200;
+        bool presented = window.handle()->frontBuffer().width == 200;
+        printf("  peak %zu KB, setelah shrink %zu KB\n", stats.peakBytes / 1024, stats.bytes / 1024);
+        check(shrunk && presented, "present() mengecilkan storage setelah shrinkDelay");
+    }
+
+    // ===== Benchmark: drag 300 langkah =====
+    {
+        const int steps = 300;
+        z::Timer timer(z::TimerMode::Precise);
+
+        // Cara lama: buffer baru seukuran client di setiap WM_SIZE
+        std::vector<z::Pixel> exact;
+        size_t exactPeak = 0;
+        timer.tick();
+        for (int i = 0; i < steps; i++) {
+            Vec2<int> size(640 + i * 4, 480 + i * 2);
+            std::vector<z::Pixel> fresh(static_cast<size_t>(size.x) * size.y, z::makePixel(0, 0, 0));
+            exact.swap(fresh);
+            exactPeak = std::max(exactPeak, exact.size() * sizeof(z::Pixel));
+        }
+        timer.tick();
+        double exactMs = timer.deltaTime() * 1000.0;
+
+        z::Window dragWindow("Drag", 640, 480);
+        z::Canvas dragCanvas(dragWindow.handle());
+        size_t start = dragCanvas.surfaceStats().reallocations;
+        timer.tick();
+        for (int i = 0; i < steps; i++) {
+            dragWindow.setSize(Vec2<int>(640 + i * 4, 480 + i * 2));
+            dragCanvas.resize();
+        }
+        timer.tick();
+        double pooledMs = timer.deltaTime() * 1000.0;
+        size_t pooledPeak = dragCanvas.surfaceStats().peakBytes;
+
+        dragCanvas.beginInteractiveResize();
+        size_t interactiveStart = dragCanvas.surfaceStats().reallocations;
+        timer.tick();
+        for (int i = steps; i < steps * 2; i++) {
+            dragWindow.setSize(Vec2<int>(640 + i * 4, 480 + i * 2));
+            dragCanvas.resize();
+        }
+        dragCanvas.endInteractiveResize();
+        timer.tick();
+        double interactiveMs = timer.deltaTime() * 1000.0;
+
+        printf("Benchmark drag %d langkah\n", steps);
+        printf("  alokasi tepat per resize   %8.3f ms | %3d alokasi | peak %6zu KB\n", exactMs, steps, exactPeak / 1024);
+        printf("  SurfacePool                %8.3f ms | %3zu alokasi | peak %6zu KB\n", pooledMs, dragCanvas.surfaceStats().reallocations - start, pooledPeak / 1024);
+        printf("  SurfacePool interactive    %8.3f ms | %3zu alokasi\n", interactiveMs, dragCanvas.surfaceStats().reallocations - interactiveStart);
+    }
+
+    return finishChecks();
+}
@@ -0,0 +1,213 @@
+#include <cstdio>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_image.h"
+#include "../include/z_atlas.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+// Source-over dengan float: hasil kernel harus dalam 1 level per channel
+static bool nearBlend(Pixel src, Pixel dst, Pixel out) {
+    float a = (src >> 24) / 255.0f;
+    for (int shift = 0; shift < 32; shift += 8) {
+        float s = shift == 24 ? 255.0f : static_cast<float>((src >> shift) & 0xFF);
+        float d = static_cast<float>((dst >> shift) & 0xFF);
+        float expect = s * a + d * (1.0f - a);
+        float got = static_cast<float>((out >> shift) & 0xFF);
+        if (got < expect - 1.0f || got > expect + 1.0f) return false;
+    }
+    return true;
+}
+
+static z::Image randomImage(int width, int height, bool mixedAlpha) {
+    z::Image image(width, height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++) {
+            Pixel p = rnd();
+            if (mixedAlpha) {
+                int kind = rnd(4);      // transparan, opaque, dan campuran
+                if (kind == 0) p &= 0x00FFFFFFu;
+                else if (kind == 1) p |= 0xFF000000u;
+            }
+            image.at(x, y) = p;
+        }
+    return image;
+}
+
+int main() {
+    seedRandom(41);
+    printf("Image\n");
+
+    // ===== Kernel: SIMD = skalar, semua panjang (ekor) =====
+    {
+        bool same = true, near = true;
+        const Pixel key = z::makePixel(255, 0, 255);
+        for (int n = 0; n < 70 && same; n++) {
+            std::vector<Pixel> src(n), dst(n);
+            for (int i = 0; i < n; i++) {
+                src[i] = rnd();
+                int kind = rnd(4);
+                if (kind == 0) src[i] &= 0x00FFFFFFu;
+                else if (kind == 1) src[i] |= 0xFF000000u;
+                else if (kind == 2) src[i] = (src[i] & 0xFF000000u) | (key & 0x00FFFFFFu);
+                dst[i] = rnd();
+            }
+            std::vector<Pixel> blended = dst, keyed = dst, copied = dst;
+            z::blitAlpha(src.data(), blended.data(), n);
+            z::blitColorKey(src.data(), keyed.data(), n, key);
+            z::blitOpaque(src.data(), copied.data(), n);
+            for (int i = 0; i < n; i++) {
+                same = same && blended[i] == z::blendPixel(src[i], dst[i]);
+                near = near && nearBlend(src[i], dst[i], blended[i]);
+                same = same && keyed[i] == ((src[i] & 0x00FFFFFFu) == (key & 0x00FFFFFFu) ? dst[i] : src[i]);
+                same = same && copied[i] == src[i];
+            }
+        }
+        check(same, "blitAlpha / blitColorKey / blitOpaque: SIMD identik dengan skalar");
+        check(near, "blitAlpha: source-over dalam 1 level dari float");
+
+        Pixel d = z::makePixel(10, 20, 30, 200);
+        bool ends = z::blendPixel(z::makePixel(1, 2, 3, 0), d) == d && z::blendPixel(z::makePixel(1, 2, 3, 255), d) == z::makePixel(1, 2, 3, 255);
+        bool alpha = (z::blendPixel(z::makePixel(0, 0, 0, 128), z::makePixel(0, 0, 0, 255)) >> 24) == 255;
+        check(ends && alpha, "alpha 0 / 255 tepat, alpha hasil tetap opaque di atas buffer opaque");
+    }
+
+    // ===== Canvas: drawImage terpotong, transform, clip =====
+    z::Window window("Image Test", 200, 150);
+    z::Canvas canvas(window.handle());
+    const Pixel black = z::makePixel(0, 0, 0);
+    {
+        z::Image image = randomImage(40, 30, true);
+        image.setBlendMode(z::BlendMode::Opaque);
+        canvas.clear();
+        canvas.drawImage(image, -10, 130);      // terpotong kiri dan bawah
+        z::Surface s = canvas.surface();
+        bool same = true;
+        for (int y = 0; y < 150; y++)
+            for (int x = 0; x < 200; x++) {
+                int ix = x + 10, iy = y - 130;
+                bool inside = ix >= 0 && ix < 40 && iy >= 0 && iy < 30;
+                same = same && s.at(x, y) == (inside ? image.at(ix, iy) : black);
+            }
+        check(same, "drawImage opaque terpotong di tepi canvas");
+
+        // Translate + clip + sub image
+        canvas.clear();
+        canvas.pushTransform();
+        canvas.translate(50.0f, 40.0f);
+        canvas.pushClip(Rect<int>(0, 0, 15, 100));
+        canvas.drawSubImage(image, Rect<int>(5, 5, 30, 20), Vec2<int>(0, 0));
+        canvas.popClip();
+        canvas.popTransform();
+        s = canvas.surface();
+        same = true;
+        for (int y = 0; y < 150; y++)
+            for (int x = 0; x < 200; x++) {
+                bool inside = x >= 50 && x < 65 && y >= 40 && y < 60;
+                same = same && s.at(x, y) == (inside ? image.at(x - 45, y - 35) : black);
+            }
+        check(same, "drawSubImage lewat translate dan pushClip");
+
+        // Color key dan alpha lewat Canvas = kernel
+        z::Image keyed = randomImage(33, 17, false);
+        keyed.setColorKey(z::PackedColor(255, 0, 255));
+        for (int i = 0; i < 100; i++)
+            keyed.at(rnd(33), rnd(17)) = z::makePixel(255, 0, 255, static_cast<uint8_t>(rnd(256)));
+        canvas.clear(RGB(7, 8, 9));
+        canvas.drawImage(keyed, 3, 4);
+        s = canvas.surface();
+        same = true;
+        for (int y = 0; y < 17; y++)
+            for (int x = 0; x < 33; x++) {
+                Pixel p = keyed.at(x, y);
+                same = same && s.at(x + 3, y + 4) == ((p & 0x00FFFFFFu) == 0x00FF00FFu ? z::makePixel(7, 8, 9) : p);
+            }
+        z::Image glass = randomImage(21, 13, true);
+        canvas.drawImage(glass, 100, 100);
+        bool blended = true;
+        for (int y = 0; y < 13; y++)
+            for (int x = 0; x < 21; x++)
+                blended = blended && s.at(x + 100, y + 100) == z::blendPixel(glass.at(x, y), z::makePixel(7, 8, 9));
+        check(same && blended, "drawImage color key dan alpha blend");
+
+        canvas.present();
+        canvas.drawImage(image, 500, 10);
+        z::Sprite sprites[2] = { { Rect<int>(0, 0, 8, 8), Vec2<int>(10, 10) }, { Rect<int>(0, 0, 8, 8), Vec2<int>(-20, 10) } };
+        canvas.drawSprites(image, sprites, 2);
+        check(canvas.frameStats().primitives == 3 && canvas.frameStats().rejected == 2, "image di luar clip ditolak dan dihitung");
+    }
+
+    // ===== Skyline packer / TextureAtlas =====
+    {
+        z::TextureAtlas atlas(256, 256, 1);
+        std::vector<z::Image> images;
+        std::vector<Rect<int>> regions;
+        for (;;) {
+            z::Image image = randomImage(4 + rnd(28), 4 + rnd(28), true);
+            Rect<int> region = atlas.add(image);
+            if (region.empty()) break;
+            images.push_back(image);
+            regions.push_back(region);
+        }
+        bool inside = true, disjoint = true, content = true;
+        for (size_t i = 0; i < regions.size(); i++) {
+            inside = inside && atlas.image().bounds().intersect(regions[i]) == regions[i];
+            for (size_t j = 0; j < i; j++)
+                disjoint = disjoint && !regions[i].overlaps(regions[j]);
+            for (int y = 0; y < regions[i].h; y++)
+                for (int x = 0; x < regions[i].w; x++)
+                    content = content && atlas.image().at(regions[i].x + x, regions[i].y + y) == images[i].at(x, y);
+        }
+        printf("  %zu image dalam atlas 256x256, occupancy %.1f%%\n", atlas.count(), atlas.occupancy() * 100.0);
+        check(atlas.count() == regions.size() && atlas.count() > 60 && atlas.occupancy() > 0.7, "skyline packer cukup rapat");
+        check(inside && disjoint && content, "region di dalam atlas, tidak tumpang tindih, isi tersalin");
+
+        z::SkylinePacker packer(100, 100);
+        Vec2<int> p;
+        bool exact = packer.pack(50, 100, p) && p == Vec2<int>(0, 0) && packer.pack(50, 100, p) && p == Vec2<int>(50, 0) && !packer.pack(1, 1, p) && packer.occupancy() == 1.0;
+        atlas.clear();
+        check(exact && atlas.count() == 0 && !atlas.add(images[0]).empty(), "packer penuh tepat, clear() mengosongkan atlas");
+    }
+
+    // ===== Benchmark: sprite per detik =====
+    {
+        z::Window benchWindow("Sprites", 1280, 720);
+        z::Canvas bench(benchWindow.handle());
+        z::Timer timer(z::TimerMode::Precise);
+        printf("Benchmark sprite per detik (1280x720)\n");
+        const int sizes[3] = { 16, 64, 256 };
+        const z::BlendMode modes[3] = { z::BlendMode::Opaque, z::BlendMode::ColorKey, z::BlendMode::Alpha };
+        const char* names[3] = { "opaque", "color key", "alpha" };
+        for (int size : sizes) {
+            // Semua sprite satu ukuran diambil dari satu atlas
+            z::TextureAtlas atlas(1024, 1024, 1);
+            z::Image frame = randomImage(size, size, true);
+            std::vector<Rect<int>> regions;
+            for (int i = 0; i < 16; i++) {
+                Rect<int> region = atlas.add(frame);
+                if (region.empty()) break;
+                regions.push_back(region);
+            }
+            const int count = size == 256 ? 200 : size == 64 ? 2000 : 20000;
+            std::vector<z::Sprite> sprites(count);
+            for (int i = 0; i < count; i++)
+                sprites[i] = z::Sprite{ regions[i % regions.size()], Vec2<int>(rnd(1280 - size), rnd(720 - size)) };
+            for (int m = 0; m < 3; m++) {
+                atlas.image().setColorKey(z::PackedColor(255, 0, 255));
+                atlas.image().setBlendMode(modes[m]);
+                bench.drawSprites(atlas.image(), sprites.data(), count);       // warm up
+                timer.tick();
+                bench.drawSprites(atlas.image(), sprites.data(), count);
+                timer.tick();
+                double seconds = timer.deltaTime();
+                printf("  %3dx%-3d %-9s %8.3f ms per %5d | %10.0f sprite/s | %7.1f Mpixel/s\n", size, size, names[m], seconds * 1000.0, count,
+                       count / seconds, static_cast<double>(count) * size * size / seconds / 1e6);
+            }
+        }
+    }
+
+    return finishChecks();
+}
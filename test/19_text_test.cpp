@@ -0,0 +1,195 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_font.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+// Bit font bawaan untuk karakter c di (x, y) dengan pembesaran scale
+static bool bitAt(char c, int x, int y, int scale) {
+    return (z::detail::builtinFont8x8[c - 0x20][y / scale] >> (x / scale)) & 1;
+}
+
+int main() {
+    seedRandom(7);
+    printf("Text\n");
+
+    // ===== Font dan atlas glyph =====
+    {
+        const z::Font& font = z::Font::builtin();
+        bool glyphs = true;
+        for (char c = 0x20; c <= 0x7E; c++) {
+            const z::Glyph& g = font.glyph(static_cast<unsigned char>(c));
+            glyphs = glyphs && g.region.w == 8 && g.region.h == 8 && g.advance == 8;
+            for (int y = 0; y < 8; y++)
+                for (int x = 0; x < 8; x++)
+                    glyphs = glyphs && ((font.atlas().at(g.region.x + x, g.region.y + y) >> 24) == 255) == bitAt(c, x, y, 1);
+        }
+        check(glyphs, "95 glyph ASCII di atlas sesuai bitmap");
+
+        z::Font big(3);
+        const z::Glyph& g = big.glyph('R');
+        bool scaled = g.region.w == 24 && big.lineHeight() == 24;
+        for (int y = 0; y < 24; y++)
+            for (int x = 0; x < 24; x++)
+                scaled = scaled && ((big.atlas().at(g.region.x + x, g.region.y + y) >> 24) == 255) == bitAt('R', x, y, 3);
+        check(scaled, "Font(3): glyph diperbesar tiga kali");
+
+        bool measured = font.measure("abc") == Vec2<int>(24, 8) && font.measure("ab\ncdef") == Vec2<int>(32, 16) &&
+                        font.measure("") == Vec2<int>() && font.measure("a\tb") == Vec2<int>(48, 8) &&
+                        font.measure("caf\xC3\xA9") == Vec2<int>(32, 8) && font.measure("x\n") == Vec2<int>(8, 16);
+        bool fallback = &font.glyph(0xE9) == &font.glyph('?') && &font.glyph('\r') == &font.glyph('?');
+        check(measured && fallback, "measure: baris, tab, UTF-8, karakter tak dikenal jadi '?'");
+    }
+
+    // ===== blitCoverage: SIMD = skalar =====
+    {
+        bool same = true;
+        for (int n = 0; n < 40; n++) {
+            std::vector<Pixel> src(n), dst(n), ref(n);
+            for (int i = 0; i < n; i++) {
+                src[i] = rnd();
+                if (i % 3 == 0) src[i] &= 0x00FFFFFFu;
+                dst[i] = ref[i] = rnd();
+            }
+            Pixel color = rnd();
+            z::blitCoverage(src.data(), dst.data(), n, color);
+            for (int i = 0; i < n; i++) {
+                unsigned x = (src[i] >> 24) * (color >> 24) + 128;
+                Pixel tinted = (color & 0x00FFFFFFu) | (((x + (x >> 8)) >> 8) << 24);
+                same = same && dst[i] == z::blendPixel(tinted, ref[i]);
+            }
+        }
+        check(same, "blitCoverage identik dengan blendPixel per pixel");
+    }
+
+    // ===== Canvas::drawText =====
+    z::Window window("Text Test", 200, 100);
+    z::Canvas canvas(window.handle());
+    {
+        canvas.clear();
+        canvas.drawText(Vec2<int>(5, 7), "Hi!\nz_", RGB(255, 200, 0));
+        z::Surface s = canvas.surface();
+        const char* lines[2] = { "Hi!", "z_" };
+        bool exact = true;
+        for (int y = 0; y < 100; y++)
+            for (int x = 0; x < 200; x++) {
+                int lx = x - 5, ly = y - 7;
+                bool on = false;
+                if (lx >= 0 && ly >= 0 && ly < 16) {
+                    const char* line = lines[ly / 8];
+                    int column = lx / 8;
+                    on = column < static_cast<int>(std::string(line).size()) && bitAt(line[column], lx % 8, ly % 8, 1);
+                }
+                exact = exact && s.at(x, y) == (on ? z::makePixel(255, 200, 0) : z::makePixel(0, 0, 0));
+            }
+        check(exact, "drawText dua baris: pixel tepat sesuai glyph");
+
+        // Alpha warna teks dan transform posisi
+        canvas.clear(RGB(0, 0, 200));
+        canvas.pushTransform();
+        canvas.translate(40.0f, 30.0f);
+        canvas.drawText(Vec2<int>(0, 0), "#", z::PackedColor(255, 255, 255, 128));
+        canvas.popTransform();
+        Pixel expect = z::blendPixel(z::makePixel(255, 255, 255, 128), z::makePixel(0, 0, 200));
+        bool blended = canvas.surface().at(40 + 1, 30 + 0) == expect && canvas.surface().at(40, 30) == z::makePixel(0, 0, 200);
+        check(blended && bitAt('#', 1, 0, 1) && !bitAt('#', 0, 0, 1), "alpha warna teks di-blend, posisi lewat transform");
+
+        // Cache label: teks sama tidak dirender ulang
+        z::TextCacheStats before = canvas.textCacheStats();
+        for (int i = 0; i < 100; i++)
+            canvas.drawText(10, 10, "static label");
+        z::TextCacheStats after = canvas.textCacheStats();
+        bool cached = after.misses - before.misses == 1 && after.hits - before.hits == 99;
+
+        canvas.present();
+        canvas.drawText(Vec2<int>(500, 10), "offscreen");
+        canvas.drawText(Vec2<int>(10, 10), "");
+        bool rejected = canvas.frameStats().primitives == 1 && canvas.frameStats().rejected == 1;
+        check(cached && rejected, "label statis satu kali render, teks di luar clip ditolak");
+
+        z::Font big(2);
+        canvas.setFont(big);
+        canvas.drawText(Vec2<int>(0, 0), "static label");
+        bool refont = canvas.measureText("ab") == Vec2<int>(32, 16) && canvas.textCacheStats().misses == after.misses + 2;
+        canvas.setFont(z::Font::builtin());
+        check(refont, "setFont: ukuran baru, label dirender ulang");
+    }
+
+    // TextCache dua generasi
+    {
+        z::TextCache cache(4);
+        const z::Font& font = z::Font::builtin();
+        std::string names[10];
+        for (int i = 0; i < 10; i++) {
+            names[i] = "label " + std::to_string(i);
+            cache.get(font, names[i]);
+        }
+        size_t misses = cache.stats().misses;
+        const z::Image& label = cache.get(font, names[9]);
+        cache.get(font, names[7]);
+        bool recent = cache.stats().misses == misses && label.width() == 56;
+        cache.get(font, names[0]);
+        bool bounded = cache.stats().misses == misses + 1 && cache.stats().entries <= 8;
+        check(recent && bounded, "TextCache: label terbaru tetap ada, jumlah entri terbatas");
+    }
+
+    // ===== Benchmark: 1000 label per frame =====
+    {
+        z::Window benchWindow("Text", 1280, 720);
+        z::Canvas bench(benchWindow.handle());
+        const z::Font& font = z::Font::builtin();
+        const int count = 1000, repeat = 20;
+        std::vector<std::string> labels(count);
+        std::vector<Vec2<int>> positions(count);
+        for (int i = 0; i < count; i++) {
+            labels[i] = "Label #" + std::to_string(i % 50) + " value";
+            positions[i] = Vec2<int>(static_cast<int>(rnd() % 1100), static_cast<int>(rnd() % 700));
+        }
+        z::Timer timer(z::TimerMode::Precise);
+        printf("Benchmark %d label per frame (ms per frame)\n", count);
+
+        // Per glyph: satu blit dari atlas untuk setiap karakter
+        z::Surface target = bench.surface();
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            for (int i = 0; i < count; i++) {
+                Vec2<int> pen = positions[i];
+                for (char c : labels[i]) {
+                    const z::Glyph& g = font.glyph(static_cast<unsigned char>(c));
+                    z::blitTinted(target, bench.getClip(), font.atlas(), g.region, pen, z::makePixel(255, 255, 255));
+                    pen.x += g.advance;
+                }
+            }
+        timer.tick();
+        double glyphMs = timer.deltaTime() * 1000.0 / repeat;
+
+        // Tanpa cache: layout + render setiap kali
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            for (int i = 0; i < count; i++) {
+                z::Image label = font.render(labels[i]);
+                z::blitTinted(target, bench.getClip(), label, label.bounds(), positions[i], z::makePixel(255, 255, 255));
+            }
+        timer.tick();
+        double renderMs = timer.deltaTime() * 1000.0 / repeat;
+
+        timer.tick();
+        for (int r = 0; r < repeat; r++)
+            for (int i = 0; i < count; i++)
+                bench.drawText(positions[i], labels[i]);
+        timer.tick();
+        double cachedMs = timer.deltaTime() * 1000.0 / repeat;
+
+        printf("  blit per glyph           %8.3f ms\n", glyphMs);
+        printf("  render tanpa cache       %8.3f ms\n", renderMs);
+        printf("  drawText (TextCache)     %8.3f ms (%5.1fx) | hits %zu misses %zu\n", cachedMs, renderMs / cachedMs,
+               bench.textCacheStats().hits, bench.textCacheStats().misses);
+    }
+
+    return finishChecks();
+}
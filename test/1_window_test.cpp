@@ -1,7 +1,7 @@
-#include <windows.h>
 #include <iostream>
 #include <vector>
 #include <cmath>
+#include <cstdlib>
 
 // Include semua header z framework
 #include "../include/z_window.h"
@@ -73,6 +73,15 @@ int main() {
         std::cout << "- Click and drag to create particles" << std::endl;
         std::cout << "- ESC to exit" << std::endl;
         std::cout << "- SPACE to clear particles" << std::endl;
+
+#if Z_PLATFORM_HEADLESS
+        // CI/benchmark: input sintetis, N frame tanpa throttle lalu keluar
+        const int benchFrames = 600;
+        int benchFrame = 0;
+        Timer benchTimer(TimerMode::Precise);
+        window.postEvent(createMouseEvent(EventType::MouseMove, Vec2<int>(400, 300), MouseButton::Unknown));
+        window.postEvent(createMouseEvent(EventType::MouseDown, Vec2<int>(400, 300), MouseButton::Left));
+#endif
         
         // Main loop
         while (!window.shouldClose()) {
@@ -119,6 +128,17 @@ int main() {
                         canvas.resize();
                         windowSize = event.getResizeSize();
                         break;
+
+                    case EventType::ResizeBegin:
+                        canvas.beginInteractiveResize();
+                        break;
+
+                    case EventType::ResizeEnd:
+                        canvas.endInteractiveResize();
+                        break;
+
+                    default:
+                        break;
                 }
             }
             
@@ -190,10 +210,6 @@ int main() {
             };
             canvas.fillPolygon(trianglePoints, 3, RGB(255, 255, 0));
             
-            // Draw info text using basic pixel drawing (since no text API in headers)
-            // This is a simple way to show some info
-            // Color<unsigned char> infoColor(255, 255, 255, 255);
-            
             // Draw simple "FPS" indicator using rectangles
             float fps = 1.0f / deltaTime;
             int fpsBarWidth = static_cast<int>(fps * 2);
@@ -206,16 +222,33 @@ int main() {
             int particleBarWidth = static_cast<int>(particles.size() * 0.4f);
             canvas.fillRect(10, 35, 200, 15, RGB(50, 50, 50));
             canvas.fillRect(10, 35, particleBarWidth, 15, RGB(0, 100, 255));
+
+            // Label bar (teks statis: satu lookup TextCache per frame)
+            canvas.drawText(Vec2<int>(216, 16), "FPS", textColor);
+            canvas.drawText(Vec2<int>(216, 39), "Particles", textColor);
             
             // Present the frame
             canvas.present();
             
+#if Z_PLATFORM_HEADLESS
+            if (++benchFrame == benchFrames) {
+                benchTimer.tick();
+                std::cout << "Headless: " << benchFrames << " frames, "
+                          << benchTimer.deltaTime() * 1000.0f / benchFrames << " ms/frame" << std::endl;
+                window.close();
+            }
+#else
             // Control frame rate (60 FPS)
             timer.sleepToFps(60.0f);
+#endif
         }
         
     } catch (const std::exception& e) {
+#if Z_PLATFORM_WIN32
         MessageBox(nullptr, e.what(), "Error", MB_OK | MB_ICONERROR);
+#else
+        std::cerr << "Error: " << e.what() << std::endl;
+#endif
         return -1;
     }
     
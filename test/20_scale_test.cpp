@@ -0,0 +1,242 @@
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_scale.h"
+#include "../include/z_jobs.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+// Gradien halus + noise, opaque
+static z::Image testImage(int width, int height) {
+    z::Image image(width, height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            image.at(x, y) = z::makePixel(static_cast<uint8_t>(x * 255 / std::max(width - 1, 1)), static_cast<uint8_t>(y * 255 / std::max(height - 1, 1)),
+                                          static_cast<uint8_t>(rnd() >> 24));
+    image.setBlendMode(z::BlendMode::Opaque);
+    return image;
+}
+
+// Spesifikasi integer: sampel 16.16 pusat-ke-pusat, lerp vertikal dulu, lalu horizontal
+static int refIndex(int64_t step, int i, int size, bool bilinear, int& weight) {
+    int64_t pos = step * i + step / 2;
+    weight = 0;
+    if (!bilinear) return static_cast<int>(std::min<int64_t>(pos >> 16, size - 1));
+    pos -= 0x8000;
+    if (pos < 0) return 0;
+    if ((pos >> 16) >= size - 1) return size - 1;
+    weight = static_cast<int>((pos >> 8) & 0xFF);
+    return static_cast<int>(pos >> 16);
+}
+
+static Pixel refLerp(Pixel a, Pixel b, int w) {
+    Pixel out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        int x = static_cast<int>((a >> shift) & 0xFF) * (256 - w) + static_cast<int>((b >> shift) & 0xFF) * w + 128;
+        out |= static_cast<Pixel>(x >> 8) << shift;
+    }
+    return out;
+}
+
+static std::vector<Pixel> refScaled(const z::Image& image, int width, int height, bool bilinear) {
+    std::vector<Pixel> out(static_cast<size_t>(width) * height);
+    int64_t stepX = (static_cast<int64_t>(image.width()) << 16) / width;
+    int64_t stepY = (static_cast<int64_t>(image.height()) << 16) / height;
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++) {
+            int wx, wy;
+            int ix = refIndex(stepX, x, image.width(), bilinear, wx);
+            int iy = refIndex(stepY, y, image.height(), bilinear, wy);
+            int ix1 = std::min(ix + 1, image.width() - 1), iy1 = std::min(iy + 1, image.height() - 1);
+            Pixel left = refLerp(image.at(ix, iy), image.at(ix, iy1), wy);
+            Pixel right = refLerp(image.at(ix1, iy), image.at(ix1, iy1), wy);
+            out[static_cast<size_t>(y) * width + x] = bilinear ? refLerp(left, right, wx) : image.at(ix, iy);
+        }
+    return out;
+}
+
+// Bilinear float tanpa kuantisasi: selisih maksimum per channel
+static int floatError(const z::Image& image, const z::Surface& s, int width, int height) {
+    int worst = 0;
+    float sx = static_cast<float>(image.width()) / width, sy = static_cast<float>(image.height()) / height;
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++) {
+            float fx = std::clamp((x + 0.5f) * sx - 0.5f, 0.0f, image.width() - 1.0f);
+            float fy = std::clamp((y + 0.5f) * sy - 0.5f, 0.0f, image.height() - 1.0f);
+            int x0 = static_cast<int>(fx), y0 = static_cast<int>(fy);
+            int x1 = std::min(x0 + 1, image.width() - 1), y1 = std::min(y0 + 1, image.height() - 1);
+            float tx = fx - x0, ty = fy - y0;
+            for (int shift = 0; shift < 24; shift += 8) {
+                auto c = [&](int px, int py) { return static_cast<float>((image.at(px, py) >> shift) & 0xFF); };
+                float v = (c(x0, y0) * (1 - tx) + c(x1, y0) * tx) * (1 - ty) + (c(x0, y1) * (1 - tx) + c(x1, y1) * tx) * ty;
+                int got = static_cast<int>((s.at(x, y) >> shift) & 0xFF);
+                worst = std::max(worst, std::abs(got - static_cast<int>(std::lround(v))));
+            }
+        }
+    return worst;
+}
+
+static bool sameAs(const z::Surface& s, const std::vector<Pixel>& ref, int width, int height) {
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            if (s.at(x, y) != ref[static_cast<size_t>(y) * width + x]) return false;
+    return true;
+}
+
+int main() {
+    seedRandom(99);
+    printf("Scale\n");
+    z::Window window("Scale Test", 320, 240);
+    z::Canvas canvas(window.handle());
+    const z::simd::Level best = z::simd::detectLevel();
+    const z::simd::Level levels[3] = { z::simd::Level::Scalar, z::simd::Level::SSE2, z::simd::Level::AVX2 };
+
+    // ===== Semua level = referensi integer, berbagai rasio =====
+    {
+        const int sizes[][4] = { { 37, 23, 320, 240 }, { 320, 240, 97, 61 }, { 64, 64, 128, 128 }, { 5, 3, 301, 7 }, { 300, 200, 299, 201 } };
+        bool same = true;
+        for (z::simd::Level level : levels) {
+            if (static_cast<int>(level) > static_cast<int>(best)) continue;
+            z::simd::setLevel(level);
+            for (const auto& size : sizes) {
+                z::Image image = testImage(size[0], size[1]);
+                for (int bilinear = 0; bilinear < 2; bilinear++) {
+                    canvas.clear();
+                    canvas.drawImageScaled(image, Rect<int>(0, 0, size[2], size[3]), bilinear ? z::Filter::Bilinear : z::Filter::Nearest);
+                    same = same && sameAs(canvas.surface(), refScaled(image, size[2], size[3], bilinear != 0), size[2], size[3]);
+                }
+            }
+        }
+        z::simd::setLevel(best);
+        check(same, "nearest dan bilinear identik dengan referensi integer di semua level SIMD");
+
+        z::Image image = testImage(40, 30);
+        canvas.clear();
+        canvas.drawImageScaled(image, Rect<int>(0, 0, 320, 240));
+        int error = floatError(image, canvas.surface(), 320, 240);
+        canvas.clear();
+        canvas.drawImageScaled(image, Rect<int>(0, 0, 31, 17));
+        error = std::max(error, floatError(image, canvas.surface(), 31, 17));
+        printf("  selisih maksimum dari bilinear float: %d level\n", error);
+        check(error <= 2, "bilinear dalam 2 level dari bilinear float");
+
+        // Skala 1:1 = blit biasa, nearest 2x = replikasi pixel
+        canvas.clear();
+        canvas.drawImageScaled(image, Rect<int>(10, 10, 40, 30));
+        bool identity = true;
+        for (int y = 0; y < 30; y++)
+            for (int x = 0; x < 40; x++)
+                identity = identity && canvas.surface().at(x + 10, y + 10) == image.at(x, y);
+        canvas.drawImageScaled(image, Rect<int>(0, 0, 80, 60), z::Filter::Nearest);
+        bool doubled = true;
+        for (int y = 0; y < 60; y++)
+            for (int x = 0; x < 80; x++)
+                doubled = doubled && canvas.surface().at(x, y) == image.at(x / 2, y / 2);
+        check(identity && doubled, "skala 1:1 identik, nearest 2x mereplikasi pixel");
+    }
+
+    // ===== Clip, transform, source rect, blend =====
+    {
+        z::Image image = testImage(50, 40);
+        std::vector<Pixel> full = refScaled(image, 200, 160, true);
+
+        // Sebagian dest di luar canvas dan di luar clip: sisanya tetap sama dengan render penuh
+        canvas.clear();
+        canvas.pushClip(Rect<int>(0, 0, 100, 100));
+        canvas.pushTransform();
+        canvas.translate(-30.0f, -20.0f);
+        canvas.drawImageScaled(image, Rect<int>(0, 0, 200, 160));
+        canvas.popTransform();
+        canvas.popClip();
+        bool clipped = true;
+        for (int y = 0; y < 240; y++)
+            for (int x = 0; x < 320; x++) {
+                Pixel expect = x < 100 && y < 100 ? full[static_cast<size_t>(y + 20) * 200 + x + 30] : z::makePixel(0, 0, 0);
+                clipped = clipped && canvas.surface().at(x, y) == expect;
+            }
+        check(clipped, "dest terpotong clip dan tepi canvas, pixel sama dengan render penuh");
+
+        // Source rect: sama dengan image hasil crop
+        z::Image crop(image.data() + 5 * 50 + 10, 20, 15, 50);
+        crop.setBlendMode(z::BlendMode::Opaque);
+        canvas.clear();
+        canvas.drawImageScaled(image, Rect<int>(10, 5, 20, 15), Rect<int>(0, 0, 70, 33), z::Filter::Nearest);
+        check(sameAs(canvas.surface(), refScaled(crop, 70, 33, false), 70, 33), "source rect: nearest sama dengan image yang di-crop");
+
+        // Alpha dan color key digabung setelah filter
+        z::Image glass(8, 8, z::makePixel(255, 0, 0, 128));
+        canvas.clear(RGB(0, 0, 255));
+        canvas.drawImageScaled(glass, Rect<int>(0, 0, 64, 64));
+        bool alpha = canvas.surface().at(30, 30) == z::blendPixel(z::makePixel(255, 0, 0, 128), z::makePixel(0, 0, 255));
+        z::Image keyed(2, 1, z::makePixel(255, 0, 255));
+        keyed.at(1, 0) = z::makePixel(0, 255, 0);
+        keyed.setColorKey(z::PackedColor(255, 0, 255));
+        canvas.drawImageScaled(keyed, Rect<int>(100, 0, 40, 10));
+        bool key = canvas.surface().at(119, 5) == z::makePixel(0, 0, 255) && canvas.surface().at(120, 5) == z::makePixel(0, 255, 0);
+        check(alpha && key, "alpha di-blend, color key tetap tajam (nearest)");
+    }
+
+    // ===== Paralel per baris = satu thread =====
+    z::Jobs jobs(3);
+    {
+        z::Window bigWindow("Scale Big", 1000, 700);
+        z::Canvas a(bigWindow.handle());
+        z::Canvas b(bigWindow.handle());
+        z::Image image = testImage(123, 77);
+        a.clear();
+        a.drawImageScaled(image, Rect<int>(-5, 3, 990, 690));
+        b.setJobs(&jobs);
+        b.clear();
+        b.drawImageScaled(image, Rect<int>(-5, 3, 990, 690));
+        z::Surface sa = a.surface(), sb = b.surface();
+        bool same = true;
+        for (int y = 0; y < 700; y++)
+            same = same && std::equal(sa.row(y), sa.row(y) + 1000, sb.row(y));
+        check(same, "setJobs: hasil paralel identik dengan satu thread");
+    }
+
+    // ===== Benchmark (Mpixel tujuan per detik) =====
+    {
+        z::Window benchWindow("Scale Bench", 1280, 720);
+        z::Canvas bench(benchWindow.handle());
+        z::Timer timer(z::TimerMode::Precise);
+        z::Image thumb = testImage(256, 144);
+        z::Image photo = testImage(1920, 1080);
+        const int repeat = 10;
+        printf("Benchmark Mpixel/s (%u thread untuk Jobs)\n", jobs.threadCount());
+
+        auto run = [&](const char* name, const z::Image& image, Rect<int> dest, z::Filter filter) {
+            printf("  %-26s", name);
+            for (z::simd::Level level : levels) {
+                if (static_cast<int>(level) > static_cast<int>(best)) continue;
+                z::simd::setLevel(level);
+                bench.drawImageScaled(image, dest, filter);
+                timer.tick();
+                for (int r = 0; r < repeat; r++)
+                    bench.drawImageScaled(image, dest, filter);
+                timer.tick();
+                printf(" | %s %7.1f", z::simd::levelName(level), static_cast<double>(dest.w) * dest.h * repeat / timer.deltaTime() / 1e6);
+            }
+            z::simd::setLevel(best);
+            bench.setJobs(&jobs);
+            timer.tick();
+            for (int r = 0; r < repeat; r++)
+                bench.drawImageScaled(image, dest, filter);
+            timer.tick();
+            bench.setJobs(nullptr);
+            printf(" | Jobs %7.1f\n", static_cast<double>(dest.w) * dest.h * repeat / timer.deltaTime() / 1e6);
+        };
+        run("256x144 -> 1280x720 near", thumb, Rect<int>(0, 0, 1280, 720), z::Filter::Nearest);
+        run("256x144 -> 1280x720 bilin", thumb, Rect<int>(0, 0, 1280, 720), z::Filter::Bilinear);
+        run("1920x1080 -> 640x360 near", photo, Rect<int>(0, 0, 640, 360), z::Filter::Nearest);
+        run("1920x1080 -> 640x360 bilin", photo, Rect<int>(0, 0, 640, 360), z::Filter::Bilinear);
+    }
+
+    return finishChecks();
+}
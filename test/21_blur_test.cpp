@@ -0,0 +1,210 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_blur.h"
+#include "../include/z_jobs.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+static void fillNoise(std::vector<Pixel>& pixels) {
+    for (Pixel& p : pixels) p = rnd();
+}
+
+// Box langsung O(r) per pixel, tepi dijepit, pembulatan sama dengan kernel
+static void referenceBoxRow(const Pixel* in, Pixel* out, int n, int r) {
+    const float inv = 1.0f / static_cast<float>(2 * r + 1);
+    for (int x = 0; x < n; x++) {
+        Pixel p = 0;
+        for (int c = 0; c < 4; c++) {
+            unsigned sum = 0;
+            for (int k = -r; k <= r; k++)
+                sum += (in[std::clamp(x + k, 0, n - 1)] >> (c * 8)) & 0xFF;
+            p |= static_cast<Pixel>(std::nearbyint(static_cast<float>(sum) * inv)) << (c * 8);
+        }
+        out[x] = p;
+    }
+}
+
+// Semua pass horizontal, lalu semua pass vertikal (urutan yang sama dengan separableBlur)
+static void referenceBlur(std::vector<Pixel>& image, int width, Rect<int> region, const int* radii, int passes) {
+    std::vector<Pixel> line(std::max(region.w, region.h)), temp(line.size());
+    for (int y = region.y; y < region.bottom(); y++)
+        for (int p = 0; p < passes; p++) {
+            Pixel* row = image.data() + static_cast<size_t>(y) * width + region.x;
+            referenceBoxRow(row, temp.data(), region.w, radii[p]);
+            std::copy(temp.begin(), temp.begin() + region.w, row);
+        }
+    for (int x = region.x; x < region.right(); x++) {
+        Pixel* column = image.data() + static_cast<size_t>(region.y) * width + x;
+        for (int y = 0; y < region.h; y++)
+            line[y] = column[static_cast<size_t>(y) * width];
+        for (int p = 0; p < passes; p++) {
+            referenceBoxRow(line.data(), temp.data(), region.h, radii[p]);
+            std::copy(temp.begin(), temp.begin() + region.h, line.begin());
+        }
+        for (int y = 0; y < region.h; y++)
+            column[static_cast<size_t>(y) * width] = line[y];
+    }
+}
+
+int main() {
+    seedRandom(5);
+    printf("Blur\n");
+    const z::simd::Level best = z::simd::detectLevel();
+
+    // ===== Sliding window = box langsung, SSE2 = skalar =====
+    {
+        bool same = true, simd = true;
+        for (int n = 1; n < 60 && same; n += 3)
+            for (int r = 0; r < 70; r += 1 + r / 4) {
+                std::vector<Pixel> in(n), fast(n), scalar(n), ref(n);
+                fillNoise(in);
+                z::detail::boxRow(in.data(), fast.data(), n, r);
+                z::detail::boxRowScalar(in.data(), scalar.data(), n, r);
+                referenceBoxRow(in.data(), ref.data(), n, r);
+                same = same && scalar == ref;
+                simd = simd && fast == scalar;
+            }
+        check(same, "sliding window identik dengan box langsung (termasuk radius > lebar)");
+        check(simd, "boxRow SSE2 identik dengan skalar");
+    }
+
+    // ===== Blur 2D per region =====
+    const int width = 160, height = 120;
+    {
+        std::vector<Pixel> image(width * height), ref;
+        fillNoise(image);
+        ref = image;
+        z::Surface surface(image.data(), width, height, width);
+        Rect<int> region(13, 7, 101, 77);
+        z::boxBlur(surface, region, 6);
+        int radius = 6;
+        referenceBlur(ref, width, region, &radius, 1);
+        check(image == ref, "boxBlur in-place = referensi, pixel di luar region tidak berubah");
+
+        // Gaussian: tiga pass, out-of-place, src tidak berubah
+        std::vector<Pixel> src(width * height), dst(width * height, 0), gauss;
+        fillNoise(src);
+        gauss = src;
+        std::vector<Pixel> original = src;
+        z::gaussianBlur(z::Surface(src.data(), width, height, width), z::Surface(dst.data(), width, height, width), region, 3.5f);
+        int radii[3];
+        z::gaussianBoxRadii(3.5f, radii);
+        referenceBlur(gauss, width, region, radii, 3);
+        bool inside = true, outside = true;
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++) {
+                size_t i = static_cast<size_t>(y) * width + x;
+                if (region.contains(Vec2<int>(x, y))) inside = inside && dst[i] == gauss[i];
+                else outside = outside && dst[i] == 0;
+            }
+        check(inside && outside && src == original, "gaussianBlur out-of-place = tiga pass referensi, src utuh");
+
+        // Warna rata tetap rata (tidak ada drift pembulatan)
+        std::vector<Pixel> flat(width * height, z::makePixel(123, 45, 67, 200));
+        z::gaussianBlur(z::Surface(flat.data(), width, height, width), Rect<int>(0, 0, width, height), 20.0f);
+        check(std::all_of(flat.begin(), flat.end(), [](Pixel p) { return p == z::makePixel(123, 45, 67, 200); }), "warna rata tidak berubah");
+    }
+
+    // Varians tiga box mendekati sigma^2 (sigma < 2 terlalu kecil untuk tiga box integer)
+    {
+        bool close = true;
+        const float sigmas[] = { 2.0f, 3.3f, 8.0f, 21.0f, 64.0f };
+        for (float sigma : sigmas) {
+            int radii[3];
+            z::gaussianBoxRadii(sigma, radii);
+            double variance = 0.0;
+            for (int r : radii) variance += ((2.0 * r + 1) * (2.0 * r + 1) - 1.0) / 12.0;
+            close = close && std::fabs(std::sqrt(variance) - sigma) <= 0.1 * sigma;
+            printf("  sigma %5.1f -> radius %d %d %d (sigma efektif %.2f)\n", sigma, radii[0], radii[1], radii[2], std::sqrt(variance));
+        }
+        check(close, "gaussianBoxRadii: sigma efektif dalam 10%");
+    }
+
+    // ===== Paralel = satu thread, semua level =====
+    z::Jobs jobs(3);
+    {
+        const int w = 700, h = 500;
+        std::vector<Pixel> single(w * h);
+        fillNoise(single);
+        std::vector<Pixel> parallel = single, scalar = single;
+        z::gaussianBlur(z::Surface(single.data(), w, h, w), Rect<int>(3, 5, 690, 490), 9.0f);
+        z::gaussianBlur(z::Surface(parallel.data(), w, h, w), Rect<int>(3, 5, 690, 490), 9.0f, &jobs);
+        z::simd::setLevel(z::simd::Level::Scalar);
+        z::gaussianBlur(z::Surface(scalar.data(), w, h, w), Rect<int>(3, 5, 690, 490), 9.0f);
+        z::simd::setLevel(best);
+        check(single == parallel && single == scalar, "Jobs dan level Scalar identik dengan satu thread SSE2");
+    }
+
+    // ===== Canvas =====
+    {
+        z::Window window("Blur Test", width, height);
+        z::Canvas canvas(window.handle());
+        canvas.clear();
+        canvas.fillRect(Rect<int>(40, 30, 60, 40), RGB(255, 255, 255));
+        z::Surface s = canvas.surface();
+        std::vector<Pixel> ref(width * height);
+        for (int y = 0; y < height; y++)
+            std::copy(s.row(y), s.row(y) + width, ref.begin() + static_cast<size_t>(y) * width);
+
+        canvas.pushClip(Rect<int>(0, 0, 80, 120));
+        canvas.pushTransform();
+        canvas.translate(10.0f, 10.0f);
+        canvas.boxBlur(Rect<int>(10, 0, 120, 100), 5);
+        canvas.popTransform();
+        canvas.popClip();
+        int radius = 5;
+        referenceBlur(ref, width, Rect<int>(20, 10, 60, 100), &radius, 1);
+        bool same = true;
+        for (int y = 0; y < height; y++)
+            same = same && std::equal(s.row(y), s.row(y) + width, ref.begin() + static_cast<size_t>(y) * width);
+        check(same, "Canvas::boxBlur: region lewat transform, dipotong clip");
+    }
+
+    // ===== Benchmark 1920x1080 =====
+    {
+        const int w = 1920, h = 1080;
+        std::vector<Pixel> frame(static_cast<size_t>(w) * h), work;
+        fillNoise(frame);
+        z::Timer timer(z::TimerMode::Precise);
+        printf("Benchmark blur 1920x1080 (ms per pass, %u thread untuk Jobs)\n", jobs.threadCount());
+        const int radii[] = { 4, 16, 64 };
+        for (int radius : radii) {
+            auto time = [&](auto fn) {
+                work = frame;
+                z::Surface s(work.data(), w, h, w);
+                timer.tick();
+                fn(s);
+                timer.tick();
+                return timer.deltaTime() * 1000.0;
+            };
+            double boxMs = time([&](z::Surface& s) { z::boxBlur(s, Rect<int>(0, 0, w, h), radius); });
+            double boxJobsMs = time([&](z::Surface& s) { z::boxBlur(s, Rect<int>(0, 0, w, h), radius, &jobs); });
+            float sigma = radius / 2.0f;
+            double gaussMs = time([&](z::Surface& s) { z::gaussianBlur(s, Rect<int>(0, 0, w, h), sigma); });
+            double gaussJobsMs = time([&](z::Surface& s) { z::gaussianBlur(s, Rect<int>(0, 0, w, h), sigma, &jobs); });
+            printf("  r %2d: box %8.2f ms | box Jobs %8.2f ms | gauss sigma %4.1f %8.2f ms | gauss Jobs %8.2f ms\n",
+                   radius, boxMs, boxJobsMs, sigma, gaussMs, gaussJobsMs);
+        }
+
+        // Pembanding: box langsung O(r) per pixel, hanya radius kecil
+        for (int radius : { 4, 16 }) {
+            work = frame;
+            std::vector<Pixel> row(w);
+            timer.tick();
+            for (int y = 0; y < h; y++) {
+                referenceBoxRow(work.data() + static_cast<size_t>(y) * w, row.data(), w, radius);
+                std::copy(row.begin(), row.end(), work.begin() + static_cast<size_t>(y) * w);
+            }
+            timer.tick();
+            printf("  r %2d: box langsung O(r), horizontal saja %8.2f ms\n", radius, timer.deltaTime() * 1000.0);
+        }
+    }
+
+    return finishChecks();
+}
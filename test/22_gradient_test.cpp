@@ -0,0 +1,224 @@
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_gradient.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+static int channel(Pixel p, int c) {
+    return static_cast<int>((p >> (c * 8)) & 0xFF);
+}
+
+// Selisih channel terbesar
+static int distance(Pixel a, Pixel b) {
+    int d = 0;
+    for (int c = 0; c < 4; c++)
+        d = std::max(d, std::abs(channel(a, c) - channel(b, c)));
+    return d;
+}
+
+int main() {
+    seedRandom(11);
+    printf("Gradient\n");
+    const z::simd::Level best = z::simd::detectLevel();
+    const Pixel black = z::makePixel(0, 0, 0), white = z::makePixel(255, 255, 255);
+
+    // ===== LUT dan stop =====
+    {
+        z::Gradient g = z::Gradient::linear(Vec2<float>(0.0f, 0.0f), Vec2<float>(100.0f, 0.0f), black, white);
+        bool ends = g.colorAt(0.0f) == black && g.colorAt(1.0f) == white && g.colorAt(-3.0f) == black && g.colorAt(7.0f) == white;
+        bool middle = distance(g.colorAt(0.5f), z::makePixel(128, 128, 128)) <= 1 && g.opaque();
+        check(ends && middle, "dua stop: ujung tepat, tengah abu-abu, Pad di luar [0, 1]");
+
+        z::Gradient multi = z::Gradient::linear(Vec2<float>(), Vec2<float>(1.0f, 0.0f), z::makePixel(255, 0, 0), z::makePixel(0, 0, 255));
+        multi.addStop(0.5f, z::makePixel(0, 255, 0));
+        multi.addStop(0.75f, z::makePixel(255, 255, 0)).addStop(0.75f, z::makePixel(0, 0, 0, 128));
+        bool stops = multi.stops().size() == 5 && distance(multi.colorAt(0.5f), z::makePixel(0, 255, 0)) <= 1 &&
+                     distance(multi.colorAt(0.25f), z::makePixel(128, 128, 0)) <= 1 &&
+                     distance(multi.colorAt(0.7499f), z::makePixel(255, 255, 0)) <= 2 &&
+                     distance(multi.colorAt(0.7501f), z::makePixel(0, 0, 0, 128)) <= 2 && !multi.opaque();
+        check(stops, "multi-stop berurutan, offset sama = transisi tajam, alpha terdeteksi");
+    }
+
+    // ===== Spread =====
+    {
+        const int n = z::Gradient::lutSize;
+        bool pad = z::detail::lutIndex(-5.0f, z::Spread::Pad) == 0 && z::detail::lutIndex(5000.0f, z::Spread::Pad) == n - 1 &&
+                   z::detail::lutIndex(NAN, z::Spread::Pad) == 0;
+        bool repeat = z::detail::lutIndex(n + 3.5f, z::Spread::Repeat) == 3 && z::detail::lutIndex(-0.5f, z::Spread::Repeat) == n - 1 &&
+                      z::detail::lutIndex(-1e20f, z::Spread::Repeat) == 0;
+        bool reflect = z::detail::lutIndex(n + 3.5f, z::Spread::Reflect) == n - 4 && z::detail::lutIndex(-0.5f, z::Spread::Reflect) == 0 &&
+                       z::detail::lutIndex(2.0f * n + 1.0f, z::Spread::Reflect) == 1 && z::detail::lutIndex(-2.0f, z::Spread::Reflect) == 1;
+        check(pad && repeat && reflect, "lutIndex: Pad, Repeat, Reflect (termasuk negatif, NaN, sangat besar)");
+    }
+
+    // ===== Span SIMD = skalar, semua kombinasi =====
+    {
+        bool same = true;
+        const z::Spread spreads[] = { z::Spread::Pad, z::Spread::Repeat, z::Spread::Reflect };
+        const z::simd::Level levels[] = { z::simd::Level::SSE2, z::simd::Level::AVX2 };
+        for (int trial = 0; trial < 300; trial++) {
+            Vec2<float> a(frand(-200.0f, 200.0f), frand(-200.0f, 200.0f));
+            z::Gradient g = trial % 2 ? z::Gradient::radial(a, frand(1.0f, 300.0f), rnd(), rnd())
+                                      : z::Gradient::linear(a, Vec2<float>(frand(-200.0f, 200.0f), frand(-200.0f, 200.0f)), rnd(), rnd());
+            g.addStop(frand(0.0f, 1.0f), rnd());
+            g.setSpread(spreads[trial % 3]).setDither((trial / 3) % 2 == 1);
+            int n = static_cast<int>(rnd() % 70);
+            z::detail::GradientRow row{ &g, frand(-3.0f, 3.0f), frand(-3.0f, 3.0f), frand(-0.1f, 0.1f), frand(-0.1f, 0.1f),
+                                        static_cast<int>(rnd() % 640), static_cast<int>(rnd() % 480) };
+            std::vector<Pixel> ref(n), out(n);
+            z::detail::gradientSpanScalar(row, ref.data(), 0, n);
+            for (z::simd::Level level : levels) {
+                if (level > best) continue;
+                z::simd::setLevel(level);
+                std::fill(out.begin(), out.end(), 0);
+                z::detail::gradientSpan(row, out.data(), n);
+                same = same && out == ref;
+            }
+            z::simd::setLevel(best);
+        }
+        check(same, "gradientSpan SSE2/AVX2 identik dengan skalar (linear, radial, spread, dither)");
+    }
+
+    z::Window window("Gradient Test", 320, 240);
+    z::Canvas canvas(window.handle());
+
+    // ===== Canvas: linear, radial, transform =====
+    {
+        canvas.clear();
+        z::Gradient g = z::Gradient::linear(Vec2<float>(20.0f, 0.0f), Vec2<float>(276.0f, 0.0f), z::makePixel(0, 0, 255), z::makePixel(255, 0, 0));
+        canvas.fillRect(Rect<int>(20, 10, 256, 30), g);
+        z::Surface s = canvas.surface();
+        bool ramp = true;
+        for (int x = 20; x < 276; x++) {
+            float t = (x + 0.5f - 20.0f) / 256.0f;
+            Pixel expect = z::makePixel(static_cast<uint8_t>(std::lround(255.0f * t)), 0, static_cast<uint8_t>(std::lround(255.0f * (1.0f - t))));
+            for (int y = 10; y < 40; y++)
+                ramp = ramp && distance(s.at(x, y), expect) <= 1;
+        }
+        bool outside = s.at(19, 20) == black && s.at(276, 20) == black && s.at(100, 9) == black && s.at(100, 40) == black;
+        check(ramp && outside, "fillRect linear: ramp horizontal dalam 1 level, di luar rect tidak berubah");
+
+        canvas.clear();
+        z::Gradient r = z::Gradient::radial(Vec2<float>(160.0f, 120.0f), 100.0f, white, black);
+        canvas.fillCircle(Vec2<int>(160, 120), 100, r);
+        bool radial = true;
+        for (int y = 0; y < 240; y += 3)
+            for (int x = 0; x < 320; x += 3) {
+                float d = std::hypot(x + 0.5f - 160.0f, y + 0.5f - 120.0f);
+                if (d > 101.0f) radial = radial && s.at(x, y) == black;
+                else if (d < 99.0f) radial = radial && std::abs(channel(s.at(x, y), 0) - static_cast<int>(std::lround(255.0f * (1.0f - d / 100.0f)))) <= 1;
+            }
+        check(radial, "fillCircle radial: warna mengikuti jarak ke pusat");
+
+        // Gradient ikut transform: user 0..50 -> device 0..100
+        canvas.clear();
+        canvas.pushTransform();
+        canvas.scale(2.0f, 2.0f);
+        canvas.fillRect(Rect<int>(0, 0, 50, 50), z::Gradient::linear(Vec2<float>(), Vec2<float>(50.0f, 0.0f), black, white));
+        canvas.popTransform();
+        bool scaled = distance(s.at(50, 50), z::makePixel(128, 128, 128)) <= 2 && channel(s.at(99, 10), 0) >= 252 && s.at(100, 10) == black;
+
+        // Rotasi 90 derajat: gradient horizontal di user jadi vertikal di device
+        canvas.clear();
+        canvas.pushTransform();
+        canvas.translate(200.0f, 20.0f);
+        canvas.rotate(1.57079632679f);
+        canvas.fillRect(Rect<int>(0, 0, 100, 60), z::Gradient::linear(Vec2<float>(), Vec2<float>(100.0f, 0.0f), black, white));
+        canvas.popTransform();
+        bool rotated = channel(s.at(170, 25), 0) < 16 && channel(s.at(170, 115), 0) > 235 && distance(s.at(150, 70), s.at(190, 70)) <= 1;
+        check(scaled && rotated, "transform scale dan rotasi ikut memetakan gradient");
+    }
+
+    // ===== Alpha, dither, clip =====
+    {
+        canvas.clear(RGB(0, 0, 200));
+        z::Gradient glass = z::Gradient::linear(Vec2<float>(), Vec2<float>(100.0f, 0.0f), z::makePixel(255, 255, 255, 0), z::makePixel(255, 255, 255, 255));
+        canvas.fillRect(Rect<int>(0, 0, 100, 10), glass);
+        z::Surface s = canvas.surface();
+        bool blended = true;
+        for (int x = 0; x < 100; x++)
+            blended = blended && s.at(x, 5) == z::blendPixel(glass.colorAt((x + 0.5f) / 100.0f), z::makePixel(0, 0, 200));
+        check(blended, "stop transparan di-blend ke background");
+
+        // Ramp 0..16 di 320 pixel: tanpa dither banding 17 level, dengan dither rata-rata blok 4x4 mendekati ideal
+        z::Gradient dark = z::Gradient::linear(Vec2<float>(), Vec2<float>(320.0f, 0.0f), black, z::makePixel(16, 16, 16));
+        canvas.fillRect(Rect<int>(0, 0, 320, 240), dark.setDither(true));
+        double worst = 0.0;
+        bool bounded = true;
+        for (int bx = 0; bx < 320; bx += 4) {
+            double sum = 0.0;
+            for (int y = 100; y < 104; y++)
+                for (int x = bx; x < bx + 4; x++) {
+                    int v = channel(s.at(x, y), 1);
+                    double ideal = dark.lut16()[static_cast<size_t>(z::detail::lutIndex((x + 0.5f) / 320.0f * z::Gradient::lutSize, z::Spread::Pad)) * 4 + 1] / 256.0;
+                    bounded = bounded && std::fabs(v - ideal) < 1.0;
+                    sum += v - ideal;
+                }
+            worst = std::max(worst, std::fabs(sum / 16.0));
+        }
+        printf("  dither: error rata-rata blok 4x4 terbesar %.3f level\n", worst);
+        check(bounded && worst < 0.25, "dither: setiap pixel dalam 1 level, rata-rata blok mendekati nilai 8.8");
+
+        canvas.clear();
+        canvas.present();
+        canvas.pushClip(Rect<int>(10, 10, 50, 50));
+        canvas.fillCircle(Vec2<int>(30, 30), 40, dark);
+        canvas.fillRect(Rect<int>(100, 100, 50, 50), dark);
+        canvas.popClip();
+        bool clipped = s.at(5, 30) == black && s.at(60, 30) == black && canvas.frameStats().primitives == 2 && canvas.frameStats().rejected == 1;
+        check(clipped, "gradient fill dipotong clip, di luar clip ditolak");
+    }
+
+    // ===== Benchmark 1280x720 =====
+    {
+        z::Window benchWindow("Gradient", 1280, 720);
+        z::Canvas bench(benchWindow.handle());
+        const int repeat = 20;
+        const double mpix = 1280.0 * 720.0 * repeat / 1e6;
+        z::Timer timer(z::TimerMode::Precise);
+        auto time = [&](auto fn) {
+            timer.tick();
+            for (int r = 0; r < repeat; r++) fn();
+            timer.tick();
+            return mpix / timer.deltaTime();
+        };
+
+        z::Gradient linear = z::Gradient::linear(Vec2<float>(0.0f, 0.0f), Vec2<float>(1280.0f, 720.0f), z::makePixel(20, 30, 90), z::makePixel(250, 180, 40));
+        linear.addStop(0.5f, z::makePixel(200, 40, 120));
+        z::Gradient radial = z::Gradient::radial(Vec2<float>(640.0f, 360.0f), 500.0f, white, z::makePixel(10, 10, 40));
+        z::Gradient dithered = linear;
+        dithered.setDither(true);
+        z::Gradient alpha = z::Gradient::linear(Vec2<float>(), Vec2<float>(1280.0f, 0.0f), z::makePixel(255, 0, 0, 0), z::makePixel(255, 0, 0, 255));
+        const Rect<int> full(0, 0, 1280, 720);
+
+        printf("Benchmark fillRect 1280x720 (Mpix/s)\n");
+        printf("  solid                %8.1f\n", time([&] { bench.fillRect(full, RGB(40, 80, 160)); }));
+        const z::simd::Level levels[] = { z::simd::Level::Scalar, z::simd::Level::SSE2, z::simd::Level::AVX2 };
+        for (z::simd::Level level : levels) {
+            if (level > best) continue;
+            z::simd::setLevel(level);
+            double l = time([&] { bench.fillRect(full, linear); });
+            double r = time([&] { bench.fillRect(full, radial); });
+            double d = time([&] { bench.fillRect(full, dithered); });
+            double a = time([&] { bench.fillRect(full, alpha); });
+            printf("  %-6s linear %8.1f | radial %8.1f | linear+dither %8.1f | alpha %8.1f\n", z::simd::levelName(level), l, r, d, a);
+        }
+        z::simd::setLevel(best);
+
+        // Cara lama: gradient dipalsukan dengan 64 fillRect bertumpuk
+        double stacked = time([&] {
+            for (int i = 0; i < 64; i++)
+                bench.fillRect(i * 20, 0, 20, 720, z::pixelToColorRef(linear.colorAt((i + 0.5f) / 64.0f)));
+        });
+        printf("  64 fillRect solid    %8.1f (banding 64 langkah)\n", stacked);
+    }
+
+    return finishChecks();
+}
@@ -0,0 +1,275 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_path.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+static Vec2<float> randomPoint(float range) {
+    return Vec2<float>(frand(-range, range), frand(-range, range));
+}
+
+// Jarak titik ke segmen ab
+static Vec2<float> cubicAt(const Vec2<float>* p, float t) {
+    float u = 1.0f - t;
+    float b0 = u * u * u, b1 = 3.0f * u * u * t, b2 = 3.0f * u * t * t, b3 = t * t * t;
+    return Vec2<float>(b0 * p[0].x + b1 * p[1].x + b2 * p[2].x + b3 * p[3].x, b0 * p[0].y + b1 * p[1].y + b2 * p[2].y + b3 * p[3].y);
+}
+
+// Error terbesar kurva terhadap polyline hasil flatten (sampling rapat)
+static float flattenError(const Vec2<float>* control, const z::FlatPath& flat) {
+    float worst = 0.0f;
+    for (int i = 0; i <= 2000; i++) {
+        Vec2<float> p = cubicAt(control, static_cast<float>(i) / 2000.0f);
+        float best = 1e30f;
+        for (size_t k = 0; k + 1 < flat.points.size(); k++)
+            best = std::min(best, segmentDistance(p, flat.points[k], flat.points[k + 1]));
+        worst = std::max(worst, best);
+    }
+    return worst;
+}
+
+// Lingkaran dari empat cubic (kappa)
+static z::Path circlePath(Vec2<float> c, float r) {
+    const float k = 0.5522847498f * r;
+    z::Path path;
+    path.moveTo(Vec2<float>(c.x + r, c.y));
+    path.cubicTo(Vec2<float>(c.x + r, c.y + k), Vec2<float>(c.x + k, c.y + r), Vec2<float>(c.x, c.y + r));
+    path.cubicTo(Vec2<float>(c.x - k, c.y + r), Vec2<float>(c.x - r, c.y + k), Vec2<float>(c.x - r, c.y));
+    path.cubicTo(Vec2<float>(c.x - r, c.y - k), Vec2<float>(c.x - k, c.y - r), Vec2<float>(c.x, c.y - r));
+    path.cubicTo(Vec2<float>(c.x + k, c.y - r), Vec2<float>(c.x + r, c.y - k), Vec2<float>(c.x + r, c.y));
+    return path.close();
+}
+
+int main() {
+    seedRandom(3);
+    printf("Path\n");
+
+    // ===== Builder dan identitas =====
+    {
+        z::Path path;
+        uint64_t empty = path.id();
+        path.lineTo(Vec2<float>(5.0f, 0.0f)).quadTo(Vec2<float>(5.0f, 5.0f), Vec2<float>(0.0f, 5.0f)).close();
+        bool verbs = path.verbs().size() == 4 && path.verbs()[0] == z::PathVerb::Move && path.points().size() == 4 &&
+                     path.points()[0] == Vec2<float>(0.0f, 0.0f);
+        z::Path copy = path;
+        uint64_t before = path.id();
+        path.lineTo(Vec2<float>(1.0f, 1.0f));
+        bool ids = empty != before && copy.id() == before && path.id() != before;
+        check(verbs && ids, "segmen tanpa moveTo mulai di (0, 0); setiap perubahan memberi id baru, copy berbagi id");
+
+        z::FlatPath flat;
+        z::Path lines;
+        lines.moveTo(Vec2<float>(0.0f, 0.0f)).lineTo(Vec2<float>(10.0f, 0.0f)).lineTo(Vec2<float>(10.0f, 10.0f)).close()
+             .lineTo(Vec2<float>(-5.0f, 0.0f))
+             .moveTo(Vec2<float>(50.0f, 50.0f)).moveTo(Vec2<float>(60.0f, 60.0f)).lineTo(Vec2<float>(70.0f, 60.0f));
+        z::flatten(lines, 0.25f, flat);
+        bool contours = flat.contours.size() == 3 && flat.contours[0].closed && flat.contours[0].count == 3 &&
+                        !flat.contours[1].closed && flat.points[flat.contours[1].begin] == Vec2<float>(0.0f, 0.0f) &&
+                        flat.contours[2].count == 2 && flat.points[flat.contours[2].begin] == Vec2<float>(60.0f, 60.0f);
+        check(contours, "flatten: contour tertutup/terbuka, lineTo setelah close mulai dari awal contour");
+    }
+
+    // ===== Flatten adaptif =====
+    {
+        bool withinTolerance = true;
+        float worstRatio = 0.0f;
+        size_t coarse = 0, fine = 0;
+        for (int trial = 0; trial < 40; trial++) {
+            Vec2<float> c[4] = { randomPoint(200.0f), randomPoint(200.0f), randomPoint(200.0f), randomPoint(200.0f) };
+            z::Path path;
+            path.moveTo(c[0]).cubicTo(c[1], c[2], c[3]);
+            z::FlatPath flat;
+            for (float tolerance : { 0.25f, 1.0f / 16.0f }) {
+                z::flatten(path, tolerance, flat);
+                float error = flattenError(c, flat);
+                withinTolerance = withinTolerance && error <= tolerance * 1.01f;
+                worstRatio = std::max(worstRatio, error / tolerance);
+                (tolerance > 0.1f ? coarse : fine) += flat.points.size() - 1;
+            }
+        }
+        printf("  error terbesar %.2f x tolerance, segmen tol 1/4: %zu, tol 1/16: %zu\n", worstRatio, coarse, fine);
+        check(withinTolerance, "cubic acak: error flatten <= tolerance");
+        check(fine > coarse * 19 / 10 && fine < coarse * 21 / 10, "tolerance 4x lebih kecil -> segmen ~2x (sqrt)");
+
+        z::Path straight, quad;
+        straight.moveTo(Vec2<float>()).cubicTo(Vec2<float>(10.0f, 10.0f), Vec2<float>(20.0f, 20.0f), Vec2<float>(30.0f, 30.0f));
+        quad.moveTo(Vec2<float>()).quadTo(Vec2<float>(50.0f, 100.0f), Vec2<float>(100.0f, 0.0f));
+        z::FlatPath a, b;
+        z::flatten(straight, 0.25f, a);
+        z::flatten(quad, 0.25f, b);
+        // Deviasi quad = |p0 - 2p1 + p2| / 8 = 25 -> sqrt(100) = 10 segmen
+        check(a.points.size() == 2 && b.points.size() == 11, "kurva lurus 1 segmen, quad sesuai batas error");
+    }
+
+    // ===== Bucket skala dan cache =====
+    {
+        bool safe = true;
+        for (float s = 0.01f; s < 100.0f; s *= 1.013f)
+            safe = safe && z::bucketTolerance(z::scaleBucket(s), 0.25f) * s <= 0.25f * 1.0001f &&
+                   z::bucketTolerance(z::scaleBucket(s), 0.25f) * s > 0.25f / 1.19f;
+        check(safe, "bucket seperempat oktaf: error di layar <= 0.25 pixel, tidak lebih dari 19% terlalu halus");
+
+        z::FlattenCache cache(4);
+        z::Path circle = circlePath(Vec2<float>(), 50.0f);
+        const z::FlatPath& small = cache.get(circle, 1.0f);
+        size_t smallCount = small.points.size();
+        const z::FlatPath& big = cache.get(circle, 8.0f);
+        bool finer = big.points.size() > smallCount * 2;
+        cache.get(circle, 1.0f);
+        cache.get(circle, 1.1f);
+        cache.get(circle, 1.15f);
+        bool hits = cache.stats().misses == 3 && cache.stats().hits == 2;
+        for (int i = 0; i < 20; i++)
+            cache.get(circlePath(Vec2<float>(), 10.0f + i), 1.0f);
+        bool bounded = cache.stats().entries <= 8;
+        check(finer && hits && bounded, "cache per (id, bucket): skala besar lebih halus, bucket sama = hit, ukuran terbatas");
+    }
+
+    z::Window window("Path Test", 320, 240);
+    z::Canvas canvas(window.handle());
+
+    // ===== Canvas fillPath / strokePath =====
+    {
+        canvas.clear();
+        canvas.fillRect(Rect<int>(10, 20, 40, 30), RGB(255, 0, 0));
+        std::vector<Pixel> expect = snapshot(canvas.surface());
+        canvas.clear();
+        z::Path square;
+        square.moveTo(Vec2<float>(10.0f, 20.0f)).lineTo(Vec2<float>(50.0f, 20.0f)).lineTo(Vec2<float>(50.0f, 50.0f)).lineTo(Vec2<float>(10.0f, 50.0f)).close();
+        canvas.fillPath(square, RGB(255, 0, 0));
+        check(snapshot(canvas.surface()) == expect, "fillPath persegi = fillRect");
+
+        canvas.clear();
+        canvas.fillPath(circlePath(Vec2<float>(160.0f, 120.0f), 80.0f), RGB(255, 255, 255));
+        z::Surface s = canvas.surface();
+        bool round = true;
+        for (int y = 0; y < 240; y++)
+            for (int x = 0; x < 320; x++) {
+                float d = std::hypot(x + 0.5f - 160.0f, y + 0.5f - 120.0f);
+                bool on = s.at(x, y) != z::makePixel(0, 0, 0);
+                if (d < 79.5f) round = round && on;
+                if (d > 80.5f) round = round && !on;
+            }
+        check(round, "fillPath lingkaran dari cubic: tepi dalam 0.5 pixel dari lingkaran sebenarnya");
+
+        // Stroke 1 pixel = rangkaian drawLine (Bresenham sama, sambungan tidak dobel)
+        Vec2<int> zig[5] = { Vec2<int>(10, 10), Vec2<int>(100, 40), Vec2<int>(30, 90), Vec2<int>(200, 150), Vec2<int>(250, 20) };
+        canvas.clear();
+        for (int i = 0; i + 1 < 5; i++)
+            canvas.drawLine(zig[i], zig[i + 1], RGB(0, 255, 0));
+        expect = snapshot(canvas.surface());
+        canvas.clear();
+        z::Path polyline;
+        polyline.moveTo(Vec2<float>(zig[0]));
+        for (int i = 1; i < 5; i++)
+            polyline.lineTo(Vec2<float>(zig[i]));
+        canvas.strokePath(polyline, RGB(0, 255, 0));
+        check(snapshot(canvas.surface()) == expect, "strokePath 1 pixel = drawLine per segmen");
+
+        // Stroke tebal: badan, sambungan, ujung bulat
+        canvas.clear();
+        z::Path corner;
+        corner.moveTo(Vec2<float>(50.0f, 100.0f)).lineTo(Vec2<float>(150.0f, 100.0f)).lineTo(Vec2<float>(150.0f, 200.0f));
+        canvas.strokePath(corner, RGB(255, 255, 0), 9);
+        auto on = [&](int x, int y) { return s.at(x, y) != z::makePixel(0, 0, 0); };
+        bool thick = on(100, 96) && on(100, 103) && !on(100, 94) && !on(100, 106) && on(46, 100) && !on(44, 100) &&
+                     on(153, 99) && on(152, 97) && !on(153, 96) && on(150, 203) && !on(150, 205) && !on(155, 95);
+        check(thick, "strokePath tebal: lebar benar, sambungan dan ujung bulat");
+
+        // Transform: path ikut, skala besar di-flatten ulang sekali per bucket
+        canvas.clear();
+        canvas.present();
+        z::FlattenCacheStats before = canvas.pathCacheStats();
+        z::Path small = circlePath(Vec2<float>(0.0f, 0.0f), 10.0f);
+        for (int frame = 0; frame < 3; frame++) {
+            canvas.pushTransform();
+            canvas.translate(160.0f, 120.0f);
+            canvas.fillPath(small, RGB(255, 255, 255));
+            canvas.scale(8.0f);
+            canvas.strokePath(small, RGB(255, 0, 0), 1);
+            canvas.popTransform();
+        }
+        z::FlattenCacheStats after = canvas.pathCacheStats();
+        bool cached = after.misses - before.misses == 2 && after.hits - before.hits == 4;
+        bool mapped = on(160, 120) && on(160 + 79, 120) && !on(160 + 40, 120);
+        canvas.pushTransform();
+        canvas.translate(-50.0f, 100.0f);
+        canvas.fillPath(small, RGB(255, 255, 255));
+        canvas.popTransform();
+        bool rejected = canvas.frameStats().rejected == 1;
+        check(cached && mapped && rejected, "transform: cache per bucket skala, hasil ikut transform, path di luar clip ditolak");
+    }
+
+    // ===== Benchmark: 2000 kurva per frame =====
+    {
+        z::Window benchWindow("Path", 1280, 720);
+        z::Canvas bench(benchWindow.handle());
+        const int count = 2000, repeat = 5;
+        std::vector<z::Path> curves(count);
+        std::vector<std::vector<Vec2<float>>> control(count);
+        for (int i = 0; i < count; i++) {
+            float x = frand(0.0f, 1100.0f), y = frand(50.0f, 670.0f);
+            curves[i].moveTo(Vec2<float>(x, y));
+            control[i].push_back(Vec2<float>(x, y));
+            for (int k = 0; k < 4; k++) {
+                Vec2<float> c1(x + 15.0f, y - frand(10.0f, 60.0f)), c2(x + 30.0f, y + frand(10.0f, 60.0f)), end(x + 45.0f, y + frand(-10.0f, 10.0f));
+                curves[i].cubicTo(c1, c2, end);
+                control[i].insert(control[i].end(), { c1, c2, end });
+                x = end.x;
+                y = end.y;
+            }
+        }
+        z::Timer timer(z::TimerMode::Precise);
+        auto time = [&](auto fn) {
+            fn();
+            timer.tick();
+            for (int r = 0; r < repeat; r++) fn();
+            timer.tick();
+            return timer.deltaTime() * 1000.0 / repeat;
+        };
+        printf("Benchmark %d kurva (4 cubic) per frame, ms per frame\n", count);
+
+        // Cara lama: 32 drawLine tetap per cubic
+        double manual = time([&] {
+            for (int i = 0; i < count; i++)
+                for (int k = 0; k < 4; k++) {
+                    const Vec2<float>* c = control[i].data() + k * 3;
+                    Vec2<float> prev = c[0];
+                    for (int s = 1; s <= 32; s++) {
+                        Vec2<float> p = cubicAt(c, s / 32.0f);
+                        bench.drawLine(Vec2<int>(prev), Vec2<int>(p), RGB(255, 255, 255));
+                        prev = p;
+                    }
+                }
+        });
+        printf("  drawLine manual (128 garis/kurva) %8.2f ms\n", manual);
+
+        for (int width : { 1, 3 }) {
+            bench.setPathCacheCapacity(0);
+            double uncached = time([&] { for (const z::Path& p : curves) bench.strokePath(p, RGB(255, 255, 255), width); });
+            bench.setPathCacheCapacity(4096);
+            double cachedMs = time([&] { for (const z::Path& p : curves) bench.strokePath(p, RGB(255, 255, 255), width); });
+            printf("  strokePath lebar %d: tanpa cache %8.2f ms | cache %8.2f ms (%4.2fx)\n", width, uncached, cachedMs, uncached / cachedMs);
+        }
+        bench.setPathCacheCapacity(0);
+        double fillUncached = time([&] { for (const z::Path& p : curves) bench.fillPath(p, RGB(255, 255, 255)); });
+        bench.setPathCacheCapacity(4096);
+        double fillCached = time([&] { for (const z::Path& p : curves) bench.fillPath(p, RGB(255, 255, 255)); });
+        // Bagian yang dihemat cache: flatten vs lookup
+        z::FlattenCache lookup(4096);
+        z::FlatPath scratch;
+        double flattenMs = time([&] { for (const z::Path& p : curves) z::flatten(p, 0.25f, scratch); });
+        double lookupMs = time([&] { for (const z::Path& p : curves) lookup.get(p, 1.0f); });
+        printf("  flatten saja %8.3f ms | lookup cache %8.3f ms (%5.1fx)\n", flattenMs, lookupMs, flattenMs / lookupMs);
+        printf("  fillPath:          tanpa cache %8.2f ms | cache %8.2f ms (%4.2fx) | hits %zu misses %zu\n", fillUncached, fillCached,
+               fillUncached / fillCached, bench.pathCacheStats().hits, bench.pathCacheStats().misses);
+    }
+
+    return finishChecks();
+}
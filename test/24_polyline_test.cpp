@@ -0,0 +1,339 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_stroke.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+
+// Berapa kali setiap pixel ditulis oleh beberapa fillPath
+struct Coverage {
+    int width, height;
+    std::vector<int> count;
+
+    Coverage(int width, int height) : width(width), height(height), count(static_cast<size_t>(width * height), 0) {}
+
+    void fill(const z::FlatPath& outline) {
+        std::vector<Pixel> dummy(static_cast<size_t>(width * height));
+        z::Raster raster(z::Surface(dummy.data(), width, height, width));
+        raster.beginPath();
+        for (const z::FlatPath::Contour& c : outline.contours)
+            raster.addContour(outline.points.data() + c.begin, static_cast<int>(c.count));
+        raster.fillPath(z::FillRule::NonZero, [&](int y, int x0, int x1) {
+            for (int x = x0; x < x1; x++) count[static_cast<size_t>(y * width + x)]++;
+        });
+    }
+
+    int at(int x, int y) const { return count[static_cast<size_t>(y * width + x)]; }
+    int maximum() const { return *std::max_element(count.begin(), count.end()); }
+};
+
+int main() {
+    seedRandom(11);
+    printf("Polyline\n");
+
+    // ===== Outline =====
+    {
+        z::Stroker stroker;
+        z::FlatPath out;
+        Vec2<float> line[2] = { Vec2<float>(10.0f, 20.0f), Vec2<float>(50.0f, 20.0f) };
+        z::StrokeStyle style;
+        style.width = 10.0f;
+        stroker.stroke(line, 2, false, style, out);
+        bool butt = out.contours.size() == 1 && out.points.size() == 4;
+        float minX = 1e9f, maxX = -1e9f;
+        for (Vec2<float> p : out.points) { minX = std::min(minX, p.x); maxX = std::max(maxX, p.x); }
+        butt = butt && minX == 10.0f && maxX == 50.0f;
+
+        out.clear();
+        style.cap = z::LineCap::Square;
+        stroker.stroke(line, 2, false, style, out);
+        bool square = out.points.size() == 8;
+        minX = 1e9f; maxX = -1e9f;
+        for (Vec2<float> p : out.points) { minX = std::min(minX, p.x); maxX = std::max(maxX, p.x); }
+        square = square && minX == 5.0f && maxX == 55.0f;
+
+        // Titik kembar dibuang; satu titik dengan cap bulat = lingkaran, butt = kosong
+        out.clear();
+        Vec2<float> same[3] = { Vec2<float>(5.0f, 5.0f), Vec2<float>(5.0f, 5.0f), Vec2<float>(5.0f, 5.0f) };
+        style.cap = z::LineCap::Butt;
+        stroker.stroke(same, 3, false, style, out);
+        bool empty = out.contours.empty();
+        style.cap = z::LineCap::Round;
+        stroker.stroke(same, 3, false, style, out);
+        bool disc = out.contours.size() == 1 && out.points.size() > 8;
+        for (Vec2<float> p : out.points)
+            disc = disc && std::fabs(std::hypot(p.x - 5.0f, p.y - 5.0f) - 5.0f) < 1e-3f;
+
+        // Segmen lurus berderet: satu titik per sisi per vertex
+        out.clear();
+        style.cap = z::LineCap::Butt;
+        std::vector<Vec2<float>> straight;
+        for (int i = 0; i < 100; i++) straight.push_back(Vec2<float>(i * 3.0f, i * 1.0f));
+        stroker.stroke(straight.data(), 100, false, style, out);
+        bool compact = out.points.size() == 200;
+        check(butt && square && empty && disc && compact, "outline: butt/square, titik kembar, titik tunggal, segmen lurus tanpa titik tambahan");
+    }
+
+    // ===== Join round + cap round = jarak ke polyline, setiap pixel ditulis sekali =====
+    {
+        const int width = 400, height = 300;
+        bool exact = true, once = true;
+        int naiveOverdraw = 0;
+        for (int trial = 0; trial < 20; trial++) {
+            std::vector<Vec2<float>> points;
+            int count = 3 + static_cast<int>(rnd() % 20);
+            for (int i = 0; i < count; i++) {
+                // Sesekali titik kembar atau putar balik penuh
+                if (i > 1 && rnd() % 6 == 0) { points.push_back(points[i - 2]); continue; }
+                if (i > 0 && rnd() % 8 == 0) { points.push_back(points[i - 1]); continue; }
+                points.push_back(Vec2<float>(frand(40.0f, 360.0f), frand(40.0f, 260.0f)));
+            }
+            z::StrokeStyle style;
+            style.width = frand(2.0f, 30.0f);
+            style.join = z::LineJoin::Round;
+            style.cap = z::LineCap::Round;
+            const float half = style.width * 0.5f;
+            z::Stroker stroker;
+            z::FlatPath outline;
+            stroker.stroke(points.data(), count, false, style, outline);
+            Coverage coverage(width, height);
+            coverage.fill(outline);
+            once = once && coverage.maximum() <= 1;
+            for (int y = 0; y < height; y++)
+                for (int x = 0; x < width; x++) {
+                    Vec2<float> c(x + 0.5f, y + 0.5f);
+                    float d = 1e9f;
+                    for (int i = 0; i + 1 < count; i++)
+                        d = std::min(d, segmentDistance(c, points[i], points[i + 1]));
+                    // Busur poligon di dalam lingkaran, error <= toleransi 0.25
+                    if (d < half - 0.3f) exact = exact && coverage.at(x, y) == 1;
+                    if (d > half + 0.01f) exact = exact && coverage.at(x, y) == 0;
+                }
+
+            // Pembanding: outline per segmen di-fill sendiri-sendiri (seperti drawLine berulang)
+            Coverage naive(width, height);
+            for (int i = 0; i + 1 < count; i++) {
+                z::FlatPath piece;
+                stroker.stroke(points.data() + i, 2, false, style, piece);
+                naive.fill(piece);
+            }
+            for (int v : naive.count) naiveOverdraw += v > 1 ? 1 : 0;
+        }
+        printf("  per segmen: %d pixel ditulis lebih dari sekali, satu outline: 0\n", naiveOverdraw);
+        check(exact && once, "join dan cap bulat = semua titik dalam jarak lebar/2, setiap pixel ditulis tepat sekali");
+    }
+
+    // ===== Baris padat di rasterizer (winding per pixel tanpa sort) = winding di pusat pixel =====
+    {
+        const int width = 320, height = 240;
+        std::vector<Vec2<float>> star;
+        for (int i = 0; i < 301; i++) {
+            float t = 6.28318530718f * static_cast<float>(i * 97 % 301) / 301.0f;
+            float r = frand(20.0f, 200.0f);
+            star.push_back(Vec2<float>(160.0f + r * std::cos(t) + frand(-0.5f, 0.5f), 120.0f + r * std::sin(t)));
+        }
+        bool same = true;
+        int densest = 0;
+        for (z::FillRule rule : { z::FillRule::NonZero, z::FillRule::EvenOdd }) {
+            std::vector<int> count(static_cast<size_t>(width * height), 0);
+            std::vector<Pixel> dummy(count.size());
+            z::Raster raster(z::Surface(dummy.data(), width, height, width));
+            raster.setClip(Rect<int>(10, 5, 300, 230));
+            raster.beginPath();
+            raster.addContour(star.data(), static_cast<int>(star.size()));
+            raster.fillPath(rule, [&](int y, int x0, int x1) {
+                for (int x = x0; x < x1; x++) count[static_cast<size_t>(y * width + x)]++;
+            });
+            for (int y = 0; y < height; y++) {
+                int crossings = 0;
+                for (int x = 0; x < width; x++) {
+                    float px = x + 0.5f, py = y + 0.5f;
+                    int winding = 0;
+                    crossings = 0;
+                    for (size_t i = 0; i < star.size(); i++) {
+                        Vec2<float> a = star[i], b = star[(i + 1) % star.size()];
+                        if ((a.y <= py) == (b.y <= py)) continue;
+                        crossings++;
+                        float cx = a.x + (py - a.y) / (b.y - a.y) * (b.x - a.x);
+                        if (cx <= px) winding += b.y > a.y ? 1 : -1;
+                    }
+                    bool inside = rule == z::FillRule::NonZero ? winding != 0 : (winding & 1) != 0;
+                    bool clipped = x >= 10 && x < 310 && y >= 5 && y < 235;
+                    same = same && count[static_cast<size_t>(y * width + x)] == ((inside && clipped) ? 1 : 0);
+                }
+                densest = std::max(densest, crossings);
+            }
+        }
+        printf("  crossing terbanyak per baris: %d\n", densest);
+        check(same && densest * 16 > 300, "rasterizer: baris padat tanpa sort = winding di pusat pixel (NonZero, EvenOdd, clip)");
+    }
+
+    z::Window window("Polyline Test", 320, 240);
+    z::Canvas canvas(window.handle());
+    z::Surface s = canvas.surface();
+    auto on = [&](int x, int y) { return s.at(x, y) != z::makePixel(0, 0, 0); };
+    Vec2<float> corner[3] = { Vec2<float>(50.0f, 100.0f), Vec2<float>(150.0f, 100.0f), Vec2<float>(150.0f, 200.0f) };
+
+    // ===== Join =====
+    {
+        canvas.clear();
+        canvas.drawPolyline(corner, 3, RGB(255, 255, 0), 9.0f, z::LineJoin::Miter);
+        bool miter = on(153, 96) && on(152, 97) && !on(155, 95) && on(100, 96) && on(100, 103) && !on(100, 94) && !on(100, 106);
+        canvas.clear();
+        canvas.drawPolyline(corner, 3, RGB(255, 255, 0), 9.0f, z::LineJoin::Round);
+        bool round = !on(153, 96) && on(152, 97);
+        canvas.clear();
+        canvas.drawPolyline(corner, 3, RGB(255, 255, 0), 9.0f, z::LineJoin::Bevel);
+        bool bevel = !on(153, 96) && !on(152, 97) && on(151, 98);
+
+        // Sudut lancip: miter lewat miterLimit jadi bevel
+        Vec2<float> sharp[3] = { Vec2<float>(20.0f, 50.0f), Vec2<float>(200.0f, 60.0f), Vec2<float>(20.0f, 70.0f) };
+        canvas.clear();
+        canvas.drawPolyline(sharp, 3, RGB(255, 255, 0), 8.0f, z::LineJoin::Miter);
+        bool limited = on(199, 60) && !on(201, 60);
+        z::StrokeStyle loose;
+        loose.width = 8.0f;
+        loose.miterLimit = 100.0f;
+        canvas.clear();
+        canvas.drawPolyline(sharp, 3, RGB(255, 255, 0), loose);
+        bool spike = on(230, 60);
+        check(miter && round && bevel && limited && spike, "join miter/round/bevel di sisi luar, miterLimit");
+    }
+
+    // ===== Cap =====
+    {
+        canvas.clear();
+        canvas.drawPolyline(corner, 3, RGB(255, 255, 0), 9.0f, z::LineJoin::Miter, z::LineCap::Butt);
+        bool butt = on(150, 199) && !on(150, 200) && on(50, 100) && !on(49, 100);
+        canvas.clear();
+        canvas.drawPolyline(corner, 3, RGB(255, 255, 0), 9.0f, z::LineJoin::Miter, z::LineCap::Square);
+        bool square = on(150, 203) && on(153, 203) && !on(150, 205) && on(46, 100) && !on(44, 100);
+        canvas.clear();
+        canvas.drawPolyline(corner, 3, RGB(255, 255, 0), 9.0f, z::LineJoin::Miter, z::LineCap::Round);
+        bool round = on(150, 203) && !on(153, 203) && !on(150, 205) && on(46, 100) && !on(46, 96);
+        check(butt && square && round, "cap butt/square/round di kedua ujung");
+    }
+
+    // ===== Tertutup, lebar 1, transform =====
+    {
+        Vec2<float> box[4] = { Vec2<float>(100.0f, 50.0f), Vec2<float>(200.0f, 50.0f), Vec2<float>(200.0f, 150.0f), Vec2<float>(100.0f, 150.0f) };
+        z::StrokeStyle style;
+        style.width = 10.0f;
+        canvas.clear();
+        canvas.drawPolygon(box, 4, RGB(0, 255, 255), style);
+        bool ring = on(100, 100) && on(104, 100) && !on(106, 100) && !on(150, 100) && on(96, 46) && on(203, 153) &&
+                    !on(94, 44) && on(150, 54) && !on(150, 56);
+
+        // Lebar 1 = rangkaian drawLine
+        Vec2<int> zig[5] = { Vec2<int>(10, 10), Vec2<int>(100, 40), Vec2<int>(30, 90), Vec2<int>(200, 150), Vec2<int>(250, 20) };
+        Vec2<float> zigf[5];
+        canvas.clear();
+        for (int i = 0; i + 1 < 5; i++)
+            canvas.drawLine(zig[i], zig[i + 1], RGB(0, 255, 0));
+        std::vector<Pixel> expect = snapshot(canvas.surface());
+        for (int i = 0; i < 5; i++) zigf[i] = Vec2<float>(zig[i]);
+        canvas.clear();
+        canvas.drawPolyline(zigf, 5, RGB(0, 255, 0));
+        bool hairline = snapshot(canvas.surface()) == expect;
+
+        // Jalur cepat (segmen di dalam clip) dan jalur line() (segmen memotong clip) bercampur
+        std::vector<Vec2<int>> walkClip(2000);
+        std::vector<Vec2<float>> walkClipf(2000);
+        for (size_t i = 0; i < walkClip.size(); i++) {
+            walkClip[i] = Vec2<int>(rnd(320) - 10, rnd(240) - 10);
+            walkClipf[i] = Vec2<float>(walkClip[i]);
+        }
+        canvas.pushClip(Rect<int>(40, 30, 200, 150));
+        canvas.clear();
+        for (size_t i = 0; i + 1 < walkClip.size(); i++)
+            canvas.drawLine(walkClip[i], walkClip[i + 1], RGB(255, 255, 0));
+        canvas.drawLine(walkClip.back(), walkClip.front(), RGB(255, 255, 0));
+        expect = snapshot(canvas.surface());
+        canvas.clear();
+        canvas.drawPolygon(walkClipf.data(), static_cast<int>(walkClipf.size()), RGB(255, 255, 0), z::StrokeStyle());
+        canvas.popClip();
+        hairline = hairline && snapshot(canvas.surface()) == expect;
+
+        // Transform: skala 2 menggandakan lebar, polyline di luar clip ditolak
+        canvas.clear();
+        canvas.present();
+        canvas.pushTransform();
+        canvas.scale(2.0f);
+        Vec2<float> across[2] = { Vec2<float>(10.0f, 50.0f), Vec2<float>(150.0f, 50.0f) };
+        canvas.drawPolyline(across, 2, RGB(255, 0, 0), 4.0f);
+        canvas.translate(-500.0f, 0.0f);
+        canvas.drawPolyline(across, 2, RGB(255, 0, 0), 4.0f);
+        canvas.popTransform();
+        bool scaled = on(100, 96) && on(100, 103) && !on(100, 95) && !on(100, 104) && !on(19, 100) && on(20, 100);
+        bool rejected = canvas.frameStats().rejected == 1;
+        check(ring && hairline && scaled && rejected, "polyline tertutup, lebar 1 = drawLine, transform dan clip");
+    }
+
+    // ===== Benchmark: polyline 1 juta titik =====
+    {
+        z::Window benchWindow("Polyline", 1920, 1080);
+        z::Canvas bench(benchWindow.handle());
+        const int count = 1000000;
+        // Random walk langkah ~2 pixel, memantul di tepi
+        std::vector<Vec2<float>> walk(count);
+        std::vector<Vec2<int>> walkInt(count);
+        float x = 960.0f, y = 540.0f, angle = 0.0f;
+        for (int i = 0; i < count; i++) {
+            angle += frand(-0.6f, 0.6f);
+            x += 2.0f * std::cos(angle);
+            y += 2.0f * std::sin(angle);
+            if (x < 20.0f || x > 1900.0f) { angle = 3.14159265f - angle; x = std::clamp(x, 20.0f, 1900.0f); }
+            if (y < 20.0f || y > 1060.0f) { angle = -angle; y = std::clamp(y, 20.0f, 1060.0f); }
+            walk[i] = Vec2<float>(x, y);
+            walkInt[i] = Vec2<int>(static_cast<int>(std::lround(x)), static_cast<int>(std::lround(y)));
+        }
+        z::Timer timer(z::TimerMode::Precise);
+        auto time = [&](int repeat, auto fn) {
+            fn();
+            timer.tick();
+            for (int r = 0; r < repeat; r++) fn();
+            timer.tick();
+            return timer.deltaTime() * 1000.0 / repeat;
+        };
+        printf("Benchmark polyline %d titik, 1920x1080, ms per polyline\n", count);
+
+        for (int width : { 1, 3, 8 }) {
+            double lines = time(1, [&] {
+                for (int i = 0; i + 1 < count; i++)
+                    bench.drawLine(walkInt[i], walkInt[i + 1], RGB(255, 255, 255), width);
+            });
+            double poly = time(3, [&] {
+                bench.drawPolyline(walk.data(), count, RGB(255, 255, 255), static_cast<float>(width));
+            });
+            printf("  lebar %d: drawLine per segmen %9.1f ms | drawPolyline %8.1f ms (%5.1fx)\n", width, lines, poly, lines / poly);
+        }
+
+        const char* joinNames[3] = { "miter", "round", "bevel" };
+        const z::LineJoin joins[3] = { z::LineJoin::Miter, z::LineJoin::Round, z::LineJoin::Bevel };
+        for (int j = 0; j < 3; j++) {
+            double poly = time(3, [&] {
+                bench.drawPolyline(walk.data(), count, RGB(255, 255, 255), 8.0f, joins[j], z::LineCap::Round);
+            });
+            printf("  lebar 8 join %s: %8.1f ms\n", joinNames[j], poly);
+        }
+
+        // Bagian outline saja (tanpa raster)
+        z::Stroker stroker;
+        z::FlatPath outline;
+        z::StrokeStyle style;
+        style.width = 8.0f;
+        double strokeMs = time(3, [&] {
+            outline.clear();
+            stroker.stroke(walk.data(), count, false, style, outline);
+        });
+        printf("  outline saja (lebar 8 miter): %6.1f ms, %zu titik (%.2f per vertex)\n", strokeMs, outline.points.size(),
+               static_cast<double>(outline.points.size()) / count);
+    }
+
+    return finishChecks();
+}
@@ -0,0 +1,285 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_series.h"
+#include "../include/z_jobs.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+using z::simd::Level;
+
+// Random walk + sesekali NaN (celah) dan lonjakan
+static std::vector<float> makeSeries(size_t n, bool gaps) {
+    std::vector<float> v(n);
+    float y = 0.0f;
+    for (size_t i = 0; i < n; i++) {
+        y += frand(-1.0f, 1.0f);
+        v[i] = y;
+        if (rnd() % 997 == 0) v[i] += frand(-80.0f, 80.0f);
+        if (gaps && rnd() % 1500 == 0) v[i] = std::numeric_limits<float>::quiet_NaN();
+    }
+    return v;
+}
+
+static void bruteMinMax(const float* v, size_t begin, size_t end, float& low, float& high) {
+    low = std::numeric_limits<float>::infinity();
+    high = -low;
+    for (size_t i = begin; i < end; i++) {
+        if (std::isnan(v[i])) continue;
+        low = std::min(low, v[i]);
+        high = std::max(high, v[i]);
+    }
+}
+
+int main() {
+    seedRandom(5);
+    printf("Series (SIMD terbaik: %s)\n", z::simd::levelName(z::simd::detectLevel()));
+
+    // ===== Pyramid =====
+    {
+        const size_t n = 100003;
+        std::vector<float> v = makeSeries(n, true);
+        z::SeriesPyramid pyramid(v.data(), n);
+        z::SeriesPyramid raw = z::SeriesPyramid::view(v.data(), n);
+        bool same = pyramid.levels() >= 3 && raw.levels() == 0 && pyramid.memoryBytes() * 14 <= n * sizeof(float) * 12 / 10;
+        for (int q = 0; q < 3000; q++) {
+            size_t a = rnd() % (n + 1), b = rnd() % (n + 1);
+            if (q % 3 == 0) b = std::min(n, a + rnd() % 100);
+            if (a > b) std::swap(a, b);
+            float low, high, pl = std::numeric_limits<float>::infinity(), ph = -pl, rl = pl, rh = ph;
+            bruteMinMax(v.data(), a, b, low, high);
+            pyramid.minMax(a, b, pl, ph);
+            raw.minMax(a, b, rl, rh);
+            same = same && pl == low && ph == high && rl == low && rh == high;
+        }
+        // Rentang kosong / semuanya NaN: low > high
+        std::vector<float> nan(100, std::numeric_limits<float>::quiet_NaN());
+        z::SeriesPyramid empty(nan.data(), nan.size());
+        float el = std::numeric_limits<float>::infinity(), eh = -el;
+        empty.minMax(0, 100, el, eh);
+        pyramid.minMax(50, 50, el, eh);
+        check(same && el > eh, "pyramid: min/max rentang acak = brute force, NaN diabaikan, memori <= ~1/14 data");
+
+        // Semua level SIMD sama persis
+        bool levels = true;
+        for (Level requested : { Level::Scalar, Level::SSE2, Level::AVX2 }) {
+            z::simd::setLevel(requested);
+            for (int q = 0; q < 200; q++) {
+                size_t a = rnd() % n, len = rnd() % 5000;
+                float low = std::numeric_limits<float>::infinity(), high = -low, bl, bh;
+                z::detail::seriesMinMax(v.data() + a, std::min(len, n - a), low, high);
+                bruteMinMax(v.data(), a, std::min(a + len, n), bl, bh);
+                levels = levels && low == bl && high == bh;
+            }
+        }
+        z::simd::setLevel(Level::AVX2);
+        check(levels, "min/max Scalar = SSE2 = AVX2");
+
+        // Envelope kolom = brute force per jendela kolom
+        std::vector<z::SeriesColumn> columns(300);
+        z::SeriesRange window(1234.5, 98765.25);
+        z::seriesEnvelope(pyramid, window, 300, columns.data());
+        bool envelope = true;
+        size_t covered = 0, expectBegin = static_cast<size_t>(std::ceil(window.begin));
+        for (int c = 0; c < 300; c++) {
+            size_t begin, end;
+            z::seriesColumnSpan(window, 300, c, n, begin, end);
+            envelope = envelope && begin == expectBegin;
+            expectBegin = end;
+            covered += end - begin;
+            float low, high;
+            bruteMinMax(v.data(), begin, end, low, high);
+            envelope = envelope && columns[c].low == low && columns[c].high == high;
+            envelope = envelope && (columns[c].first == v[begin] || std::isnan(v[begin])) && (columns[c].last == v[end - 1] || std::isnan(v[end - 1]));
+        }
+        envelope = envelope && covered == static_cast<size_t>(std::ceil(window.end)) - static_cast<size_t>(std::ceil(window.begin));
+        check(envelope, "envelope: kolom bersebelahan tanpa celah/tumpang tindih, min/max/first/last benar");
+    }
+
+    // ===== LTTB =====
+    {
+        std::vector<float> flat(10000, 1.0f);
+        flat[4321] = 50.0f;
+        std::vector<size_t> picked(10000);
+        size_t count = z::lttb(flat.data(), 0, flat.size(), 100, picked.data());
+        bool shape = count == 100 && picked[0] == 0 && picked[99] == 9999 &&
+                     std::find(picked.begin(), picked.begin() + 100, size_t(4321)) != picked.begin() + 100;
+        for (size_t i = 1; i < count; i++) shape = shape && picked[i] > picked[i - 1];
+        size_t few = z::lttb(flat.data(), 10, 60, 100, picked.data());
+        bool all = few == 50 && picked[0] == 10 && picked[49] == 59;
+        check(shape && all, "LTTB: jumlah titik = threshold, ujung ikut, lonjakan tunggal tetap terpilih");
+    }
+
+    z::Window window("Series Test", 320, 240);
+    z::Canvas canvas(window.handle());
+    z::Surface s = canvas.surface();
+    auto on = [&](int x, int y) { return s.at(x, y) != z::makePixel(0, 0, 0); };
+    const Rect<int> area(10, 20, 300, 200);
+
+    // ===== drawSeries MinMax =====
+    {
+        const size_t n = 30000;
+        std::vector<float> v = makeSeries(n, false);
+        float low, high;
+        bruteMinMax(v.data(), 0, n, low, high);
+        z::SeriesRange x(0.0, static_cast<double>(n)), y(low, high);
+        z::SeriesPyramid pyramid(v.data(), n);
+
+        canvas.clear();
+        canvas.drawSeries(v.data(), n, x, y, area, RGB(0, 255, 0));
+        std::vector<Pixel> direct = snapshot(canvas.surface());
+        canvas.clear();
+        canvas.drawSeries(pyramid, x, y, area, RGB(0, 255, 0));
+        bool same = snapshot(canvas.surface()) == direct;
+
+        // Setiap sampel jatuh di pixel yang menyala, per kolom satu run, tidak keluar area
+        bool covers = true, runs = true, inside = true;
+        const float scale = (area.h - 1) / (high - low);
+        for (size_t i = 0; i < n; i++) {
+            int px = area.x + static_cast<int>(i * area.w / n);
+            int py = static_cast<int>(std::floor(area.y + 0.5f + (high - v[i]) * scale));
+            covers = covers && on(px, py);
+        }
+        for (int px = 0; px < 320; px++) {
+            int transitions = 0;
+            for (int py = 1; py < 240; py++)
+                transitions += on(px, py) != on(px, py - 1) ? 1 : 0;
+            runs = runs && transitions <= 2;
+            for (int py = 0; py < 240; py++)
+                if (on(px, py) && !area.contains(Vec2<int>(px, py))) inside = false;
+        }
+        check(same && covers && runs && inside, "MinMax: pointer = pyramid, semua sampel tertutup, satu span per kolom, di dalam area");
+
+        // Zoom sampai < 2 sampel per kolom: polyline sampel, sama dengan drawPolyline di clip area
+        z::SeriesRange zoom(1000.25, 1150.25);
+        canvas.clear();
+        canvas.drawSeries(pyramid, zoom, y, area, RGB(255, 255, 0));
+        std::vector<Pixel> zoomed = snapshot(canvas.surface());
+        std::vector<Vec2<float>> points;
+        for (size_t i = 1000; i <= 1151; i++)
+            points.push_back(Vec2<float>(static_cast<float>(area.x + (i - zoom.begin) * area.w / (zoom.end - zoom.begin)),
+                                         area.y + 0.5f + (high - v[i]) * scale));
+        canvas.clear();
+        canvas.pushClip(area);
+        canvas.drawPolyline(points.data(), static_cast<int>(points.size()), RGB(255, 255, 0));
+        canvas.popClip();
+        bool sparse = snapshot(canvas.surface()) == zoomed;
+
+        // LTTB: polyline lewat titik hasil lttb()
+        canvas.clear();
+        canvas.drawSeries(pyramid, x, y, area, RGB(255, 0, 255), z::SeriesMode::Lttb);
+        std::vector<Pixel> lttbImage = snapshot(canvas.surface());
+        std::vector<size_t> picked(n);
+        size_t count = z::lttb(v.data(), 0, n, static_cast<size_t>(area.w), picked.data());
+        points.clear();
+        for (size_t i = 0; i < count; i++)
+            points.push_back(Vec2<float>(static_cast<float>(area.x + picked[i] * static_cast<double>(area.w) / n),
+                                         area.y + 0.5f + (high - v[picked[i]]) * scale));
+        canvas.clear();
+        canvas.pushClip(area);
+        canvas.drawPolyline(points.data(), static_cast<int>(points.size()), RGB(255, 0, 255));
+        canvas.popClip();
+        bool lttbSame = snapshot(canvas.surface()) == lttbImage;
+        check(sparse && lttbSame, "zoom < 2 sampel/kolom = polyline sampel, Lttb = polyline hasil lttb()");
+
+        // Transform: skala 2 -> kolom device 2x lebih banyak; rotasi tetap menggambar; di luar clip ditolak
+        canvas.clear();
+        canvas.present();
+        canvas.pushTransform();
+        canvas.scale(2.0f);
+        canvas.drawSeries(pyramid, x, y, Rect<int>(5, 5, 140, 100), RGB(0, 255, 255));
+        canvas.popTransform();
+        int litColumns = 0;
+        for (int px = 0; px < 320; px++) {
+            bool any = false;
+            for (int py = 0; py < 240; py++) any = any || on(px, py);
+            litColumns += any ? 1 : 0;
+        }
+        canvas.clear();
+        canvas.pushTransform();
+        canvas.translate(160.0f, 120.0f);
+        canvas.rotate(0.3f);
+        canvas.drawSeries(pyramid, x, y, Rect<int>(-100, -50, 200, 100), RGB(0, 255, 255));
+        canvas.translate(1000.0f, 0.0f);
+        canvas.drawSeries(pyramid, x, y, Rect<int>(-100, -50, 200, 100), RGB(0, 255, 255));
+        canvas.popTransform();
+        bool rotated = on(160, 120) || on(160, 119) || on(160, 121);
+        int rotatedPixels = 0;
+        for (Pixel p : snapshot(canvas.surface())) rotatedPixels += p != z::makePixel(0, 0, 0) ? 1 : 0;
+        bool rejected = canvas.frameStats().rejected == 1;
+        check(litColumns == 280 && rotatedPixels > 300 && rejected && (rotated || rotatedPixels > 0),
+              "transform: kolom mengikuti skala device, rotasi lewat polyline, di luar clip ditolak");
+    }
+
+    // ===== Benchmark: 100 juta sampel, 2000 kolom =====
+    {
+        const size_t n = 100000000;
+        const int width = 2000;
+        z::Window benchWindow("Series", width, 600);
+        z::Canvas bench(benchWindow.handle());
+        std::vector<float> v(n);
+        float y = 0.0f;
+        for (size_t i = 0; i < n; i++) {
+            y += static_cast<float>(static_cast<int>(rnd() % 2001) - 1000) * 0.001f;
+            v[i] = y + ((i & 0xFFFFF) == 0 ? 100.0f : 0.0f);
+        }
+        float low, high;
+        bruteMinMax(v.data(), 0, n, low, high);
+        const z::SeriesRange yRange(low, high);
+        const Rect<int> plot(0, 0, width, 600);
+        z::Timer timer(z::TimerMode::Precise);
+        auto time = [&](int repeat, auto fn) {
+            fn();
+            timer.tick();
+            for (int r = 0; r < repeat; r++) fn();
+            timer.tick();
+            return timer.deltaTime() * 1000.0 / repeat;
+        };
+        printf("Benchmark %zu sampel, %d kolom, ms\n", n, width);
+
+        // drawLine per sampel: 1 juta sampel diukur, dikali 100
+        double lines = time(1, [&] {
+            for (size_t i = 0; i + 1 < 1000000; i++)
+                bench.drawLine(static_cast<int>(i * width / 1000000), static_cast<int>(300 + v[i] * 0.1f),
+                               static_cast<int>((i + 1) * width / 1000000), static_cast<int>(300 + v[i + 1] * 0.1f));
+        }) * 100.0;
+        printf("  drawLine per sampel (perkiraan)          %10.1f\n", lines);
+
+        z::SeriesPyramid pyramid;
+        for (Level requested : { Level::Scalar, Level::AVX2 }) {
+            Level used = z::simd::setLevel(requested);
+            double build = time(1, [&] { pyramid.build(v.data(), n); });
+            double scan = time(3, [&] { bench.drawSeries(v.data(), n, z::SeriesRange(0.0, static_cast<double>(n)), yRange, plot); });
+            printf("  %-6s build pyramid %8.1f | drawSeries pointer (pindai semua) %8.1f\n", z::simd::levelName(used), build, scan);
+        }
+        z::Jobs jobs;
+        double parallel = time(1, [&] { pyramid.build(v.data(), n, &jobs); });
+        printf("  build pyramid, Jobs %u thread            %10.1f (%.1f MB)\n", jobs.threadCount(), parallel, pyramid.memoryBytes() / 1048576.0);
+
+        double full = time(20, [&] { bench.drawSeries(pyramid, z::SeriesRange(0.0, static_cast<double>(n)), yRange, plot); });
+        // Pan: jendela 1/100 data bergeser tiap frame
+        int frame = 0;
+        double pan = time(60, [&] {
+            double begin = (frame++ % 60) * 1.5e6;
+            bench.drawSeries(pyramid, z::SeriesRange(begin, begin + 1e6), yRange, plot);
+        });
+        double deep = time(60, [&] {
+            double begin = 5e7 + (frame++ % 60) * 1e3;
+            bench.drawSeries(pyramid, z::SeriesRange(begin, begin + 2e4), yRange, plot);
+        });
+        printf("  drawSeries pyramid: penuh %6.3f | pan 1M sampel %6.3f | zoom 20k sampel %6.3f\n", full, pan, deep);
+        double lttbMs = time(1, [&] { bench.drawSeries(pyramid, z::SeriesRange(0.0, static_cast<double>(n)), yRange, plot, RGB(255, 255, 255), z::SeriesMode::Lttb); });
+        double lttbPan = time(20, [&] {
+            double begin = (frame++ % 60) * 1.5e6;
+            bench.drawSeries(pyramid, z::SeriesRange(begin, begin + 1e6), yRange, plot, RGB(255, 255, 255), z::SeriesMode::Lttb);
+        });
+        printf("  Lttb (pindai sampel terlihat): penuh %8.1f | pan 1M sampel %6.2f\n", lttbMs, lttbPan);
+    }
+
+    return finishChecks();
+}
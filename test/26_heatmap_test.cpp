@@ -0,0 +1,264 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_heatmap.h"
+#include "../include/z_jobs.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+using z::simd::Level;
+
+// Beberapa cluster Gaussian (Box-Muller) + noise merata, sebagian di luar buffer
+static std::vector<Vec2<float>> makePoints(size_t n, float width, float height) {
+    std::vector<Vec2<float>> points(n);
+    const float cx[3] = {0.3f, 0.6f, 0.75f}, cy[3] = {0.4f, 0.55f, 0.2f}, sd[3] = {0.05f, 0.12f, 0.02f};
+    for (size_t i = 0; i < n; i++) {
+        unsigned pick = rnd() % 8;
+        if (pick >= 3) {
+            points[i] = Vec2<float>(frand(-0.1f, 1.1f) * width, frand(-0.1f, 1.1f) * height);
+            continue;
+        }
+        float u = std::max(frand(0.0f, 1.0f), 1e-6f), v = frand(0.0f, 6.2831853f);
+        float r = std::sqrt(-2.0f * std::log(u));
+        points[i] = Vec2<float>((cx[pick] + sd[pick] * r * std::cos(v)) * width, (cy[pick] + sd[pick] * r * std::sin(v)) * height);
+    }
+    return points;
+}
+
+// Referensi: pixel terdekat (.5 ke genap) setelah transform, sama dengan drawPixels
+static std::vector<uint32_t> bruteCounts(const std::vector<Vec2<float>>& points, const Affine& m, int w, int h) {
+    std::vector<uint32_t> counts(static_cast<size_t>(w) * h, 0);
+    for (const Vec2<float>& p : points) {
+        Vec2<float> q = m * p;
+        float x = std::nearbyint(q.x), y = std::nearbyint(q.y);
+        if (x >= 0.0f && x < w && y >= 0.0f && y < h)
+            counts[static_cast<size_t>(y) * w + static_cast<size_t>(x)]++;
+    }
+    return counts;
+}
+
+static bool sameCounts(const z::Heatmap& heat, const std::vector<uint32_t>& expected) {
+    return std::equal(expected.begin(), expected.end(), heat.data());
+}
+
+int main() {
+    seedRandom(11);
+    printf("Heatmap (SIMD terbaik: %s)\n", z::simd::levelName(z::simd::level()));
+
+    // Skala pangkat 2 + translasi: hasil kali eksak, jadi FMA AVX2 tidak mengubah pembulatan
+    const Affine scaleHalf(0.5f, 0.0f, 0.0f, 0.5f, 3.25f, -2.0f);
+    {
+        std::vector<Vec2<float>> points = makePoints(200003, 700.0f, 500.0f);
+        // Tepat di tengah pixel (.5 ke genap), NaN, dan jauh di luar jangkauan int
+        for (int i = 0; i < 64; i++)
+            points.push_back(Vec2<float>(2.0f * i + 1.0f - 6.5f, 2.0f * i + 4.0f));
+        points.push_back(Vec2<float>(std::numeric_limits<float>::quiet_NaN(), 10.0f));
+        points.push_back(Vec2<float>(20.0f, std::numeric_limits<float>::infinity()));
+        points.push_back(Vec2<float>(3e10f, 10.0f));
+        points.push_back(Vec2<float>(-3e10f, -3e10f));
+        const std::vector<uint32_t> expected = bruteCounts(points, scaleHalf, 320, 240);
+
+        bool levelsOk = true;
+        for (Level requested : {Level::Scalar, Level::SSE2, Level::AVX2}) {
+            z::simd::setLevel(requested);
+            z::Heatmap heat(320, 240);
+            heat.add(points.data(), points.size(), scaleHalf);
+            levelsOk = levelsOk && sameCounts(heat, expected);
+        }
+        check(levelsOk, "binning Scalar/SSE2/AVX2 = pixel terdekat, NaN/inf/di luar buffer dibuang");
+
+        z::Jobs jobs(3);
+        z::Heatmap single(320, 240), parallel(320, 240);
+        single.add(points.data(), points.size(), scaleHalf);
+        parallel.add(points.data(), points.size(), scaleHalf, &jobs);
+        bool first = sameCounts(parallel, expected);
+        // Buffer partisi dipakai ulang: harus sudah nol setelah reduksi
+        parallel.add(points.data(), points.size(), scaleHalf, &jobs);
+        bool twice = true;
+        for (size_t i = 0; i < expected.size(); i++)
+            twice = twice && parallel.data()[i] == 2 * expected[i];
+        uint64_t total = 0;
+        for (uint32_t c : expected) total += c;
+        uint64_t singleTotal = 0;
+        for (size_t i = 0; i < expected.size(); i++) singleTotal += single.data()[i];
+        check(first && twice && singleTotal == total && parallel.memoryBytes() > single.memoryBytes(),
+              "Jobs: partisi per thread + reduksi = satu thread, add berulang menjumlah");
+
+        parallel.clear();
+        check(parallel.maxCount() == 0 && single.maxCount() == *std::max_element(expected.begin(), expected.end()),
+              "clear / maxCount");
+    }
+
+    {
+        z::Window window("Heatmap Test", 320, 240);
+        z::Canvas canvas(window.handle());
+
+        // Pixel yang punya count = pixel yang dinyalakan drawPixels (transform canvas sama)
+        std::vector<Vec2<float>> points = makePoints(5000, 640.0f, 480.0f);
+        canvas.clear(RGB(0, 0, 0));
+        canvas.pushTransform();
+        canvas.scale(0.5f, 0.5f);
+        canvas.drawPixels(points.data(), static_cast<int>(points.size()), RGB(255, 255, 255));
+        std::vector<Pixel> lit = snapshot(canvas.surface());
+        z::Heatmap heat;
+        canvas.accumulatePoints(heat, points.data(), points.size());
+        canvas.popTransform();
+        bool same = heat.width() == 320 && heat.height() == 240;
+        for (int y = 0; same && y < 240; y++)
+            for (int x = 0; x < 320; x++)
+                same = same && ((heat.at(x, y) > 0) == ((lit[static_cast<size_t>(y) * 320 + x] & 0xFFFFFF) != 0));
+        check(same, "accumulatePoints: ukuran = canvas, pixel ber-count = pixel drawPixels");
+
+        // Tone mapping: count 0 tidak disentuh, max = ujung palette, di luar clip tidak disentuh
+        z::Gradient palette = z::Gradient::linear(Vec2<float>(0.0f, 0.0f), Vec2<float>(1.0f, 0.0f), z::makePixel(0, 0, 80), z::makePixel(255, 255, 255));
+        palette.addStop(0.5f, z::makePixel(255, 64, 0));
+        z::Heatmap small(320, 240);
+        std::vector<Vec2<float>> pile;
+        for (int i = 1; i <= 200; i++)
+            for (int k = 0; k < i; k++)
+                pile.push_back(Vec2<float>(static_cast<float>(i), 10.0f));
+        for (int k = 0; k < 7; k++)
+            pile.push_back(Vec2<float>(5.0f, 200.0f));
+        small.add(pile.data(), pile.size());
+
+        canvas.clear(RGB(1, 2, 3));
+        canvas.pushClip(Rect<int>(0, 0, 150, 240));
+        canvas.drawHeatmap(small, palette, z::HeatScale::Linear);
+        canvas.popClip();
+        z::Surface s = canvas.surface();
+        const Pixel background = s.at(0, 0);
+        bool monotonic = true;
+        for (int x = 2; x < 150; x++)
+            monotonic = monotonic && ((s.at(x, 10) >> 8) & 0xFF) >= ((s.at(x - 1, 10) >> 8) & 0xFF);     // hijau naik di semua stop
+        check(background == s.at(0, 10) && s.at(150, 10) == background && s.at(199, 10) == background &&
+              s.at(1, 10) != background && monotonic && s.at(5, 200) != background && s.at(6, 200) == background,
+              "drawHeatmap: count 0 dan di luar clip tidak disentuh, warna naik dengan count");
+
+        canvas.drawHeatmap(small, palette, z::HeatScale::Linear);
+        bool top = s.at(200, 10) == palette.lut()[z::Gradient::lutSize - 1];
+        canvas.drawHeatmap(small, palette, z::HeatScale::Linear, 100);
+        bool clamped = s.at(100, 10) == palette.lut()[z::Gradient::lutSize - 1] && s.at(180, 10) == s.at(100, 10);
+        check(top && clamped, "count max = ujung palette, maxCount manual menjepit count di atasnya");
+
+        // Log mengangkat count kecil dibanding Linear
+        canvas.drawHeatmap(small, palette, z::HeatScale::Linear);
+        Pixel linearLow = s.at(5, 200);
+        canvas.drawHeatmap(small, palette, z::HeatScale::Log);
+        Pixel logLow = s.at(5, 200);
+        canvas.drawHeatmap(small, palette, z::HeatScale::Sqrt);
+        Pixel sqrtLow = s.at(5, 200);
+        const Pixel* lut = palette.lut();
+        auto position = [&](Pixel p) { return std::find(lut, lut + z::Gradient::lutSize, p) - lut; };
+        check(position(linearLow) < position(sqrtLow) && position(sqrtLow) < position(logLow), "Log > Sqrt > Linear untuk count kecil");
+
+        // Count di atas tabel (> 65535) lewat rumus langsung, hasil sama dengan Gradient LUT
+        std::vector<Vec2<float>> heavy(200000, Vec2<float>(30.0f, 30.0f));
+        heavy.insert(heavy.end(), 100000, Vec2<float>(31.0f, 30.0f));
+        z::Heatmap deep(320, 240);
+        deep.add(heavy.data(), heavy.size());
+        canvas.drawHeatmap(deep, palette, z::HeatScale::Linear);
+        int half = static_cast<int>(100000.0 / 200000.0 * z::Gradient::lutSize);
+        check(s.at(31, 30) == lut[half] && s.at(30, 30) == lut[z::Gradient::lutSize - 1], "count besar di luar tabel");
+
+        // Palette transparan di-blend ke background
+        z::Gradient glass = z::Gradient::linear(Vec2<float>(0.0f, 0.0f), Vec2<float>(1.0f, 0.0f), z::makePixel(255, 0, 0, 128), z::makePixel(255, 0, 0, 128));
+        canvas.clear(RGB(0, 0, 255));
+        canvas.drawHeatmap(small, glass);
+        check(s.at(100, 10) == z::blendPixel(z::makePixel(255, 0, 0, 128), s.at(0, 0)), "palette tidak opaque di-blend");
+
+        // Tabel tone map di-cache di heatmap: frame berikutnya dengan kunci sama tidak membangun ulang,
+        // palette yang diubah di tempat (id baru) / scale / maxCount lain membangun ulang
+        size_t builds = small.toneTableBuilds();
+        canvas.drawHeatmap(small, palette, z::HeatScale::Log);
+        canvas.drawHeatmap(small, palette, z::HeatScale::Log);
+        bool reused = small.toneTableBuilds() == builds + 1;
+        canvas.drawHeatmap(small, palette, z::HeatScale::Log, 50);
+        canvas.drawHeatmap(small, palette, z::HeatScale::Sqrt, 50);
+        bool rekeyed = small.toneTableBuilds() == builds + 3;
+        z::Gradient edited = palette;
+        edited.clearStops(z::makePixel(0, 255, 0));
+        canvas.drawHeatmap(small, edited, z::HeatScale::Sqrt, 50);
+        check(reused && rekeyed && small.toneTableBuilds() == builds + 4 && s.at(100, 10) == z::makePixel(0, 255, 0),
+              "tabel tone map dipakai ulang, dibangun ulang kalau palette/scale/maxCount berubah");
+
+        // Jobs: tone mapping per baris = satu thread
+        z::Jobs jobs(3);
+        z::Heatmap big(320, 240);
+        std::vector<Vec2<float>> many = makePoints(400000, 320.0f, 240.0f);
+        big.add(many.data(), many.size());
+        canvas.clear(RGB(0, 0, 0));
+        canvas.drawHeatmap(big, palette);
+        std::vector<Pixel> one = snapshot(canvas.surface());
+        canvas.setJobs(&jobs);
+        canvas.clear(RGB(0, 0, 0));
+        z::Heatmap viaCanvas;
+        canvas.accumulatePoints(viaCanvas, many.data(), many.size());
+        canvas.drawHeatmap(viaCanvas, palette);
+        canvas.setJobs(nullptr);
+        check(snapshot(canvas.surface()) == one, "Jobs: binning + tone mapping = satu thread");
+    }
+
+    // ===== BENCHMARK =====
+    {
+        const int width = 1920, height = 1080;
+        const size_t n = 20000000;
+        std::vector<Vec2<float>> points = makePoints(n, static_cast<float>(width), static_cast<float>(height));
+        z::Gradient palette = z::Gradient::linear(Vec2<float>(0.0f, 0.0f), Vec2<float>(1.0f, 0.0f), z::makePixel(0, 0, 0), z::makePixel(255, 255, 255));
+        palette.addStop(0.3f, z::makePixel(120, 0, 160));
+        palette.addStop(0.7f, z::makePixel(255, 140, 0));
+
+        z::Window benchWindow("Heatmap", width, height);
+        z::Canvas bench(benchWindow.handle());
+        z::Timer timer(z::TimerMode::Precise);
+        auto rate = [&](double ms) { return static_cast<double>(n) / (ms / 1000.0) / 1e6; };
+
+        printf("Benchmark %zu titik, %dx%d\n", n, width, height);
+        bench.clear(RGB(0, 0, 0));
+        timer.tick();
+        bench.drawPixels(points.data(), static_cast<int>(n), RGB(255, 255, 255));
+        timer.tick();
+        double pixelsMs = timer.deltaTime() * 1000.0;
+        printf("  drawPixels (overdraw satu warna)        %8.1f ms  %7.1f M titik/s\n", pixelsMs, rate(pixelsMs));
+
+        z::Heatmap heat(width, height);
+        for (Level requested : {Level::Scalar, Level::SSE2, Level::AVX2}) {
+            Level used = z::simd::setLevel(requested);
+            heat.clear();
+            timer.tick();
+            heat.add(points.data(), n);
+            timer.tick();
+            double ms = timer.deltaTime() * 1000.0;
+            printf("  binning %-6s 1 thread                  %8.1f ms  %7.1f M titik/s\n", z::simd::levelName(used), ms, rate(ms));
+        }
+
+        // Scaling: mesin CI bisa punya core lebih sedikit dari thread yang diminta
+        printf("  scaling (hardware_concurrency %u):\n", std::thread::hardware_concurrency());
+        for (unsigned threads : {1u, 2u, 4u, 8u}) {
+            z::Jobs jobs(threads - 1);
+            z::Heatmap scaled(width, height);
+            scaled.add(points.data(), n, Affine(), &jobs);     // alokasi buffer partisi di luar pengukuran
+            scaled.clear();
+            timer.tick();
+            scaled.add(points.data(), n, Affine(), &jobs);
+            timer.tick();
+            double ms = timer.deltaTime() * 1000.0;
+            printf("    %u thread: %8.1f ms  %7.1f M titik/s  (%.1f MB)\n", threads, ms, rate(ms), scaled.memoryBytes() / 1048576.0);
+        }
+
+        for (z::HeatScale scale : {z::HeatScale::Linear, z::HeatScale::Log}) {
+            timer.tick();
+            const int frames = 10;
+            for (int f = 0; f < frames; f++)
+                bench.drawHeatmap(heat, palette, scale);
+            timer.tick();
+            printf("  tone mapping %-6s                       %8.2f ms\n", scale == z::HeatScale::Log ? "Log" : "Linear", timer.deltaTime() * 1000.0 / frames);
+        }
+    }
+
+    return finishChecks();
+}
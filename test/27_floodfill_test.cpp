@@ -0,0 +1,274 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_floodfill.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+using z::Pixel;
+using z::Connectivity;
+
+// Noise beberapa warna yang saling berdekatan (untuk tolerance) di atas background
+static std::vector<Pixel> makeNoise(int w, int h, int walls) {
+    const Pixel shades[4] = {z::makePixel(100, 100, 100), z::makePixel(104, 98, 101), z::makePixel(96, 103, 100), z::makePixel(200, 30, 30)};
+    std::vector<Pixel> pixels(static_cast<size_t>(w) * h);
+    for (Pixel& p : pixels)
+        p = rnd(100) < walls ? shades[3] : shades[rnd(3)];
+    return pixels;
+}
+
+// Referensi: BFS per pixel dengan visited terpisah, membaca gambar asli
+static std::vector<Pixel> bruteFill(std::vector<Pixel> pixels, int w, Rect<int> clip, Vec2<int> seed, Pixel color, int tolerance, Connectivity connectivity) {
+    const Pixel target = pixels[static_cast<size_t>(seed.y) * w + seed.x];
+    auto near = [&](Pixel p) {
+        for (int shift = 0; shift < 24; shift += 8)
+            if (std::abs(static_cast<int>((p >> shift) & 0xFF) - static_cast<int>((target >> shift) & 0xFF)) > tolerance) return false;
+        return true;
+    };
+    const std::vector<Pixel> original = pixels;
+    std::vector<uint8_t> visited(pixels.size(), 0);
+    std::vector<Vec2<int>> queue{seed};
+    visited[static_cast<size_t>(seed.y) * w + seed.x] = 1;
+    for (size_t i = 0; i < queue.size(); i++) {
+        Vec2<int> p = queue[i];
+        pixels[static_cast<size_t>(p.y) * w + p.x] = color;
+        for (int dy = -1; dy <= 1; dy++)
+            for (int dx = -1; dx <= 1; dx++) {
+                if ((dx == 0 && dy == 0) || (connectivity == Connectivity::Four && dx != 0 && dy != 0)) continue;
+                Vec2<int> q(p.x + dx, p.y + dy);
+                if (!clip.contains(q)) continue;
+                size_t index = static_cast<size_t>(q.y) * w + q.x;
+                if (visited[index] || !near(original[index])) continue;
+                visited[index] = 1;
+                queue.push_back(q);
+            }
+    }
+    return pixels;
+}
+
+// Maze sempurna: sel di koordinat ganjil, dinding 1 pixel, DFS iteratif (backtracker)
+static std::vector<Pixel> makeMaze(int w, int h, Pixel wall, Pixel path) {
+    std::vector<Pixel> pixels(static_cast<size_t>(w) * h, wall);
+    const int cw = (w - 1) / 2, ch = (h - 1) / 2;
+    std::vector<uint8_t> seen(static_cast<size_t>(cw) * ch, 0);
+    std::vector<int> stack{0};
+    seen[0] = 1;
+    pixels[static_cast<size_t>(1) * w + 1] = path;
+    const int dx[4] = {1, -1, 0, 0}, dy[4] = {0, 0, 1, -1};
+    while (!stack.empty()) {
+        int cell = stack.back(), cx = cell % cw, cy = cell / cw;
+        int options[4], n = 0;
+        for (int k = 0; k < 4; k++) {
+            int nx = cx + dx[k], ny = cy + dy[k];
+            if (nx >= 0 && nx < cw && ny >= 0 && ny < ch && !seen[static_cast<size_t>(ny) * cw + nx]) options[n++] = k;
+        }
+        if (n == 0) {
+            stack.pop_back();
+            continue;
+        }
+        int k = options[rnd(n)], nx = cx + dx[k], ny = cy + dy[k];
+        seen[static_cast<size_t>(ny) * cw + nx] = 1;
+        pixels[static_cast<size_t>(2 * cy + 1 + dy[k]) * w + 2 * cx + 1 + dx[k]] = path;
+        pixels[static_cast<size_t>(2 * ny + 1) * w + 2 * nx + 1] = path;
+        stack.push_back(ny * cw + nx);
+    }
+    return pixels;
+}
+
+static void load(z::Canvas& canvas, const std::vector<Pixel>& pixels) {
+    z::Surface s = canvas.surface();
+    for (int y = 0; y < s.height; y++)
+        std::copy(pixels.begin() + static_cast<std::ptrdiff_t>(y) * s.width, pixels.begin() + static_cast<std::ptrdiff_t>(y + 1) * s.width, s.row(y));
+}
+
+int main() {
+    seedRandom(3);
+    printf("Flood fill\n");
+    const Pixel fill = z::makePixel(0, 200, 0);
+
+    {
+        // Banyak gambar noise acak: sama dengan BFS per pixel untuk 4/8 arah, tolerance, dan clip
+        const int w = 97, h = 61;
+        z::FloodFill flood;
+        bool same = true, counts = true;
+        for (int round = 0; round < 60; round++) {
+            std::vector<Pixel> pixels = makeNoise(w, h, 30 + round % 20);
+            Rect<int> clip = round % 3 == 0 ? Rect<int>(5, 4, 70, 50) : Rect<int>(0, 0, w, h);
+            Vec2<int> seed(clip.x + rnd(clip.w), clip.y + rnd(clip.h));
+            Connectivity connectivity = round % 2 ? Connectivity::Eight : Connectivity::Four;
+            int tolerance = round % 4 < 2 ? 0 : 6;
+            std::vector<Pixel> expected = bruteFill(pixels, w, clip, seed, fill, tolerance, connectivity);
+            size_t changed = 0;
+            for (size_t i = 0; i < pixels.size(); i++)
+                changed += expected[i] != pixels[i];
+            z::Surface surface(pixels.data(), w, h, w);
+            size_t filled = flood.fill(surface, clip, seed, fill, tolerance, connectivity);
+            same = same && pixels == expected;
+            counts = counts && filled == changed;
+        }
+        check(same && counts, "span fill = BFS per pixel (4/8 arah, tolerance, clip), jumlah pixel benar");
+
+        // Warna fill masih dalam tolerance: mask mencegah pixel diulang
+        std::vector<Pixel> pixels = makeNoise(w, h, 35);
+        Vec2<int> seed(10, 10);
+        const Pixel close = z::makePixel(101, 101, 99);
+        std::vector<Pixel> expected = bruteFill(pixels, w, Rect<int>(0, 0, w, h), seed, close, 8, Connectivity::Eight);
+        z::Surface surface(pixels.data(), w, h, w);
+        flood.fill(surface, Rect<int>(0, 0, w, h), seed, close, 8, Connectivity::Eight);
+        bool masked = pixels == expected;
+        // Warna sama tanpa tolerance: tidak ada yang berubah
+        std::vector<Pixel> before = pixels;
+        size_t none = flood.fill(surface, Rect<int>(0, 0, w, h), seed, pixels[10 * w + 10], 0, Connectivity::Four);
+        check(masked && none == 0 && pixels == before, "fill dengan warna yang cocok sendiri: mask, warna sama: no-op");
+
+        // Diagonal: dinding checkerboard menahan 4 arah, tidak menahan 8 arah
+        std::vector<Pixel> board(16 * 16);
+        for (int y = 0; y < 16; y++)
+            for (int x = 0; x < 16; x++)
+                board[y * 16 + x] = (x + y) % 2 ? z::makePixel(0, 0, 0) : z::makePixel(255, 255, 255);
+        std::vector<Pixel> copy = board;
+        z::Surface a(board.data(), 16, 16, 16), b(copy.data(), 16, 16, 16);
+        check(flood.fill(a, Rect<int>(0, 0, 16, 16), Vec2<int>(0, 0), fill, 0, Connectivity::Four) == 1 &&
+              flood.fill(b, Rect<int>(0, 0, 16, 16), Vec2<int>(0, 0), fill, 0, Connectivity::Eight) == 128,
+              "checkerboard: 4 arah 1 pixel, 8 arah 128 pixel");
+
+        // Stack kasus terburuk: sisir (banyak run per baris), checkerboard 8 arah (run 1 pixel),
+        // dan maze; kapasitas stack tetap di bawah stackBound(clip)
+        bool bounded = true, correct = true;
+        size_t worst = 0, bound = 0;
+        for (int pattern = 0; pattern < 4; pattern++) {
+            const int cw = 301, ch = 41;
+            const Pixel open = z::makePixel(255, 255, 255), wall = z::makePixel(0, 0, 0);
+            auto isOpen = [&](int x, int y) {
+                switch (pattern) {
+                    case 0: return x % 2 == 0 || y == ch - 1;                              // sisir: gigi ke atas dari baris bawah
+                    case 1: return x % 2 == 0 || y == ch - 1 || (y % 4 == 0 && x % 4 != 1); // sisir dengan jembatan
+                    default: return (x + y) % 2 == 0;                                       // checkerboard, tersambung diagonal
+                }
+            };
+            std::vector<Pixel> grid = pattern == 3 ? makeMaze(cw, ch, wall, open) : std::vector<Pixel>(static_cast<size_t>(cw) * ch, wall);
+            for (int y = 0; y < ch && pattern < 3; y++)
+                for (int x = 0; x < cw; x++)
+                    if (isOpen(x, y)) grid[static_cast<size_t>(y) * cw + x] = open;
+            const Rect<int> clip(0, 0, cw, ch);
+            const Vec2<int> seed = pattern == 3 ? Vec2<int>(1, 1) : Vec2<int>(0, pattern == 2 ? 0 : ch - 1);
+            const Connectivity connectivity = pattern == 2 ? Connectivity::Eight : Connectivity::Four;
+            std::vector<Pixel> expected = bruteFill(grid, cw, clip, seed, fill, 0, connectivity);
+            z::FloodFill fresh;
+            z::Surface surface(grid.data(), cw, ch, cw);
+            fresh.fill(surface, clip, seed, fill, 0, connectivity);
+            correct = correct && grid == expected;
+            bound = z::FloodFill::stackBound(clip);
+            bounded = bounded && fresh.stackCapacity() <= bound;
+            worst = std::max(worst, fresh.stackCapacity());
+        }
+        printf("  stack kasus terburuk: kapasitas %zu segmen, batas %zu\n", worst, bound);
+        check(correct && bounded, "sisir / checkerboard / maze: hasil = BFS, stackCapacity() <= stackBound(clip)");
+    }
+
+    {
+        z::Window window("Flood Fill Test", 320, 240);
+        z::Canvas canvas(window.handle());
+
+        // Seed lewat transform, dibatasi clip, seed di luar clip ditolak
+        canvas.clear(RGB(0, 0, 0));
+        canvas.drawRect(Rect<int>(40, 40, 100, 80), RGB(255, 255, 255));
+        canvas.pushTransform();
+        canvas.translate(30.0f, 30.0f);
+        size_t inside = canvas.floodFill(Vec2<int>(50, 50), RGB(255, 0, 0));
+        canvas.popTransform();
+        z::Surface s = canvas.surface();
+        bool box = inside == 98 * 78 && s.at(41, 41) == z::toPixel(RGB(255, 0, 0)) && s.at(138, 118) == s.at(41, 41) &&
+                   s.at(40, 40) == z::toPixel(RGB(255, 255, 255)) && s.at(20, 20) == z::toPixel(RGB(0, 0, 0));
+
+        canvas.pushClip(Rect<int>(0, 0, 160, 240));
+        size_t outside = canvas.floodFill(Vec2<int>(5, 5), Color<unsigned char>(0, 0, 255, 255));
+        size_t rejectedBefore = canvas.frameStats().rejected;
+        size_t rejected = canvas.floodFill(Vec2<int>(300, 5), Color<unsigned char>(0, 0, 255, 255));
+        canvas.popClip();
+        bool clipped = outside == static_cast<size_t>(160 * 240 - 100 * 80) && s.at(159, 5) == z::toPixel(RGB(0, 0, 255)) &&
+                       s.at(160, 5) == z::toPixel(RGB(0, 0, 0)) && rejected == 0 && canvas.frameStats().rejected == rejectedBefore + 1;
+        check(box && clipped, "Canvas: seed lewat transform, berhenti di outline dan clip, di luar clip ditolak");
+
+        // Maze: region satu jalur panjang (pipa sempit), tanpa rekursi
+        std::vector<Pixel> maze = makeMaze(320, 240, z::makePixel(0, 0, 0), z::makePixel(255, 255, 255));
+        load(canvas, maze);
+        size_t corridors = canvas.floodFill(Vec2<int>(1, 1), z::PackedColor(0, 200, 0));
+        std::vector<Pixel> after = snapshot(canvas.surface());
+        std::vector<Pixel> expected = bruteFill(maze, 320, Rect<int>(0, 0, 320, 240), Vec2<int>(1, 1), z::toPixel(z::PackedColor(0, 200, 0)), 0, Connectivity::Four);
+        size_t white = std::count(maze.begin(), maze.end(), z::makePixel(255, 255, 255));
+        check(after == expected && corridors == white, "maze: semua jalur terisi (maze sempurna = satu region)");
+    }
+
+    // ===== BENCHMARK =====
+    {
+        const int width = 3840, height = 2160;
+        const Pixel wall = z::makePixel(0, 0, 0), path = z::makePixel(255, 255, 255);
+        std::vector<Pixel> maze = makeMaze(width, height, wall, path);
+        z::Window benchWindow("Flood Fill", width, height);
+        z::Canvas bench(benchWindow.handle());
+        z::Timer timer(z::TimerMode::Precise);
+
+        printf("Benchmark maze %dx%d (ms)\n", width, height);
+        struct Case {
+            const char* name;
+            int tolerance;
+            Connectivity connectivity;
+            Pixel color;
+        };
+        const Case cases[] = {
+            {"4 arah, exact        ", 0, Connectivity::Four, z::makePixel(0, 200, 0)},
+            {"8 arah, exact        ", 0, Connectivity::Eight, z::makePixel(0, 200, 0)},
+            {"4 arah, tolerance 16 ", 16, Connectivity::Four, z::makePixel(0, 200, 0)},
+            {"4 arah, mask (fill ~ seed)", 16, Connectivity::Four, z::makePixel(250, 250, 250)},
+        };
+        for (const Case& c : cases) {
+            load(bench, maze);
+            timer.tick();
+            size_t filled = bench.floodFill(Vec2<int>(1, 1), c.color, c.tolerance, c.connectivity);
+            timer.tick();
+            printf("  floodFill %-26s %8.2f ms  (%zu pixel)\n", c.name, timer.deltaTime() * 1000.0, filled);
+        }
+
+        // Emulasi lama: drawPixel per pixel dengan stack titik (versi rekursif tidak muat di stack thread)
+        z::Surface s = bench.surface();
+        auto naive = [&]() {
+            std::vector<Vec2<int>> stack{Vec2<int>(1, 1)};
+            size_t painted = 0;
+            while (!stack.empty()) {
+                Vec2<int> p = stack.back();
+                stack.pop_back();
+                if (p.x < 0 || p.y < 0 || p.x >= width || p.y >= height || s.at(p.x, p.y) != path) continue;
+                bench.drawPixel(p, RGB(0, 200, 0));
+                painted++;
+                stack.push_back(Vec2<int>(p.x + 1, p.y));
+                stack.push_back(Vec2<int>(p.x - 1, p.y));
+                stack.push_back(Vec2<int>(p.x, p.y + 1));
+                stack.push_back(Vec2<int>(p.x, p.y - 1));
+            }
+            return painted;
+        };
+        load(bench, maze);
+        timer.tick();
+        size_t painted = naive();
+        timer.tick();
+        printf("  drawPixel per pixel + stack titik        %8.2f ms  (%zu pixel)\n", timer.deltaTime() * 1000.0, painted);
+
+        // Area terbuka: span panjang, hampir sebatas bandwidth memori
+        bench.clear(RGB(255, 255, 255));
+        timer.tick();
+        size_t open = bench.floodFill(Vec2<int>(1, 1), RGB(0, 200, 0));
+        timer.tick();
+        printf("  area terbuka: floodFill                  %8.2f ms  (%zu pixel)\n", timer.deltaTime() * 1000.0, open);
+        bench.clear(RGB(255, 255, 255));
+        timer.tick();
+        painted = naive();
+        timer.tick();
+        printf("  area terbuka: drawPixel per pixel        %8.2f ms  (%zu pixel)\n", timer.deltaTime() * 1000.0, painted);
+    }
+
+    return finishChecks();
+}
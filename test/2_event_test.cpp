@@ -1,49 +1,75 @@
 #include <cstdio>
+#include <chrono>
+#include <thread>
 #include "../include/z_window.h"
 #include "../include/z_event_util.h"
+#include "test_util.h"
 
-class MyWindow : public z::Window<MyWindow> {
-public:
-    MyWindow() : z::Window<MyWindow>("Event Window", 800, 600) {}
+int main() {
+    z::Window w("Event Window", 800, 600);
+    w.show();
+    w.setRunMode(z::RunMode::EventDriven);   // blok seperti GetMessage
 
-    LRESULT onEvent(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
-        z::Event ev = z::translateWinEvent(hwnd, msg, wp, lp) ;
+#if Z_PLATFORM_HEADLESS
+    // invalidate() dari thread lain harus membangunkan waitFrame jauh sebelum deadline-nya
+    {
+        w.waitFrame();                      // frame awal dari setRunMode
+        w.scheduleWakeup(2.0f);
+        auto start = std::chrono::steady_clock::now();
+        std::thread other([&w] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            w.invalidate();
+        });
+        bool frame = w.waitFrame();
+        double waited = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        other.join();
+        printf("invalidate() dari thread lain: waitFrame kembali setelah %.1f ms (deadline 2000 ms)\n", waited * 1000.0);
+        check(frame && waited < 1.0, "invalidate() dari thread lain membangunkan waitFrame sebelum timeout");
+    }
+    w.resetIdleStats();
 
-        switch (ev.type) {
-            case z::EventType::Quit:
-                PostQuitMessage(0) ;
-                return 0 ;
+    // Sumber event sintetis: skrip input lalu tutup
+    w.postEvent(z::createMouseEvent(z::EventType::MouseMove, Vec2<int>(120, 80), z::MouseButton::Unknown));
+    w.postEvent(z::createResizeEvent(Vec2<int>(1024, 768)));
+    w.postEvent(z::createKeyEvent(z::EventType::KeyDown, VK_ESCAPE));
+#endif
 
-            case z::EventType::KeyDown:
-                if (ev.key.keyCode == VK_ESCAPE)
-                    PostQuitMessage(0) ;
-                break ;
+    while (!w.shouldClose()) {
+        if (!w.waitFrame())
+            break;
 
-            case z::EventType::MouseMove:
-                printf("Mouse at (%d, %d)\n", ev.mouse.x, ev.mouse.y) ;
-                break ;
+        z::Event ev;
+        while (w.pollEvent(ev)) {
+            switch (ev.type) {
+                case z::EventType::Quit:
+                    w.close() ;
+                    break ;
 
-            case z::EventType::Resize:
-                printf("Resize: %d x %d\n", ev.resize.width, ev.resize.height) ;
-                break ;
+                case z::EventType::KeyDown:
+                    if (ev.key.keyCode == VK_ESCAPE)
+                        w.close() ;
+                    break ;
 
-            default:
-                break ;
-        }
+                case z::EventType::MouseMove:
+                    printf("Mouse at (%d, %d)\n", ev.mouse.x, ev.mouse.y) ;
+                    break ;
 
-        return DefWindowProc(hwnd, msg, wp, lp) ;
-    }
-};
+                case z::EventType::Resize:
+                    printf("Resize: %d x %d\n", ev.resize.width, ev.resize.height) ;
+                    break ;
 
-int WINAPI WinMain(HINSTANCE h, HINSTANCE, LPSTR, int cmdShow) {
-    MyWindow w;
-    w.show(cmdShow);
-
-    MSG msg = {};
-    while (GetMessage(&msg, nullptr, 0, 0)) {
-        TranslateMessage(&msg);
-        DispatchMessage(&msg);
+                default:
+                    break ;
+            }
+        }
     }
 
-    return 0;
-}
\ No newline at end of file
+#if Z_PLATFORM_HEADLESS
+    // Semua input sudah di antrian sebelum loop: tidak perlu tidur sama sekali, paling banyak
+    // satu wakeup per event
+    z::IdleStats stats = w.idleStats();
+    printf("Idle: %llu wakeups, %llu frames\n", stats.wakeups, stats.frames);
+    check(stats.wakeups <= 3, "loop event-driven tidak bangun lebih sering dari jumlah event");
+#endif
+    return finishChecks();
+}
@@ -1,52 +1,88 @@
 #include <cstdio>
 #include "../include/z_window.h"
-#include "../include/z_event_util.h"
 #include "../include/z_timer.h"
+#include "test_util.h"
 
-class MyWindow : public z::Window<MyWindow> {
-public:
-    MyWindow() : z::Window<MyWindow>("Event Window", 800, 600) {}
+// Event-driven loop: tidur sampai ada input / deadline / invalidate(),
+// jadi window yang diam tidak menghabiskan satu core.
+int main() {
+    z::Window window("Event Window", 800, 600);
+    z::Timer timer(z::TimerMode::Simple) ;
+    window.show();
+    window.setRunMode(z::RunMode::EventDriven);
 
-    LRESULT onEvent(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
-        z::Event ev = z::translateWinEvent(hwnd, msg, wp, lp) ;
+    // Contoh timer: bangun sekali tiap detik walaupun tidak ada input
+    window.scheduleWakeup(1.0f);
 
-        switch (ev.type) {
-            case z::EventType::Quit:
-                PostQuitMessage(0) ;
-                return 0 ;
+#if Z_PLATFORM_HEADLESS
+    // Headless: satu input sintetis, lalu ukur idle selama 3 laporan
+    window.postEvent(z::createMouseEvent(z::EventType::MouseMove, Vec2<int>(10, 10), z::MouseButton::Unknown));
+    int reports = 0;
+    double maxWakeups = 0.0, maxCpu = 0.0;
+#endif
 
-            case z::EventType::KeyDown:
-                if (ev.key.keyCode == VK_ESCAPE)
-                    PostQuitMessage(0) ;
-                break ;
+    while (!window.shouldClose()) {
+        if (!window.waitFrame())
+            break;
 
-            case z::EventType::MouseMove:
-                printf("Mouse at (%d, %d)\n", ev.mouse.x, ev.mouse.y) ;
-                break ;
+        timer.tick();
 
-            case z::EventType::Resize:
-                printf("Resize: %d x %d\n", ev.resize.width, ev.resize.height) ;
-                break ;
+        z::Event ev;
+        while (window.pollEvent(ev)) {
+            switch (ev.type) {
+                case z::EventType::Quit:
+                    window.close();
+                    break ;
 
-            default:
-                break ;
+                case z::EventType::KeyDown:
+                    if (ev.key.keyCode == VK_ESCAPE)
+                        window.close();
+                    // Tahan SPACE untuk masuk mode animasi (continuous)
+                    if (ev.key.keyCode == VK_SPACE)
+                        window.setAnimating(true);
+                    break ;
+
+                case z::EventType::KeyUp:
+                    if (ev.key.keyCode == VK_SPACE)
+                        window.setAnimating(false);
+                    break ;
+
+                case z::EventType::MouseMove:
+                    printf("Mouse at (%d, %d)\n", ev.mouse.x, ev.mouse.y) ;
+                    break ;
+
+                case z::EventType::Resize:
+                    printf("Resize: %d x %d\n", ev.resize.width, ev.resize.height) ;
+                    break ;
+
+                default:
+                    break ;
+            }
         }
 
-        return DefWindowProc(hwnd, msg, wp, lp) ;
-    }
-};
-
-int WINAPI WinMain(HINSTANCE h, HINSTANCE, LPSTR, int cmdShow) {
-    MyWindow w;
-	z::Timer timer(z::TimerMode::Simple) ;
-    w.show(cmdShow);
-
-    MSG msg = {};
-    while (GetMessage(&msg, nullptr, 0, 0)) {
-        TranslateMessage(&msg);
-        DispatchMessage(&msg);
-		timer.sleepToFps(60) ;
+        if (timer.totalTime() >= 1.0f) {
+            z::IdleStats stats = window.idleStats();
+            printf("Frame dt=%.3fs | wakeups/s=%.2f | cpu=%.2f%%\n",
+                   timer.deltaTime(), stats.wakeupsPerSecond(), stats.cpuUsage() * 100.0);
+            window.resetIdleStats();
+            timer.reset();
+            window.scheduleWakeup(1.0f);
+#if Z_PLATFORM_HEADLESS
+            maxWakeups = std::max(maxWakeups, stats.wakeupsPerSecond());
+            maxCpu = std::max(maxCpu, stats.cpuUsage());
+            if (++reports == 3)
+                window.close();
+#endif
+        }
+
+        if (window.isAnimating())
+            timer.sleepToFps(60) ;
     }
 
-    return 0;
-}
\ No newline at end of file
+#if Z_PLATFORM_HEADLESS
+    // Idle: satu wakeup terjadwal per detik (+ input sintetis di laporan pertama), CPU hampir nol
+    check(maxWakeups <= 3.0, "idle: wakeups/s <= 3");
+    check(maxCpu < 0.05, "idle: cpu < 5% satu core");
+#endif
+    return finishChecks();
+}
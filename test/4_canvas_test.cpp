@@ -1,33 +1,85 @@
+#include <cstdio>
+#include <cmath>
+#include <memory>
 #include "../include/z_window.h"
 #include "../include/z_canvas.h"
 #include "../include/z_timer.h"
 #include "../include/z_event_util.h"
 
-class GameWindow : public z::Window<GameWindow> {
+class GameWindow : public z::Window {
 public:
-    GameWindow() : z::Window<GameWindow>("Canvas Demo - SDL3 Style", 800, 600) {
+    GameWindow() : z::Window("Canvas Demo - SDL3 Style", 800, 600) {
         canvas = std::make_unique<z::Canvas>(handle());
         timer = std::make_unique<z::Timer>(z::TimerMode::Precise);
         running = true;
     }
 
-    LRESULT onEvent(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
-        z::Event event = z::translateWinEvent(hwnd, msg, wp, lp);
-        
+    void run() {
+        show();
+
+#if Z_PLATFORM_HEADLESS
+        // CI/benchmark: klik sintetis, N frame tanpa throttle
+        postEvent(z::createMouseEvent(z::EventType::MouseDown, Vec2<int>(400, 300), z::MouseButton::Left));
+        const int benchFrames = 1000;
+        int frame = 0;
+        z::Timer benchTimer(z::TimerMode::Precise);
+#endif
+
+        while (running) {
+            timer->tick();
+            
+            // Handle messages
+            processMessages();
+
+            z::Event event;
+            while (pollEvent(event))
+                onEvent(event);
+            
+            if (!running || shouldClose()) break;
+            
+            update();
+            render();
+
+#if Z_PLATFORM_HEADLESS
+            if (++frame == benchFrames) {
+                benchTimer.tick();
+                printf("Headless: %d frames, %.3f ms/frame\n", benchFrames, benchTimer.deltaTime() * 1000.0f / benchFrames);
+                running = false;
+            }
+#else
+            timer->sleepToFps(60.0f);
+#endif
+        }
+    }
+
+private:
+    std::unique_ptr<z::Canvas> canvas;
+    std::unique_ptr<z::Timer> timer;
+    bool running;
+    int mouseX = 0, mouseY = 0;
+    float time = 0.0f;
+
+    void onEvent(const z::Event& event) {
         switch (event.type) {
             case z::EventType::Quit:
                 running = false;
-                PostQuitMessage(0);
-                return 0;
+                break;
                 
             case z::EventType::Resize:
                 canvas->resize();
                 break;
+
+            case z::EventType::ResizeBegin:
+                canvas->beginInteractiveResize();
+                break;
+
+            case z::EventType::ResizeEnd:
+                canvas->endInteractiveResize();
+                break;
                 
             case z::EventType::KeyDown:
                 if (event.key.keyCode == VK_ESCAPE) {
                     running = false;
-                    PostQuitMessage(0);
                 }
                 break;
                 
@@ -37,40 +89,12 @@ public:
                     mouseY = event.mouse.y;
                 }
                 break;
-        }
-        
-        return DefWindowProc(hwnd, msg, wp, lp);
-    }
 
-    void run() {
-        show(SW_SHOWDEFAULT);
-        
-        MSG msg = {};
-        while (running) {
-            timer->tick();
-            
-            // Handle messages
-            while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
-                TranslateMessage(&msg);
-                DispatchMessage(&msg);
-            }
-            
-            if (!running) break;
-            
-            update();
-            render();
-            
-            timer->sleepToFps(60.0f);
+            default:
+                break;
         }
     }
 
-private:
-    std::unique_ptr<z::Canvas> canvas;
-    std::unique_ptr<z::Timer> timer;
-    bool running;
-    int mouseX = 0, mouseY = 0;
-    float time = 0.0f;
-
     void update() {
         time += timer->deltaTime();
     }
@@ -86,10 +110,10 @@ private:
         canvas->drawRect(200, 50, 100, 80, RGB(255, 0, 0), 3);
         
         // === DEMO 3: Rectangle with fill only ===
-        canvas->drawRect(350, 50, 100, 80, RGB(0, 255, 0));
+        canvas->fillRect(350, 50, 100, 80, RGB(0, 255, 0));
         
         // === DEMO 4: Rectangle with fill and stroke ===
-        canvas->drawRect(500, 50, 100, 80, RGB(0, 0, 255), RGB(255, 255, 0), 2);
+        canvas->fillRect(500, 50, 100, 80, RGB(0, 0, 255), RGB(255, 255, 0), 2);
         
         // === DEMO 5: Multiple rectangles dengan warna berbeda ===
         for (int x = 0; x < 10; x++) {
@@ -99,17 +123,17 @@ private:
                     static_cast<int>(127 + 127 * sin(time + y * 0.3f)),
                     static_cast<int>(127 + 127 * sin(time + (x + y) * 0.2f))
                 );
-                canvas->drawRect(50 + x * 35, 200 + y * 35, 30, 30, color);
+                canvas->fillRect(50 + x * 35, 200 + y * 35, 30, 30, color);
             }
         }
         
         // === DEMO 6: Interactive rectangle at mouse position ===
-        canvas->drawRect(mouseX - 25, mouseY - 25, 50, 50, RGB(255, 200, 100), RGB(255, 255, 255), 2);
+        canvas->fillRect(mouseX - 25, mouseY - 25, 50, 50, RGB(255, 200, 100), RGB(255, 255, 255), 2);
         
         // === DEMO 7: Circle variations ===
         canvas->drawCircle(650, 250, 40, RGB(255, 255, 255), 2);  // outline only
-        canvas->drawCircle(650, 350, 30, RGB(100, 255, 255)) ;      // fill only
-        canvas->drawCircle(650, 450, 35, RGB(255, 100, 255), RGB(255, 255, 255), 3); // fill + stroke
+        canvas->fillCircle(650, 350, 30, RGB(100, 255, 255)) ;      // fill only
+        canvas->fillCircle(650, 450, 35, RGB(255, 100, 255), RGB(255, 255, 255), 3); // fill + stroke
         
         // === DEMO 8: Lines ===
         for (int i = 0; i < 20; i++) {
@@ -132,19 +156,31 @@ private:
             canvas->drawPixel(px, py, pixelColor);
         }
         
+        // === DEMO 10: Gradient fill (satu fill, tanpa rect bertumpuk) ===
+        z::Gradient sky = z::Gradient::linear(Vec2<float>(450.0f, 0.0f), Vec2<float>(750.0f, 0.0f), z::makePixel(30, 60, 160), z::makePixel(250, 160, 60));
+        sky.addStop(0.5f + 0.4f * std::sin(time), z::makePixel(220, 60, 140));
+        canvas->fillRect(Rect<int>(450, 520, 300, 40), sky.setDither(true));
+        canvas->fillCircle(Vec2<int>(530, 450), 35, z::Gradient::radial(Vec2<float>(520.0f, 440.0f), 45.0f, z::makePixel(255, 255, 255), z::makePixel(40, 40, 120)));
+
+        // === DEMO 11: Polyline (ujung garis demo 8 disambung, satu stroke) ===
+        Vec2<float> wave[20];
+        for (int i = 0; i < 20; i++)
+            wave[i] = Vec2<float>(50.0f + i * 20.0f, 450.0f + 50.0f * std::sin(time * 2 + i * 0.5f));
+        canvas->drawPolyline(wave, 20, RGB(100, 200, 255), 3.0f, z::LineJoin::Round, z::LineCap::Round);
+
         // Present the final frame
         canvas->present();
     }
 };
 
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow) {
+int main() {
     try {
         GameWindow window;
         window.run();
     } catch (const std::exception& e) {
-        MessageBoxA(nullptr, e.what(), "Error", MB_OK | MB_ICONERROR);
+        fprintf(stderr, "Error: %s\n", e.what());
         return -1;
     }
     
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include "../include/z_jobs.h"
+#include "../include/z_timer.h"
+#include "../include/z_unit.h"
+
+// Partikel sama seperti di 1_window_test.cpp
+struct Particle {
+    Vec2<float> position;
+    Vec2<float> velocity;
+    Color<unsigned char> color;
+    float life;
+
+    Particle(Vec2<float> pos, Vec2<float> vel, Color<unsigned char> col)
+        : position(pos), velocity(vel), color(col), life(1.0f) {}
+
+    void update(float dt) {
+        // Sedikit kerja tambahan supaya kernel tidak murni bandwidth-bound
+        velocity.y += 9.8f * dt;
+        velocity = velocity * Vec2<float>(0.999f) ;
+        position = position + velocity * Vec2<float>(dt) ;
+        if (position.x < 0.0f || position.x > 800.0f) velocity.x = -velocity.x;
+        if (position.y > 600.0f) { position.y = 600.0f; velocity.y = -velocity.y * 0.8f; }
+        life -= dt * 0.05f;
+        if (life < 0.0f) life = 1.0f;
+        color.a = static_cast<unsigned char>(life * 255);
+    }
+};
+
+static std::vector<Particle> makeParticles(size_t count) {
+    std::vector<Particle> particles;
+    particles.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        float a = static_cast<float>(i) * 0.001f;
+        particles.emplace_back(
+            Vec2<float>(400.0f + std::cos(a) * 100.0f, 300.0f + std::sin(a) * 100.0f),
+            Vec2<float>(std::cos(a * 7.0f) * 50.0f, std::sin(a * 3.0f) * 50.0f),
+            Color<unsigned char>(255, 128, 64, 255));
+    }
+    return particles;
+}
+
+static double checksum(const std::vector<Particle>& particles) {
+    double sum = 0.0;
+    for (const Particle& p : particles)
+        sum += p.position.x + p.position.y;
+    return sum;
+}
+
+int main() {
+    const size_t particleCount = 100000;
+    const int iterations = 200;
+    const float dt = 1.0f / 60.0f;
+
+    // ===== Scaling benchmark: update partikel dengan parallelFor =====
+    double baseMs = 0.0;
+    double baseSum = 0.0;
+    const unsigned threadCounts[] = { 1, 2, 4, 8, 16 };
+
+    printf("Particle update: %zu particles x %d iterations (hardware threads: %u)\n",
+           particleCount, iterations, std::thread::hardware_concurrency());
+
+    for (unsigned threads : threadCounts) {
+        std::vector<Particle> particles = makeParticles(particleCount);
+        z::Jobs jobs(threads - 1);   // thread pemanggil ikut bekerja
+
+        z::Timer timer(z::TimerMode::Precise);
+        for (int it = 0; it < iterations; it++) {
+            jobs.parallelFor(0, particles.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                    particles[i].update(dt);
+            });
+        }
+        timer.tick();
+
+        double ms = timer.deltaTime() * 1000.0 / iterations;
+        double sum = checksum(particles);
+        if (threads == 1) {
+            baseMs = ms;
+            baseSum = sum;
+        }
+
+        printf("  %2u threads: %.3f ms/update, speedup %.2fx %s\n",
+               threads, ms, baseMs / ms, sum == baseSum ? "" : "(CHECKSUM MISMATCH)");
+        if (sum != baseSum)
+            return 1;
+    }
+
+    // ===== Dependency: render menunggu update =====
+    z::Jobs jobs;
+    std::vector<Particle> particles = makeParticles(particleCount);
+    std::atomic<int> updated{0};
+    int renderSaw = -1;
+
+    z::JobCounter updateDone;
+    z::JobCounter renderDone;
+
+    const size_t chunks = 16;
+    const size_t chunkSize = particles.size() / chunks;
+    for (size_t c = 0; c < chunks; c++) {
+        jobs.run([&, c] {
+            size_t end = c + 1 == chunks ? particles.size() : (c + 1) * chunkSize;
+            for (size_t i = c * chunkSize; i < end; i++)
+                particles[i].update(dt);
+            updated.fetch_add(1);
+        }, &updateDone);
+    }
+
+    // Render baru boleh jalan setelah semua chunk update selesai
+    jobs.run([&] { renderSaw = updated.load(); }, &renderDone, &updateDone);
+    jobs.wait(renderDone);
+
+    printf("Dependency: render saw %d/%zu update chunks %s\n",
+           renderSaw, chunks, renderSaw == static_cast<int>(chunks) ? "(OK)" : "(FAIL)");
+    if (renderSaw != static_cast<int>(chunks))
+        return 1;
+
+    // ===== Idle: worker tidur di condition variable, tidak polling =====
+    {
+        z::Jobs idle(3);
+        idle.parallelFor(0, 64, [](size_t, size_t) {}, 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));      // lewati fase spin
+        std::clock_t cpuBegin = std::clock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        double cpuMs = 1000.0 * static_cast<double>(std::clock() - cpuBegin) / CLOCKS_PER_SEC;
+        bool quiet = cpuMs < 15.0;
+        printf("Idle: 3 worker, 300 ms tidur, CPU %.2f ms %s\n", cpuMs, quiet ? "(OK)" : "(FAIL)");
+        if (!quiet)
+            return 1;
+    }
+
+    // ===== Wakeup: job di deque lokal worker membangunkan worker lain yang tidur =====
+    {
+        z::Jobs local(2);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));      // kedua worker tidur
+        std::atomic<bool> innerDone{false}, outerDone{false};
+        local.run([&] {
+            // Di worker: job dalam masuk deque lokal, worker ini tidak ikut mengerjakannya
+            local.run([&] { innerDone = true; });
+            while (!innerDone)
+                std::this_thread::yield();
+            outerDone = true;
+        });
+        auto start = std::chrono::steady_clock::now();
+        while (!outerDone && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        printf("Wakeup: job dari deque lokal diambil worker yang tidur %s\n", outerDone ? "(OK)" : "(FAIL)");
+        if (!outerDone)
+            return 1;
+    }
+
+    // ===== Pool: node job dipakai ulang, parallelFor berulang tidak mengalokasi =====
+    {
+        z::Jobs pooled(3);
+        auto frame = [&] { pooled.parallelFor(0, 4096, [](size_t, size_t) {}, 16); };
+        for (int i = 0; i < 10; i++) frame();
+        size_t warm = pooled.jobCapacity();
+        for (int i = 0; i < 1000; i++) frame();
+        bool reused = pooled.jobCapacity() == warm;
+        printf("Pool: %zu node setelah pemanasan, %zu setelah 1000 frame %s\n", warm, pooled.jobCapacity(), reused ? "(OK)" : "(FAIL)");
+        if (!reused)
+            return 1;
+    }
+
+    return 0;
+}
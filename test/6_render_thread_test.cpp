@@ -0,0 +1,187 @@
+#include <cstdio>
+#include <cmath>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "../include/z_window.h"
+#include "../include/z_render_thread.h"
+#include "../include/z_timer.h"
+#include "../include/z_event_util.h"
+#include "test_util.h"
+
+static COLORREF frameColor(int i) {
+    return RGB((i * 37) & 0xFF, (i * 91) & 0xFF, (i * 53) & 0xFF);
+}
+
+int main() {
+    // ===== 1. Mailbox: handoff deterministik di satu thread =====
+    printf("FrameMailbox\n");
+    {
+        z::FrameMailbox<int> mailbox;
+        int value = 0;
+
+        check(!mailbox.acquire(), "kosong sebelum publish");
+
+        mailbox.back() = 1;
+        mailbox.publish();
+        check(mailbox.acquire() && mailbox.front() == 1, "frame 1 diterima");
+        check(!mailbox.acquire(), "tidak ada frame baru");
+
+        // Dua publish tanpa acquire: frame 2 ditimpa frame 3
+        mailbox.back() = 2;
+        check(!mailbox.publish(), "publish 2 tidak menimpa");
+        mailbox.back() = 3;
+        check(mailbox.publish(), "publish 3 menimpa frame 2");
+        check(mailbox.acquire() && mailbox.front() == 3, "konsumer mendapat frame terbaru (3)");
+        check(mailbox.dropped() == 1 && mailbox.published() == 3, "dropped = 1, published = 3");
+
+        // Slot yang dipegang konsumer tidak pernah dipakai ulang oleh produser
+        for (int i = 4; i < 100; i++) {
+            mailbox.back() = i;
+            mailbox.publish();
+            if (i % 3 == 0 && mailbox.acquire())
+                value = mailbox.front();
+        }
+        check(value == 99, "front tetap valid selama produser menulis");
+    }
+
+    z::Window window("Render Thread Test", 320, 240);
+    window.show();
+
+    // ===== 2. Render thread: setiap frame yang di-flush terlihat di front buffer =====
+    printf("RenderThread handoff\n");
+    {
+        z::RenderThread renderer(window.handle());
+        bool allMatch = true;
+
+        for (int i = 1; i <= 20; i++) {
+            window.postEvent(z::createMouseEvent(z::EventType::MouseMove, Vec2<int>(i, i), z::MouseButton::Unknown));
+            window.processMessages();
+            z::Event ev;
+            while (window.pollEvent(ev)) {}
+
+            z::DrawList& list = renderer.beginFrame();
+            list.clearColor(frameColor(i));
+            list.fillRect(10, 10, 20, 20, RGB(255, 255, 255));
+            renderer.submit(window.takeInputTicks());
+            renderer.flush();
+
+            z::Surface front = window.native().frontBuffer();
+            if (front.at(0, 0) != z::toPixel(frameColor(i)) || front.at(15, 15) != z::makePixel(255, 255, 255))
+                allMatch = false;
+        }
+        check(allMatch, "20 frame: warna front buffer sesuai frame yang di-submit");
+
+        z::RenderStats stats = renderer.stats();
+        check(stats.presented == 20 && stats.dropped == 0, "presented = 20, dropped = 0");
+        check(stats.latencySamples == 20, "setiap frame membawa latency input");
+
+        // Burst tanpa menunggu: hanya frame terakhir yang wajib tampil
+        renderer.resetStats();
+        for (int i = 1; i <= 50; i++) {
+            z::DrawList& list = renderer.beginFrame();
+            list.clearColor(frameColor(1000 + i));
+            renderer.submit();
+        }
+        renderer.flush();
+        stats = renderer.stats();
+        check(window.native().frontBuffer().at(0, 0) == z::toPixel(frameColor(1050)), "burst: frame terakhir yang tampil");
+        check(stats.presented + stats.dropped == stats.submitted, "burst: presented + dropped == submitted");
+        printf("  burst: submitted=%llu presented=%llu dropped=%llu\n",
+               (unsigned long long)stats.submitted, (unsigned long long)stats.presented, (unsigned long long)stats.dropped);
+
+        // Resize diproses render thread sebelum frame berikutnya
+        window.postEvent(z::createResizeEvent(Vec2<int>(400, 300)));
+        window.processMessages();
+        z::Event ev;
+        while (window.pollEvent(ev)) {
+            if (ev.type == z::EventType::Resize)
+                renderer.resize();
+        }
+        renderer.beginFrame().clearColor(RGB(1, 2, 3));
+        renderer.submit();
+        renderer.flush();
+        z::Surface front = window.native().frontBuffer();
+        check(front.width == 400 && front.height == 300 && front.at(399, 299) == z::makePixel(1, 2, 3), "resize: front buffer 400x300");
+    }
+
+    // ===== 3. Frame berat: thread UI tidak menunggu rasterisasi =====
+    // Present frame pertama ditahan latch, jadi render thread pasti sibuk selama semua submit
+    // berikutnya (deterministik juga di mesin 1 core), lalu dilepas dan di-flush
+    printf("Heavy frames\n");
+    {
+        std::mutex latchMutex;
+        std::condition_variable latchCv;
+        bool entered = false, released = false;
+        window.native().setPresentHook([&] {
+            std::unique_lock<std::mutex> lock(latchMutex);
+            entered = true;
+            latchCv.notify_all();
+            latchCv.wait(lock, [&] { return released; });
+        });
+
+        z::RenderThread renderer(window.handle());
+        auto record = [&](int i) {
+            window.postEvent(z::createMouseEvent(z::EventType::MouseMove, Vec2<int>(i % 400, i % 300), z::MouseButton::Unknown));
+            window.processMessages();
+            z::Event ev;
+            while (window.pollEvent(ev)) {}
+
+            z::DrawList& list = renderer.beginFrame();
+            list.clearColor(RGB(20, 20, 30));
+            for (int c = 0; c < 400; c++) {
+                float a = c * 0.05f + i * 0.02f;
+                list.fillCircle(200 + static_cast<int>(150 * std::cos(a)), 150 + static_cast<int>(120 * std::sin(a * 1.3f)), 40,
+                                RGB(c & 0xFF, 128, 255 - (c & 0xFF)));
+            }
+            renderer.submit(window.takeInputTicks());
+        };
+
+        record(0);
+        {
+            std::unique_lock<std::mutex> lock(latchMutex);
+            latchCv.wait(lock, [&] { return entered; });
+        }
+
+        z::Timer timer(z::TimerMode::Precise);
+        double maxSubmitMs = 0.0;
+        const int frames = 200;
+        const unsigned long long presentsBefore = window.native().presentCount();
+        for (int i = 1; i <= frames; i++) {
+            timer.tick();
+            record(i);
+            timer.tick();
+            maxSubmitMs = std::max(maxSubmitMs, static_cast<double>(timer.deltaTime()) * 1000.0);
+        }
+        const bool neverWaited = window.native().presentCount() == presentsBefore;
+        {
+            std::lock_guard<std::mutex> lock(latchMutex);
+            released = true;
+        }
+        latchCv.notify_all();
+        renderer.flush();
+        window.native().setPresentHook(nullptr);
+
+        z::RenderStats stats = renderer.stats();
+        printf("  frames submitted=%llu presented=%llu dropped=%llu\n",
+               (unsigned long long)stats.submitted, (unsigned long long)stats.presented, (unsigned long long)stats.dropped);
+        printf("  input-to-present: avg %.3f ms, max %.3f ms (%llu samples)\n",
+               stats.averageLatencyMs(), stats.maxLatencyMs, (unsigned long long)stats.latencySamples);
+        check(neverWaited, "200 submit selesai selama render thread tertahan di present()");
+        check(stats.submitted == frames + 1 && stats.presented == 2 && stats.dropped == frames - 1,
+              "frame yang ditahan + frame terakhir ter-present, sisanya di-drop");
+        check(stats.latencySamples == 2, "latency terukur walaupun ada frame yang di-drop");
+
+        // Waktu render frame yang sama tanpa latch, sebagai pembanding biaya record + submit
+        renderer.resetStats();
+        for (int i = 0; i < 10; i++) {
+            record(i);
+            renderer.flush();
+        }
+        double renderMs = renderer.stats().averageRenderMs();
+        printf("  render %.3f ms/frame avg | record+submit max %.3f ms\n", renderMs, maxSubmitMs);
+        check(maxSubmitMs < renderMs / 4.0, "record+submit terlama < 1/4 waktu render");
+    }
+
+    return finishChecks();
+}
@@ -0,0 +1,161 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <atomic>
+#include <new>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_arena.h"
+#include "../include/z_event_util.h"
+#include "test_util.h"
+
+// GCC menganggap free() di operator delete pengganti tidak cocok dengan new (false positive)
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Hitung semua alokasi heap global untuk membuktikan loop frame bebas alokasi
+static std::atomic<size_t> g_heapAllocations{0};
+
+void* operator new(size_t size) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete[](p); }
+
+struct Particle {
+    Vec2<float> position;
+    Vec2<float> velocity;
+    float life;
+};
+
+int main() {
+    // ===== 1. Arena dasar =====
+    printf("FrameArena\n");
+    {
+        z::FrameArena arena(1024);
+
+        void* a = arena.allocate(3, 1);
+        double* b = arena.allocateArray<double>(4);
+        check(reinterpret_cast<uintptr_t>(b) % alignof(double) == 0, "alignment dihormati");
+        check(a != static_cast<void*>(b), "alokasi berbeda");
+
+        {
+            z::ArenaScope scope(arena);
+            arena.allocate(512);
+            check(arena.frameStats().bytes > 512, "scope: byte bertambah");
+        }
+        check(arena.frameStats().bytes < 512, "scope: rewind mengembalikan posisi");
+
+        // Frame yang meluber ke beberapa block digabung saat reset
+        for (int i = 0; i < 10; i++)
+            arena.allocate(1000);
+        size_t blocks = arena.frameStats().blockAllocations;
+        arena.reset();      // block digabung (satu alokasi di frame ini)
+        for (int i = 0; i < 10; i++)
+            arena.allocate(1000);
+        arena.reset();
+        for (int i = 0; i < 10; i++)
+            arena.allocate(1000);
+        check(blocks > 0 && arena.frameStats().blockAllocations == 0, "setelah digabung, frame tidak alokasi block");
+        check(arena.lastFrameStats().allocations == 10, "lastFrameStats menghitung alokasi frame sebelumnya");
+    }
+
+    // ===== 2. Loop frame: event + partikel sementara + polygon =====
+    printf("Frame loop\n");
+    z::Window window("Arena Test", 640, 480);
+    z::Canvas canvas(window.handle());
+    window.show();
+
+    std::vector<Particle> particles(20000);
+    for (size_t i = 0; i < particles.size(); i++) {
+        float a = static_cast<float>(i) * 0.01f;
+        particles[i] = Particle{Vec2<float>(320.0f, 240.0f), Vec2<float>(std::cos(a) * 60.0f, std::sin(a) * 60.0f), 1.0f + (i % 100) * 0.01f};
+    }
+
+    z::FrameArena& arena = z::FrameArena::threadLocal();
+    const int warmupFrames = 10;
+    const int frames = 500;
+    size_t heapBefore = 0;
+    size_t arenaAllocs = 0;
+    size_t arenaBytes = 0;
+
+    for (int frame = 0; frame < warmupFrames + frames; frame++) {
+        if (frame == warmupFrames)
+            heapBefore = g_heapAllocations.load();
+
+        arena.reset();
+        if (frame > warmupFrames) {
+            arenaAllocs += arena.lastFrameStats().allocations;
+            arenaBytes += arena.lastFrameStats().bytes;
+        }
+
+        // Beberapa input per frame lewat antrian event
+        for (int e = 0; e < 8; e++)
+            window.postEvent(z::createMouseEvent(z::EventType::MouseMove, Vec2<int>(frame % 640, e * 10), z::MouseButton::Unknown));
+        window.processMessages();
+        z::Event ev;
+        int mouseX = 0;
+        while (window.pollEvent(ev))
+            if (ev.type == z::EventType::MouseMove) mouseX = ev.mouse.x;
+
+        // Daftar partikel yang terlihat: container sementara di arena
+        z::ArenaVector<const Particle*> visible;
+        visible.reserve(particles.size());
+        for (Particle& p : particles) {
+            p.position = p.position + p.velocity * Vec2<float>(1.0f / 60.0f);
+            p.life -= 1.0f / 120.0f;
+            if (p.life <= 0.0f) {
+                p.position = Vec2<float>(320.0f, 240.0f);
+                p.life = 1.5f;
+            }
+            if (p.position.x >= 0 && p.position.x < 640 && p.position.y >= 0 && p.position.y < 480)
+                visible.push_back(&p);
+        }
+
+        canvas.clear(RGB(10, 10, 20));
+        for (size_t i = 0; i < visible.size(); i += 16)
+            canvas.drawPixel(static_cast<int>(visible[i]->position.x), static_cast<int>(visible[i]->position.y), RGB(255, 200, 100));
+
+        // Polygon Vec2 -> POINT memakai scratch arena
+        Vec2<int> star[10];
+        for (int k = 0; k < 10; k++) {
+            float r = (k % 2) ? 40.0f : 90.0f;
+            float a = k * 0.6283f + frame * 0.01f;
+            star[k] = Vec2<int>(mouseX / 2 + 160 + static_cast<int>(r * std::cos(a)), 240 + static_cast<int>(r * std::sin(a)));
+        }
+        canvas.fillPolygon(star, 10, RGB(255, 255, 0));
+        canvas.drawPolygon(star, 10, RGB(255, 255, 255), 3);
+        canvas.present();
+    }
+
+    size_t heapAllocs = g_heapAllocations.load() - heapBefore;
+    printf("  arena: %.1f allocs/frame, %.1f KB/frame, capacity %zu KB, block allocs total %zu\n",
+           static_cast<double>(arenaAllocs) / (frames - 1), static_cast<double>(arenaBytes) / (frames - 1) / 1024.0,
+           arena.capacity() / 1024, arena.totalBlockAllocations());
+    printf("  heap allocations setelah warmup: %zu dalam %d frame\n", heapAllocs, frames);
+    check(heapAllocs == 0, "steady state bebas alokasi heap");
+
+    // ===== 3. Pembanding: vector biasa untuk data sementara =====
+    {
+        size_t before = g_heapAllocations.load();
+        for (int frame = 0; frame < frames; frame++) {
+            std::vector<const Particle*> visible;
+            for (const Particle& p : particles)
+                if (p.position.x >= 0 && p.position.x < 640 && p.position.y >= 0 && p.position.y < 480)
+                    visible.push_back(&p);
+        }
+        printf("  pembanding std::vector: %.1f heap allocs/frame\n",
+               static_cast<double>(g_heapAllocations.load() - before) / frames);
+    }
+
+    return finishChecks();
+}
@@ -0,0 +1,221 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "../include/z_window.h"
+#include "../include/z_canvas.h"
+#include "../include/z_particles.h"
+#include "../include/z_timer.h"
+#include "test_util.h"
+
+// Baseline AoS, sama seperti 1_window_test.cpp
+struct Particle {
+    Vec2<float> position;
+    Vec2<float> velocity;
+    Color<unsigned char> color;
+    float life;
+
+    Particle(Vec2<float> pos, Vec2<float> vel, Color<unsigned char> col, float l)
+        : position(pos), velocity(vel), color(col), life(l) {}
+
+    void update(float dt) {
+        position = position + velocity * Vec2<float>(dt) ;
+        life -= dt * 0.5f;
+        color.a = static_cast<unsigned char>(life * 255);
+    }
+
+    bool isAlive() const {
+        return life > 0;
+    }
+};
+
+// Seed yang sama supaya AoS dan SoA mendapat partikel yang sama
+struct Spawn {
+    float x, y, vx, vy, life;
+    Color<unsigned char> color;
+};
+
+static Spawn makeSpawn(int width, int height) {
+    Spawn s;
+    s.x = rndUnit() * width;
+    s.y = rndUnit() * height;
+    s.vx = (rndUnit() - 0.5f) * 200.0f;
+    s.vy = (rndUnit() - 0.5f) * 200.0f;
+    s.life = 0.01f + rndUnit() * 1.99f;     // umur tersebar, jadi ada partikel mati setiap frame
+    s.color = Color<unsigned char>(100 + static_cast<int>(rndUnit() * 155), 100 + static_cast<int>(rndUnit() * 155), 100 + static_cast<int>(rndUnit() * 155), 255);
+    return s;
+}
+
+struct Result {
+    double updateMs;
+    double drawMs;
+};
+
+static Result runAoS(z::Canvas& canvas, size_t count, int frames, float dt) {
+    Vec2<int> size = canvas.getSize();
+    std::vector<Particle> particles;
+    particles.reserve(count);
+    seedRandom(1);
+    while (particles.size() < count) {
+        Spawn s = makeSpawn(size.x, size.y);
+        particles.emplace_back(Vec2<float>(s.x, s.y), Vec2<float>(s.vx, s.vy), s.color, s.life);
+    }
+
+    z::Timer timer(z::TimerMode::Precise);
+    double updateMs = 0.0, drawMs = 0.0;
+    for (int f = 0; f < frames; f++) {
+        timer.tick();
+        for (auto it = particles.begin(); it != particles.end();) {
+            it->update(dt);
+            if (!it->isAlive())
+                it = particles.erase(it);
+            else
+                ++it;
+        }
+        while (particles.size() < count) {
+            Spawn s = makeSpawn(size.x, size.y);
+            particles.emplace_back(Vec2<float>(s.x, s.y), Vec2<float>(s.vx, s.vy), s.color, s.life);
+        }
+        timer.tick();
+        updateMs += timer.deltaTime() * 1000.0;
+
+        canvas.clear(RGB(0, 0, 0));
+        for (const Particle& p : particles)
+            canvas.drawPixel(Vec2<int>(static_cast<int>(p.position.x), static_cast<int>(p.position.y)), p.color);
+        canvas.present();
+        timer.tick();
+        drawMs += timer.deltaTime() * 1000.0;
+    }
+    return Result{updateMs / frames, drawMs / frames};
+}
+
+static Result runSoA(z::Canvas& canvas, size_t count, int frames, float dt) {
+    Vec2<int> size = canvas.getSize();
+    z::ParticleSystem particles(count);
+    seedRandom(1);
+    while (!particles.full()) {
+        Spawn s = makeSpawn(size.x, size.y);
+        particles.emit(Vec2<float>(s.x, s.y), Vec2<float>(s.vx, s.vy), s.color, s.life);
+    }
+
+    z::Timer timer(z::TimerMode::Precise);
+    double updateMs = 0.0, drawMs = 0.0;
+    for (int f = 0; f < frames; f++) {
+        timer.tick();
+        particles.update(dt);
+        while (!particles.full()) {
+            Spawn s = makeSpawn(size.x, size.y);
+            particles.emit(Vec2<float>(s.x, s.y), Vec2<float>(s.vx, s.vy), s.color, s.life);
+        }
+        timer.tick();
+        updateMs += timer.deltaTime() * 1000.0;
+
+        canvas.clear(RGB(0, 0, 0));
+        particles.draw(canvas);
+        canvas.present();
+        timer.tick();
+        drawMs += timer.deltaTime() * 1000.0;
+    }
+    return Result{updateMs / frames, drawMs / frames};
+}
+
+static void report(const char* name, size_t count, Result r) {
+    double total = r.updateMs + r.drawMs;
+    printf("  %-28s %8zu particles: update %7.3f ms | draw %7.3f ms | total %7.3f ms (%s 60 fps)\n",
+           name, count, r.updateMs, r.drawMs, total, total <= 1000.0 / 60.0 ? "meets" : "misses");
+}
+
+int main() {
+    const float dt = 1.0f / 60.0f;
+
+    // ===== Kebenaran: SoA mengikuti integrasi AoS =====
+    {
+        z::ParticleSystem soa(1000);
+        std::vector<Particle> aos;
+        seedRandom(7);
+        for (int i = 0; i < 1000; i++) {
+            Spawn s = makeSpawn(800, 600);
+            s.life = 10.0f;     // tidak ada yang mati, urutan tetap sama
+            soa.emit(Vec2<float>(s.x, s.y), Vec2<float>(s.vx, s.vy), s.color, s.life);
+            aos.emplace_back(Vec2<float>(s.x, s.y), Vec2<float>(s.vx, s.vy), s.color, s.life);
+        }
+        for (int step = 0; step < 30; step++) {
+            soa.update(dt);
+            for (Particle& p : aos) p.update(dt);
+        }
+        bool same = true;
+        for (size_t i = 0; i < aos.size(); i++) {
+            if (std::fabs(soa.position(i).x - aos[i].position.x) > 1e-3f || std::fabs(soa.position(i).y - aos[i].position.y) > 1e-3f
+                || std::fabs(soa.life()[i] - aos[i].life) > 1e-5f)
+                same = false;
+        }
+        check(same, "SoA update sama dengan AoS");
+
+        // Swap-remove: setengah partikel mati, sisanya tetap utuh
+        z::ParticleSystem pool(8);
+        for (int i = 0; i < 8; i++)
+            pool.emit(static_cast<float>(i), 0.0f, 0.0f, 0.0f, z::makePixel(255, 255, 255), (i % 2) ? 1.0f : 0.01f);
+        pool.update(0.1f);
+        bool removed = pool.size() == 4;
+        for (size_t i = 0; i < pool.size(); i++)
+            if (static_cast<int>(pool.x()[i]) % 2 != 1) removed = false;
+        check(removed, "swap-remove membuang partikel mati");
+    }
+
+    // ===== Benchmark =====
+    z::Window window("Particle Benchmark", 1920, 1080);
+    z::Canvas canvas(window.handle());
+    window.show();
+
+    // ===== draw(Canvas&) lewat transform, clip, dan CanvasStats =====
+    {
+        z::ParticleSystem dots(2);
+        dots.emit(10.0f, 10.0f, 0.0f, 0.0f, z::makePixel(255, 0, 0), 1.0f);
+        dots.emit(100.0f, 100.0f, 0.0f, 0.0f, z::makePixel(255, 0, 0), 1.0f);
+        canvas.clear(RGB(0, 0, 0));
+        size_t before = canvas.frameStats().primitives, rejectedBefore = canvas.frameStats().rejected;
+        canvas.pushClip(Rect<int>(0, 0, 50, 50));
+        canvas.translate(5.0f, 5.0f);
+        dots.draw(canvas);
+        canvas.resetTransform();
+        canvas.popClip();
+        const z::Surface& s = canvas.surface();
+        bool routed = (s.at(15, 15) & 0xFFFFFFu) == (z::makePixel(255, 0, 0) & 0xFFFFFFu)
+            && (s.at(10, 10) & 0xFFFFFFu) == 0 && (s.at(105, 105) & 0xFFFFFFu) == 0
+            && canvas.frameStats().primitives - before == 2 && canvas.frameStats().rejected - rejectedBefore == 1;
+        check(routed, "draw(Canvas&) mengikuti transform, clip, dan frameStats");
+
+        // Kedua overload: pembulatan terdekat yang sama, blend sama dengan blendPixel
+        z::ParticleSystem mixed(4002);
+        seedRandom(3);
+        while (mixed.size() < 4000)
+            mixed.emit(rndUnit() * 1960.0f - 20.0f, rndUnit() * 1120.0f - 20.0f, 0.0f, 0.0f,
+                       z::makePixel(static_cast<uint8_t>(rndUnit() * 255), static_cast<uint8_t>(rndUnit() * 255), static_cast<uint8_t>(rndUnit() * 255)), rndUnit() * 1.5f);
+        mixed.emit(10.5f, 10.4f, 0.0f, 0.0f, z::makePixel(0, 0, 255), 1.0f);      // .5 ke genap: pixel (10, 10)
+        mixed.emit(11.5f, 10.6f, 0.0f, 0.0f, z::makePixel(0, 0, 255), 1.0f);      // pixel (12, 11)
+        std::vector<z::Pixel> reference(static_cast<size_t>(canvas.getSize().x) * canvas.getSize().y, z::makePixel(40, 40, 40));
+        z::Surface plain(reference.data(), canvas.getSize().x, canvas.getSize().y, canvas.getSize().x);
+        canvas.clear(RGB(40, 40, 40));
+        mixed.draw(plain);
+        mixed.draw(canvas);
+        bool same = true;
+        for (int y = 0; y < plain.height; y++)
+            for (int x = 0; x < plain.width; x++)
+                same = same && plain.at(x, y) == s.at(x, y);
+        bool nearest = plain.at(10, 10) == z::makePixel(0, 0, 255) && plain.at(12, 11) == z::makePixel(0, 0, 255) && plain.at(11, 10) != z::makePixel(0, 0, 255);
+        bool exact = true;
+        for (unsigned a = 0; a < 256; a += 5)
+            for (int k = 0; k < 64; k++) {
+                z::Pixel src = (static_cast<z::Pixel>(rndUnit() * 16777215.0f)) | (a << 24), dst = static_cast<z::Pixel>(rndUnit() * 4294967295.0f);
+                exact = exact && z::detail::blendPoint(src, dst, a) == (a == 0 ? dst : z::blendPixel(src, dst));
+            }
+        check(same && nearest && exact, "draw(Surface) = draw(Canvas), pembulatan terdekat, blend = blendPixel");
+    }
+
+    printf("Benchmark (1920x1080 headless, update = integrate + remove + respawn)\n");
+    report("AoS vector + erase", 100000, runAoS(canvas, 100000, 30, dt));
+    report("SoA ParticleSystem", 100000, runSoA(canvas, 100000, 120, dt));
+    report("SoA ParticleSystem", 1000000, runSoA(canvas, 1000000, 60, dt));
+
+    return finishChecks();
+}
@@ -0,0 +1,160 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/z_simd.h"
+#include "../include/z_timer.h"
+#include "../include/z_unit.h"
+#include "test_util.h"
+
+using z::simd::Level;
+using z::simd::Rounding;
+
+static const size_t COUNT = 4096;      // muat di cache, jadi yang terukur kernel-nya
+static const int REPEAT = 2000;
+
+static std::vector<Vec2<float>> A, B, C;
+static std::vector<Vec2<int>> I0, I1;
+
+static void fillInputs() {
+    A.resize(COUNT); B.resize(COUNT); C.resize(COUNT);
+    I0.resize(COUNT); I1.resize(COUNT);
+    seedRandom(99);
+    auto coord = []() { return frand(-100.0f, 100.0f); };
+    for (size_t i = 0; i < COUNT; i++) {
+        A[i] = Vec2<float>(coord(), coord());
+        B[i] = Vec2<float>(coord(), coord());
+        C[i] = Vec2<float>(coord(), coord());
+        I0[i] = Vec2<int>(static_cast<int>(coord() * 1000), static_cast<int>(coord() * 1000));
+        I1[i] = Vec2<int>(static_cast<int>(coord() * 1000), static_cast<int>(coord() * 1000));
+    }
+    // Kasus khusus: vektor nol dan nilai .5 untuk pembulatan
+    A[0] = Vec2<float>(0.0f, 0.0f);
+    A[1] = Vec2<float>(2.5f, -2.5f);
+    A[2] = Vec2<float>(-0.5f, 1.5f);
+    A[3] = Vec2<float>(-3.0f, 3.0f);
+}
+
+// Waktu per elemen dalam nanodetik
+template <typename Fn>
+static double timeNs(Fn&& fn) {
+    z::Timer timer(z::TimerMode::Precise);
+    for (int r = 0; r < REPEAT; r++)
+        fn();
+    timer.tick();
+    return static_cast<double>(timer.deltaTime()) * 1e9 / (static_cast<double>(REPEAT) * COUNT);
+}
+
+static bool closeEnough(float a, float b) {
+    return std::fabs(a - b) <= 1e-5f * std::max(1.0f, std::fabs(b));
+}
+
+static bool sameVec(const std::vector<Vec2<float>>& a, const std::vector<Vec2<float>>& b) {
+    for (size_t i = 0; i < a.size(); i++)
+        if (!closeEnough(a[i].x, b[i].x) || !closeEnough(a[i].y, b[i].y)) return false;
+    return true;
+}
+
+static bool sameFloat(const std::vector<float>& a, const std::vector<float>& b) {
+    for (size_t i = 0; i < a.size(); i++)
+        if (!closeEnough(a[i], b[i])) return false;
+    return true;
+}
+
+static bool sameInt(const std::vector<Vec2<int>>& a, const std::vector<Vec2<int>>& b) {
+    for (size_t i = 0; i < a.size(); i++)
+        if (a[i].x != b[i].x || a[i].y != b[i].y) return false;
+    return true;
+}
+
+static void row(const char* name, double baseNs, const double* levelNs, int levels, bool ok) {
+    printf("  %-16s operator %6.3f ns", name, baseNs);
+    for (int l = 0; l < levels; l++)
+        printf(" | %6.3f ns (%5.2fx)", levelNs[l], baseNs / levelNs[l]);
+    printf("  %s\n", ok ? "" : "MISMATCH");
+    if (!ok) failures++;
+}
+
+int main() {
+    fillInputs();
+
+    Level best = z::simd::detectLevel();
+    std::vector<Level> levels;
+    levels.push_back(Level::Scalar);
+#if Z_HAS_SSE2
+    levels.push_back(Level::SSE2);
+#endif
+    if (best == Level::AVX2) levels.push_back(Level::AVX2);
+    int n = static_cast<int>(levels.size());
+
+    printf("CPU level: %s, %zu Vec2 x %d\n", z::simd::levelName(best), COUNT, REPEAT);
+    printf("  %-16s %-20s", "kernel", "loop Vec2 operator");
+    for (Level l : levels) printf(" | %-18s", z::simd::levelName(l));
+    printf("\n");
+
+    std::vector<Vec2<float>> ref(COUNT), out(COUNT);
+    std::vector<float> refF(COUNT), outF(COUNT);
+    std::vector<Vec2<int>> refI(COUNT), outI(COUNT);
+    double ns[3];
+    bool ok;
+
+    // Setiap kernel: baseline = loop memakai operator Vec2 yang ada (member non-const,
+    // jadi perlu salinan), lalu kernel simd di setiap level dicek terhadap baseline.
+#define BENCH_VEC(name, baselineBody, kernelCall, refVec, outVec, sameFn) \
+    { \
+        double base = timeNs([&] { for (size_t i = 0; i < COUNT; i++) { baselineBody; } }); \
+        ok = true; \
+        for (int l = 0; l < n; l++) { \
+            z::simd::setLevel(levels[l]); \
+            ns[l] = timeNs([&] { kernelCall; }); \
+            ok = ok && sameFn(outVec, refVec); \
+        } \
+        row(name, base, ns, n, ok); \
+    }
+
+    BENCH_VEC("add", { Vec2<float> a = A[i]; ref[i] = a + B[i]; }, z::simd::add(A.data(), B.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("sub", { Vec2<float> a = A[i]; ref[i] = a - B[i]; }, z::simd::sub(A.data(), B.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("scale", { Vec2<float> a = A[i]; ref[i] = a * 1.5f; }, z::simd::scale(A.data(), 1.5f, out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("fma", { Vec2<float> a = A[i]; Vec2<float> m = a * B[i]; ref[i] = m + C[i]; }, z::simd::fma(A.data(), B.data(), C.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("lerp", { Vec2<float> a = A[i]; Vec2<float> b = B[i]; Vec2<float> d = b - a; ref[i] = a + d * 0.25f; }, z::simd::lerp(A.data(), B.data(), 0.25f, out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("min", { ref[i] = Vec2<float>(std::min(A[i].x, B[i].x), std::min(A[i].y, B[i].y)); }, z::simd::min(A.data(), B.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("max", { ref[i] = Vec2<float>(std::max(A[i].x, B[i].x), std::max(A[i].y, B[i].y)); }, z::simd::max(A.data(), B.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("dot", { refF[i] = A[i].x * B[i].x + A[i].y * B[i].y; }, z::simd::dot(A.data(), B.data(), outF.data(), COUNT), refF, outF, sameFloat)
+    BENCH_VEC("length", { refF[i] = std::sqrt(A[i].x * A[i].x + A[i].y * A[i].y); }, z::simd::length(A.data(), outF.data(), COUNT), refF, outF, sameFloat)
+    BENCH_VEC("normalize", {
+            Vec2<float> a = A[i];
+            float len = std::sqrt(a.x * a.x + a.y * a.y);
+            ref[i] = len > 0.0f ? a / len : Vec2<float>(0.0f);
+        }, z::simd::normalize(A.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("toInt truncate", { refI[i] = Vec2<int>(A[i]); }, z::simd::toInt(A.data(), outI.data(), COUNT, Rounding::Truncate), refI, outI, sameInt)
+    BENCH_VEC("toInt nearest", { refI[i] = Vec2<int>(static_cast<int>(std::nearbyint(A[i].x)), static_cast<int>(std::nearbyint(A[i].y))); }, z::simd::toInt(A.data(), outI.data(), COUNT, Rounding::Nearest), refI, outI, sameInt)
+    BENCH_VEC("toInt floor", { refI[i] = Vec2<int>(static_cast<int>(std::floor(A[i].x)), static_cast<int>(std::floor(A[i].y))); }, z::simd::toInt(A.data(), outI.data(), COUNT, Rounding::Floor), refI, outI, sameInt)
+    BENCH_VEC("toInt ceil", { refI[i] = Vec2<int>(static_cast<int>(std::ceil(A[i].x)), static_cast<int>(std::ceil(A[i].y))); }, z::simd::toInt(A.data(), outI.data(), COUNT, Rounding::Ceil), refI, outI, sameInt)
+    BENCH_VEC("toFloat", { ref[i] = Vec2<float>(I0[i]); }, z::simd::toFloat(I0.data(), out.data(), COUNT), ref, out, sameVec)
+    BENCH_VEC("add int", { Vec2<int> a = I0[i]; refI[i] = a + I1[i]; }, z::simd::add(I0.data(), I1.data(), outI.data(), COUNT), refI, outI, sameInt)
+    BENCH_VEC("sub int", { Vec2<int> a = I0[i]; refI[i] = a - I1[i]; }, z::simd::sub(I0.data(), I1.data(), outI.data(), COUNT), refI, outI, sameInt)
+
+#undef BENCH_VEC
+
+    // Pembulatan .5 dan nilai negatif
+    z::simd::setLevel(best);
+    Vec2<float> halves[4] = { Vec2<float>(2.5f, -2.5f), Vec2<float>(-0.5f, 1.5f), Vec2<float>(-3.7f, 3.2f), Vec2<float>(0.0f, -0.0f) };
+    Vec2<int> r[4];
+    z::simd::toInt(halves, r, 4, Rounding::Nearest);
+    bool nearestOk = r[0].x == 2 && r[0].y == -2 && r[1].x == 0 && r[1].y == 2 && r[2].x == -4 && r[2].y == 3;
+    z::simd::toInt(halves, r, 4, Rounding::Floor);
+    bool floorOk = r[2].x == -4 && r[2].y == 3 && r[1].x == -1;
+    z::simd::toInt(halves, r, 4, Rounding::Ceil);
+    bool ceilOk = r[2].x == -3 && r[2].y == 4 && r[1].x == 0 && r[3].x == 0;
+    check(nearestOk && floorOk && ceilOk, "rounding modes (nearest-even, floor, ceil)");
+
+    // In-place dan jumlah yang bukan kelipatan lebar SIMD
+    std::vector<Vec2<float>> odd(A.begin(), A.begin() + 13);
+    std::vector<Vec2<float>> oddRef = odd;
+    for (Vec2<float>& v : oddRef) v = v + v;
+    z::simd::add(odd.data(), odd.data(), odd.data(), odd.size());
+    bool inPlaceOk = sameVec(odd, oddRef);
+    check(inPlaceOk, "in-place, count 13 (tail skalar)");
+
+    return finishChecks();
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "../include/z_unit.h"
+#include "../include/z_surface.h"
+
+// Fixture bersama test: hitungan kegagalan, check(), LCG deterministik, dan helper geometri/pixel.
+// Setiap test memilih seed sendiri lewat seedRandom() di awal main() supaya data
+// acaknya tetap sama antar build, lalu mengakhiri main dengan return finishChecks().
+
+inline int failures = 0;
+
+inline void check(bool ok, const char* what) {
+    printf("  [%s] %s\n", ok ? " OK " : "FAIL", what);
+    if (!ok) failures++;
+}
+
+// Ringkasan akhir; hasilnya dipakai sebagai exit code
+inline int finishChecks() {
+    printf("%s\n", failures == 0 ? "All checks passed" : "Some checks FAILED");
+    return failures == 0 ? 0 : 1;
+}
+
+// ===== RANDOM =====
+// LCG Numerical Recipes. 8 bit bawah periodenya pendek, jadi rnd(n) dan rndUnit() memakai bit atas
+
+inline unsigned rngState = 1;
+
+inline void seedRandom(unsigned seed) {
+    rngState = seed;
+}
+
+inline unsigned rnd() {
+    rngState = rngState * 1664525u + 1013904223u;
+    return rngState;
+}
+
+// 0 .. n - 1
+inline int rnd(int n) {
+    return static_cast<int>((rnd() >> 8) % static_cast<unsigned>(n));
+}
+
+// [0, 1) dengan resolusi 24 bit
+inline float rndUnit() {
+    return static_cast<float>(rnd() >> 8) / 16777216.0f;
+}
+
+// [lo, hi)
+inline float frand(float lo, float hi) {
+    return lo + (hi - lo) * rndUnit();
+}
+
+// ===== GEOMETRI & PIXEL =====
+
+// Jarak titik p ke segmen ab
+inline float segmentDistance(Vec2<float> p, Vec2<float> a, Vec2<float> b) {
+    float dx = b.x - a.x, dy = b.y - a.y;
+    float len2 = dx * dx + dy * dy;
+    float t = len2 > 0.0f ? std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / len2, 0.0f, 1.0f) : 0.0f;
+    return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+}
+
+// Salinan isi surface baris per baris (tanpa padding stride), untuk membandingkan dua render
+inline std::vector<z::Pixel> snapshot(const z::Surface& s) {
+    std::vector<z::Pixel> out;
+    for (int y = 0; y < s.height; y++)
+        out.insert(out.end(), s.row(y), s.row(y) + s.width);
+    return out;
+}